@@ -0,0 +1,172 @@
+#include "audio_fingerprint.h"
+#include "fast_hash.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+constexpr size_t kReadChunk = 1024 * 1024;  // 顺序读取的块大小
+
+std::uint32_t ReadLE32(const std::uint8_t* p) {
+    return std::uint32_t(p[0]) | (std::uint32_t(p[1]) << 8) | (std::uint32_t(p[2]) << 16) | (std::uint32_t(p[3]) << 24);
+}
+
+std::uint32_t ReadBE24(const std::uint8_t* p) {
+    return (std::uint32_t(p[0]) << 16) | (std::uint32_t(p[1]) << 8) | p[2];
+}
+
+// 文件末尾的ID3v1与APEv2标签
+std::uint64_t StripTrailingTags(const FileReader& file, std::uint64_t end) {
+    std::uint8_t buf[32];
+    if (end >= 128 && file.ReadAt(end - 128, buf, 3) == 3 && std::memcmp(buf, "TAG", 3) == 0) end -= 128;
+    if (end >= 32 && file.ReadAt(end - 32, buf, 32) == 32 && std::memcmp(buf, "APETAGEX", 8) == 0) {
+        const std::uint32_t size = ReadLE32(buf + 12);                  // 含尾部，不含头部
+        const bool hasHeader = (ReadLE32(buf + 20) & 0x80000000u) != 0;
+        const std::uint64_t total = static_cast<std::uint64_t>(size) + (hasHeader ? 32 : 0);
+        if (total <= end) end -= total;
+    }
+    return end;
+}
+
+// FLAC：跳过所有元数据块（标签、封面、填充）
+bool SkipFlacMetadata(const FileReader& file, std::uint64_t& pos) {
+    pos += 4; // "fLaC"
+    for (int block = 0; block < 1024; ++block) {
+        std::uint8_t h[4];
+        if (file.ReadAt(pos, h, 4) != 4) return false;
+        pos += 4 + ReadBE24(h + 1);
+        if (h[0] & 0x80) return true;
+    }
+    return false;
+}
+
+// Ogg：跳过头部包（Vorbis 3个，Opus 2个，其他1个）所在的页，返回第一个音频页的偏移
+bool SkipOggHeaders(const FileReader& file, std::uint64_t& pos) {
+    std::uint8_t h[27 + 255];
+    int headerPackets = 1;
+    int packets = 0;
+    for (int page = 0; page < 64; ++page) {
+        if (file.ReadAt(pos, h, 27) != 27 || std::memcmp(h, "OggS", 4) != 0) return false;
+        const std::uint8_t segments = h[26];
+        if (file.ReadAt(pos + 27, h + 27, segments) != segments) return false;
+        std::uint32_t bodySize = 0;
+        for (std::uint8_t i = 0; i < segments; ++i) {
+            bodySize += h[27 + i];
+            if (h[27 + i] < 255) ++packets;
+        }
+        if (page == 0) {
+            std::uint8_t magic[8];
+            if (file.ReadAt(pos + 27 + segments, magic, 8) == 8) {
+                if (std::memcmp(magic, "\x01vorbis", 7) == 0) headerPackets = 3;
+                if (std::memcmp(magic, "OpusHead", 8) == 0) headerPackets = 2;
+            }
+        }
+        pos += 27 + segments + bodySize;
+        if (packets >= headerPackets) return true;
+    }
+    return false;
+}
+
+} // namespace
+
+bool LocateAudioPayload(const FileReader& file, AudioPayload& payload) {
+    payload = AudioPayload();
+    std::uint8_t head[12];
+    if (file.ReadAt(0, head, sizeof(head)) != sizeof(head)) return false;
+
+    std::uint64_t begin = 0;
+    if (std::memcmp(head, "ID3", 3) == 0) {
+        const std::uint32_t body = (std::uint32_t(head[6] & 0x7f) << 21) | (std::uint32_t(head[7] & 0x7f) << 14) |
+                                   (std::uint32_t(head[8] & 0x7f) << 7) | (head[9] & 0x7f);
+        begin = 10 + body + ((head[3] == 4 && (head[5] & 0x10)) ? 10 : 0);
+    }
+
+    if (begin == 0 && std::memcmp(head, "RIFF", 4) == 0 && std::memcmp(head + 8, "WAVE", 4) == 0) {
+        std::uint64_t pos = 12;
+        for (int chunk = 0; chunk < 64; ++chunk) {
+            std::uint8_t h[8];
+            if (file.ReadAt(pos, h, 8) != 8) return false;
+            const std::uint32_t size = ReadLE32(h + 4);
+            if (std::memcmp(h, "data", 4) == 0) {
+                payload.begin = pos + 8;
+                payload.end = std::min<std::uint64_t>(payload.begin + size, file.Size());
+                return payload.end > payload.begin;
+            }
+            pos += 8 + size + (size & 1);
+        }
+        return false;
+    }
+
+    if (begin == 0 && std::memcmp(head, "OggS", 4) == 0) {
+        if (!SkipOggHeaders(file, begin)) return false;
+        payload.begin = begin;
+        payload.end = file.Size();
+        payload.oggPages = true;
+        return payload.end > payload.begin;
+    }
+
+    std::uint8_t magic[4];
+    if (file.ReadAt(begin, magic, 4) == 4 && std::memcmp(magic, "fLaC", 4) == 0) {
+        if (!SkipFlacMetadata(file, begin)) return false;
+    }
+    payload.begin = begin;
+    payload.end = StripTrailingTags(file, file.Size());
+    return payload.end > payload.begin;
+}
+
+bool ComputeAudioFingerprint(const std::string& pathUtf8, AudioFingerprint& fingerprint) {
+    fingerprint = AudioFingerprint();
+    FileReader file;
+    AudioPayload payload;
+    if (!file.Open(pathUtf8) || !LocateAudioPayload(file, payload)) return false;
+
+    FastHash64 audioHash;
+    FastHash64 fileHash;
+    std::vector<std::uint8_t> buffer(kReadChunk);
+    std::uint64_t audioBytes = 0;
+
+    // 顺序读取[from, to)：全部计入文件哈希，audio为true时同时计入音频哈希
+    auto feed = [&](std::uint64_t from, std::uint64_t to, bool audio) {
+        while (from < to) {
+            const size_t want = static_cast<size_t>(std::min<std::uint64_t>(buffer.size(), to - from));
+            const size_t got = file.ReadAt(from, buffer.data(), want);
+            if (got == 0) return false;
+            fileHash.Update(buffer.data(), got);
+            if (audio) {
+                audioHash.Update(buffer.data(), got);
+                audioBytes += got;
+            }
+            from += got;
+        }
+        return true;
+    };
+
+    if (!feed(0, payload.begin, false)) return false;
+    std::uint64_t pos = payload.begin;
+    if (payload.oggPages) {
+        // 逐页处理：页头只计入文件哈希，页体计入音频哈希
+        std::uint8_t h[27 + 255];
+        while (pos + 27 <= payload.end) {
+            if (file.ReadAt(pos, h, 27) != 27 || std::memcmp(h, "OggS", 4) != 0) break;
+            const std::uint8_t segments = h[26];
+            if (file.ReadAt(pos + 27, h + 27, segments) != segments) break;
+            std::uint32_t bodySize = 0;
+            for (std::uint8_t i = 0; i < segments; ++i) bodySize += h[27 + i];
+            fileHash.Update(h, 27 + segments);
+            const std::uint64_t body = pos + 27 + segments;
+            if (body + bodySize > payload.end || !feed(body, body + bodySize, true)) break;
+            pos = body + bodySize;
+        }
+    } else {
+        if (!feed(pos, payload.end, true)) return false;
+        pos = payload.end;
+    }
+    if (!feed(pos, file.Size(), false)) return false;
+
+    fingerprint.payloadSize = payload.end - payload.begin; // 与只定位时的取值一致（Ogg含音频页页头）
+    fingerprint.audioHash = audioHash.Final() | 1; // 保证非0（0表示未计算）
+    fingerprint.fileHash = fileHash.Final();
+    return audioBytes > 0;
+}
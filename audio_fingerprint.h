@@ -0,0 +1,33 @@
+// 音频内容指纹：只对音频数据区（去掉ID3v2/ID3v1/APE标签、FLAC元数据块、Ogg头部包、WAV的非data块）做哈希，
+// 改名、改标签后的同一音频得到相同指纹；同时计算整个文件的哈希，用于区分逐字节相同的副本
+#pragma once
+
+#include "fs_util.h"
+
+#include <cstdint>
+#include <string>
+
+struct AudioFingerprint {
+    static constexpr std::uint64_t kNoPayload = ~0ull;  // 已定位但没有可识别的音频数据（不参与比较）
+
+    std::uint64_t payloadSize = 0;  // 音频数据区[begin, end)的字节数；0表示尚未定位
+    std::uint64_t audioHash = 0;    // 音频数据区哈希；0表示尚未计算（只有音频数据大小相同的文件才需要计算）
+    std::uint64_t fileHash = 0;     // 整个文件的哈希（与audioHash一同计算）
+
+    bool Located() const { return payloadSize != 0; }
+    bool Comparable() const { return payloadSize != 0 && payloadSize != kNoPayload; }
+    bool Hashed() const { return audioHash != 0; }
+};
+
+// 音频数据区[begin, end)
+struct AudioPayload {
+    std::uint64_t begin = 0;
+    std::uint64_t end = 0;
+    bool oggPages = false;          // Ogg：区内每页的页头（序号/CRC随头部包变化）不计入音频哈希
+};
+
+// 只读取文件头尾定位音频数据区
+bool LocateAudioPayload(const FileReader& file, AudioPayload& payload);
+
+// 读取整个文件计算指纹（一次顺序读取同时得到音频哈希与文件哈希）
+bool ComputeAudioFingerprint(const std::string& pathUtf8, AudioFingerprint& fingerprint);
@@ -0,0 +1,161 @@
+// 曲目加载基准：对每个音频文件分别按流式与整首解码加载，输出两种方式的解码开销与常驻内存，
+// 以及加载策略（load_policy）在给定内存预算下的选择，用于调整LoadPolicyOptions
+// - 流式：解码引导段后以音频回调的块大小读完整首，统计音频线程上每秒音频的解码耗时
+// - 整首解码：在加载线程上解码整首，统计解码耗时；播放时音频线程只复制内存
+// 不指定文件时生成几个合成的WAV文件（只能验证流程：WAV未压缩，策略总是选择流式）
+// 用法：bench_load [文件...] [--budget MB] [--rate 采样率] [--channels 声道数]
+#include "load_policy.h"
+#include "track_source.h"
+#include "media_probe.h"
+#include "tag_reader.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr ma_uint64 kCallbackFrames = 480;     // 模拟音频回调每次读取的帧数（48kHz下10ms）
+constexpr float kLeadInSeconds = 3.0f;
+
+double SecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// 以回调的块大小读完整首，返回读取的帧数与总耗时
+ma_uint64 ReadToEnd(TrackSource& track, std::uint32_t channels, double& seconds) {
+    std::vector<float> buffer(static_cast<size_t>(kCallbackFrames * channels));
+    ma_uint64 total = 0;
+    const auto start = std::chrono::steady_clock::now();
+    while (true) {
+        ma_uint64 read = 0;
+        if (ma_data_source_read_pcm_frames(track.DataSource(), buffer.data(), kCallbackFrames, &read) != MA_SUCCESS) {
+            break;
+        }
+        total += read;
+    }
+    seconds = SecondsSince(start);
+    return total;
+}
+
+void MakeSyntheticFiles(const fs::path& dir, std::vector<std::string>& files) {
+    fs::create_directories(dir);
+    const std::uint32_t rate = 44100;
+    const float lengths[] = {30.0f, 180.0f, 600.0f};
+    for (float seconds : lengths) {
+        const fs::path path = dir / ("synthetic_" + std::to_string(static_cast<int>(seconds)) + "s.wav");
+        ma_encoder_config config = ma_encoder_config_init(ma_encoding_format_wav, ma_format_s16, 2, rate);
+        ma_encoder encoder;
+        if (ma_encoder_init_file(path.string().c_str(), &config, &encoder) != MA_SUCCESS) continue;
+        std::vector<std::int16_t> block(static_cast<size_t>(rate) * 2);
+        const ma_uint64 frames = static_cast<ma_uint64>(seconds * rate);
+        for (ma_uint64 written = 0; written < frames; written += rate) {
+            for (std::uint32_t i = 0; i < rate; ++i) {
+                const double t = static_cast<double>(written + i) / rate;
+                block[i * 2] = block[i * 2 + 1] = static_cast<std::int16_t>(8000 * std::sin(2 * 3.14159265 * 440 * t));
+            }
+            ma_encoder_write_pcm_frames(&encoder, block.data(), std::min<ma_uint64>(rate, frames - written), NULL);
+        }
+        ma_encoder_uninit(&encoder);
+        files.push_back(path.string());
+    }
+}
+
+const char* FormatName(AudioFormat format) {
+    switch (format) {
+        case AUDIO_FORMAT_MP3:  return "mp3";
+        case AUDIO_FORMAT_FLAC: return "flac";
+        case AUDIO_FORMAT_WAV:  return "wav";
+        case AUDIO_FORMAT_OGG:  return "ogg";
+        default:                return "?";
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::vector<std::string> files;
+    LoadPolicyOptions options;
+    std::uint32_t sampleRate = 48000;
+    std::uint32_t channels = 2;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--budget") == 0 && i + 1 < argc) {
+            options.memoryBudget = std::strtoull(argv[++i], nullptr, 10) << 20;
+        } else if (std::strcmp(argv[i], "--rate") == 0 && i + 1 < argc) {
+            sampleRate = static_cast<std::uint32_t>(std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--channels") == 0 && i + 1 < argc) {
+            channels = static_cast<std::uint32_t>(std::atoi(argv[++i]));
+        } else {
+            files.push_back(argv[i]);
+        }
+    }
+    if (files.empty()) {
+        MakeSyntheticFiles(fs::temp_directory_path() / "bench_load", files);
+    }
+
+    LoadPolicy policy(options);
+    std::printf("%-32s %5s %8s %8s | %-6s | %12s %10s | %10s %10s %10s\n", "file", "fmt", "seconds", "size KB",
+                "policy", "stream us/s", "stream KB", "decode ms", "decode KB", "memcpy us/s");
+    for (std::uint32_t id = 0; id < files.size(); ++id) {
+        const std::string& file = files[id];
+        TrackTags tags;
+        TrackLoadInfo info;
+        std::error_code ec;
+        info.fileSize = fs::file_size(fs::u8path(file), ec);
+        if (!ProbeTrackFile(file, tags, info.durationMs, info.format)) {
+            std::fprintf(stderr, "probe failed: %s\n", file.c_str());
+            continue;
+        }
+        MemoryReservation reservation;
+        const LoadMode mode = policy.Choose(info, channels, sampleRate, reservation);
+        const std::wstring path = fs::u8path(file).wstring();
+
+        // 流式：引导段 + 音频线程解码
+        std::unique_ptr<TrackSource> streamed;
+        if (TrackSource::Open(id, path, info.format, channels, sampleRate, streamed) != MA_SUCCESS) {
+            std::fprintf(stderr, "open failed: %s\n", file.c_str());
+            continue;
+        }
+        streamed->DecodeLeadIn(static_cast<ma_uint64>(kLeadInSeconds * sampleRate));
+        double streamSeconds = 0;
+        const ma_uint64 frames = ReadToEnd(*streamed, channels, streamSeconds);
+        const TrackLoadStats streamStats = streamed->Stats();
+        const double audioSeconds = static_cast<double>(frames) / sampleRate;
+        streamed.reset();
+
+        // 整首解码：加载线程解码全部，音频线程只复制内存
+        std::unique_ptr<TrackSource> decoded;
+        TrackSource::Open(id, path, info.format, channels, sampleRate, decoded);
+        const ma_uint64 expected = LoadPolicy::EstimatePcmBytes(info.durationMs, channels, sampleRate) /
+                                   (sizeof(float) * channels);
+        decoded->SetLoadMode(LoadMode::Decode, MemoryReservation(), expected);
+        while (!decoded->Complete() && decoded->DecodeLeadIn(sampleRate * 60) == MA_SUCCESS) {
+        }
+        double copySeconds = 0;
+        ReadToEnd(*decoded, channels, copySeconds);
+        const TrackLoadStats decodeStats = decoded->Stats();
+
+        std::printf("%-32.32s %5s %8.1f %8llu | %-6s | %12.1f %10llu | %10.1f %10llu %10.1f\n",
+                    fs::u8path(file).filename().u8string().c_str(), FormatName(info.format), audioSeconds,
+                    (unsigned long long)(info.fileSize / 1024), mode == LoadMode::Decode ? "decode" : "stream",
+                    audioSeconds > 0 ? streamStats.streamDecodeNs / 1e3 / audioSeconds : 0.0,
+                    (unsigned long long)(streamStats.residentBytes / 1024), decodeStats.prepareDecodeNs / 1e6,
+                    (unsigned long long)(decodeStats.residentBytes / 1024),
+                    audioSeconds > 0 ? copySeconds * 1e6 / audioSeconds : 0.0);
+        if (mode == LoadMode::Decode) reservation.Shrink(decodeStats.residentBytes); // 与播放时一样按实际占用计入预算
+    }
+
+    const LoadPolicyStats stats = policy.Stats();
+    std::printf("policy: stream=%llu decode=%llu over-budget=%llu budget used=%llu KB peak=%llu KB limit=%llu KB\n",
+                (unsigned long long)stats.streamed, (unsigned long long)stats.decoded,
+                (unsigned long long)stats.overBudget, (unsigned long long)(stats.budgetUsed / 1024),
+                (unsigned long long)(stats.budgetPeak / 1024), (unsigned long long)(options.memoryBudget / 1024));
+    return 0;
+}
@@ -0,0 +1,304 @@
+// 搜索基准：生成合成曲目名（拉丁字母与CJK混合），构建列式曲目表与三元组索引后，
+// 分别测量顺序扫描、索引查询（全部命中）与界面使用的有上限查询（kDenseHitLimit）的单次耗时与内存分配次数，
+// 索引查询超过5ms的标出SLOW；以及各级子串查找内核（标量/SSE2/AVX2）的吞吐量（GB/s）
+// 模糊排序：子串命中按得分取前topK（命中太少时对全表模糊匹配），报告每次排序的耗时
+// 字段查询：按列批量求值的条件（时长/大小/格式/字段包含），分别以单线程与默认线程数测量
+// 结果缓存：在后台搜索线程上逐字输入几个关键词再重复输入一遍，比较两遍每次按键的平均耗时与缓存计数
+// 同时测量旧实现（逐曲目复制文件名并转小写）作为对照；旧实现还要构造fs::path，实际开销更高
+// 用法：bench_search [曲目数，默认1000000] [--no-baseline]
+#include "track_table.h"
+#include "byte_search.h"
+#include "fuzzy_search.h"
+#include "pinyin.h"
+#include "search_worker.h"
+#include "track_query.h"
+#include "text_fold.h"
+#include "trigram_index.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cwctype>
+#include <new>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 统计全局内存分配次数
+static std::atomic<std::uint64_t> g_allocations{0};
+
+void* operator new(size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+namespace {
+
+void AppendCodePoint(std::uint32_t cp, std::string& out) {
+    if (cp < 0x80) {
+        out.push_back(static_cast<char>(cp));
+    } else if (cp < 0x800) {
+        out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else {
+        out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    }
+}
+
+// 合成文件名：约一半为“Artist - Title NNN.ext”形式的拉丁名，其余为CJK名
+std::string MakeName(std::mt19937& rng) {
+    static const char* kWords[] = {"Love", "Night", "Blue", "River", "Dream", "Fire", "Rain", "Summer",
+                                   "Heart", "Light", "Moon", "Road", "Star", "Wind", "Ocean", "Shadow"};
+    static const char* kExts[] = {".mp3", ".flac", ".ogg", ".wav"};
+    std::string name;
+    if (rng() % 2 == 0) {
+        name += kWords[rng() % 16];
+        name += ' ';
+        name += kWords[rng() % 16];
+        name += " - ";
+        for (int i = 0, n = 1 + rng() % 3; i < n; ++i) {
+            if (i) name += ' ';
+            name += kWords[rng() % 16];
+        }
+    } else {
+        for (int i = 0, n = 2 + rng() % 3; i < n; ++i) AppendCodePoint(0x4E00 + rng() % 0x5000, name);
+        name += " - ";
+        for (int i = 0, n = 2 + rng() % 6; i < n; ++i) AppendCodePoint(0x4E00 + rng() % 0x5000, name);
+    }
+    char number[8];
+    std::snprintf(number, sizeof(number), " %03u", static_cast<unsigned>(rng() % 1000));
+    name += number;
+    name += kExts[rng() % 4];
+    return name;
+}
+
+std::wstring Widen(const std::string& utf8) {
+    std::wstring out;
+    for (size_t i = 0; i < utf8.size();) {
+        const unsigned char c = static_cast<unsigned char>(utf8[i]);
+        std::uint32_t cp;
+        if (c < 0x80) { cp = c; i += 1; }
+        else if (c < 0xE0) { cp = ((c & 0x1F) << 6) | (utf8[i + 1] & 0x3F); i += 2; }
+        else { cp = ((c & 0x0F) << 12) | ((utf8[i + 1] & 0x3F) << 6) | (utf8[i + 2] & 0x3F); i += 3; }
+        out.push_back(static_cast<wchar_t>(cp));
+    }
+    return out;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::uint32_t count = 1000000;
+    bool baseline = true;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--no-baseline") == 0) baseline = false;
+        else count = static_cast<std::uint32_t>(std::strtoul(argv[i], nullptr, 10));
+    }
+
+    std::mt19937 rng(42);
+    std::vector<std::string> names;
+    names.reserve(count);
+    for (std::uint32_t i = 0; i < count; ++i) names.push_back(MakeName(rng));
+
+    auto start = std::chrono::steady_clock::now();
+    TrackTable table;
+    std::mt19937 columnRng(7); // 时长30秒~10分钟、大小1~50MB，供字段查询使用
+    for (const auto& name : names) {
+        table.Append(name, (1u << 20) + columnRng() % (49u << 20), 30000 + columnRng() % 570000,
+                     AudioFormatFromName(name));
+    }
+    const double buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::printf("tracks=%u build=%.1fms table=%.1fMB\n", count, buildMs, table.MemoryBytes() / 1e6);
+
+    // 子串查找内核吞吐量：在全部检索键首尾相接的缓冲区中查找所有出现位置
+    std::string keys;
+    for (const auto& name : names) {
+        AppendFoldedUtf8(name, keys);
+        keys.push_back('\0');
+    }
+    for (const char* needle : {"zzzz", "moon", "ocean - st"}) {
+        for (int level = SIMD_SCALAR; level <= DetectSimdLevel(); ++level) {
+            const int iterations = 5;
+            size_t hits = 0;
+            start = std::chrono::steady_clock::now();
+            for (int it = 0; it < iterations; ++it) {
+                const char* p = keys.data();
+                const char* end = p + keys.size();
+                while (const char* hit = FindSubstringWith(static_cast<SimdLevel>(level), p, end - p, needle)) {
+                    ++hits;
+                    p = hit + 1;
+                }
+            }
+            const double seconds =
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / iterations;
+            std::printf("kernel %-6s needle=%-12s hits=%zu %.2fGB/s\n", SimdLevelName(static_cast<SimdLevel>(level)),
+                        needle, hits / iterations, keys.size() / seconds / 1e9);
+        }
+    }
+
+    // 查询：常见词、大写（验证折叠）、单字母（命中密集）、CJK及其拼音、拼音首字母、无命中
+    std::string cjk;
+    AppendCodePoint(0x4E00 + 0x123, cjk);
+    const std::string pinyin(PinyinOf(0x4E00 + 0x123));
+    const std::string queries[] = {"love", "NIGHT - blue", "e", cjk, pinyin, "zjl", "zzzz", "moon star", "ocean - st"};
+
+    start = std::chrono::steady_clock::now();
+    TrigramIndex index;
+    index.Build(table);
+    const double indexMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    const TrigramIndexStats stats = index.Stats();
+    std::printf("index build=%.1fms postings=%llu index=%.1fMB\n", indexMs, (unsigned long long)stats.postings,
+                stats.memoryBytes / 1e6);
+
+    std::vector<std::uint32_t> results;
+    results.reserve(count);
+    const double kQueryBudgetMs = 5.0;
+    int slowQueries = 0;
+    for (const auto& raw : queries) {
+        std::string key;
+        AppendFoldedUtf8(raw, key);
+        for (int mode = 0; mode < 3; ++mode) {
+            const int iterations = 20;
+            results.clear();
+            index.Search(table, key, results); // 预热查询缓冲区
+            const std::uint64_t allocBefore = g_allocations.load();
+            start = std::chrono::steady_clock::now();
+            for (int it = 0; it < iterations; ++it) {
+                results.clear();
+                if (mode == 0) table.Search(key, results);
+                else if (mode == 1) index.Search(table, key, results);
+                else index.Search(table, key, results, kDenseHitLimit);
+            }
+            const double ms =
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / iterations;
+            const std::uint64_t allocs = g_allocations.load() - allocBefore;
+            const bool slow = mode != 0 && ms > kQueryBudgetMs;
+            slowQueries += slow ? 1 : 0;
+            std::printf("%-6s query(%zu bytes) matches=%zu time=%.3fms/query allocations/query=%.1f%s\n",
+                        mode == 0 ? "linear" : mode == 1 ? "index" : "limit", key.size(), results.size(), ms,
+                        static_cast<double>(allocs) / iterations, slow ? " SLOW(>5ms)" : "");
+        }
+    }
+    std::printf("index queries over %.0fms: %d\n", kQueryBudgetMs, slowQueries);
+
+    // 模糊排序（默认线程数）：常见词（大量子串命中）、漏字/错序（全表模糊匹配）、多词、无命中
+    std::printf("fuzzy threads=%u topK=%zu\n", std::thread::hardware_concurrency(), FuzzyOptions().topK);
+    for (const char* raw : {"love", "lvoe", "nght blu", "moon star", "zzzq"}) {
+        std::string key;
+        AppendFoldedUtf8(raw, key);
+        const int iterations = 10;
+        double indexMs = 0.0;
+        double rankMs = 0.0;
+        size_t exact = 0;
+        for (int it = 0; it < iterations; ++it) {
+            results.clear();
+            start = std::chrono::steady_clock::now();
+            index.Search(table, key, results);
+            const auto ranked = std::chrono::steady_clock::now();
+            exact = results.size();
+            RankSearchResults(table, key, results, FuzzyOptions());
+            indexMs += std::chrono::duration<double, std::milli>(ranked - start).count();
+            rankMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - ranked).count();
+        }
+        std::printf("fuzzy  query(%s) substring=%zu ranked=%zu index=%.3fms rank=%.3fms/query\n", raw, exact,
+                    results.size(), indexMs / iterations, rankMs / iterations);
+    }
+
+    // 字段查询：只有条件（全表按列求值）、条件 + 普通文本（索引 + 排列后筛选）
+    for (const char* raw : {"duration>300", "format:flac size>20mb", "name:love duration<3:00", "love format:mp3",
+                            "-love format:ogg,wav duration>=2m"}) {
+        std::string key;
+        AppendFoldedUtf8(raw, key);
+        const TrackQuery query(key);
+        for (unsigned threads : {1u, std::thread::hardware_concurrency()}) {
+            QueryOptions options;
+            options.threadCount = threads;
+            const int iterations = 10;
+            start = std::chrono::steady_clock::now();
+            for (int it = 0; it < iterations; ++it) {
+                results.clear();
+                if (query.Text().empty()) {
+                    query.Scan(table, 0, table.Size(), results, options);
+                } else {
+                    index.Search(table, query.Text(), results);
+                    query.Filter(table, results, options);
+                }
+            }
+            const double ms =
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / iterations;
+            std::printf("fields query(%s) threads=%u matches=%zu time=%.3fms/query\n", raw, threads, results.size(), ms);
+        }
+    }
+
+    // 结果缓存：逐字输入（每次按键等待结果），第二遍全部命中缓存
+    {
+        std::mutex mutex;
+        std::condition_variable published;
+        std::uint64_t doneTicket = 0;
+        SearchWorker worker(table, index, [&](std::unique_ptr<SearchResult> result) {
+            std::lock_guard<std::mutex> lock(mutex);
+            doneTicket = result->ticket;
+            published.notify_all();
+        });
+        worker.Start();
+        const char* typed[] = {"night blue", "love format:flac", "moon star", "ocean duration>300"};
+        for (int pass = 0; pass < 2; ++pass) {
+            size_t keystrokes = 0;
+            start = std::chrono::steady_clock::now();
+            for (const char* raw : typed) {
+                for (size_t length = 1; raw[length - 1] != '\0'; ++length) {
+                    std::string key;
+                    AppendFoldedUtf8(std::string_view(raw, length), key);
+                    const std::uint64_t ticket = worker.Submit(std::move(key));
+                    std::unique_lock<std::mutex> lock(mutex);
+                    published.wait(lock, [&] { return doneTicket == ticket; });
+                    ++keystrokes;
+                }
+            }
+            const double ms =
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / keystrokes;
+            const SearchCacheStats stats = worker.CacheStats();
+            std::printf("cache  pass=%d keystrokes=%zu time=%.3fms/keystroke hits=%llu base=%llu misses=%llu "
+                        "entries=%zu memory=%.1fMB\n",
+                        pass + 1, keystrokes, ms, (unsigned long long)stats.hits, (unsigned long long)stats.baseHits,
+                        (unsigned long long)stats.misses, stats.entries, stats.memoryBytes / 1e6);
+        }
+        worker.Stop();
+    }
+
+    if (baseline) {
+        // 旧实现：保存完整宽字符路径，每次查询逐曲目取文件名并转小写
+        std::vector<std::wstring> paths;
+        paths.reserve(count);
+        for (const auto& name : names) paths.push_back(L"C:/Users/someone/Music/music/Artist/Album/" + Widen(name));
+        for (const auto& raw : {std::string("love"), std::string("zzzz")}) {
+            std::wstring keyword = Widen(raw);
+            std::vector<std::wstring> matches;
+            const std::uint64_t allocBefore = g_allocations.load();
+            size_t nameBytes = 0;
+            start = std::chrono::steady_clock::now();
+            for (const auto& path : paths) {
+                // libstdc++在非Windows平台无法用fs::path转换非ASCII宽字符，这里直接按分隔符截取文件名
+                std::wstring lower = path.substr(path.find_last_of(L"/\\") + 1);
+                std::transform(lower.begin(), lower.end(), lower.begin(), ::towlower);
+                nameBytes += lower.size() * sizeof(wchar_t);
+                if (lower.find(keyword) != std::wstring::npos) matches.push_back(path);
+            }
+            const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            std::printf("baseline query(%s) matches=%zu time=%.3fms/query %.2fGB/s allocations/query=%llu\n",
+                        raw.c_str(), matches.size(), ms, nameBytes / (ms / 1e3) / 1e9,
+                        (unsigned long long)(g_allocations.load() - allocBefore));
+        }
+    }
+    return 0;
+}
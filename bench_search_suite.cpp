@@ -0,0 +1,361 @@
+// 搜索基准套件：按固定种子生成可复现的合成曲库（拉丁/CJK混合的文件名与标题/歌手/专辑标签，词频服从Zipf分布），
+// 在多个规模（默认1万/10万/100万首）上运行与界面搜索相同的流程（折叠关键词 -> TrackQuery -> SearchTracks -> 拆分结果），
+// 按查询类型分组报告每次查询耗时的p50/p99/最大值与平均内存分配次数（matches含模糊匹配补充的结果）：
+// - prefix：常见词的前1~3个字符（逐字输入的开头几次按键，命中密集）
+// - common：常见整词        - rare：低频词（命中很少）          - pinyin：中文歌手名的全拼与首字母
+// - typo：拼错的词（子串命中少，走全表模糊匹配）                 - empty：子串不会命中的词（同样走全表模糊匹配）
+// - fields：字段查询（歌手/格式/时长/大小条件）
+// 指定--save时把结果写入文件，之后用--compare读取并输出与之相比的变化，便于每次修改搜索实现后与基线对照
+// 用法：bench_search_suite [曲目数...] [--queries N] [--save 文件] [--compare 文件]
+#include "fuzzy_search.h"
+#include "pinyin.h"
+#include "text_fold.h"
+#include "track_bitmap.h"
+#include "track_query.h"
+#include "track_table.h"
+#include "trigram_index.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+// 统计全局内存分配次数
+static std::atomic<std::uint64_t> g_allocations{0};
+
+void* operator new(size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+namespace {
+
+constexpr std::uint32_t kCorpusSeed = 20240601;
+constexpr std::uint32_t kQuerySeed = 11;
+constexpr size_t kVocabulary = 3000;     // 每种文字的词汇量
+constexpr size_t kCommonRank = 50;       // 排名在此之前的为常见词
+constexpr size_t kRareRank = 2000;       // 排名在此之后的为低频词
+
+void AppendCodePoint(std::uint32_t cp, std::string& out) {
+    if (cp < 0x80) {
+        out.push_back(static_cast<char>(cp));
+    } else if (cp < 0x800) {
+        out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else {
+        out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    }
+}
+
+// 取UTF-8文本的前count个字符
+std::string Utf8Prefix(const std::string& text, size_t count) {
+    size_t i = 0;
+    while (i < text.size() && count > 0) {
+        ++i;
+        while (i < text.size() && (static_cast<unsigned char>(text[i]) & 0xC0) == 0x80) ++i;
+        --count;
+    }
+    return text.substr(0, i);
+}
+
+// 按Zipf分布（s=1）抽取词汇排名
+class ZipfSampler {
+public:
+    explicit ZipfSampler(size_t n) : m_cdf(n) {
+        double sum = 0.0;
+        for (size_t i = 0; i < n; ++i) m_cdf[i] = (sum += 1.0 / (i + 1));
+        for (auto& c : m_cdf) c /= sum;
+    }
+    size_t operator()(std::mt19937& rng) const {
+        const double u = std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+        return std::min<size_t>(std::upper_bound(m_cdf.begin(), m_cdf.end(), u) - m_cdf.begin(), m_cdf.size() - 1);
+    }
+
+private:
+    std::vector<double> m_cdf;
+};
+
+// 合成曲库：词汇表按排名排列（0最常见）；拉丁词由音节拼成且不含字母v，拼音中v只出现在lv/nv中，
+// 因此以"vv"开头的词不会作为子串命中任何曲目
+struct Corpus {
+    std::vector<std::string> latin;
+    std::vector<std::string> cjk;
+    std::vector<std::string> artists;
+    std::vector<bool> artistCjk;
+    std::vector<std::string> names;
+    std::vector<std::string> tags[3];   // 标题/歌手/专辑
+    TrackTable table;
+    TrigramIndex index;
+};
+
+void BuildVocabulary(Corpus& corpus) {
+    static const char* kSyllables[] = {"ka", "lo", "mi", "ra", "ne", "to", "su", "da", "ber", "mon",
+                                       "ly", "sha", "ri", "el", "an", "or", "in", "gu", "te", "fo"};
+    std::mt19937 rng(kCorpusSeed);
+    while (corpus.latin.size() < kVocabulary) {
+        std::string word;
+        for (int i = 0, n = 2 + rng() % 2; i < n; ++i) word += kSyllables[rng() % 20];
+        word[0] = static_cast<char>(word[0] - 'a' + 'A');
+        if (std::find(corpus.latin.begin(), corpus.latin.end(), word) == corpus.latin.end()) corpus.latin.push_back(word);
+    }
+    for (size_t i = 0; i < kVocabulary; ++i) {
+        std::string word;
+        for (int j = 0, n = 1 + rng() % 3; j < n; ++j) AppendCodePoint(0x4E00 + rng() % 0x5000, word);
+        corpus.cjk.push_back(word);
+    }
+}
+
+std::string MakePhrase(const std::vector<std::string>& words, const ZipfSampler& zipf, std::mt19937& rng, int minWords,
+                       int maxWords, bool cjk) {
+    std::string phrase;
+    for (int i = 0, n = minWords + rng() % (maxWords - minWords + 1); i < n; ++i) {
+        if (i && !cjk) phrase += ' ';
+        phrase += words[zipf(rng)];
+    }
+    return phrase;
+}
+
+void BuildCorpus(Corpus& corpus, std::uint32_t count) {
+    static const char* kExts[] = {".mp3", ".flac", ".ogg", ".wav", ".m4a"};
+    const ZipfSampler zipf(kVocabulary);
+    std::mt19937 rng(kCorpusSeed + count);
+
+    const size_t artistCount = std::max<size_t>(50, count / 40);
+    for (size_t i = 0; i < artistCount; ++i) {
+        const bool cjk = rng() % 2 == 0;
+        corpus.artistCjk.push_back(cjk);
+        corpus.artists.push_back(MakePhrase(cjk ? corpus.cjk : corpus.latin, zipf, rng, 1, 2, cjk));
+    }
+
+    corpus.names.reserve(count);
+    for (auto& column : corpus.tags) column.reserve(count);
+    std::string album;
+    for (std::uint32_t id = 0; id < count; ++id) {
+        const size_t artist = rng() % artistCount;
+        bool cjk = corpus.artistCjk[artist];
+        if (id % 12 == 0) album = MakePhrase(cjk ? corpus.cjk : corpus.latin, zipf, rng, 1, 3, cjk);
+        if (rng() % 7 == 0) cjk = !cjk; // 少量曲目的标题使用另一种文字
+        std::string title = MakePhrase(cjk ? corpus.cjk : corpus.latin, zipf, rng, 1, 4, cjk);
+
+        char number[8];
+        std::snprintf(number, sizeof(number), "%02u. ", static_cast<unsigned>(1 + id % 12));
+        std::string name;
+        switch (rng() % 3) {
+        case 0: name = corpus.artists[artist] + " - " + title; break;
+        case 1: name = number + title; break;
+        default: name = title; break;
+        }
+        name += kExts[rng() % 5];
+
+        const bool tagged = rng() % 5 != 0;
+        corpus.names.push_back(std::move(name));
+        corpus.tags[0].push_back(tagged ? title : std::string());
+        corpus.tags[1].push_back(tagged ? corpus.artists[artist] : std::string());
+        corpus.tags[2].push_back(tagged ? album : std::string());
+    }
+
+    std::mt19937 columnRng(kCorpusSeed ^ count); // 时长30秒~10分钟、大小1~50MB
+    for (std::uint32_t id = 0; id < count; ++id) {
+        const std::string_view tags[] = {corpus.tags[0][id], corpus.tags[1][id], corpus.tags[2][id]};
+        corpus.table.Append(corpus.names[id], (1u << 20) + columnRng() % (49u << 20), 30000 + columnRng() % 570000,
+                            AudioFormatFromName(corpus.names[id]), tags, 3);
+    }
+    corpus.index.Build(corpus.table);
+}
+
+struct Workload {
+    const char* name;
+    std::vector<std::string> queries;   // 原始（未折叠）关键词，与用户输入相同
+};
+
+std::vector<Workload> MakeWorkloads(const Corpus& corpus, size_t perWorkload) {
+    std::mt19937 rng(kQuerySeed);
+    auto pickWords = [&](size_t firstRank, size_t endRank) -> const std::string& {
+        const auto& words = rng() % 2 == 0 ? corpus.latin : corpus.cjk;
+        return words[firstRank + rng() % (endRank - firstRank)];
+    };
+
+    std::vector<Workload> workloads = {{"prefix", {}}, {"common", {}}, {"rare", {}}, {"pinyin", {}},
+                                       {"typo", {}},   {"empty", {}},  {"fields", {}}};
+    for (size_t i = 0; i < perWorkload; ++i) {
+        workloads[0].queries.push_back(Utf8Prefix(pickWords(0, kCommonRank), 1 + i % 3));
+        workloads[1].queries.push_back(pickWords(0, kCommonRank));
+        workloads[2].queries.push_back(pickWords(kRareRank, kVocabulary));
+
+        // 中文歌手名的全拼或首字母
+        size_t artist = rng() % corpus.artists.size();
+        while (!corpus.artistCjk[artist]) artist = (artist + 1) % corpus.artists.size();
+        std::string full, initials;
+        AppendPinyinKeys(corpus.artists[artist], full, initials);
+        workloads[3].queries.push_back(i % 2 == 0 ? full : initials);
+
+        // 中频拉丁词交换相邻两个字母
+        std::string typo = corpus.latin[kCommonRank + rng() % 500];
+        const size_t at = 1 + rng() % (typo.size() - 2);
+        std::swap(typo[at], typo[at + 1]);
+        workloads[4].queries.push_back(typo);
+
+        // "vv"开头的拉丁串或谚文（曲库中没有）
+        std::string empty;
+        if (i % 2 == 0) {
+            empty = "vv";
+            for (int j = 0; j < 3; ++j) empty.push_back(static_cast<char>('a' + rng() % 26));
+        } else {
+            for (int j = 0; j < 2; ++j) AppendCodePoint(0xAC00 + rng() % 11172, empty);
+        }
+        workloads[5].queries.push_back(empty);
+
+        std::string fields;
+        switch (i % 3) {
+        case 0: fields = "artist:\"" + corpus.artists[rng() % corpus.artists.size()] + "\" duration>240"; break;
+        case 1: fields = "format:flac size>20mb"; break;
+        default: fields = pickWords(0, kCommonRank) + " -format:mp3 duration<5:00"; break;
+        }
+        workloads[6].queries.push_back(fields);
+    }
+    return workloads;
+}
+
+struct WorkloadResult {
+    std::uint32_t tracks = 0;
+    std::string workload;
+    double matches = 0.0;
+    double p50 = 0.0;
+    double p99 = 0.0;
+    double max = 0.0;
+    double allocations = 0.0;
+};
+
+double Percentile(const std::vector<double>& sorted, double p) {
+    const size_t rank = static_cast<size_t>(std::ceil(p * sorted.size()));
+    return sorted[std::min(sorted.size() - 1, rank > 0 ? rank - 1 : 0)];
+}
+
+// 与界面搜索相同的流程：折叠关键词、解析、查询并排列，再把结果拆为排列部分与位图
+WorkloadResult RunWorkload(const Corpus& corpus, const Workload& workload, int repeats) {
+    std::vector<std::uint32_t> ids;
+    TrackBitmap rest;
+    std::string key;
+    auto runOnce = [&](const std::string& raw) {
+        key.clear();
+        AppendFoldedUtf8(raw, key);
+        SearchTracks(corpus.table, corpus.index, TrackQuery(key), ids);
+        SplitRankedIds(ids, rest);
+        return ids.size() + rest.Cardinality();
+    };
+    runOnce(workload.queries.front()); // 预热
+
+    WorkloadResult result;
+    result.workload = workload.name;
+    std::vector<double> samples;
+    std::uint64_t matches = 0;
+    std::uint64_t allocations = 0;
+    for (int r = 0; r < repeats; ++r) {
+        for (const auto& raw : workload.queries) {
+            const std::uint64_t allocBefore = g_allocations.load();
+            const auto start = std::chrono::steady_clock::now();
+            matches += runOnce(raw);
+            samples.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+            allocations += g_allocations.load() - allocBefore;
+        }
+    }
+    std::sort(samples.begin(), samples.end());
+    result.matches = static_cast<double>(matches) / samples.size();
+    result.p50 = Percentile(samples, 0.50);
+    result.p99 = Percentile(samples, 0.99);
+    result.max = samples.back();
+    result.allocations = static_cast<double>(allocations) / samples.size();
+    return result;
+}
+
+// 保存格式：每行“曲目数 查询类型 p50 p99 分配次数”
+bool SaveResults(const char* path, const std::vector<WorkloadResult>& results) {
+    FILE* file = std::fopen(path, "w");
+    if (file == nullptr) return false;
+    for (const auto& r : results) {
+        std::fprintf(file, "%u %s %.6f %.6f %.2f\n", r.tracks, r.workload.c_str(), r.p50, r.p99, r.allocations);
+    }
+    return std::fclose(file) == 0;
+}
+
+bool LoadResults(const char* path, std::vector<WorkloadResult>& results) {
+    FILE* file = std::fopen(path, "r");
+    if (file == nullptr) return false;
+    WorkloadResult r;
+    char workload[32];
+    while (std::fscanf(file, "%u %31s %lf %lf %lf", &r.tracks, workload, &r.p50, &r.p99, &r.allocations) == 5) {
+        r.workload = workload;
+        results.push_back(r);
+    }
+    std::fclose(file);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::vector<std::uint32_t> sizes;
+    size_t perWorkload = 32;
+    const char* savePath = nullptr;
+    const char* comparePath = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--queries") == 0 && i + 1 < argc) perWorkload = std::strtoul(argv[++i], nullptr, 10);
+        else if (std::strcmp(argv[i], "--save") == 0 && i + 1 < argc) savePath = argv[++i];
+        else if (std::strcmp(argv[i], "--compare") == 0 && i + 1 < argc) comparePath = argv[++i];
+        else sizes.push_back(static_cast<std::uint32_t>(std::strtoul(argv[i], nullptr, 10)));
+    }
+    if (sizes.empty()) sizes = {10000, 100000, 1000000};
+    if (perWorkload == 0) perWorkload = 1;
+
+    std::vector<WorkloadResult> baseline;
+    if (comparePath != nullptr && !LoadResults(comparePath, baseline)) {
+        std::fprintf(stderr, "cannot read %s\n", comparePath);
+        return 1;
+    }
+
+    std::vector<WorkloadResult> results;
+    for (std::uint32_t count : sizes) {
+        Corpus corpus;
+        BuildVocabulary(corpus);
+        const auto start = std::chrono::steady_clock::now();
+        BuildCorpus(corpus, count);
+        const double buildMs =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::printf("tracks=%u build=%.1fms table=%.1fMB index=%.1fMB\n", count, buildMs,
+                    corpus.table.MemoryBytes() / 1e6, corpus.index.Stats().memoryBytes / 1e6);
+
+        // 小曲库上多重复几遍，使p99有足够的样本
+        const int repeats = count <= 100000 ? 5 : 2;
+        for (const auto& workload : MakeWorkloads(corpus, perWorkload)) {
+            WorkloadResult r = RunWorkload(corpus, workload, repeats);
+            r.tracks = count;
+            std::printf("  %-7s matches=%-9.1f p50=%8.3fms p99=%8.3fms max=%8.3fms allocations/query=%.1f",
+                        r.workload.c_str(), r.matches, r.p50, r.p99, r.max, r.allocations);
+            for (const auto& b : baseline) {
+                if (b.tracks != count || b.workload != r.workload) continue;
+                std::printf("  vs baseline: p50 %+.1f%% p99 %+.1f%% allocations %+.1f", (r.p50 / b.p50 - 1.0) * 100.0,
+                            (r.p99 / b.p99 - 1.0) * 100.0, r.allocations - b.allocations);
+            }
+            std::printf("\n");
+            results.push_back(std::move(r));
+        }
+    }
+
+    if (savePath != nullptr && !SaveResults(savePath, results)) {
+        std::fprintf(stderr, "cannot write %s\n", savePath);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,237 @@
+#include "byte_search.h"
+
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BYTE_SEARCH_SSE2 1
+#include <emmintrin.h>
+// AVX2实现单独以target属性编译（MSVC无需属性），由运行时检测决定是否调用
+#if defined(__GNUC__) || defined(__clang__)
+#define BYTE_SEARCH_AVX2 1
+#define BYTE_SEARCH_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#elif defined(_MSC_VER)
+#define BYTE_SEARCH_AVX2 1
+#define BYTE_SEARCH_TARGET_AVX2
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+#endif
+
+namespace {
+
+using FindFn = const char* (*)(const char* p, size_t n, const char* needle, size_t m);
+
+// 标量实现：memchr（libc内部已向量化）定位首字节，再比较末字节与其余字节；要求m >= 2
+const char* FindScalar(const char* p, size_t n, const char* needle, size_t m) {
+    if (m > n) return nullptr;
+    const char* last = p + (n - m);
+    const char first = needle[0];
+    const char lastByte = needle[m - 1];
+    while (p <= last) {
+        p = static_cast<const char*>(std::memchr(p, first, static_cast<size_t>(last - p) + 1));
+        if (p == nullptr) return nullptr;
+        if (p[m - 1] == lastByte && std::memcmp(p + 1, needle + 1, m - 2) == 0) return p;
+        ++p;
+    }
+    return nullptr;
+}
+
+#ifdef BYTE_SEARCH_SSE2
+unsigned CountTrailingZeros(unsigned mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+
+// 对mask中每个候选起始位置比较中间部分（首末字节已相等）
+inline const char* VerifyCandidates(unsigned mask, const char* block, const char* needle, size_t m) {
+    while (mask != 0) {
+        const unsigned bit = CountTrailingZeros(mask);
+        if (std::memcmp(block + bit + 1, needle + 1, m - 2) == 0) return block + bit;
+        mask &= mask - 1;
+    }
+    return nullptr;
+}
+
+// SSE2：每次取起始位置i..i+15与结束位置i+m-1..i+m+14各16字节，两次比较的与即候选位置
+const char* FindSse2(const char* p, size_t n, const char* needle, size_t m) {
+    if (m > n) return nullptr;
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[m - 1]);
+    size_t i = 0;
+    for (; i + m - 1 + 16 <= n; i += 16) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + m - 1));
+        const unsigned mask =
+            static_cast<unsigned>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last))));
+        if (mask != 0) {
+            if (const char* hit = VerifyCandidates(mask, p + i, needle, m)) return hit;
+        }
+    }
+    return FindScalar(p + i, n - i, needle, m);
+}
+
+// 可越过文本末尾读取kFindPadding字节的SSE2实现：块内超出最后一个起始位置的候选按掩码去掉
+const char* FindSse2Padded(const char* p, size_t n, const char* needle, size_t m) {
+    if (m > n) return nullptr;
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[m - 1]);
+    const size_t starts = n - m + 1;
+    for (size_t i = 0; i < starts; i += 16) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + m - 1));
+        unsigned mask =
+            static_cast<unsigned>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last))));
+        if (starts - i < 16) mask &= (1u << (starts - i)) - 1;
+        if (mask != 0) {
+            if (const char* hit = VerifyCandidates(mask, p + i, needle, m)) return hit;
+        }
+    }
+    return nullptr;
+}
+#endif
+
+#ifdef BYTE_SEARCH_AVX2
+BYTE_SEARCH_TARGET_AVX2
+const char* FindAvx2Padded(const char* p, size_t n, const char* needle, size_t m) {
+    if (m > n) return nullptr;
+    const __m256i first = _mm256_set1_epi8(needle[0]);
+    const __m256i last = _mm256_set1_epi8(needle[m - 1]);
+    const size_t starts = n - m + 1;
+    for (size_t i = 0; i < starts; i += 32) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i + m - 1));
+        unsigned mask = static_cast<unsigned>(
+            _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last))));
+        if (starts - i < 32) mask &= (1u << (starts - i)) - 1;
+        if (mask != 0) {
+            if (const char* hit = VerifyCandidates(mask, p + i, needle, m)) return hit;
+        }
+    }
+    return nullptr;
+}
+
+BYTE_SEARCH_TARGET_AVX2
+const char* FindAvx2(const char* p, size_t n, const char* needle, size_t m) {
+    if (m > n) return nullptr;
+    const __m256i first = _mm256_set1_epi8(needle[0]);
+    const __m256i last = _mm256_set1_epi8(needle[m - 1]);
+    size_t i = 0;
+    // 主循环每次检查64个起始位置，两组结果合并后只做一次movemask判断（绝大多数块没有候选）
+    for (; i + m - 1 + 64 <= n; i += 64) {
+        const __m256i a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        const __m256i b0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i + m - 1));
+        const __m256i a1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i + 32));
+        const __m256i b1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i + 32 + m - 1));
+        const __m256i eq0 = _mm256_and_si256(_mm256_cmpeq_epi8(a0, first), _mm256_cmpeq_epi8(b0, last));
+        const __m256i eq1 = _mm256_and_si256(_mm256_cmpeq_epi8(a1, first), _mm256_cmpeq_epi8(b1, last));
+        if (_mm256_testz_si256(_mm256_or_si256(eq0, eq1), _mm256_or_si256(eq0, eq1))) continue;
+        const unsigned mask0 = static_cast<unsigned>(_mm256_movemask_epi8(eq0));
+        if (mask0 != 0) {
+            if (const char* hit = VerifyCandidates(mask0, p + i, needle, m)) return hit;
+        }
+        const unsigned mask1 = static_cast<unsigned>(_mm256_movemask_epi8(eq1));
+        if (mask1 != 0) {
+            if (const char* hit = VerifyCandidates(mask1, p + i + 32, needle, m)) return hit;
+        }
+    }
+    for (; i + m - 1 + 32 <= n; i += 32) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i + m - 1));
+        const unsigned mask = static_cast<unsigned>(
+            _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last))));
+        if (mask != 0) {
+            if (const char* hit = VerifyCandidates(mask, p + i, needle, m)) return hit;
+        }
+    }
+    return FindSse2(p + i, n - i, needle, m);
+}
+
+bool CpuHasAvx2() {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_cpu_supports("avx2"); // 同时检查操作系统是否保存YMM寄存器
+#else
+    int info[4];
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 6) != 6) return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#endif
+}
+#endif
+
+FindFn PaddedKernelFor(SimdLevel level) {
+    switch (level) {
+#ifdef BYTE_SEARCH_AVX2
+        case SIMD_AVX2: return FindAvx2Padded;
+#endif
+#ifdef BYTE_SEARCH_SSE2
+        case SIMD_SSE2: return FindSse2Padded;
+#endif
+        default: return FindScalar;
+    }
+}
+
+FindFn KernelFor(SimdLevel level) {
+    switch (level) {
+#ifdef BYTE_SEARCH_AVX2
+        case SIMD_AVX2: return FindAvx2;
+#endif
+#ifdef BYTE_SEARCH_SSE2
+        case SIMD_SSE2: return FindSse2;
+#endif
+        default: return FindScalar;
+    }
+}
+
+const char* FindWith(FindFn kernel, const char* haystack, size_t n, std::string_view needle) {
+    if (needle.empty()) return haystack;
+    if (needle.size() == 1) return static_cast<const char*>(std::memchr(haystack, needle[0], n));
+    return kernel(haystack, n, needle.data(), needle.size());
+}
+
+} // namespace
+
+SimdLevel DetectSimdLevel() {
+    static const SimdLevel level = [] {
+#ifdef BYTE_SEARCH_AVX2
+        if (CpuHasAvx2()) return SIMD_AVX2;
+#endif
+#ifdef BYTE_SEARCH_SSE2
+        return SIMD_SSE2;
+#else
+        return SIMD_SCALAR;
+#endif
+    }();
+    return level;
+}
+
+const char* SimdLevelName(SimdLevel level) {
+    switch (level) {
+        case SIMD_AVX2: return "avx2";
+        case SIMD_SSE2: return "sse2";
+        default: return "scalar";
+    }
+}
+
+const char* FindSubstring(const char* haystack, size_t n, std::string_view needle) {
+    static const FindFn kernel = KernelFor(DetectSimdLevel());
+    return FindWith(kernel, haystack, n, needle);
+}
+
+const char* FindSubstringWith(SimdLevel level, const char* haystack, size_t n, std::string_view needle) {
+    if (level > DetectSimdLevel()) level = DetectSimdLevel();
+    return FindWith(KernelFor(level), haystack, n, needle);
+}
+
+const char* FindSubstringPadded(const char* haystack, size_t n, std::string_view needle) {
+    static const FindFn kernel = PaddedKernelFor(DetectSimdLevel());
+    return FindWith(kernel, haystack, n, needle);
+}
@@ -0,0 +1,43 @@
+// 字节子串查找内核：用关键词的首字节与末字节同时预过滤（SSE2/AVX2一次检查16/32个起始位置），
+// 两端都相等的位置再比较中间部分。检索键已折叠为UTF-8，字节匹配即码点匹配
+// 运行时按CPU选择最快的实现；非x86平台使用标量实现（memchr定位首字节）
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+enum SimdLevel {
+    SIMD_SCALAR,
+    SIMD_SSE2,
+    SIMD_AVX2,
+};
+
+// 当前CPU与编译器共同支持的最高级别（只检测一次）
+SimdLevel DetectSimdLevel();
+const char* SimdLevelName(SimdLevel level);
+
+// 在[haystack, haystack+n)中查找needle第一次出现的位置，未找到返回nullptr；空needle返回haystack
+const char* FindSubstring(const char* haystack, size_t n, std::string_view needle);
+
+// 同上，使用指定级别的实现（级别高于DetectSimdLevel()时按后者处理），用于基准测试对比
+const char* FindSubstringWith(SimdLevel level, const char* haystack, size_t n, std::string_view needle);
+
+// 同FindSubstring，但调用方保证haystack+n之后还有kFindPadding字节可读（内容任意，不会被当作命中）：
+// 短文本（逐个校验的检索键）整块比较、末尾按掩码截断，不退回标量实现
+constexpr size_t kFindPadding = 32;
+const char* FindSubstringPadded(const char* haystack, size_t n, std::string_view needle);
+
+// 提示CPU预取p所在的缓存行（逐个访问大量分散的曲目时提前发出内存请求）
+inline void PrefetchRead(const void* p) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#else
+    (void)p;
+#endif
+}
@@ -0,0 +1,128 @@
+#include "duplicate_finder.h"
+#include "audio_fingerprint.h"
+#include "fs_util.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <unordered_map>
+
+namespace {
+
+// 按下标并行处理[0, count)，每个线程从共享计数器领取下一个下标
+template <typename Fn>
+void ParallelFor(size_t count, unsigned threadCount, const std::atomic<bool>& cancelled, Fn&& fn) {
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        while (!cancelled.load(std::memory_order_relaxed)) {
+            const size_t i = next.fetch_add(1);
+            if (i >= count) break;
+            fn(i);
+        }
+    };
+    threadCount = static_cast<unsigned>(std::min<size_t>(threadCount, count));
+    std::vector<std::thread> threads;
+    for (unsigned i = 1; i < threadCount; ++i) threads.emplace_back(worker);
+    worker();
+    for (auto& t : threads) t.join();
+}
+
+} // namespace
+
+std::vector<DuplicateGroup> DuplicateFinder::Run(const std::string& rootUtf8, std::vector<CatalogEntry>& entries,
+                                                 const DuplicateOptions& options, DuplicateStats& stats) {
+    stats = DuplicateStats();
+    const auto start = std::chrono::steady_clock::now();
+    const std::string root = TrimTrailingSeparators(rootUtf8);
+    unsigned threadCount = options.threadCount;
+    if (threadCount == 0) threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    // 1. 定位音频数据区（只读文件头尾）
+    std::vector<std::uint32_t> toLocate;
+    for (std::uint32_t i = 0; i < entries.size(); ++i) {
+        if (!entries[i].fingerprint.Located()) toLocate.push_back(i);
+    }
+    ParallelFor(toLocate.size(), threadCount, m_cancelled, [&](size_t k) {
+        CatalogEntry& entry = entries[toLocate[k]];
+        FileReader file;
+        AudioPayload payload;
+        entry.fingerprint = AudioFingerprint();
+        if (file.Open(JoinPath(root, entry.path)) && LocateAudioPayload(file, payload)) {
+            entry.fingerprint.payloadSize = payload.end - payload.begin;
+        } else {
+            entry.fingerprint.payloadSize = AudioFingerprint::kNoPayload;
+        }
+    });
+    stats.located = toLocate.size();
+
+    // 2. 按音频数据区大小分桶，只有桶内多于一个文件时才需要读取全文
+    std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> buckets;
+    for (std::uint32_t i = 0; i < entries.size(); ++i) {
+        if (entries[i].fingerprint.Comparable()) buckets[entries[i].fingerprint.payloadSize].push_back(i);
+    }
+    std::vector<std::uint32_t> toHash;
+    for (const auto& kv : buckets) {
+        if (kv.second.size() < 2) continue;
+        for (std::uint32_t i : kv.second) {
+            if (!entries[i].fingerprint.Hashed()) toHash.push_back(i);
+        }
+    }
+    std::atomic<std::uint64_t> hashedBytes{0};
+    ParallelFor(toHash.size(), threadCount, m_cancelled, [&](size_t k) {
+        CatalogEntry& entry = entries[toHash[k]];
+        AudioFingerprint fingerprint;
+        if (ComputeAudioFingerprint(JoinPath(root, entry.path), fingerprint)) {
+            entry.fingerprint = fingerprint;
+            hashedBytes.fetch_add(entry.size, std::memory_order_relaxed);
+        } else {
+            entry.fingerprint.payloadSize = AudioFingerprint::kNoPayload;
+        }
+    });
+    stats.hashed = toHash.size();
+    stats.hashedBytes = hashedBytes.load();
+
+    // 3. 桶内按音频哈希分组
+    std::vector<DuplicateGroup> groups;
+    for (auto& kv : buckets) {
+        std::vector<std::uint32_t>& members = kv.second;
+        if (members.size() < 2) continue;
+        std::sort(members.begin(), members.end(), [&entries](std::uint32_t a, std::uint32_t b) {
+            const std::uint64_t ha = entries[a].fingerprint.audioHash;
+            const std::uint64_t hb = entries[b].fingerprint.audioHash;
+            return ha != hb ? ha < hb : a < b;
+        });
+        for (size_t begin = 0; begin < members.size();) {
+            const AudioFingerprint& first = entries[members[begin]].fingerprint;
+            size_t end = begin + 1;
+            while (end < members.size() && entries[members[end]].fingerprint.audioHash == first.audioHash) ++end;
+            if (first.Hashed() && first.Comparable() && end - begin >= 2) {
+                DuplicateGroup group;
+                group.members.assign(members.begin() + begin, members.begin() + end);
+                group.byteIdentical = true;
+                for (std::uint32_t i : group.members) {
+                    const CatalogEntry& e = entries[i];
+                    if (e.fingerprint.fileHash != first.fileHash || e.size != entries[group.members[0]].size) {
+                        group.byteIdentical = false;
+                    }
+                }
+                stats.duplicateFiles += group.members.size() - 1;
+                if (group.byteIdentical) ++stats.byteIdenticalGroups;
+                groups.push_back(std::move(group));
+            }
+            begin = end;
+        }
+    }
+    std::sort(groups.begin(), groups.end(),
+              [](const DuplicateGroup& a, const DuplicateGroup& b) { return a.members[0] < b.members[0]; });
+    stats.groups = groups.size();
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return groups;
+}
+
+bool NeedsFingerprinting(const LibraryCatalog& catalog) {
+    if (!catalog.HasFingerprints()) return catalog.TrackCount() > 0;
+    for (std::uint32_t id = 0; id < catalog.TrackCount(); ++id) {
+        if (!catalog.TrackFingerprint(id).Located()) return true;
+    }
+    return false;
+}
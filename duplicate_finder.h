@@ -0,0 +1,49 @@
+// 重复曲目检测：按音频数据区大小分桶，只对大小相同的文件读取全文计算指纹（大小唯一的文件不可能重复），
+// 再按音频哈希分组。指纹随目录保存，之后只需处理新增/修改的文件
+#pragma once
+
+#include "library_catalog.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 一组音频内容相同的曲目（成员为entries下标，至少2个）
+struct DuplicateGroup {
+    std::vector<std::uint32_t> members;
+    bool byteIdentical = false;     // 所有成员逐字节相同（否则仅音频相同，标签/文件名不同）
+};
+
+struct DuplicateOptions {
+    unsigned threadCount = 0;       // 工作线程数，0表示使用CPU核心数
+};
+
+struct DuplicateStats {
+    std::uint64_t located = 0;      // 本次定位音频数据区的文件数（只读文件头尾）
+    std::uint64_t hashed = 0;       // 本次读取全文计算指纹的文件数
+    std::uint64_t hashedBytes = 0;
+    std::uint64_t groups = 0;
+    std::uint64_t byteIdenticalGroups = 0;
+    std::uint64_t duplicateFiles = 0;   // 各组中除第一个之外的文件数（可删除的副本数）
+    double seconds = 0.0;
+
+    double MegabytesPerSecond() const { return seconds > 0.0 ? hashedBytes / seconds / 1e6 : 0.0; }
+};
+
+class DuplicateFinder {
+public:
+    // 补全entries中缺失的指纹（就地修改），返回重复分组；路径相对rootUtf8
+    std::vector<DuplicateGroup> Run(const std::string& rootUtf8, std::vector<CatalogEntry>& entries,
+                                    const DuplicateOptions& options, DuplicateStats& stats);
+
+    // 请求取消（可从任意线程调用）；取消后entries中的指纹可能不完整，但已计算的均有效
+    void Cancel() { m_cancelled.store(true); }
+    bool IsCancelled() const { return m_cancelled.load(); }
+
+private:
+    std::atomic<bool> m_cancelled{false};
+};
+
+// 目录中是否有尚未定位音频数据区的曲目（新加入或来自旧版目录），需要运行DuplicateFinder
+bool NeedsFingerprinting(const LibraryCatalog& catalog);
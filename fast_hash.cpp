@@ -0,0 +1,131 @@
+#include "fast_hash.h"
+
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FAST_HASH_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+constexpr std::uint32_t kStripesPerBlock = 16;  // 每1KB打散一次累加器，避免通道熵退化
+constexpr std::uint64_t kPrime32 = 0x9E3779B1u;
+constexpr std::uint64_t kPrime64a = 0x9E3779B185EBCA87ull;
+constexpr std::uint64_t kPrime64b = 0xC2B2AE3D27D4EB4Full;
+
+alignas(16) const std::uint64_t kKey[8] = {
+    0xbe4ba423396cfeb8ull, 0x1cad21f72c81017cull, 0xdb979083e96dd4deull, 0x1f67b3b7a4a44072ull,
+    0x78e5c0cc4ee679cbull, 0x2172ffcc7dd05a82ull, 0x8e2443f7744608b8ull, 0x4c263a81e69035e0ull,
+};
+alignas(16) const std::uint64_t kScrambleKey[8] = {
+    0xcb00c391bb52283cull, 0xa32e531b8b65d088ull, 0x4ef90da297486471ull, 0xd8acdea946ef1938ull,
+    0x3f349ce33f76faa8ull, 0x1d4f0bc7c7bbdcf9ull, 0x3159b4cd4be0518aull, 0x647378d9c97e9fc8ull,
+};
+
+#ifndef FAST_HASH_SSE2
+std::uint64_t Load64(const std::uint8_t* p) {
+    std::uint64_t v;
+    std::memcpy(&v, p, 8); // 小端平台；哈希值只在本机持久化比较
+    return v;
+}
+#endif
+
+// 每个64字节条带：acc[i] += lo32(d^k) * hi32(d^k)，相邻通道交换累加原始数据
+void Accumulate(std::uint64_t* acc, const std::uint8_t* p, size_t count, std::uint32_t& stripesInBlock) {
+#ifdef FAST_HASH_SSE2
+    __m128i a[4];
+    for (int j = 0; j < 4; ++j) a[j] = _mm_load_si128(reinterpret_cast<const __m128i*>(acc) + j);
+    const __m128i prime = _mm_set1_epi32(static_cast<int>(kPrime32));
+    for (size_t s = 0; s < count; ++s, p += 64) {
+        for (int j = 0; j < 4; ++j) {
+            const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p) + j);
+            const __m128i dk = _mm_xor_si128(d, _mm_load_si128(reinterpret_cast<const __m128i*>(kKey) + j));
+            const __m128i product = _mm_mul_epu32(dk, _mm_shuffle_epi32(dk, _MM_SHUFFLE(0, 3, 0, 1)));
+            const __m128i swapped = _mm_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2));
+            a[j] = _mm_add_epi64(a[j], _mm_add_epi64(product, swapped));
+        }
+        if (++stripesInBlock == kStripesPerBlock) {
+            stripesInBlock = 0;
+            for (int j = 0; j < 4; ++j) {
+                __m128i x = _mm_xor_si128(a[j], _mm_srli_epi64(a[j], 47));
+                x = _mm_xor_si128(x, _mm_load_si128(reinterpret_cast<const __m128i*>(kScrambleKey) + j));
+                const __m128i lo = _mm_mul_epu32(x, prime);
+                const __m128i hi = _mm_mul_epu32(_mm_srli_epi64(x, 32), prime);
+                a[j] = _mm_add_epi64(lo, _mm_slli_epi64(hi, 32));
+            }
+        }
+    }
+    for (int j = 0; j < 4; ++j) _mm_store_si128(reinterpret_cast<__m128i*>(acc) + j, a[j]);
+#else
+    for (size_t s = 0; s < count; ++s, p += 64) {
+        for (int i = 0; i < 8; ++i) {
+            const std::uint64_t d = Load64(p + 8 * i);
+            const std::uint64_t dk = d ^ kKey[i];
+            acc[i ^ 1] += d;
+            acc[i] += (dk & 0xffffffffu) * (dk >> 32);
+        }
+        if (++stripesInBlock == kStripesPerBlock) {
+            stripesInBlock = 0;
+            for (int i = 0; i < 8; ++i) {
+                std::uint64_t x = acc[i] ^ (acc[i] >> 47) ^ kScrambleKey[i];
+                acc[i] = x * kPrime32;
+            }
+        }
+    }
+#endif
+}
+
+std::uint64_t Avalanche(std::uint64_t h) {
+    h ^= h >> 33;
+    h *= kPrime64b;
+    h ^= h >> 29;
+    h *= kPrime64a;
+    h ^= h >> 32;
+    return h;
+}
+
+} // namespace
+
+FastHash64::FastHash64() {
+    for (int i = 0; i < 8; ++i) m_acc[i] = kKey[7 - i];
+}
+
+void FastHash64::Update(const void* data, size_t size) {
+    const std::uint8_t* p = static_cast<const std::uint8_t*>(data);
+    m_totalLength += size;
+    if (m_buffered > 0) {
+        const size_t take = size < 64 - m_buffered ? size : 64 - m_buffered;
+        std::memcpy(m_buffer + m_buffered, p, take);
+        m_buffered += take;
+        p += take;
+        size -= take;
+        if (m_buffered < 64) return;
+        Consume(m_buffer, 1);
+        m_buffered = 0;
+    }
+    const size_t stripes = size / 64;
+    Consume(p, stripes);
+    p += stripes * 64;
+    size -= stripes * 64;
+    std::memcpy(m_buffer, p, size);
+    m_buffered = size;
+}
+
+void FastHash64::Consume(const std::uint8_t* stripes, size_t count) {
+    Accumulate(m_acc, stripes, count, m_stripesInBlock);
+}
+
+std::uint64_t FastHash64::Final() const {
+    alignas(16) std::uint64_t acc[8];
+    std::memcpy(acc, m_acc, sizeof(acc));
+    if (m_buffered > 0) {
+        std::uint8_t last[64] = {0};
+        std::memcpy(last, m_buffer, m_buffered);
+        std::uint32_t stripesInBlock = m_stripesInBlock;
+        Accumulate(acc, last, 1, stripesInBlock);
+    }
+    std::uint64_t h = m_totalLength * kPrime64a;
+    for (int i = 0; i < 8; ++i) h = (h ^ Avalanche(acc[i] + kScrambleKey[i])) * kPrime64b;
+    return Avalanche(h);
+}
@@ -0,0 +1,31 @@
+// 快速64位流式哈希（用于音频内容指纹）：8条64位累加通道，每次处理64字节
+// x86下用SSE2（_mm_mul_epu32，32x32->64乘法）并行处理，其他平台用等价的标量实现，结果一致
+// 非加密哈希，仅用于相同内容判定（配合长度比较）
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+class FastHash64 {
+public:
+    FastHash64();
+
+    void Update(const void* data, size_t size);
+    std::uint64_t Final() const;
+
+    // 一次性计算
+    static std::uint64_t Hash(const void* data, size_t size) {
+        FastHash64 h;
+        h.Update(data, size);
+        return h.Final();
+    }
+
+private:
+    void Consume(const std::uint8_t* stripes, size_t count);
+
+    alignas(16) std::uint64_t m_acc[8];
+    std::uint8_t m_buffer[64];   // 未满64字节的尾部
+    size_t m_buffered = 0;
+    std::uint64_t m_totalLength = 0;
+    std::uint32_t m_stripesInBlock = 0;
+};
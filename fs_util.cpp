@@ -0,0 +1,343 @@
+#include "fs_util.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+#include <unordered_map>
+
+#ifdef _WIN32
+
+// MinGW头文件可能缺少以下定义（Windows 7+）
+#ifndef FIND_FIRST_EX_LARGE_FETCH
+#define FIND_FIRST_EX_LARGE_FETCH 2
+#endif
+
+std::wstring Utf8ToWide(std::string_view str) {
+    if (str.empty()) return L"";
+    int nLen = MultiByteToWideChar(CP_UTF8, 0, str.data(), (int)str.size(), nullptr, 0);
+    if (nLen <= 0) return L"";
+    std::wstring wStr(nLen, 0);
+    MultiByteToWideChar(CP_UTF8, 0, str.data(), (int)str.size(), &wStr[0], nLen);
+    return wStr;
+}
+
+std::string WideToUtf8(std::wstring_view str) {
+    if (str.empty()) return "";
+    int nLen = WideCharToMultiByte(CP_UTF8, 0, str.data(), (int)str.size(), nullptr, 0, nullptr, nullptr);
+    if (nLen <= 0) return "";
+    std::string out(nLen, 0);
+    WideCharToMultiByte(CP_UTF8, 0, str.data(), (int)str.size(), &out[0], nLen, nullptr, nullptr);
+    return out;
+}
+
+static std::int64_t FileTimeToInt64(const FILETIME& ft) {
+    return (static_cast<std::int64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime;
+}
+
+bool ListDirectory(const std::string& dirUtf8, std::vector<DirEntry>& out) {
+    out.clear();
+    std::wstring pattern = Utf8ToWide(JoinPath(dirUtf8, "*"));
+    WIN32_FIND_DATAW fd;
+    // FindExInfoBasic跳过8.3短文件名，LARGE_FETCH减少内核往返
+    HANDLE hFind = FindFirstFileExW(pattern.c_str(), FindExInfoBasic, &fd,
+                                    FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH);
+    if (hFind == INVALID_HANDLE_VALUE) return false;
+    do {
+        const wchar_t* n = fd.cFileName;
+        if (n[0] == L'.' && (n[1] == 0 || (n[1] == L'.' && n[2] == 0))) continue;
+        DirEntry entry;
+        entry.name = WideToUtf8(n);
+        // 重解析点（目录联接/符号链接）不递归，避免环
+        entry.isDir = (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) &&
+                      !(fd.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT);
+        entry.size = (static_cast<std::uint64_t>(fd.nFileSizeHigh) << 32) | fd.nFileSizeLow;
+        entry.mtime = FileTimeToInt64(fd.ftLastWriteTime);
+        out.push_back(std::move(entry));
+    } while (FindNextFileW(hFind, &fd));
+    FindClose(hFind);
+    return true;
+}
+
+bool StatPath(const std::string& pathUtf8, FileStat& out) {
+    out = FileStat();
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!GetFileAttributesExW(Utf8ToWide(pathUtf8).c_str(), GetFileExInfoStandard, &data)) {
+        return false;
+    }
+    out.exists = true;
+    out.isDir = (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+    out.size = (static_cast<std::uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+    out.mtime = FileTimeToInt64(data.ftLastWriteTime);
+    return true;
+}
+
+bool StatChildren(const std::string& dirUtf8, const std::vector<std::string>& names, std::vector<FileStat>& out) {
+    out.assign(names.size(), FileStat());
+    std::vector<DirEntry> entries;
+    if (!ListDirectory(dirUtf8, entries)) return false;
+    std::unordered_map<std::string, const DirEntry*> byName;
+    for (const auto& entry : entries) byName.emplace(entry.name, &entry);
+    for (size_t i = 0; i < names.size(); ++i) {
+        auto it = byName.find(names[i]);
+        if (it == byName.end()) continue;
+        out[i].exists = true;
+        out[i].isDir = it->second->isDir;
+        out[i].size = it->second->size;
+        out[i].mtime = it->second->mtime;
+    }
+    return true;
+}
+
+bool MappedFile::Open(const std::string& pathUtf8) {
+    Close();
+    HANDLE hFile = CreateFileW(Utf8ToWide(pathUtf8).c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+                               NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (hFile == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(hFile, &size) || size.QuadPart == 0) {
+        CloseHandle(hFile);
+        return false;
+    }
+    HANDLE hMapping = CreateFileMappingW(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (hMapping == NULL) {
+        CloseHandle(hFile);
+        return false;
+    }
+    void* view = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == NULL) {
+        CloseHandle(hMapping);
+        CloseHandle(hFile);
+        return false;
+    }
+    m_file = hFile;
+    m_mapping = hMapping;
+    m_data = static_cast<const std::uint8_t*>(view);
+    m_size = static_cast<size_t>(size.QuadPart);
+    return true;
+}
+
+void MappedFile::Close() {
+    if (m_data != nullptr) UnmapViewOfFile(m_data);
+    if (m_mapping != nullptr) CloseHandle(m_mapping);
+    if (m_file != nullptr) CloseHandle(m_file);
+    m_data = nullptr;
+    m_mapping = nullptr;
+    m_file = nullptr;
+    m_size = 0;
+}
+
+bool FileReader::Open(const std::string& pathUtf8) {
+    Close();
+    HANDLE hFile = CreateFileW(Utf8ToWide(pathUtf8).c_str(), GENERIC_READ,
+                               FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING,
+                               FILE_ATTRIBUTE_NORMAL, NULL);
+    if (hFile == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(hFile, &size)) {
+        CloseHandle(hFile);
+        return false;
+    }
+    m_file = hFile;
+    m_size = static_cast<std::uint64_t>(size.QuadPart);
+    return true;
+}
+
+void FileReader::Close() {
+    if (m_file != nullptr) CloseHandle(m_file);
+    m_file = nullptr;
+    m_size = 0;
+}
+
+size_t FileReader::ReadAt(std::uint64_t offset, void* buffer, size_t size) const {
+    if (m_file == nullptr || offset >= m_size) return 0;
+    if (size > m_size - offset) size = static_cast<size_t>(m_size - offset);
+    // 同步句柄上OVERLAPPED只用于指定偏移，不依赖（也不修改共享的）文件指针语义
+    OVERLAPPED ov = {};
+    ov.Offset = static_cast<DWORD>(offset);
+    ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+    DWORD read = 0;
+    if (!ReadFile(m_file, buffer, static_cast<DWORD>(size), &read, &ov)) return 0;
+    return read;
+}
+
+#else
+
+bool MappedFile::Open(const std::string& pathUtf8) {
+    Close();
+    int fd = open(pathUtf8.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+    void* view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd); // 映射建立后即可关闭fd
+    if (view == MAP_FAILED) return false;
+    m_data = static_cast<const std::uint8_t*>(view);
+    m_size = static_cast<size_t>(st.st_size);
+    return true;
+}
+
+void MappedFile::Close() {
+    if (m_data != nullptr) munmap(const_cast<std::uint8_t*>(m_data), m_size);
+    m_data = nullptr;
+    m_size = 0;
+}
+
+bool FileReader::Open(const std::string& pathUtf8) {
+    Close();
+    int fd = open(pathUtf8.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return false;
+    }
+    m_fd = fd;
+    m_size = static_cast<std::uint64_t>(st.st_size);
+    return true;
+}
+
+void FileReader::Close() {
+    if (m_fd >= 0) close(m_fd);
+    m_fd = -1;
+    m_size = 0;
+}
+
+size_t FileReader::ReadAt(std::uint64_t offset, void* buffer, size_t size) const {
+    if (m_fd < 0) return 0;
+    size_t total = 0;
+    while (total < size) {
+        const ssize_t n = pread(m_fd, static_cast<char*>(buffer) + total, size - total,
+                                static_cast<off_t>(offset + total));
+        if (n <= 0) break;
+        total += static_cast<size_t>(n);
+    }
+    return total;
+}
+
+static std::int64_t StatToMtime(const struct stat& st) {
+    return static_cast<std::int64_t>(st.st_mtim.tv_sec) * 1000000000LL + st.st_mtim.tv_nsec;
+}
+
+bool ListDirectory(const std::string& dirUtf8, std::vector<DirEntry>& out) {
+    out.clear();
+    DIR* dir = opendir(dirUtf8.c_str());
+    if (dir == nullptr) return false;
+    const int dfd = dirfd(dir);
+    while (struct dirent* de = readdir(dir)) {
+        const char* n = de->d_name;
+        if (n[0] == '.' && (n[1] == 0 || (n[1] == '.' && n[2] == 0))) continue;
+        DirEntry entry;
+        entry.name = n;
+        // 相对目录fd做stat，避免内核重复解析完整路径
+        struct stat st;
+        if (de->d_type == DT_DIR) {
+            entry.isDir = true;
+            if (fstatat(dfd, n, &st, AT_SYMLINK_NOFOLLOW) == 0) entry.mtime = StatToMtime(st);
+        } else {
+            if (fstatat(dfd, n, &st, 0) != 0) continue;
+            // d_type未知时（部分文件系统）需要根据stat结果判断；符号链接目录不递归
+            if (S_ISDIR(st.st_mode)) {
+                if (de->d_type == DT_LNK) continue;
+                entry.isDir = true;
+            } else if (!S_ISREG(st.st_mode)) {
+                continue;
+            }
+            entry.size = static_cast<std::uint64_t>(st.st_size);
+            entry.mtime = StatToMtime(st);
+        }
+        out.push_back(std::move(entry));
+    }
+    closedir(dir);
+    return true;
+}
+
+bool StatChildren(const std::string& dirUtf8, const std::vector<std::string>& names, std::vector<FileStat>& out) {
+    out.assign(names.size(), FileStat());
+    int dfd = open(dirUtf8.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dfd < 0) return false;
+    for (size_t i = 0; i < names.size(); ++i) {
+        struct stat st;
+        if (fstatat(dfd, names[i].c_str(), &st, 0) != 0) continue;
+        out[i].exists = true;
+        out[i].isDir = S_ISDIR(st.st_mode);
+        out[i].size = static_cast<std::uint64_t>(st.st_size);
+        out[i].mtime = StatToMtime(st);
+    }
+    close(dfd);
+    return true;
+}
+
+bool StatPath(const std::string& pathUtf8, FileStat& out) {
+    out = FileStat();
+    struct stat st;
+    if (stat(pathUtf8.c_str(), &st) != 0) return false;
+    out.exists = true;
+    out.isDir = S_ISDIR(st.st_mode);
+    out.size = static_cast<std::uint64_t>(st.st_size);
+    out.mtime = StatToMtime(st);
+    return true;
+}
+
+#endif
+
+static bool IsSeparator(char c) {
+    return c == '/' || c == '\\';
+}
+
+std::string JoinPath(const std::string& dir, const std::string& name) {
+    if (dir.empty()) return name;
+    std::string out = dir;
+    if (!IsSeparator(out.back())) out.push_back(kPathSep);
+    out += name;
+    return out;
+}
+
+std::string TrimTrailingSeparators(const std::string& path) {
+    std::string out = path;
+    while (out.size() > 1 && IsSeparator(out.back())) out.pop_back();
+    return out;
+}
+
+std::string_view ParentOf(std::string_view path) {
+    const size_t pos = path.find_last_of("/\\");
+    return pos == std::string_view::npos ? std::string_view() : path.substr(0, pos);
+}
+
+std::string RelativePath(const std::string& root, const std::string& full) {
+    const std::string base = TrimTrailingSeparators(root);
+    if (TrimTrailingSeparators(full) == base) return std::string();
+    if (full.size() <= base.size() || full.compare(0, base.size(), base) != 0) return full;
+    if (!IsSeparator(base.back()) && !IsSeparator(full[base.size()])) return full;
+    size_t pos = base.size();
+    while (pos < full.size() && IsSeparator(full[pos])) ++pos;
+    return full.substr(pos);
+}
+
+bool IsSupportedAudioFile(const std::string& name) {
+    const size_t dot = name.find_last_of('.');
+    if (dot == std::string::npos) return false;
+    const size_t len = name.size() - dot;
+    if (len < 4 || len > 5) return false;
+    // 扩展名转小写（仅ASCII，避免locale开销）
+    char ext[6] = {0};
+    for (size_t i = 0; i < len; ++i) {
+        char c = name[dot + i];
+        ext[i] = (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+    return std::strcmp(ext, ".mp3") == 0 || std::strcmp(ext, ".wav") == 0 ||
+           std::strcmp(ext, ".flac") == 0 || std::strcmp(ext, ".ogg") == 0;
+}
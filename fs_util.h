@@ -0,0 +1,107 @@
+// 跨平台文件系统辅助函数（曲库扫描/目录校验共用）
+// 路径在内部统一使用UTF-8，Windows下在调用系统API前转换为UTF-16
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef _WIN32
+constexpr char kPathSep = '\\';
+#else
+constexpr char kPathSep = '/';
+#endif
+
+// 目录项（mtime为平台原生时间刻度，仅用于相等比较）
+struct DirEntry {
+    std::string name;
+    bool isDir = false;
+    std::uint64_t size = 0;
+    std::int64_t mtime = 0;
+};
+
+// 单个路径的元信息
+struct FileStat {
+    bool exists = false;
+    bool isDir = false;
+    std::uint64_t size = 0;
+    std::int64_t mtime = 0;
+};
+
+// 列出目录下的所有直接子项（一次系统调用批量拿到大小/时间，避免逐个stat）
+// 符号链接指向的目录不会被标记为目录，防止递归扫描出现环
+bool ListDirectory(const std::string& dirUtf8, std::vector<DirEntry>& out);
+
+// 获取单个路径的元信息
+bool StatPath(const std::string& pathUtf8, FileStat& out);
+
+// 批量获取目录下若干已知子项的元信息（out与names一一对应，不存在的项exists为false）
+// POSIX下基于目录fd逐个fstatat，Windows下一次列举目录后按名字匹配
+bool StatChildren(const std::string& dirUtf8, const std::vector<std::string>& names, std::vector<FileStat>& out);
+
+// 拼接路径（自动处理末尾分隔符）
+std::string JoinPath(const std::string& dir, const std::string& name);
+
+// 去掉路径末尾多余的分隔符（保留根目录）
+std::string TrimTrailingSeparators(const std::string& path);
+
+// 上级目录（无分隔符时返回空串，即根目录）
+std::string_view ParentOf(std::string_view path);
+
+// 取full相对root的部分（full即root时返回空串，不在root下时原样返回）
+std::string RelativePath(const std::string& root, const std::string& full);
+
+// 判断扩展名是否为支持的音频格式（.mp3/.wav/.flac/.ogg，ASCII不区分大小写）
+bool IsSupportedAudioFile(const std::string& name);
+
+// 只读内存映射文件（RAII），用于曲库目录等大文件的零拷贝访问
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile() { Close(); }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool Open(const std::string& pathUtf8);
+    void Close();
+    const std::uint8_t* Data() const { return m_data; }
+    size_t Size() const { return m_size; }
+
+private:
+    const std::uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+#ifdef _WIN32
+    void* m_file = nullptr;     // HANDLE
+    void* m_mapping = nullptr;  // HANDLE
+#endif
+};
+
+// 只读文件（RAII），按偏移定长读取（pread），用于只读取文件头/尾若干字节的场景（标签、时长探测）
+class FileReader {
+public:
+    FileReader() = default;
+    ~FileReader() { Close(); }
+    FileReader(const FileReader&) = delete;
+    FileReader& operator=(const FileReader&) = delete;
+
+    bool Open(const std::string& pathUtf8);
+    void Close();
+    std::uint64_t Size() const { return m_size; }
+    // 从offset处读取最多size字节，返回实际读取的字节数（越过文件末尾时较少）；可多线程并发调用
+    size_t ReadAt(std::uint64_t offset, void* buffer, size_t size) const;
+
+private:
+    std::uint64_t m_size = 0;
+#ifdef _WIN32
+    void* m_file = nullptr;     // HANDLE
+#else
+    int m_fd = -1;
+#endif
+};
+
+#ifdef _WIN32
+// UTF-8 <-> UTF-16 转换（仅Windows，供系统API和界面使用）
+std::wstring Utf8ToWide(std::string_view str);
+std::string WideToUtf8(std::wstring_view str);
+#endif
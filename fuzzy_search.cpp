@@ -0,0 +1,253 @@
+#include "fuzzy_search.h"
+#include "byte_search.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+namespace {
+
+// 得分参数（与fzf相同的量级）：每个匹配字符16分，间隔首字符-3、之后每字符-1
+constexpr int kScoreMatch = 16;
+constexpr int kGapStart = -3;
+constexpr int kGapExtension = -1;
+constexpr int kBonusBoundary = 8;       // 键首或分隔符之后
+constexpr int kBonusConsecutive = 4;    // 连续匹配至少获得的奖励（抵消一次间隔）
+constexpr int kBonusFirstCharMultiplier = 2;
+constexpr int kBonusSubstring = 64;     // 词（多个词时还有完整关键词）在检索键中连续出现
+
+bool IsSeparator(unsigned char c) {
+    switch (c) {
+        case ' ': case '-': case '_': case '.': case '/': case '\\': case '(': case ')': case '[': case ']':
+        case ',': case '&': case '+': case TrackTable::kKeyFieldSeparator:
+            return true;
+        default:
+            return false;
+    }
+}
+
+size_t Utf8CharBytes(unsigned char lead) {
+    if (lead < 0xC0) return 1; // ASCII或非法字节（按单字节处理）
+    if (lead < 0xE0) return 2;
+    if (lead < 0xF0) return 3;
+    return 4;
+}
+
+int BonusAt(std::string_view key, size_t pos) {
+    if (pos == 0) return kBonusBoundary;
+    return IsSeparator(static_cast<unsigned char>(key[pos - 1])) ? kBonusBoundary : 0;
+}
+
+bool CharAt(std::string_view key, size_t pos, const char* c, size_t bytes) {
+    return pos + bytes <= key.size() && std::memcmp(key.data() + pos, c, bytes) == 0;
+}
+
+// “更好”的命中：得分高者优先，同分时id小者（目录顺序）优先
+bool Better(const FuzzyHit& a, const FuzzyHit& b) {
+    return a.score != b.score ? a.score > b.score : a.id < b.id;
+}
+
+// 有界堆：堆顶为当前保留的最差命中，满时只有更好的命中才替换堆顶
+void PushBounded(std::vector<FuzzyHit>& heap, size_t k, FuzzyHit hit) {
+    if (heap.size() < k) {
+        heap.push_back(hit);
+        std::push_heap(heap.begin(), heap.end(), Better);
+    } else if (k > 0 && Better(hit, heap.front())) {
+        std::pop_heap(heap.begin(), heap.end(), Better);
+        heap.back() = hit;
+        std::push_heap(heap.begin(), heap.end(), Better);
+    }
+}
+
+} // namespace
+
+FuzzyPattern::FuzzyPattern(std::string_view foldedQuery) : m_query(foldedQuery) {
+    size_t i = 0;
+    while (i < foldedQuery.size()) {
+        while (i < foldedQuery.size() && foldedQuery[i] == ' ') ++i;
+        const size_t begin = i;
+        while (i < foldedQuery.size() && foldedQuery[i] != ' ') ++i;
+        if (i == begin) break;
+        Term term;
+        term.text.assign(foldedQuery.substr(begin, i - begin));
+        for (size_t k = 0; k < term.text.size();) {
+            const size_t bytes = std::min(Utf8CharBytes(static_cast<unsigned char>(term.text[k])), term.text.size() - k);
+            term.charBytes.push_back(static_cast<std::uint8_t>(bytes));
+            k += bytes;
+        }
+        m_mask |= TrackTable::ByteMask(term.text);
+        m_terms.push_back(std::move(term));
+    }
+}
+
+int FuzzyPattern::ScoreTerm(const Term& term, std::string_view key) const {
+    const char* text = term.text.data();
+    const size_t chars = term.charBytes.size();
+
+    // 1. 词在检索键中连续出现时，直接按该位置计分（子串命中优先于任何不连续的匹配）
+    size_t start;
+    int score = 0;
+    if (const char* hit = FindSubstring(key.data(), key.size(), term.text)) {
+        start = static_cast<size_t>(hit - key.data());
+        score = kBonusSubstring;
+    } else {
+        // 2. 正向：每个字符取最早的出现位置，确认能按顺序匹配，并得到匹配结束位置
+        size_t pos = 0;
+        for (size_t c = 0, offset = 0; c < chars; offset += term.charBytes[c++]) {
+            const size_t bytes = term.charBytes[c];
+            while (true) {
+                const void* found =
+                    pos < key.size() ? std::memchr(key.data() + pos, text[offset], key.size() - pos) : nullptr;
+                if (found == nullptr) return FuzzyPattern::kNoMatch;
+                pos = static_cast<size_t>(static_cast<const char*>(found) - key.data());
+                if (CharAt(key, pos, text + offset, bytes)) break;
+                ++pos;
+            }
+            pos += bytes;
+        }
+
+        // 3. 反向：从结束位置往回匹配，取最晚的起点，得到最短的匹配窗口
+        start = pos;
+        for (size_t c = chars, offset = term.text.size(); c > 0;) {
+            const size_t bytes = term.charBytes[--c];
+            offset -= bytes;
+            do {
+                --start;
+            } while (!CharAt(key, start, text + offset, bytes)); // 正向已确认存在，必然在窗口内找到
+        }
+    }
+
+    // 4. 从起点正向贪心匹配并计分
+    int runBonus = 0;       // 当前连续段首字符的奖励
+    bool consecutive = false;
+    bool inGap = false;
+    size_t c = 0;
+    size_t offset = 0;
+    for (size_t p = start; c < chars;) {
+        const size_t bytes = term.charBytes[c];
+        if (CharAt(key, p, text + offset, bytes)) {
+            int bonus = BonusAt(key, p);
+            if (!consecutive) {
+                runBonus = bonus;
+            } else {
+                if (bonus >= kBonusBoundary && bonus > runBonus) runBonus = bonus;
+                bonus = std::max(bonus, std::max(runBonus, kBonusConsecutive));
+            }
+            score += kScoreMatch + (c == 0 ? bonus * kBonusFirstCharMultiplier : bonus);
+            consecutive = true;
+            inGap = false;
+            p += bytes;
+            offset += bytes;
+            ++c;
+        } else {
+            score += inGap ? kGapExtension : kGapStart;
+            inGap = true;
+            consecutive = false;
+            p += Utf8CharBytes(static_cast<unsigned char>(key[p]));
+        }
+    }
+    return std::max(score, 0);
+}
+
+int FuzzyPattern::Score(std::string_view key) const {
+    int total = 0;
+    for (const Term& term : m_terms) {
+        const int score = ScoreTerm(term, key);
+        if (score == kNoMatch) return kNoMatch;
+        total += score;
+    }
+    if (m_terms.size() > 1 && FindSubstring(key.data(), key.size(), m_query) != nullptr) total += kBonusSubstring;
+    return total;
+}
+
+bool FuzzyRank(const TrackTable& table, const FuzzyPattern& pattern, const std::uint32_t* ids, size_t count,
+               const FuzzyOptions& options, std::vector<FuzzyHit>& top, std::vector<std::uint32_t>* matched) {
+    top.clear();
+    if (ids == nullptr) count = table.Size();
+    const size_t chunkSize = std::max<size_t>(options.chunkSize, 1);
+    const size_t chunks = (count + chunkSize - 1) / chunkSize;
+    unsigned threads = options.threadCount != 0 ? options.threadCount : std::thread::hardware_concurrency();
+    threads = static_cast<unsigned>(std::max<size_t>(1, std::min<size_t>(threads == 0 ? 1 : threads, chunks)));
+
+    // 每段的匹配结果单独存放，最后按段拼接以保持输入顺序；每个线程一个有界堆
+    std::vector<std::vector<std::uint32_t>> chunkMatches(matched != nullptr ? chunks : 0);
+    std::vector<std::vector<FuzzyHit>> heaps(threads);
+    std::atomic<size_t> nextChunk{0};
+    std::atomic<bool> cancelled{false};
+
+    auto work = [&](unsigned worker) {
+        std::vector<FuzzyHit>& heap = heaps[worker];
+        heap.reserve(std::min(options.topK, count) + 1);
+        while (true) {
+            const size_t chunk = nextChunk.fetch_add(1);
+            if (chunk >= chunks || cancelled.load()) break;
+            if (options.isCancelled && options.isCancelled()) {
+                cancelled.store(true);
+                break;
+            }
+            const size_t first = chunk * chunkSize;
+            const size_t last = std::min(count, first + chunkSize);
+            const std::uint64_t mask = pattern.Mask();
+            for (size_t i = first; i < last; ++i) {
+                const std::uint32_t id = ids != nullptr ? ids[i] : static_cast<std::uint32_t>(i);
+                if ((table.KeyMask(id) & mask) != mask) continue;
+                const int score = pattern.Score(table.SearchKey(id));
+                if (score == FuzzyPattern::kNoMatch) continue;
+                PushBounded(heap, options.topK, FuzzyHit{score, id});
+                if (matched != nullptr) chunkMatches[chunk].push_back(id);
+            }
+        }
+    };
+    if (threads == 1) {
+        work(0);
+    } else {
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1);
+        for (unsigned t = 1; t < threads; ++t) pool.emplace_back(work, t);
+        work(0);
+        for (auto& thread : pool) thread.join();
+    }
+    if (cancelled.load()) return false;
+
+    // 合并各线程的堆，取全局前topK并排序
+    for (auto& heap : heaps) top.insert(top.end(), heap.begin(), heap.end());
+    if (top.size() > options.topK) {
+        std::nth_element(top.begin(), top.begin() + options.topK, top.end(), Better);
+        top.resize(options.topK);
+    }
+    std::sort(top.begin(), top.end(), Better);
+    if (matched != nullptr) {
+        for (const auto& part : chunkMatches) matched->insert(matched->end(), part.begin(), part.end());
+    }
+    return true;
+}
+
+bool RankSearchResults(const TrackTable& table, std::string_view foldedQuery, std::vector<std::uint32_t>& ids,
+                       const FuzzyOptions& options) {
+    const FuzzyPattern pattern(foldedQuery);
+    if (pattern.Empty()) return true;
+
+    std::vector<FuzzyHit> top;
+    std::vector<std::uint32_t> matched;
+    if (ids.size() < options.topK) {
+        // 子串命中太少：对全表模糊匹配，匹配集合包含全部子串命中
+        if (!FuzzyRank(table, pattern, nullptr, 0, options, top, &matched)) return false;
+    } else {
+        if (!FuzzyRank(table, pattern, ids.data(), ids.size(), options, top, nullptr)) return false;
+        matched.swap(ids);
+    }
+
+    // 得分最高的在前，其余保持id升序
+    std::vector<std::uint32_t> topIds;
+    topIds.reserve(top.size());
+    for (const auto& hit : top) topIds.push_back(hit.id);
+    std::sort(topIds.begin(), topIds.end());
+    ids.clear();
+    ids.reserve(matched.size());
+    for (const auto& hit : top) ids.push_back(hit.id);
+    for (std::uint32_t id : matched) {
+        if (!std::binary_search(topIds.begin(), topIds.end(), id)) ids.push_back(id);
+    }
+    return true;
+}
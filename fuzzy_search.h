@@ -0,0 +1,61 @@
+// 模糊排序搜索（fzf风格）：关键词按空格拆分为若干词，每个词须按顺序（可不连续）出现在检索键中，
+// 词之间顺序不限。得分奖励词首/分隔符之后的匹配与连续匹配，惩罚中间的间隔
+// 多线程分段打分，每个线程只保留得分最高的topK首（有界堆），不对全部命中排序
+#pragma once
+
+#include "track_table.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct FuzzyHit {
+    int score = 0;
+    std::uint32_t id = 0;
+};
+
+struct FuzzyOptions {
+    size_t topK = 1000;                 // 按得分排在前面的曲目数
+    unsigned threadCount = 0;           // 工作线程数，0表示使用CPU核心数
+    std::uint32_t chunkSize = 1u << 14; // 每段的曲目数（线程间按段分配）
+    std::function<bool()> isCancelled;  // 可选：在各段之间检查，返回true时放弃本次排序
+};
+
+class FuzzyPattern {
+public:
+    static constexpr int kNoMatch = -1;
+
+    // foldedQuery为已折叠的关键词（text_fold）
+    explicit FuzzyPattern(std::string_view foldedQuery);
+
+    bool Empty() const { return m_terms.empty(); }
+    // 各词全部字节的掩码（TrackTable::ByteMask），检索键掩码不包含它时必然不匹配
+    std::uint64_t Mask() const { return m_mask; }
+
+    // 检索键的得分（非负），不匹配时返回kNoMatch；包含完整关键词（子串命中）的另加奖励
+    int Score(std::string_view key) const;
+
+private:
+    struct Term {
+        std::string text;
+        std::vector<std::uint8_t> charBytes; // 各字符（码点）的UTF-8字节数
+    };
+
+    int ScoreTerm(const Term& term, std::string_view key) const;
+
+    std::string m_query;
+    std::uint64_t m_mask = 0;
+    std::vector<Term> m_terms;
+};
+
+// 对ids[0, count)（ids为nullptr时为表中全部曲目）打分：top为得分最高的至多topK首（得分降序，同分按id升序），
+// matched非空时追加全部匹配的曲目id（与输入顺序相同）。被取消时返回false
+bool FuzzyRank(const TrackTable& table, const FuzzyPattern& pattern, const std::uint32_t* ids, size_t count,
+               const FuzzyOptions& options, std::vector<FuzzyHit>& top, std::vector<std::uint32_t>* matched);
+
+// 排列搜索结果：ids为子串命中的曲目（升序）。命中少于topK首时，再对全表做模糊匹配补充（漏字/词序不同）
+// 结果中得分最高的topK首按得分降序在前，其余按id升序在后。被取消时返回false（ids不变）
+bool RankSearchResults(const TrackTable& table, std::string_view foldedQuery, std::vector<std::uint32_t>& ids,
+                       const FuzzyOptions& options);
@@ -0,0 +1,360 @@
+#include "library_catalog.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <unordered_map>
+
+namespace fs = std::filesystem;
+
+static const char kCatalogMagic[8] = {'M', 'P', 'C', 'A', 'T', 'L', 'G', 0};
+
+// 段起始偏移按8字节对齐，保证映射后的记录可直接访问
+static std::uint64_t AlignUp(std::uint64_t value) {
+    return (value + 7) & ~static_cast<std::uint64_t>(7);
+}
+
+static std::uint32_t FindNameOffset(const std::string& path) {
+    const size_t pos = path.find_last_of("/\\");
+    return pos == std::string::npos ? 0 : static_cast<std::uint32_t>(pos + 1);
+}
+
+void LibraryCatalog::SortEntries(std::vector<CatalogEntry>& entries) {
+    std::sort(entries.begin(), entries.end(),
+              [](const CatalogEntry& a, const CatalogEntry& b) { return a.path < b.path; });
+}
+
+std::vector<std::uint8_t> LibraryCatalog::BuildImage(std::vector<CatalogEntry> entries,
+                                                     std::vector<CatalogDirEntry> dirs, std::uint64_t generation) {
+    SortEntries(entries);
+
+    // 1. 目录表：补齐根目录以及所有缺失的上级目录，排序后根目录（空路径）位于下标0
+    std::unordered_map<std::string, std::int64_t> dirMtimes;
+    dirMtimes.emplace(std::string(), 0);
+    for (auto& d : dirs) dirMtimes[d.path] = d.mtime;
+    auto ensureDir = [&dirMtimes](std::string_view path) {
+        while (dirMtimes.emplace(std::string(path), 0).second && !path.empty()) {
+            path = ParentOf(path);
+        }
+    };
+    for (auto& d : dirs) ensureDir(ParentOf(d.path));
+    for (auto& e : entries) ensureDir(ParentOf(e.path));
+
+    std::vector<std::string> dirPaths;
+    dirPaths.reserve(dirMtimes.size());
+    for (auto& kv : dirMtimes) dirPaths.push_back(kv.first);
+    std::sort(dirPaths.begin(), dirPaths.end());
+    std::unordered_map<std::string_view, std::uint32_t> dirIndex;
+    for (size_t i = 0; i < dirPaths.size(); ++i) {
+        dirIndex.emplace(dirPaths[i], static_cast<std::uint32_t>(i));
+    }
+
+    // 2. 字符串池与定长记录
+    std::vector<char> strings;
+    std::vector<CatalogDir> dirRecords(dirPaths.size());
+    for (size_t i = 0; i < dirPaths.size(); ++i) {
+        const std::string& path = dirPaths[i];
+        CatalogDir& d = dirRecords[i];
+        std::memset(&d, 0, sizeof(d));
+        d.mtime = dirMtimes[path];
+        d.pathOffset = static_cast<std::uint32_t>(strings.size());
+        d.pathLength = static_cast<std::uint32_t>(path.size());
+        d.parentIndex = path.empty() ? 0 : dirIndex[ParentOf(path)];
+        strings.insert(strings.end(), path.begin(), path.end());
+    }
+
+    std::vector<CatalogTrack> tracks(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const CatalogEntry& e = entries[i];
+        CatalogTrack& t = tracks[i];
+        std::memset(&t, 0, sizeof(t));
+        t.size = e.size;
+        t.mtime = e.mtime;
+        t.pathOffset = static_cast<std::uint32_t>(strings.size());
+        t.pathLength = static_cast<std::uint32_t>(e.path.size());
+        t.nameOffset = FindNameOffset(e.path);
+        t.dirIndex = dirIndex[ParentOf(e.path)];
+        strings.insert(strings.end(), e.path.begin(), e.path.end());
+    }
+
+    // 3. 标签列：文本去重（歌手/专辑/流派大量重复），列中只存下标
+    std::vector<char> tagStrings;
+    std::vector<CatalogTagRef> tagRefs(1, CatalogTagRef{0, 0});
+    std::unordered_map<std::string_view, std::uint32_t> tagIds;
+    std::vector<std::uint32_t> tagColumns(static_cast<size_t>(TAG_FIELD_COUNT) * entries.size(), 0);
+    std::vector<CatalogTagNumbers> tagNumbers(entries.size());
+    std::vector<std::uint32_t> durations(entries.size());
+    std::vector<CatalogFingerprint> fingerprints(entries.size());
+    std::vector<std::uint8_t> formats(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const TrackTags& tags = entries[i].tags;
+        for (std::uint32_t f = 0; f < TAG_FIELD_COUNT; ++f) {
+            const std::string& text = tags.text[f];
+            if (text.empty()) continue;
+            auto inserted = tagIds.emplace(text, static_cast<std::uint32_t>(tagRefs.size()));
+            if (inserted.second) {
+                tagRefs.push_back(CatalogTagRef{static_cast<std::uint32_t>(tagStrings.size()),
+                                                static_cast<std::uint32_t>(text.size())});
+                tagStrings.insert(tagStrings.end(), text.begin(), text.end());
+            }
+            tagColumns[f * entries.size() + i] = inserted.first->second;
+        }
+        tagNumbers[i].year = tags.year;
+        tagNumbers[i].trackNumber = tags.trackNumber;
+        durations[i] = entries[i].durationMs;
+        formats[i] = entries[i].format;
+        fingerprints[i].payloadSize = entries[i].fingerprint.payloadSize;
+        fingerprints[i].audioHash = entries[i].fingerprint.audioHash;
+        fingerprints[i].fileHash = entries[i].fingerprint.fileHash;
+    }
+
+    // 4. 布局：文件头 | 段表 | 各段数据
+    struct Pending { std::uint32_t id; const void* data; std::uint64_t size; };
+    const Pending pending[] = {
+        {CATALOG_SEC_TRACKS, tracks.data(), tracks.size() * sizeof(CatalogTrack)},
+        {CATALOG_SEC_DIRS, dirRecords.data(), dirRecords.size() * sizeof(CatalogDir)},
+        {CATALOG_SEC_STRINGS, strings.data(), strings.size()},
+        {CATALOG_SEC_TAG_COLUMNS, tagColumns.data(), tagColumns.size() * sizeof(std::uint32_t)},
+        {CATALOG_SEC_TAG_NUMBERS, tagNumbers.data(), tagNumbers.size() * sizeof(CatalogTagNumbers)},
+        {CATALOG_SEC_DURATIONS, durations.data(), durations.size() * sizeof(std::uint32_t)},
+        {CATALOG_SEC_FINGERPRINTS, fingerprints.data(), fingerprints.size() * sizeof(CatalogFingerprint)},
+        {CATALOG_SEC_FORMATS, formats.data(), formats.size()},
+        {CATALOG_SEC_TAG_REFS, tagRefs.data(), tagRefs.size() * sizeof(CatalogTagRef)},
+        {CATALOG_SEC_TAG_STRINGS, tagStrings.data(), tagStrings.size()},
+    };
+    const std::uint32_t sectionCount = sizeof(pending) / sizeof(pending[0]);
+
+    std::vector<CatalogSection> sections(sectionCount);
+    std::uint64_t offset = AlignUp(sizeof(CatalogHeader) + sectionCount * sizeof(CatalogSection));
+    for (std::uint32_t i = 0; i < sectionCount; ++i) {
+        sections[i].id = pending[i].id;
+        sections[i].reserved = 0;
+        sections[i].offset = offset;
+        sections[i].size = pending[i].size;
+        offset = AlignUp(offset + pending[i].size);
+    }
+
+    std::vector<std::uint8_t> image(offset, 0);
+    CatalogHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, kCatalogMagic, sizeof(kCatalogMagic));
+    header.version = kCatalogVersion;
+    header.sectionCount = sectionCount;
+    header.fileSize = offset;
+    header.generation = generation;
+    header.trackCount = static_cast<std::uint32_t>(entries.size());
+    header.dirCount = static_cast<std::uint32_t>(dirRecords.size());
+    std::memcpy(image.data(), &header, sizeof(header));
+    std::memcpy(image.data() + sizeof(header), sections.data(), sectionCount * sizeof(CatalogSection));
+    for (std::uint32_t i = 0; i < sectionCount; ++i) {
+        if (pending[i].size > 0) {
+            std::memcpy(image.data() + sections[i].offset, pending[i].data, pending[i].size);
+        }
+    }
+    return image;
+}
+
+static bool WriteCatalogFile(const std::uint8_t* data, size_t size, const std::string& pathUtf8) {
+    const fs::path target = fs::u8path(pathUtf8);
+    const fs::path tmp = fs::u8path(pathUtf8 + ".tmp");
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        if (!out) return false;
+        out.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+        if (!out) return false;
+    }
+    std::error_code ec;
+    fs::rename(tmp, target, ec);
+    if (ec) {
+        // Windows下旧文件仍被映射时无法替换，留待下次启动时替换
+        fs::rename(tmp, fs::u8path(pathUtf8 + ".new"), ec);
+        if (ec) return false;
+    }
+    return true;
+}
+
+bool LibraryCatalog::SaveImage(const std::vector<std::uint8_t>& image, const std::string& pathUtf8) {
+    return WriteCatalogFile(image.data(), image.size(), pathUtf8);
+}
+
+bool LibraryCatalog::SaveTo(const std::string& pathUtf8) const {
+    return WriteCatalogFile(m_data, m_size, pathUtf8);
+}
+
+std::shared_ptr<const LibraryCatalog> LibraryCatalog::Open(const std::string& pathUtf8) {
+    std::error_code ec;
+    const fs::path pendingNew = fs::u8path(pathUtf8 + ".new");
+    if (fs::exists(pendingNew, ec)) {
+        fs::rename(pendingNew, fs::u8path(pathUtf8), ec);
+    }
+
+    auto catalog = std::shared_ptr<LibraryCatalog>(new LibraryCatalog());
+    if (!catalog->m_file.Open(pathUtf8)) return nullptr;
+    if (!catalog->Attach(catalog->m_file.Data(), catalog->m_file.Size())) return nullptr;
+    return catalog;
+}
+
+std::shared_ptr<const LibraryCatalog> LibraryCatalog::FromImage(std::vector<std::uint8_t> image) {
+    auto catalog = std::shared_ptr<LibraryCatalog>(new LibraryCatalog());
+    catalog->m_image = std::move(image);
+    if (!catalog->Attach(catalog->m_image.data(), catalog->m_image.size())) return nullptr;
+    return catalog;
+}
+
+// 校验文件头和段表并定位各段；任何越界都视为损坏，调用方会退回全量扫描
+bool LibraryCatalog::Attach(const std::uint8_t* data, size_t size) {
+    if (size < sizeof(CatalogHeader)) return false;
+    CatalogHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, kCatalogMagic, sizeof(kCatalogMagic)) != 0) return false;
+    if (header.version != kCatalogVersion || header.fileSize != size) return false;
+    if (sizeof(CatalogHeader) + static_cast<std::uint64_t>(header.sectionCount) * sizeof(CatalogSection) > size) {
+        return false;
+    }
+
+    const auto* sections = reinterpret_cast<const CatalogSection*>(data + sizeof(CatalogHeader));
+    const CatalogSection* trackSec = nullptr;
+    const CatalogSection* stringSec = nullptr;
+    const CatalogSection* dirSec = nullptr;
+    const CatalogSection* tagStringSec = nullptr;
+    const CatalogSection* tagRefSec = nullptr;
+    const CatalogSection* tagColumnSec = nullptr;
+    const CatalogSection* tagNumberSec = nullptr;
+    const CatalogSection* durationSec = nullptr;
+    const CatalogSection* fingerprintSec = nullptr;
+    const CatalogSection* formatSec = nullptr;
+    for (std::uint32_t i = 0; i < header.sectionCount; ++i) {
+        const CatalogSection& sec = sections[i];
+        if (sec.offset > size || sec.size > size - sec.offset || (sec.offset & 7) != 0) return false;
+        if (sec.id == CATALOG_SEC_TRACKS) trackSec = &sec;
+        if (sec.id == CATALOG_SEC_STRINGS) stringSec = &sec;
+        if (sec.id == CATALOG_SEC_DIRS) dirSec = &sec;
+        if (sec.id == CATALOG_SEC_TAG_STRINGS) tagStringSec = &sec;
+        if (sec.id == CATALOG_SEC_TAG_REFS) tagRefSec = &sec;
+        if (sec.id == CATALOG_SEC_TAG_COLUMNS) tagColumnSec = &sec;
+        if (sec.id == CATALOG_SEC_TAG_NUMBERS) tagNumberSec = &sec;
+        if (sec.id == CATALOG_SEC_DURATIONS) durationSec = &sec;
+        if (sec.id == CATALOG_SEC_FINGERPRINTS) fingerprintSec = &sec;
+        if (sec.id == CATALOG_SEC_FORMATS) formatSec = &sec;
+    }
+    if (trackSec == nullptr || stringSec == nullptr || dirSec == nullptr) return false;
+    if (trackSec->size != static_cast<std::uint64_t>(header.trackCount) * sizeof(CatalogTrack)) return false;
+    if (dirSec->size != static_cast<std::uint64_t>(header.dirCount) * sizeof(CatalogDir)) return false;
+    if (header.dirCount == 0) return false; // 至少包含根目录
+
+    const auto* dirs = reinterpret_cast<const CatalogDir*>(data + dirSec->offset);
+    for (std::uint32_t i = 0; i < header.dirCount; ++i) {
+        const CatalogDir& d = dirs[i];
+        if (static_cast<std::uint64_t>(d.pathOffset) + d.pathLength > stringSec->size) return false;
+        if (d.parentIndex >= header.dirCount) return false;
+    }
+
+    const auto* tracks = reinterpret_cast<const CatalogTrack*>(data + trackSec->offset);
+    for (std::uint32_t i = 0; i < header.trackCount; ++i) {
+        const CatalogTrack& t = tracks[i];
+        if (static_cast<std::uint64_t>(t.pathOffset) + t.pathLength > stringSec->size) return false;
+        if (t.nameOffset > t.pathLength || t.dirIndex >= header.dirCount) return false;
+    }
+
+    // 标签段为可选：四段须同时存在且有效，否则视为没有标签
+    const CatalogTagRef* tagRefs = nullptr;
+    const std::uint32_t* tagColumns = nullptr;
+    const CatalogTagNumbers* tagNumbers = nullptr;
+    const char* tagStrings = nullptr;
+    if (tagStringSec != nullptr && tagRefSec != nullptr && tagColumnSec != nullptr && tagNumberSec != nullptr &&
+        tagRefSec->size >= sizeof(CatalogTagRef) && tagRefSec->size % sizeof(CatalogTagRef) == 0 &&
+        tagColumnSec->size == static_cast<std::uint64_t>(header.trackCount) * TAG_FIELD_COUNT * sizeof(std::uint32_t) &&
+        tagNumberSec->size == static_cast<std::uint64_t>(header.trackCount) * sizeof(CatalogTagNumbers)) {
+        tagRefs = reinterpret_cast<const CatalogTagRef*>(data + tagRefSec->offset);
+        tagColumns = reinterpret_cast<const std::uint32_t*>(data + tagColumnSec->offset);
+        tagNumbers = reinterpret_cast<const CatalogTagNumbers*>(data + tagNumberSec->offset);
+        tagStrings = reinterpret_cast<const char*>(data + tagStringSec->offset);
+        const std::uint64_t refCount = tagRefSec->size / sizeof(CatalogTagRef);
+        for (std::uint64_t i = 0; i < refCount; ++i) {
+            if (static_cast<std::uint64_t>(tagRefs[i].offset) + tagRefs[i].length > tagStringSec->size) return false;
+        }
+        const std::uint64_t cellCount = static_cast<std::uint64_t>(header.trackCount) * TAG_FIELD_COUNT;
+        for (std::uint64_t i = 0; i < cellCount; ++i) {
+            if (tagColumns[i] >= refCount) return false;
+        }
+    }
+
+    const std::uint32_t* durations = nullptr;
+    if (durationSec != nullptr && durationSec->size == static_cast<std::uint64_t>(header.trackCount) * 4) {
+        durations = reinterpret_cast<const std::uint32_t*>(data + durationSec->offset);
+    }
+    const CatalogFingerprint* fingerprints = nullptr;
+    if (fingerprintSec != nullptr &&
+        fingerprintSec->size == static_cast<std::uint64_t>(header.trackCount) * sizeof(CatalogFingerprint)) {
+        fingerprints = reinterpret_cast<const CatalogFingerprint*>(data + fingerprintSec->offset);
+    }
+    const std::uint8_t* formats = nullptr;
+    if (formatSec != nullptr && formatSec->size == header.trackCount) {
+        formats = data + formatSec->offset;
+    }
+
+    m_data = data;
+    m_size = size;
+    m_durations = durations;
+    m_fingerprints = fingerprints;
+    m_formats = formats;
+    m_tagRefs = tagRefs;
+    m_tagColumns = tagColumns;
+    m_tagNumbers = tagNumbers;
+    m_tagStrings = tagStrings;
+    m_tracks = tracks;
+    m_dirs = dirs;
+    m_dirCount = header.dirCount;
+    m_strings = reinterpret_cast<const char*>(data + stringSec->offset);
+    m_trackCount = header.trackCount;
+    m_generation = header.generation;
+    return true;
+}
+
+std::vector<CatalogEntry> LibraryCatalog::ToEntries() const {
+    std::vector<CatalogEntry> entries(m_trackCount);
+    for (std::uint32_t i = 0; i < m_trackCount; ++i) {
+        entries[i].path = std::string(TrackPath(i));
+        entries[i].size = TrackSize(i);
+        entries[i].mtime = TrackMtime(i);
+        entries[i].tags = GetTrackTags(i);
+        entries[i].durationMs = TrackDurationMs(i);
+        entries[i].format = TrackFormat(i);
+        entries[i].fingerprint = TrackFingerprint(i);
+    }
+    return entries;
+}
+
+std::uint32_t LibraryCatalog::FindTrack(std::string_view relPath) const {
+    std::uint32_t lo = 0;
+    std::uint32_t hi = m_trackCount;
+    while (lo < hi) {
+        const std::uint32_t mid = lo + (hi - lo) / 2;
+        if (TrackPath(mid) < relPath) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo < m_trackCount && TrackPath(lo) == relPath ? lo : kInvalidTrack;
+}
+
+TrackTags LibraryCatalog::GetTrackTags(std::uint32_t id) const {
+    TrackTags tags;
+    for (std::uint32_t f = 0; f < TAG_FIELD_COUNT; ++f) {
+        tags.text[f] = std::string(TrackTag(id, static_cast<TagField>(f)));
+    }
+    tags.year = TrackYear(id);
+    tags.trackNumber = TrackNumber(id);
+    return tags;
+}
+
+std::vector<CatalogDirEntry> LibraryCatalog::ToDirEntries() const {
+    std::vector<CatalogDirEntry> dirs(m_dirCount);
+    for (std::uint32_t i = 0; i < m_dirCount; ++i) {
+        dirs[i].path = std::string(DirPath(i));
+        dirs[i].mtime = DirMtime(i);
+    }
+    return dirs;
+}
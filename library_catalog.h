@@ -0,0 +1,222 @@
+// 持久化曲库目录：固定布局的二进制文件（文件头 + 段表 + 定长记录 + 字符串池）
+// 启动时直接mmap，映射区域本身就是曲目表，无需反序列化
+#pragma once
+
+#include "audio_fingerprint.h"
+#include "fs_util.h"
+#include "media_probe.h"
+#include "tag_reader.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// 格式不兼容变更时递增；新增段不需要递增（读取方忽略未知段）
+constexpr std::uint32_t kCatalogVersion = 2;
+
+// 段ID
+enum CatalogSectionId : std::uint32_t {
+    CATALOG_SEC_STRINGS = 1,  // 字符串池（UTF-8，无结尾0）
+    CATALOG_SEC_TRACKS  = 2,  // CatalogTrack数组，按相对路径字节序排序
+    CATALOG_SEC_DIRS    = 3,  // CatalogDir数组，按相对路径字节序排序（根目录路径为空，下标0）
+    // 标签列存储：文本去重后存一份，每个字段一列，列中只存文本下标
+    CATALOG_SEC_TAG_STRINGS = 4,  // 标签文本池（UTF-8，无结尾0）
+    CATALOG_SEC_TAG_REFS    = 5,  // CatalogTagRef数组（去重后的文本），下标0为空串
+    CATALOG_SEC_TAG_COLUMNS = 6,  // TAG_FIELD_COUNT列，每列trackCount个uint32文本下标，按TagField顺序排列
+    CATALOG_SEC_TAG_NUMBERS = 7,  // CatalogTagNumbers数组（与曲目一一对应）
+    CATALOG_SEC_DURATIONS   = 8,  // uint32时长（毫秒，0表示未知），与曲目一一对应
+    CATALOG_SEC_FINGERPRINTS = 9, // CatalogFingerprint数组（音频内容指纹），与曲目一一对应
+    CATALOG_SEC_FORMATS     = 10, // uint8 AudioFormat（按文件内容识别的容器格式），与曲目一一对应
+};
+
+// 以下结构体直接映射文件内容，字段均自然对齐，勿随意调整顺序
+struct CatalogHeader {
+    char magic[8];              // "MPCATLG"
+    std::uint32_t version;
+    std::uint32_t sectionCount;
+    std::uint64_t fileSize;     // 用于检测截断
+    std::uint64_t generation;   // 目录版本号，每次内容变化递增
+    std::uint32_t trackCount;
+    std::uint32_t dirCount;
+    std::uint32_t reserved[6];
+};
+
+struct CatalogSection {
+    std::uint32_t id;
+    std::uint32_t reserved;
+    std::uint64_t offset;       // 相对文件头
+    std::uint64_t size;
+};
+
+struct CatalogTrack {
+    std::uint64_t size;         // 文件大小
+    std::int64_t mtime;         // 修改时间（平台原生刻度）
+    std::uint32_t pathOffset;   // 相对路径在字符串池中的偏移
+    std::uint32_t pathLength;
+    std::uint32_t nameOffset;   // 文件名在相对路径中的起始位置
+    std::uint32_t dirIndex;     // 所属目录在CatalogDir数组中的下标
+};
+
+struct CatalogDir {
+    std::int64_t mtime;         // 目录修改时间（子项增删会改变它）
+    std::uint32_t pathOffset;
+    std::uint32_t pathLength;
+    std::uint32_t parentIndex;  // 根目录指向自身
+    std::uint32_t reserved;
+};
+
+struct CatalogTagRef {
+    std::uint32_t offset;       // 在标签文本池中的偏移
+    std::uint32_t length;
+};
+
+struct CatalogTagNumbers {
+    std::uint16_t year;
+    std::uint16_t trackNumber;
+};
+
+struct CatalogFingerprint {
+    std::uint64_t payloadSize;  // 含义同AudioFingerprint
+    std::uint64_t audioHash;
+    std::uint64_t fileHash;
+};
+
+static_assert(sizeof(CatalogHeader) == 64, "CatalogHeader layout");
+static_assert(sizeof(CatalogSection) == 24, "CatalogSection layout");
+static_assert(sizeof(CatalogTrack) == 32, "CatalogTrack layout");
+static_assert(sizeof(CatalogDir) == 24, "CatalogDir layout");
+static_assert(sizeof(CatalogTagRef) == 8, "CatalogTagRef layout");
+static_assert(sizeof(CatalogTagNumbers) == 4, "CatalogTagNumbers layout");
+static_assert(sizeof(CatalogFingerprint) == 24, "CatalogFingerprint layout");
+
+// 构建目录时使用的单曲描述（路径相对music根目录）
+struct CatalogEntry {
+    std::string path;
+    std::uint64_t size = 0;
+    std::int64_t mtime = 0;
+    TrackTags tags;
+    std::uint32_t durationMs = 0;
+    AudioFormat format = AUDIO_FORMAT_UNKNOWN;
+    AudioFingerprint fingerprint;
+};
+
+// 构建目录时使用的目录描述（路径相对music根目录，根目录为空串）
+struct CatalogDirEntry {
+    std::string path;
+    std::int64_t mtime = 0;
+};
+
+// 只读目录快照：可由mmap文件或内存镜像承载，创建后不可修改，可跨线程共享
+class LibraryCatalog {
+public:
+    // 打开并校验目录文件；若存在上次未能替换的新版本（.new）会先尝试替换
+    static std::shared_ptr<const LibraryCatalog> Open(const std::string& pathUtf8);
+    // 从内存镜像创建（BuildImage的结果）
+    static std::shared_ptr<const LibraryCatalog> FromImage(std::vector<std::uint8_t> image);
+
+    // 把条目序列化为目录镜像（会按路径排序）
+    // dirs中缺失的上级目录会自动补齐（mtime记为0，下次重扫时必然重新列举）
+    static std::vector<std::uint8_t> BuildImage(std::vector<CatalogEntry> entries, std::vector<CatalogDirEntry> dirs,
+                                                std::uint64_t generation);
+    // 原子写入：先写临时文件再重命名；目标被映射占用（Windows）时保留为.new，下次启动时替换
+    static bool SaveImage(const std::vector<std::uint8_t>& image, const std::string& pathUtf8);
+
+    // 把当前快照写入文件（写入方式同SaveImage）
+    bool SaveTo(const std::string& pathUtf8) const;
+
+    // 条目按路径排序（与目录内曲目顺序一致）
+    static void SortEntries(std::vector<CatalogEntry>& entries);
+
+    std::uint32_t TrackCount() const { return m_trackCount; }
+    std::uint64_t Generation() const { return m_generation; }
+
+    std::string_view TrackPath(std::uint32_t id) const {
+        const CatalogTrack& t = m_tracks[id];
+        return std::string_view(m_strings + t.pathOffset, t.pathLength);
+    }
+    std::string_view TrackName(std::uint32_t id) const {
+        const CatalogTrack& t = m_tracks[id];
+        return std::string_view(m_strings + t.pathOffset + t.nameOffset, t.pathLength - t.nameOffset);
+    }
+    std::uint64_t TrackSize(std::uint32_t id) const { return m_tracks[id].size; }
+    std::int64_t TrackMtime(std::uint32_t id) const { return m_tracks[id].mtime; }
+    std::uint32_t TrackDir(std::uint32_t id) const { return m_tracks[id].dirIndex; }
+
+    // 标签（旧版目录没有标签段时全部为空，重扫时会补读）
+    bool HasTags() const { return m_tagColumns != nullptr; }
+    // 去重后的文本下标：相同文本的下标相同（0为空串），可直接用于分组/比较
+    std::uint32_t TrackTagId(std::uint32_t id, TagField field) const {
+        return m_tagColumns != nullptr ? m_tagColumns[static_cast<size_t>(field) * m_trackCount + id] : 0;
+    }
+    std::string_view TagText(std::uint32_t tagId) const {
+        if (m_tagRefs == nullptr) return std::string_view();
+        return std::string_view(m_tagStrings + m_tagRefs[tagId].offset, m_tagRefs[tagId].length);
+    }
+    std::string_view TrackTag(std::uint32_t id, TagField field) const { return TagText(TrackTagId(id, field)); }
+    std::uint16_t TrackYear(std::uint32_t id) const { return m_tagNumbers != nullptr ? m_tagNumbers[id].year : 0; }
+    std::uint16_t TrackNumber(std::uint32_t id) const {
+        return m_tagNumbers != nullptr ? m_tagNumbers[id].trackNumber : 0;
+    }
+    TrackTags GetTrackTags(std::uint32_t id) const;
+
+    // 时长（毫秒，扫描时探测，0表示未知）
+    bool HasDurations() const { return m_durations != nullptr; }
+    std::uint32_t TrackDurationMs(std::uint32_t id) const { return m_durations != nullptr ? m_durations[id] : 0; }
+
+    // 按文件内容识别的容器格式（旧版目录没有此列时返回AUDIO_FORMAT_UNKNOWN）
+    bool HasFormats() const { return m_formats != nullptr; }
+    AudioFormat TrackFormat(std::uint32_t id) const {
+        return m_formats != nullptr ? static_cast<AudioFormat>(m_formats[id]) : AUDIO_FORMAT_UNKNOWN;
+    }
+
+    // 音频内容指纹（由DuplicateFinder补全；文件变化后清零，等待重新计算）
+    bool HasFingerprints() const { return m_fingerprints != nullptr; }
+    AudioFingerprint TrackFingerprint(std::uint32_t id) const {
+        AudioFingerprint fp;
+        if (m_fingerprints != nullptr) {
+            fp.payloadSize = m_fingerprints[id].payloadSize;
+            fp.audioHash = m_fingerprints[id].audioHash;
+            fp.fileHash = m_fingerprints[id].fileHash;
+        }
+        return fp;
+    }
+
+    // 按相对路径查找曲目（曲目按路径排序，二分查找）；不存在时返回kInvalidTrack
+    static constexpr std::uint32_t kInvalidTrack = 0xffffffffu;
+    std::uint32_t FindTrack(std::string_view relPath) const;
+
+    std::uint32_t DirCount() const { return m_dirCount; }
+    std::string_view DirPath(std::uint32_t index) const {
+        const CatalogDir& d = m_dirs[index];
+        return std::string_view(m_strings + d.pathOffset, d.pathLength);
+    }
+    std::int64_t DirMtime(std::uint32_t index) const { return m_dirs[index].mtime; }
+    std::uint32_t DirParent(std::uint32_t index) const { return m_dirs[index].parentIndex; }
+
+    // 导出为可修改的条目列表
+    std::vector<CatalogEntry> ToEntries() const;
+    std::vector<CatalogDirEntry> ToDirEntries() const;
+
+private:
+    bool Attach(const std::uint8_t* data, size_t size);
+
+    MappedFile m_file;                  // mmap承载
+    std::vector<std::uint8_t> m_image;  // 内存镜像承载
+    const std::uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    const CatalogTrack* m_tracks = nullptr;
+    const CatalogDir* m_dirs = nullptr;
+    const char* m_strings = nullptr;
+    const CatalogTagRef* m_tagRefs = nullptr;
+    const char* m_tagStrings = nullptr;
+    const std::uint32_t* m_tagColumns = nullptr;
+    const CatalogTagNumbers* m_tagNumbers = nullptr;
+    const std::uint32_t* m_durations = nullptr;
+    const CatalogFingerprint* m_fingerprints = nullptr;
+    const std::uint8_t* m_formats = nullptr;
+    std::uint32_t m_trackCount = 0;
+    std::uint32_t m_dirCount = 0;
+    std::uint64_t m_generation = 0;
+};
@@ -0,0 +1,327 @@
+#include "library_rescan.h"
+#include "fs_util.h"
+#include "media_probe.h"
+
+#include <algorithm>
+#include <chrono>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+namespace {
+
+// 单个已知目录的检查结果
+enum DirState : std::uint8_t {
+    DIR_UNCHANGED,
+    DIR_CHANGED,    // mtime变化，已重新列举
+    DIR_REMOVED,
+};
+
+// 每个工作线程的局部结果，结束后统一合并，避免热路径加锁
+struct LocalResult {
+    RescanDelta delta;
+    std::vector<std::uint32_t> removedIds;
+    std::vector<std::pair<std::uint32_t, CatalogEntry>> modifiedIds;
+    std::vector<std::string> newDirRoots;   // 相对路径
+    std::vector<std::uint32_t> vanishedDirs; // 重新列举时发现已不存在的已知子目录
+    RescanStats stats;
+};
+
+// 只有路径与stat信息的条目（标签、时长等由之后的探测填写）
+CatalogEntry StatEntry(std::string path, std::uint64_t size, std::int64_t mtime) {
+    CatalogEntry entry;
+    entry.path = std::move(path);
+    entry.size = size;
+    entry.mtime = mtime;
+    return entry;
+}
+
+// 并行探测targets的格式、标签与时长（新增/修改的文件，或从旧版目录升级时的全部文件）
+void ProbeFilesParallel(const std::string& root, const std::vector<CatalogEntry*>& targets, unsigned threadCount,
+                      const std::atomic<bool>& cancelled) {
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        while (!cancelled.load(std::memory_order_relaxed)) {
+            const size_t i = next.fetch_add(1);
+            if (i >= targets.size()) break;
+            CatalogEntry& target = *targets[i];
+            ProbeTrackFile(JoinPath(root, target.path), target.tags, target.durationMs, target.format);
+        }
+    };
+    threadCount = static_cast<unsigned>(std::min<size_t>(threadCount, targets.size()));
+    std::vector<std::thread> threads;
+    for (unsigned i = 1; i < threadCount; ++i) threads.emplace_back(worker);
+    worker();
+    for (auto& t : threads) t.join();
+}
+
+} // namespace
+
+RescanResult LibraryRescanner::Rescan(const std::string& rootUtf8, const LibraryCatalog& previous,
+                                      const RescanOptions& options) {
+    RescanResult result;
+    const auto start = std::chrono::steady_clock::now();
+    const std::string root = TrimTrailingSeparators(rootUtf8);
+    const std::uint32_t dirCount = previous.DirCount();
+    const std::uint32_t trackCount = previous.TrackCount();
+
+    // 1. 按目录归类已知曲目（计数排序），并建立已知目录路径集合
+    std::vector<std::uint32_t> dirTrackBegin(dirCount + 1, 0);
+    for (std::uint32_t id = 0; id < trackCount; ++id) ++dirTrackBegin[previous.TrackDir(id) + 1];
+    for (std::uint32_t d = 0; d < dirCount; ++d) dirTrackBegin[d + 1] += dirTrackBegin[d];
+    std::vector<std::uint32_t> dirTracks(trackCount);
+    {
+        std::vector<std::uint32_t> cursor(dirTrackBegin.begin(), dirTrackBegin.end() - 1);
+        for (std::uint32_t id = 0; id < trackCount; ++id) dirTracks[cursor[previous.TrackDir(id)]++] = id;
+    }
+    // 已知目录的直接子目录（同样用计数排序，根目录的parent指向自身需排除）
+    std::vector<std::uint32_t> dirChildBegin(dirCount + 1, 0);
+    for (std::uint32_t d = 1; d < dirCount; ++d) ++dirChildBegin[previous.DirParent(d) + 1];
+    for (std::uint32_t d = 0; d < dirCount; ++d) dirChildBegin[d + 1] += dirChildBegin[d];
+    std::vector<std::uint32_t> dirChildren(dirChildBegin[dirCount]);
+    {
+        std::vector<std::uint32_t> cursor(dirChildBegin.begin(), dirChildBegin.end() - 1);
+        for (std::uint32_t d = 1; d < dirCount; ++d) dirChildren[cursor[previous.DirParent(d)]++] = d;
+    }
+    std::unordered_map<std::string_view, std::uint32_t> knownDirs;
+    knownDirs.reserve(dirCount);
+    for (std::uint32_t d = 0; d < dirCount; ++d) knownDirs.emplace(previous.DirPath(d), d);
+
+    // 待检查的目录：默认全部，指定dirtyDirs时只检查其中的已知目录
+    const bool filtered = !options.dirtyDirs.empty();
+    std::vector<std::uint32_t> workList;
+    if (filtered) {
+        std::vector<std::uint8_t> queued(dirCount, 0);
+        for (const auto& path : options.dirtyDirs) {
+            auto it = knownDirs.find(path);
+            if (it == knownDirs.end() || queued[it->second]) continue;
+            queued[it->second] = 1;
+            workList.push_back(it->second);
+        }
+    } else {
+        workList.resize(dirCount);
+        for (std::uint32_t d = 0; d < dirCount; ++d) workList[d] = d;
+    }
+
+    // 2. 并行检查每个待查目录（目录表是扁平的，无需递归）
+    std::vector<DirState> states(dirCount, DIR_UNCHANGED);
+    std::vector<std::int64_t> newMtimes(dirCount, 0);
+    for (std::uint32_t d = 0; d < dirCount; ++d) newMtimes[d] = previous.DirMtime(d);
+    unsigned threadCount = options.threadCount;
+    if (threadCount == 0) threadCount = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<LocalResult> locals(threadCount);
+    std::atomic<size_t> nextWork{0};
+
+    auto worker = [&](unsigned self) {
+        LocalResult& local = locals[self];
+        std::vector<std::string> names;
+        std::vector<FileStat> stats;
+        std::vector<DirEntry> entries;
+        while (!m_cancelled.load(std::memory_order_relaxed)) {
+            const size_t w = nextWork.fetch_add(1);
+            if (w >= workList.size()) break;
+            const std::uint32_t d = workList[w];
+            const std::string_view relDir = previous.DirPath(d);
+            const std::string fullDir = relDir.empty() ? root : JoinPath(root, std::string(relDir));
+            const std::uint32_t* tracksBegin = dirTracks.data() + dirTrackBegin[d];
+            const std::uint32_t* tracksEnd = dirTracks.data() + dirTrackBegin[d + 1];
+            ++local.stats.dirsChecked;
+
+            FileStat dirStat;
+            if (!StatPath(fullDir, dirStat) || !dirStat.isDir) {
+                states[d] = DIR_REMOVED;
+                for (const std::uint32_t* it = tracksBegin; it != tracksEnd; ++it) {
+                    local.removedIds.push_back(*it);
+                    local.delta.removed.emplace_back(previous.TrackPath(*it));
+                }
+                continue;
+            }
+            newMtimes[d] = dirStat.mtime;
+
+            if (dirStat.mtime == previous.DirMtime(d) && !filtered) {
+                // 目录项未增删：不列举目录，仅按需核对已知文件
+                states[d] = DIR_UNCHANGED;
+                ++local.stats.dirsSkipped;
+                if (!options.verifyFiles || tracksBegin == tracksEnd) continue;
+                names.clear();
+                for (const std::uint32_t* it = tracksBegin; it != tracksEnd; ++it) {
+                    names.emplace_back(previous.TrackName(*it));
+                }
+                StatChildren(fullDir, names, stats);
+                local.stats.filesChecked += names.size();
+                for (size_t i = 0; i < names.size(); ++i) {
+                    const std::uint32_t id = tracksBegin[i];
+                    if (!stats[i].exists || stats[i].isDir) {
+                        local.removedIds.push_back(id);
+                        local.delta.removed.emplace_back(previous.TrackPath(id));
+                    } else if (stats[i].size != previous.TrackSize(id) || stats[i].mtime != previous.TrackMtime(id)) {
+                        local.modifiedIds.emplace_back(
+                            id, StatEntry(std::string(previous.TrackPath(id)), stats[i].size, stats[i].mtime));
+                    }
+                }
+                continue;
+            }
+
+            // 目录项有变化：重新列举并与已知子项比较
+            states[d] = DIR_CHANGED;
+            ++local.stats.dirsListed;
+            if (!ListDirectory(fullDir, entries)) {
+                newMtimes[d] = previous.DirMtime(d); // 列举失败时保持原状，下次重试
+                continue;
+            }
+            std::unordered_map<std::string_view, std::uint32_t> known;
+            for (const std::uint32_t* it = tracksBegin; it != tracksEnd; ++it) {
+                known.emplace(previous.TrackName(*it), *it);
+            }
+            std::vector<std::uint8_t> childSeen(dirChildBegin[d + 1] - dirChildBegin[d], 0);
+            for (const auto& entry : entries) {
+                const std::string relPath = relDir.empty() ? entry.name : JoinPath(std::string(relDir), entry.name);
+                if (entry.isDir) {
+                    auto dirIt = knownDirs.find(relPath);
+                    if (dirIt == knownDirs.end()) {
+                        local.newDirRoots.push_back(relPath);
+                    } else if (previous.DirParent(dirIt->second) == d) {
+                        const std::uint32_t* first = dirChildren.data() + dirChildBegin[d];
+                        const std::uint32_t* last = dirChildren.data() + dirChildBegin[d + 1];
+                        const std::uint32_t* pos = std::lower_bound(first, last, dirIt->second);
+                        if (pos != last && *pos == dirIt->second) childSeen[pos - first] = 1;
+                    }
+                    continue;
+                }
+                if (!IsSupportedAudioFile(entry.name)) continue;
+                auto it = known.find(entry.name);
+                if (it == known.end()) {
+                    local.delta.added.push_back(StatEntry(relPath, entry.size, entry.mtime));
+                    continue;
+                }
+                const std::uint32_t id = it->second;
+                known.erase(it);
+                if (entry.size != previous.TrackSize(id) || entry.mtime != previous.TrackMtime(id)) {
+                    local.modifiedIds.emplace_back(id, StatEntry(relPath, entry.size, entry.mtime));
+                }
+            }
+            for (const auto& kv : known) {
+                local.removedIds.push_back(kv.second);
+                local.delta.removed.emplace_back(previous.TrackPath(kv.second));
+            }
+            for (size_t i = 0; i < childSeen.size(); ++i) {
+                if (!childSeen[i]) local.vanishedDirs.push_back(dirChildren[dirChildBegin[d] + i]);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned i = 1; i < threadCount; ++i) threads.emplace_back(worker, i);
+    worker(0);
+    for (auto& t : threads) t.join();
+
+    // 列举时已不存在的子目录，以及被删除目录的所有已知子目录，一并视为删除
+    // （整棵子树被移走时子目录不会单独产生事件）。目录表按路径排序，上级目录总在子目录之前，一趟即可传递
+    LocalResult& first = locals[0];
+    auto removeDir = [&](std::uint32_t d) {
+        states[d] = DIR_REMOVED;
+        for (std::uint32_t i = dirTrackBegin[d]; i < dirTrackBegin[d + 1]; ++i) {
+            first.removedIds.push_back(dirTracks[i]);
+            first.delta.removed.emplace_back(previous.TrackPath(dirTracks[i]));
+        }
+    };
+    for (auto& local : locals) {
+        for (std::uint32_t d : local.vanishedDirs) {
+            if (states[d] != DIR_REMOVED) removeDir(d);
+        }
+    }
+    for (std::uint32_t d = 1; d < dirCount && !m_cancelled.load(); ++d) {
+        if (states[d] != DIR_REMOVED && states[previous.DirParent(d)] == DIR_REMOVED) removeDir(d);
+    }
+
+    // 3. 合并各线程结果
+    std::vector<std::uint32_t> removedIds;
+    std::vector<std::pair<std::uint32_t, CatalogEntry>> modifiedIds;
+    std::vector<std::string> newDirRoots;
+    for (auto& local : locals) {
+        auto append = [](auto& dst, auto& src) {
+            dst.insert(dst.end(), std::make_move_iterator(src.begin()), std::make_move_iterator(src.end()));
+        };
+        append(result.delta.added, local.delta.added);
+        append(result.delta.removed, local.delta.removed);
+        append(removedIds, local.removedIds);
+        append(modifiedIds, local.modifiedIds);
+        append(newDirRoots, local.newDirRoots);
+        result.stats.dirsChecked += local.stats.dirsChecked;
+        result.stats.dirsListed += local.stats.dirsListed;
+        result.stats.dirsSkipped += local.stats.dirsSkipped;
+        result.stats.filesChecked += local.stats.filesChecked;
+    }
+
+    // 4. 新出现的目录：整棵子树交给并行扫描器
+    std::vector<CatalogDirEntry> newDirs;
+    ScanOptions scanOptions;
+    scanOptions.threadCount = threadCount;
+    for (const auto& relRoot : newDirRoots) {
+        if (m_cancelled.load()) break;
+        m_subtreeScanner.Scan(JoinPath(root, relRoot), scanOptions,
+                              [&](std::vector<ScannedFile>& batch, std::vector<ScannedDir>& dirs) {
+            for (const auto& file : batch) {
+                result.delta.added.push_back(StatEntry(RelativePath(root, file.path), file.size, file.mtime));
+            }
+            for (const auto& dir : dirs) {
+                newDirs.push_back(CatalogDirEntry{RelativePath(root, dir.path), dir.mtime});
+            }
+        });
+    }
+    result.stats.dirsNew = newDirs.size();
+
+    // 新增/修改的文件读取标签、探测时长，之后再生成delta.modified，使其带有这些信息
+    std::vector<CatalogEntry*> probeTargets;
+    for (auto& entry : result.delta.added) probeTargets.push_back(&entry);
+    for (auto& kv : modifiedIds) probeTargets.push_back(&kv.second);
+    ProbeFilesParallel(root, probeTargets, threadCount, m_cancelled);
+    for (const auto& kv : modifiedIds) result.delta.modified.push_back(kv.second);
+    // 基准目录来自缺少标签/时长/格式段的旧版本：补充探测全部已有文件
+    const bool upgradeProbe = (!previous.HasTags() || !previous.HasDurations() || !previous.HasFormats()) &&
+                              trackCount > 0;
+
+    // 5. 有任何变化（包括仅目录mtime变化）时组装完整的新条目/目录列表
+    bool dirsChanged = !newDirs.empty();
+    for (std::uint32_t d = 0; d < dirCount && !dirsChanged; ++d) {
+        dirsChanged = states[d] != DIR_UNCHANGED;
+    }
+    result.changed = !m_cancelled.load() && (dirsChanged || upgradeProbe || !result.delta.Empty());
+    if (result.changed) {
+        std::vector<std::uint8_t> drop(trackCount, 0);
+        for (std::uint32_t id : removedIds) drop[id] = 1;
+        std::unordered_map<std::uint32_t, CatalogEntry*> modifiedById;
+        for (auto& kv : modifiedIds) modifiedById.emplace(kv.first, &kv.second);
+
+        result.entries.reserve(trackCount + result.delta.added.size());
+        for (std::uint32_t id = 0; id < trackCount; ++id) {
+            if (drop[id]) continue;
+            auto it = modifiedById.find(id);
+            if (it != modifiedById.end()) {
+                result.entries.push_back(*it->second);
+            } else {
+                result.entries.push_back(CatalogEntry{std::string(previous.TrackPath(id)), previous.TrackSize(id),
+                                                      previous.TrackMtime(id), previous.GetTrackTags(id),
+                                                      previous.TrackDurationMs(id), previous.TrackFormat(id),
+                                                      previous.TrackFingerprint(id)});
+            }
+        }
+        if (upgradeProbe) {
+            probeTargets.clear();
+            for (auto& entry : result.entries) probeTargets.push_back(&entry);
+            ProbeFilesParallel(root, probeTargets, threadCount, m_cancelled);
+            if (m_cancelled.load()) result.changed = false;
+        }
+        result.entries.insert(result.entries.end(), result.delta.added.begin(), result.delta.added.end());
+
+        result.dirs.reserve(dirCount + newDirs.size());
+        for (std::uint32_t d = 0; d < dirCount; ++d) {
+            if (states[d] == DIR_REMOVED) continue;
+            result.dirs.push_back(CatalogDirEntry{std::string(previous.DirPath(d)), newMtimes[d]});
+        }
+        result.dirs.insert(result.dirs.end(), newDirs.begin(), newDirs.end());
+    }
+
+    result.stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
@@ -0,0 +1,62 @@
+// 增量重扫：基于上次的目录快照，比较目录/文件的mtime与大小，只处理发生变化的部分
+// 目录mtime不变说明其直接子项没有增删，此时不再列举目录（可选地逐个核对已知文件）
+#pragma once
+
+#include "library_catalog.h"
+#include "library_scanner.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct RescanOptions {
+    unsigned threadCount = 0;   // 工作线程数，0表示使用CPU核心数
+    bool verifyFiles = true;    // 目录未变化时是否核对已知文件的大小/mtime（检测原地修改，例如改标签）
+    // 非空时只检查这些目录（相对路径，通常来自文件监视），且无论mtime是否变化都重新列举；
+    // 其余已知目录视为未变化。未知路径会被忽略（新目录由其上级目录的列举发现）
+    std::vector<std::string> dirtyDirs;
+};
+
+// 相对上次快照的变化（路径均相对music根目录）
+struct RescanDelta {
+    std::vector<CatalogEntry> added;
+    std::vector<CatalogEntry> modified;
+    std::vector<std::string> removed;
+
+    bool Empty() const { return added.empty() && modified.empty() && removed.empty(); }
+};
+
+struct RescanStats {
+    std::uint64_t dirsChecked = 0;   // stat过的已知目录
+    std::uint64_t dirsListed = 0;    // 因mtime变化而重新列举的目录
+    std::uint64_t dirsSkipped = 0;   // mtime未变、跳过列举的目录
+    std::uint64_t dirsNew = 0;       // 新出现的目录（全量扫描其子树）
+    std::uint64_t filesChecked = 0;  // 核对过大小/mtime的已知文件
+    double seconds = 0.0;
+};
+
+struct RescanResult {
+    RescanDelta delta;
+    bool changed = false;                  // 是否需要写回目录（包括仅目录mtime变化的情况）
+    std::vector<CatalogEntry> entries;     // changed时为完整的新条目列表
+    std::vector<CatalogDirEntry> dirs;     // changed时为完整的新目录列表
+    RescanStats stats;
+};
+
+class LibraryRescanner {
+public:
+    // 以previous为基准增量重扫rootUtf8（阻塞调用）
+    RescanResult Rescan(const std::string& rootUtf8, const LibraryCatalog& previous, const RescanOptions& options);
+
+    // 请求取消（可从任意线程调用）；取消后的结果不完整，调用方应丢弃
+    void Cancel() {
+        m_cancelled.store(true);
+        m_subtreeScanner.Cancel();
+    }
+    bool IsCancelled() const { return m_cancelled.load(); }
+
+private:
+    std::atomic<bool> m_cancelled{false};
+    LibraryScanner m_subtreeScanner;   // 扫描新出现的子树
+};
@@ -0,0 +1,171 @@
+#include "library_scanner.h"
+#include "fs_util.h"
+#include "media_probe.h"
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+// 每个工作线程一个目录队列：自己从尾部取（LIFO，局部性好），其他线程从头部窃取
+struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<ScannedDir> dirs;
+};
+
+class ScanJob {
+public:
+    ScanJob(unsigned threadCount, const ScanOptions& options, const ScanBatchCallback& onBatch,
+            const std::atomic<bool>& cancelled)
+        : m_options(options), m_onBatch(onBatch), m_cancelled(cancelled) {
+        for (unsigned i = 0; i < threadCount; ++i) {
+            m_queues.push_back(std::make_unique<WorkerQueue>());
+        }
+    }
+
+    void Run(const std::string& root, ScanStats& stats) {
+        // 根目录的mtime需单独获取，子目录的mtime在父目录列举时顺带得到
+        ScannedDir rootDir;
+        rootDir.path = root;
+        FileStat st;
+        if (StatPath(root, st)) rootDir.mtime = st.mtime;
+        m_pending.store(1);
+        m_queues[0]->dirs.push_back(std::move(rootDir));
+
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < m_queues.size(); ++i) {
+            threads.emplace_back(&ScanJob::WorkerLoop, this, i);
+        }
+        WorkerLoop(0); // 调用线程也参与扫描
+        for (auto& t : threads) t.join();
+
+        stats.files = m_files.load();
+        stats.directories = m_directories.load();
+        stats.errors = m_errors.load();
+    }
+
+private:
+    bool PopLocal(size_t self, ScannedDir& dir) {
+        WorkerQueue& q = *m_queues[self];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (q.dirs.empty()) return false;
+        dir = std::move(q.dirs.back());
+        q.dirs.pop_back();
+        return true;
+    }
+
+    bool Steal(size_t self, ScannedDir& dir) {
+        const size_t n = m_queues.size();
+        for (size_t k = 1; k < n; ++k) {
+            WorkerQueue& q = *m_queues[(self + k) % n];
+            std::lock_guard<std::mutex> lock(q.mutex);
+            if (q.dirs.empty()) continue;
+            dir = std::move(q.dirs.front());
+            q.dirs.pop_front();
+            return true;
+        }
+        return false;
+    }
+
+    void Flush(std::vector<ScannedFile>& batch, std::vector<ScannedDir>& dirs) {
+        if (batch.empty() && dirs.empty()) return;
+        {
+            std::lock_guard<std::mutex> lock(m_callbackMutex);
+            if (m_onBatch) m_onBatch(batch, dirs);
+        }
+        batch.clear();
+        dirs.clear();
+    }
+
+    void WorkerLoop(size_t self) {
+        std::vector<ScannedFile> batch;
+        batch.reserve(m_options.batchSize);
+        std::vector<ScannedDir> doneDirs;
+        std::vector<DirEntry> entries;
+        std::vector<ScannedDir> subDirs;
+        unsigned idleRounds = 0;
+
+        while (!m_cancelled.load(std::memory_order_relaxed)) {
+            ScannedDir dir;
+            if (!PopLocal(self, dir) && !Steal(self, dir)) {
+                // 所有已发现目录都处理完毕才退出；否则短暂让出CPU等待可窃取的任务
+                if (m_pending.load() == 0) break;
+                if (++idleRounds < 64) {
+                    std::this_thread::yield();
+                } else {
+                    std::this_thread::sleep_for(std::chrono::microseconds(200));
+                }
+                continue;
+            }
+            idleRounds = 0;
+
+            if (!ListDirectory(dir.path, entries)) {
+                m_errors.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                m_directories.fetch_add(1, std::memory_order_relaxed);
+                subDirs.clear();
+                for (auto& entry : entries) {
+                    if (entry.isDir) {
+                        ScannedDir sub;
+                        sub.path = JoinPath(dir.path, entry.name);
+                        sub.mtime = entry.mtime;
+                        subDirs.push_back(std::move(sub));
+                    } else if (IsSupportedAudioFile(entry.name)) {
+                        ScannedFile file;
+                        file.path = JoinPath(dir.path, entry.name);
+                        file.size = entry.size;
+                        file.mtime = entry.mtime;
+                        if (m_options.probeFiles) ProbeTrackFile(file.path, file.tags, file.durationMs, file.format);
+                        batch.push_back(std::move(file));
+                        m_files.fetch_add(1, std::memory_order_relaxed);
+                        if (batch.size() >= m_options.batchSize) Flush(batch, doneDirs);
+                    }
+                }
+                doneDirs.push_back(std::move(dir));
+                if (doneDirs.size() >= m_options.batchSize) Flush(batch, doneDirs);
+                if (!subDirs.empty()) {
+                    // 先增加计数再入队，保证其他线程看到pending为0时确实没有剩余任务
+                    m_pending.fetch_add(subDirs.size());
+                    WorkerQueue& q = *m_queues[self];
+                    std::lock_guard<std::mutex> lock(q.mutex);
+                    for (auto& sub : subDirs) q.dirs.push_back(std::move(sub));
+                }
+            }
+            m_pending.fetch_sub(1);
+        }
+        Flush(batch, doneDirs);
+    }
+
+    std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+    const ScanOptions& m_options;
+    const ScanBatchCallback& m_onBatch;
+    const std::atomic<bool>& m_cancelled;
+    std::mutex m_callbackMutex;
+    std::atomic<size_t> m_pending{0};
+    std::atomic<std::uint64_t> m_files{0};
+    std::atomic<std::uint64_t> m_directories{0};
+    std::atomic<std::uint64_t> m_errors{0};
+};
+
+} // namespace
+
+ScanStats LibraryScanner::Scan(const std::string& rootUtf8, const ScanOptions& options,
+                               const ScanBatchCallback& onBatch) {
+    ScanStats stats;
+    const auto start = std::chrono::steady_clock::now();
+
+    unsigned threadCount = options.threadCount;
+    if (threadCount == 0) threadCount = std::max(1u, std::thread::hardware_concurrency());
+    ScanOptions effective = options;
+    if (effective.batchSize == 0) effective.batchSize = 1;
+
+    ScanJob job(threadCount, effective, onBatch, m_cancelled);
+    job.Run(TrimTrailingSeparators(rootUtf8), stats);
+
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
@@ -0,0 +1,59 @@
+// 递归曲库扫描器：多线程工作窃取遍历子目录，按批次回传扫描结果
+#pragma once
+
+#include "media_probe.h"
+#include "tag_reader.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// 扫描得到的单个音频文件（路径为UTF-8，mtime为平台原生时间刻度）
+struct ScannedFile {
+    std::string path;
+    std::uint64_t size = 0;
+    std::int64_t mtime = 0;
+    TrackTags tags;             // 以下在ScanOptions::probeFiles为true时填充
+    std::uint32_t durationMs = 0;
+    AudioFormat format = AUDIO_FORMAT_UNKNOWN;
+};
+
+// 扫描得到的目录（用于增量重扫：目录mtime不变说明其直接子项未增删）
+struct ScannedDir {
+    std::string path;
+    std::int64_t mtime = 0;
+};
+
+struct ScanOptions {
+    unsigned threadCount = 0;   // 工作线程数，0表示使用CPU核心数
+    size_t batchSize = 512;     // 每批回传的文件数
+    bool probeFiles = false;    // 是否在扫描线程中顺带识别格式、读取标签、探测时长（只读文件头尾，不解码）
+};
+
+struct ScanStats {
+    std::uint64_t files = 0;        // 命中的音频文件数
+    std::uint64_t directories = 0;  // 遍历的目录数
+    std::uint64_t errors = 0;       // 无法打开的目录数
+    double seconds = 0.0;           // 扫描耗时
+
+    double FilesPerSecond() const { return seconds > 0.0 ? files / seconds : 0.0; }
+};
+
+// 批次回调：由扫描器内部加锁串行调用，回调内部无需再加锁，可直接move走batch中的数据
+// dirs为本批次中已成功列出的目录（可能为空）
+using ScanBatchCallback = std::function<void(std::vector<ScannedFile>& batch, std::vector<ScannedDir>& dirs)>;
+
+class LibraryScanner {
+public:
+    // 阻塞扫描root目录（含所有子目录），返回统计信息
+    ScanStats Scan(const std::string& rootUtf8, const ScanOptions& options, const ScanBatchCallback& onBatch);
+
+    // 请求取消（可从任意线程调用），Scan会尽快返回；取消状态不会自动清除，每次扫描应使用新的扫描器
+    void Cancel() { m_cancelled.store(true); }
+    bool IsCancelled() const { return m_cancelled.load(); }
+
+private:
+    std::atomic<bool> m_cancelled{false};
+};
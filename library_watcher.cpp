@@ -0,0 +1,354 @@
+#include "library_watcher.h"
+#include "fs_util.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#include <unordered_map>
+#endif
+
+#include <algorithm>
+
+namespace {
+
+// 相对路径拼接（根目录为空串）
+std::string JoinRelative(const std::string& dir, const std::string& name) {
+    return dir.empty() ? name : JoinPath(dir, name);
+}
+
+// 同一批事件往往集中在少数目录，与上一个相同时不重复追加
+void PushDirty(std::vector<std::string>& dirtyDirs, std::string path) {
+    if (!dirtyDirs.empty() && dirtyDirs.back() == path) return;
+    dirtyDirs.push_back(std::move(path));
+}
+
+#ifdef _WIN32
+
+// -------------------------- Windows：ReadDirectoryChangesW（子树监视，重叠I/O） --------------------------
+class Win32WatchBackend : public WatchBackend {
+public:
+    ~Win32WatchBackend() override {
+        if (m_dir != INVALID_HANDLE_VALUE) {
+            CancelIo(m_dir);
+            CloseHandle(m_dir);
+        }
+        if (m_overlapped.hEvent != NULL) CloseHandle(m_overlapped.hEvent);
+        if (m_stopEvent != NULL) CloseHandle(m_stopEvent);
+    }
+
+    bool Start(const std::string& rootUtf8) override {
+        m_dir = CreateFileW(Utf8ToWide(rootUtf8).c_str(), FILE_LIST_DIRECTORY,
+                            FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING,
+                            FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, NULL);
+        if (m_dir == INVALID_HANDLE_VALUE) return false;
+        m_overlapped.hEvent = CreateEventW(NULL, TRUE, FALSE, NULL);
+        m_stopEvent = CreateEventW(NULL, TRUE, FALSE, NULL);
+        if (m_overlapped.hEvent == NULL || m_stopEvent == NULL) return false;
+        return IssueRead();
+    }
+
+    bool WaitEvents(std::vector<std::string>& dirtyDirs, bool& fullRescan) override {
+        HANDLE handles[2] = {m_overlapped.hEvent, m_stopEvent};
+        DWORD waitResult = WaitForMultipleObjects(2, handles, FALSE, INFINITE);
+        if (waitResult != WAIT_OBJECT_0) {
+            CancelIo(m_dir);
+            return false;
+        }
+        DWORD bytes = 0;
+        if (!GetOverlappedResult(m_dir, &m_overlapped, &bytes, FALSE) || bytes == 0) {
+            // 缓冲区溢出（或网络路径不支持）：事件已丢失，只能全量重扫
+            fullRescan = true;
+        } else {
+            const BYTE* base = reinterpret_cast<const BYTE*>(m_buffer.data());
+            for (DWORD offset = 0;;) {
+                const auto* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(base + offset);
+                std::wstring name(info->FileName, info->FileNameLength / sizeof(WCHAR));
+                std::string rel = WideToUtf8(name);
+                // 上级目录需要重新列举；条目本身若是已知目录（被删除/改名）也需检查
+                PushDirty(dirtyDirs, std::string(ParentOf(rel)));
+                if (info->Action == FILE_ACTION_REMOVED || info->Action == FILE_ACTION_RENAMED_OLD_NAME) {
+                    PushDirty(dirtyDirs, rel);
+                }
+                if (info->NextEntryOffset == 0) break;
+                offset += info->NextEntryOffset;
+            }
+        }
+        ResetEvent(m_overlapped.hEvent);
+        if (!IssueRead()) return false;
+        return true;
+    }
+
+    void Stop() override {
+        if (m_stopEvent != NULL) SetEvent(m_stopEvent);
+    }
+
+private:
+    bool IssueRead() {
+        const DWORD filter = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME |
+                             FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE;
+        return ReadDirectoryChangesW(m_dir, m_buffer.data(), static_cast<DWORD>(m_buffer.size() * sizeof(DWORD)),
+                                     TRUE, filter, NULL, &m_overlapped, NULL) != 0;
+    }
+
+    HANDLE m_dir = INVALID_HANDLE_VALUE;
+    HANDLE m_stopEvent = NULL;
+    OVERLAPPED m_overlapped = {};
+    std::vector<DWORD> m_buffer = std::vector<DWORD>(16 * 1024); // 64KB，DWORD对齐（网络路径上限）
+};
+
+#else
+
+// -------------------------- Linux：inotify（每个目录一个watch，新目录出现时补加） --------------------------
+class InotifyWatchBackend : public WatchBackend {
+public:
+    ~InotifyWatchBackend() override {
+        if (m_fd >= 0) close(m_fd);
+        if (m_wakeFd >= 0) close(m_wakeFd);
+    }
+
+    bool Start(const std::string& rootUtf8) override {
+        m_root = TrimTrailingSeparators(rootUtf8);
+        m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        m_wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (m_fd < 0 || m_wakeFd < 0) return false;
+        bool overflow = false;
+        AddTree(std::string(), overflow);
+        return !m_wdPaths.empty();
+    }
+
+    bool WaitEvents(std::vector<std::string>& dirtyDirs, bool& fullRescan) override {
+        pollfd fds[2] = {{m_fd, POLLIN, 0}, {m_wakeFd, POLLIN, 0}};
+        while (poll(fds, 2, -1) < 0) {
+            if (errno != EINTR) return false;
+        }
+        if (fds[1].revents & POLLIN) return false;
+
+        alignas(inotify_event) char buffer[64 * 1024];
+        for (;;) {
+            const ssize_t len = read(m_fd, buffer, sizeof(buffer));
+            if (len <= 0) break; // EAGAIN：本轮已读完
+            for (char* p = buffer; p < buffer + len;) {
+                const auto* ev = reinterpret_cast<const inotify_event*>(p);
+                p += sizeof(inotify_event) + ev->len;
+                HandleEvent(*ev, dirtyDirs, fullRescan);
+            }
+        }
+        return true;
+    }
+
+    void Stop() override {
+        if (m_wakeFd >= 0) {
+            const std::uint64_t one = 1;
+            ssize_t ignored = write(m_wakeFd, &one, sizeof(one));
+            (void)ignored;
+        }
+    }
+
+private:
+    static constexpr std::uint32_t kMask = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_CLOSE_WRITE |
+                                           IN_ATTRIB | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+
+    void HandleEvent(const inotify_event& ev, std::vector<std::string>& dirtyDirs, bool& fullRescan) {
+        if (ev.mask & IN_Q_OVERFLOW) {
+            fullRescan = true;
+            return;
+        }
+        auto it = m_wdPaths.find(ev.wd);
+        if (it == m_wdPaths.end()) return;
+        if (ev.mask & IN_IGNORED) { // watch已被内核移除（目录删除或卸载）
+            m_wdPaths.erase(it);
+            return;
+        }
+        const std::string dir = it->second;
+        PushDirty(dirtyDirs, dir);
+        if (ev.len == 0 || !(ev.mask & IN_ISDIR)) return;
+
+        // 子目录的增删/移动：子目录本身也要检查；新出现的子树需要补加watch
+        std::string child = JoinRelative(dir, ev.name);
+        if (ev.mask & (IN_CREATE | IN_MOVED_TO)) AddTree(child, fullRescan);
+        PushDirty(dirtyDirs, std::move(child));
+    }
+
+    // 为rel及其所有子目录添加watch；同一inode再次添加时内核返回原wd，此处顺带更新其路径（目录被移动的情况）
+    void AddTree(const std::string& rel, bool& fullRescan) {
+        std::vector<std::string> stack{rel};
+        std::vector<DirEntry> entries;
+        while (!stack.empty()) {
+            std::string dir = std::move(stack.back());
+            stack.pop_back();
+            const std::string full = dir.empty() ? m_root : JoinPath(m_root, dir);
+            const int wd = inotify_add_watch(m_fd, full.c_str(), kMask);
+            if (wd < 0) {
+                // 达到max_user_watches上限时无法继续实时监视该子树，退回全量重扫
+                if (errno == ENOSPC) fullRescan = true;
+                continue;
+            }
+            m_wdPaths[wd] = dir;
+            if (!ListDirectory(full, entries)) continue;
+            for (const auto& entry : entries) {
+                if (entry.isDir) stack.push_back(JoinRelative(dir, entry.name));
+            }
+        }
+    }
+
+    std::string m_root;
+    int m_fd = -1;
+    int m_wakeFd = -1;
+    std::unordered_map<int, std::string> m_wdPaths; // wd -> 相对路径（仅在读取线程访问）
+};
+
+#endif
+
+} // namespace
+
+std::unique_ptr<WatchBackend> CreateWatchBackend() {
+#ifdef _WIN32
+    return std::make_unique<Win32WatchBackend>();
+#else
+    return std::make_unique<InotifyWatchBackend>();
+#endif
+}
+
+LibraryWatcher::LibraryWatcher(std::string rootUtf8, std::string catalogPath, WatchOptions options,
+                               CatalogUpdateCallback onUpdate)
+    : m_root(TrimTrailingSeparators(rootUtf8)), m_catalogPath(std::move(catalogPath)),
+      m_options(options), m_onUpdate(std::move(onUpdate)) {}
+
+LibraryWatcher::~LibraryWatcher() {
+    Stop();
+}
+
+bool LibraryWatcher::Start() {
+    m_backend = CreateWatchBackend();
+    if (!m_backend->Start(m_root)) {
+        m_backend.reset();
+        return false;
+    }
+    m_readerThread = std::thread(&LibraryWatcher::ReaderLoop, this);
+    m_applierThread = std::thread(&LibraryWatcher::ApplierLoop, this);
+    return true;
+}
+
+void LibraryWatcher::SetCatalog(std::shared_ptr<const LibraryCatalog> catalog) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_catalog = std::move(catalog);
+    }
+    m_cv.notify_all();
+}
+
+void LibraryWatcher::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_stopping) return;
+        m_stopping = true;
+        if (m_activeRescanner != nullptr) m_activeRescanner->Cancel();
+    }
+    m_cv.notify_all();
+    if (m_backend) m_backend->Stop();
+    if (m_readerThread.joinable()) m_readerThread.join();
+    if (m_applierThread.joinable()) m_applierThread.join();
+}
+
+void LibraryWatcher::ReaderLoop() {
+    std::vector<std::string> dirs;
+    bool fullRescan = false;
+    while (m_backend->WaitEvents(dirs, fullRescan)) {
+        if (dirs.empty() && !fullRescan) continue;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            const auto now = std::chrono::steady_clock::now();
+            if (!HasPendingLocked()) m_firstEvent = now;
+            m_lastEvent = now;
+            for (auto& dir : dirs) m_dirty.insert(std::move(dir));
+            m_fullRescan = m_fullRescan || fullRescan;
+        }
+        m_cv.notify_all();
+        dirs.clear();
+        fullRescan = false;
+    }
+}
+
+void LibraryWatcher::ApplierLoop() {
+    using Clock = std::chrono::steady_clock;
+    const auto quiet = std::chrono::milliseconds(m_options.quietMs);
+    const auto maxDelay = std::chrono::milliseconds(m_options.maxDelayMs);
+    const auto saveInterval = std::chrono::milliseconds(m_options.saveIntervalMs);
+    std::shared_ptr<const LibraryCatalog> unsaved;   // 已发布但尚未写盘的目录
+    Clock::time_point lastSave = Clock::now() - saveInterval;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto ready = [this] { return m_stopping || (m_catalog && HasPendingLocked()); };
+    while (!m_stopping) {
+        // 1. 空闲：等待事件；有未写盘的目录时，静默一个写盘间隔后写盘
+        if (!ready()) {
+            if (!unsaved) {
+                m_cv.wait(lock, ready);
+            } else if (!m_cv.wait_for(lock, saveInterval, ready)) {
+                lock.unlock();
+                unsaved->SaveTo(m_catalogPath);
+                unsaved.reset();
+                lastSave = Clock::now();
+                lock.lock();
+            }
+            continue;
+        }
+
+        // 2. 合并突发事件：等到静默quietMs，或距第一个事件已过maxDelayMs
+        const auto deadline = m_firstEvent + maxDelay;
+        while (!m_stopping) {
+            const auto until = std::min(m_lastEvent + quiet, deadline);
+            if (Clock::now() >= until) break;
+            m_cv.wait_until(lock, until);
+        }
+        if (m_stopping) break;
+
+        // 3. 取走待处理目录，在锁外做增量重扫
+        RescanOptions options;
+        options.threadCount = m_options.threadCount;
+        if (!m_fullRescan) options.dirtyDirs.assign(m_dirty.begin(), m_dirty.end());
+        m_dirty.clear();
+        m_fullRescan = false;
+        std::shared_ptr<const LibraryCatalog> base = m_catalog;
+        LibraryRescanner rescanner;
+        m_activeRescanner = &rescanner;
+        lock.unlock();
+
+        RescanResult result = rescanner.Rescan(m_root, *base, options);
+        std::shared_ptr<const LibraryCatalog> fresh;
+        if (result.changed && !rescanner.IsCancelled()) {
+            fresh = LibraryCatalog::FromImage(LibraryCatalog::BuildImage(
+                std::move(result.entries), std::move(result.dirs), base->Generation() + 1));
+        }
+        if (fresh) {
+            if (m_onUpdate) m_onUpdate(fresh, result.delta);
+            if (Clock::now() - lastSave >= saveInterval) {
+                fresh->SaveTo(m_catalogPath);
+                unsaved.reset();
+                lastSave = Clock::now();
+            } else {
+                unsaved = fresh;
+            }
+        }
+
+        lock.lock();
+        m_activeRescanner = nullptr;
+        if (m_catalog != base) {
+            // 应用期间基准被外部替换：本次结果基于旧基准，安排一次全量重扫保证一致
+            m_fullRescan = true;
+            m_firstEvent = m_lastEvent = Clock::now();
+        } else if (fresh) {
+            m_catalog = fresh;
+        }
+    }
+    lock.unlock();
+    if (unsaved) unsaved->SaveTo(m_catalogPath);
+}
@@ -0,0 +1,85 @@
+// 曲库实时监视：平台后端（Linux inotify / Windows ReadDirectoryChangesW）上报受影响的目录，
+// 合并一段时间内的突发事件后只对这些目录做增量重扫，并发布新的目录快照
+#pragma once
+
+#include "library_catalog.h"
+#include "library_rescan.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+// 文件系统变化通知后端（各平台实现同一接口）
+class WatchBackend {
+public:
+    virtual ~WatchBackend() = default;
+
+    // 开始监视root（含所有子目录）
+    virtual bool Start(const std::string& rootUtf8) = 0;
+    // 阻塞等待下一批事件：受影响目录的相对路径追加到dirtyDirs；事件丢失（队列溢出）时置fullRescan
+    // Stop被调用后返回false
+    virtual bool WaitEvents(std::vector<std::string>& dirtyDirs, bool& fullRescan) = 0;
+    // 唤醒并终止WaitEvents（可从任意线程调用）
+    virtual void Stop() = 0;
+};
+
+// 创建当前平台的后端
+std::unique_ptr<WatchBackend> CreateWatchBackend();
+
+struct WatchOptions {
+    int quietMs = 500;           // 最后一个事件之后静默多久才应用
+    int maxDelayMs = 2000;       // 事件持续不断时最长合并多久（大批量复制时按此节奏分批应用）
+    int saveIntervalMs = 10000;  // 目录写盘的最小间隔，避免大批量复制时反复写大文件
+    unsigned threadCount = 2;    // 重扫线程数，保持较小以免影响播放
+};
+
+// 目录更新回调：在监视器的工作线程上调用
+using CatalogUpdateCallback =
+    std::function<void(const std::shared_ptr<const LibraryCatalog>& catalog, const RescanDelta& delta)>;
+
+class LibraryWatcher {
+public:
+    LibraryWatcher(std::string rootUtf8, std::string catalogPath, WatchOptions options,
+                   CatalogUpdateCallback onUpdate);
+    ~LibraryWatcher();
+
+    LibraryWatcher(const LibraryWatcher&) = delete;
+    LibraryWatcher& operator=(const LibraryWatcher&) = delete;
+
+    // 启动后端和工作线程；失败（例如平台不支持）时返回false
+    bool Start();
+    // 设置基准目录；在此之前收到的事件会累积，设置后立即应用
+    void SetCatalog(std::shared_ptr<const LibraryCatalog> catalog);
+    // 停止监视并把尚未写盘的目录写入文件
+    void Stop();
+
+private:
+    void ReaderLoop();
+    void ApplierLoop();
+    bool HasPendingLocked() const { return m_fullRescan || !m_dirty.empty(); }
+
+    std::string m_root;
+    std::string m_catalogPath;
+    WatchOptions m_options;
+    CatalogUpdateCallback m_onUpdate;
+    std::unique_ptr<WatchBackend> m_backend;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_stopping = false;
+    std::unordered_set<std::string> m_dirty;   // 待重新列举的目录（相对路径）
+    bool m_fullRescan = false;
+    std::chrono::steady_clock::time_point m_firstEvent;
+    std::chrono::steady_clock::time_point m_lastEvent;
+    std::shared_ptr<const LibraryCatalog> m_catalog;
+    LibraryRescanner* m_activeRescanner = nullptr;
+
+    std::thread m_readerThread;
+    std::thread m_applierThread;
+};
@@ -0,0 +1,116 @@
+#include "load_policy.h"
+
+#include <algorithm>
+
+// ---------- MemoryBudget ----------
+
+bool MemoryBudget::TryReserve(std::uint64_t bytes) {
+    std::uint64_t used = m_used.load();
+    do {
+        if (bytes > m_limit - std::min(used, m_limit)) return false;
+    } while (!m_used.compare_exchange_weak(used, used + bytes));
+    const std::uint64_t now = used + bytes;
+    std::uint64_t peak = m_peak.load();
+    while (now > peak && !m_peak.compare_exchange_weak(peak, now)) {
+    }
+    return true;
+}
+
+void MemoryBudget::Release(std::uint64_t bytes) {
+    m_used.fetch_sub(bytes);
+}
+
+// ---------- MemoryReservation ----------
+
+MemoryReservation::MemoryReservation(MemoryReservation&& other) noexcept
+    : m_budget(std::move(other.m_budget)), m_bytes(other.m_bytes) {
+    other.m_bytes = 0;
+}
+
+MemoryReservation& MemoryReservation::operator=(MemoryReservation&& other) noexcept {
+    if (this != &other) {
+        Reset();
+        m_budget = std::move(other.m_budget);
+        m_bytes = other.m_bytes;
+        other.m_bytes = 0;
+    }
+    return *this;
+}
+
+void MemoryReservation::Shrink(std::uint64_t bytes) {
+    if (m_budget == nullptr || bytes >= m_bytes) return;
+    m_budget->Release(m_bytes - bytes);
+    m_bytes = bytes;
+}
+
+void MemoryReservation::Reset() {
+    if (m_budget != nullptr && m_bytes > 0) m_budget->Release(m_bytes);
+    m_budget.reset();
+    m_bytes = 0;
+}
+
+// ---------- LoadPolicy ----------
+
+LoadPolicy::LoadPolicy(LoadPolicyOptions options)
+    : m_options(options), m_budget(std::make_shared<MemoryBudget>(options.memoryBudget)) {}
+
+std::uint64_t LoadPolicy::EstimatePcmBytes(std::uint32_t durationMs, std::uint32_t channels, std::uint32_t sampleRate) {
+    if (durationMs == 0) return 0;
+    const std::uint64_t frames = static_cast<std::uint64_t>(durationMs) * sampleRate / 1000 + sampleRate;
+    return frames * channels * sizeof(float);
+}
+
+std::uint64_t LoadPolicy::DecodableBytes(const TrackLoadInfo& info, std::uint32_t channels,
+                                         std::uint32_t sampleRate) const {
+    const std::uint64_t pcmBytes = EstimatePcmBytes(info.durationMs, channels, sampleRate);
+    const bool compressed = info.format != AUDIO_FORMAT_WAV && info.format != AUDIO_FORMAT_UNKNOWN &&
+                            static_cast<double>(pcmBytes) >=
+                                static_cast<double>(info.fileSize) * m_options.minCompressionRatio;
+    if (pcmBytes == 0 || !compressed || pcmBytes > m_options.maxTrackBytes) return 0;
+    return pcmBytes;
+}
+
+bool LoadPolicy::Reserve(std::uint64_t bytes, MemoryReservation& reservation) {
+    if (!m_budget->TryReserve(bytes) && (!m_reclaim || m_reclaim(bytes) == 0 || !m_budget->TryReserve(bytes))) {
+        return false;
+    }
+    reservation = MemoryReservation(m_budget, bytes);
+    return true;
+}
+
+LoadMode LoadPolicy::Choose(const TrackLoadInfo& info, std::uint32_t channels, std::uint32_t sampleRate,
+                            MemoryReservation& reservation) {
+    reservation.Reset();
+    const std::uint64_t pcmBytes = DecodableBytes(info, channels, sampleRate);
+    if (pcmBytes == 0) {
+        m_streamed.fetch_add(1);
+        return LoadMode::Stream;
+    }
+    if (!Reserve(pcmBytes, reservation)) {
+        m_overBudget.fetch_add(1);
+        m_streamed.fetch_add(1);
+        return LoadMode::Stream;
+    }
+    m_decoded.fetch_add(1);
+    return LoadMode::Decode;
+}
+
+bool LoadPolicy::ReserveCapture(const TrackLoadInfo& info, std::uint32_t channels, std::uint32_t sampleRate,
+                                MemoryReservation& reservation) {
+    reservation.Reset();
+    const std::uint64_t pcmBytes = DecodableBytes(info, channels, sampleRate);
+    if (pcmBytes == 0 || !Reserve(pcmBytes, reservation)) return false;
+    m_captured.fetch_add(1);
+    return true;
+}
+
+LoadPolicyStats LoadPolicy::Stats() const {
+    LoadPolicyStats stats;
+    stats.streamed = m_streamed.load();
+    stats.decoded = m_decoded.load();
+    stats.overBudget = m_overBudget.load();
+    stats.captured = m_captured.load();
+    stats.budgetUsed = m_budget->Used();
+    stats.budgetPeak = m_budget->Peak();
+    return stats;
+}
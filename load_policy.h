@@ -0,0 +1,123 @@
+// 曲目的加载方式：流式（只预先解码引导段，其余由音频线程边播边解码）或整首解码（在加载线程上解码为PCM，
+// 播放时音频线程只复制内存）
+// - 按目录中的时长、格式与文件大小估算整首PCM的大小与解码开销，在全局内存预算之内才整首解码
+// - 未压缩的格式（WAV，或压缩比很低的文件）解码几乎没有开销，整首解码只会占用内存，总是流式
+// - 时长未知（首次扫描中）的曲目无法估算大小，总是流式
+// - 流式播放的曲目同样值得整首解码时，在预算之内预留整首的大小，边播边保存解码输出（放入PCM缓存）
+// - 预算同时计入PCM缓存中的曲目（缓存的PCM持有预留）；预算不足时先由回收回调（SetReclaimer）淘汰缓存再重试
+// 决策与预算计数可在任意线程进行
+#pragma once
+
+#include "media_probe.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+enum class LoadMode : std::uint8_t {
+    Stream,     // 引导段 + 流式解码
+    Decode,     // 整首解码
+};
+
+struct LoadPolicyOptions {
+    std::uint64_t memoryBudget = 384ull << 20;      // 整首解码的曲目合计占用的上限
+    std::uint64_t maxTrackBytes = 160ull << 20;     // 单首整首解码的上限（48kHz立体声f32约14分钟）
+    float minCompressionRatio = 2.0f;               // PCM大小/文件大小低于此值视为未压缩，解码没有可节省的开销
+};
+
+// 目录中与加载方式有关的信息
+struct TrackLoadInfo {
+    AudioFormat format = AUDIO_FORMAT_UNKNOWN;
+    std::uint32_t durationMs = 0;                   // 0表示未知
+    std::uint64_t fileSize = 0;
+};
+
+// 整首解码的内存预算（原子计数）
+class MemoryBudget {
+public:
+    explicit MemoryBudget(std::uint64_t limit) : m_limit(limit) {}
+
+    // 剩余预算足够时预留bytes并返回true
+    bool TryReserve(std::uint64_t bytes);
+    void Release(std::uint64_t bytes);
+
+    std::uint64_t Limit() const { return m_limit; }
+    std::uint64_t Used() const { return m_used.load(); }
+    std::uint64_t Peak() const { return m_peak.load(); }
+
+private:
+    const std::uint64_t m_limit;
+    std::atomic<std::uint64_t> m_used{0};
+    std::atomic<std::uint64_t> m_peak{0};
+};
+
+// 从预算中预留的内存，析构时归还（可比预算对象存活得更久的曲目持有）
+class MemoryReservation {
+public:
+    MemoryReservation() = default;
+    MemoryReservation(std::shared_ptr<MemoryBudget> budget, std::uint64_t bytes)
+        : m_budget(std::move(budget)), m_bytes(bytes) {}
+    ~MemoryReservation() { Reset(); }
+    MemoryReservation(MemoryReservation&& other) noexcept;
+    MemoryReservation& operator=(MemoryReservation&& other) noexcept;
+    MemoryReservation(const MemoryReservation&) = delete;
+    MemoryReservation& operator=(const MemoryReservation&) = delete;
+
+    // 实际占用少于预留时归还多出的部分
+    void Shrink(std::uint64_t bytes);
+    void Reset();
+    std::uint64_t Bytes() const { return m_bytes; }
+
+private:
+    std::shared_ptr<MemoryBudget> m_budget;
+    std::uint64_t m_bytes = 0;
+};
+
+struct LoadPolicyStats {
+    std::uint64_t streamed = 0;         // 选择流式的次数
+    std::uint64_t decoded = 0;          // 选择整首解码的次数
+    std::uint64_t overBudget = 0;       // 其中本可整首解码、因预算不足改为流式的次数
+    std::uint64_t captured = 0;         // 流式播放时预留了整首、边播边保存解码输出的次数
+    std::uint64_t budgetUsed = 0;       // 当前整首解码的曲目占用的字节数
+    std::uint64_t budgetPeak = 0;
+};
+
+// 预算不足时回收至少bytes字节的预算（例如淘汰PCM缓存），返回实际归还的字节数
+using BudgetReclaimer = std::function<std::uint64_t(std::uint64_t bytes)>;
+
+class LoadPolicy {
+public:
+    explicit LoadPolicy(LoadPolicyOptions options = LoadPolicyOptions());
+
+    // 在开始选择加载方式之前设置
+    void SetReclaimer(BudgetReclaimer reclaim) { m_reclaim = std::move(reclaim); }
+
+    // 选择加载方式；整首解码时从预算中预留估算的PCM大小（reservation），曲目释放时归还
+    LoadMode Choose(const TrackLoadInfo& info, std::uint32_t channels, std::uint32_t sampleRate,
+                    MemoryReservation& reservation);
+
+    // 流式播放的曲目：值得整首解码（压缩格式、大小在单首上限之内）且预算足够时预留整首的PCM大小并返回true，
+    // 边播边保存解码输出，播完时整首都在内存中
+    bool ReserveCapture(const TrackLoadInfo& info, std::uint32_t channels, std::uint32_t sampleRate,
+                        MemoryReservation& reservation);
+
+    // 按时长估算的整首PCM字节数（f32，含1秒余量）；时长未知时为0
+    static std::uint64_t EstimatePcmBytes(std::uint32_t durationMs, std::uint32_t channels, std::uint32_t sampleRate);
+
+    LoadPolicyStats Stats() const;
+
+private:
+    // 整首PCM的估算大小；不值得整首解码时为0
+    std::uint64_t DecodableBytes(const TrackLoadInfo& info, std::uint32_t channels, std::uint32_t sampleRate) const;
+    // 从预算中预留bytes，不足时先回收再重试一次
+    bool Reserve(std::uint64_t bytes, MemoryReservation& reservation);
+
+    LoadPolicyOptions m_options;
+    std::shared_ptr<MemoryBudget> m_budget;
+    BudgetReclaimer m_reclaim;
+    std::atomic<std::uint64_t> m_streamed{0};
+    std::atomic<std::uint64_t> m_decoded{0};
+    std::atomic<std::uint64_t> m_overBudget{0};
+    std::atomic<std::uint64_t> m_captured{0};
+};
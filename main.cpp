@@ -19,9 +19,7 @@
 #define UNICODE
 #define _UNICODE
 
-// miniaudio配置：启用宽字符API
-#define MINIAUDIO_IMPLEMENTATION
-#define MA_ENABLE_WINDOWS_WIDECHAR_PATHS 1  // 启用miniaudio宽字符路径支持
+// miniaudio的实现在player_core中（miniaudio.cpp）
 #include "miniaudio.h"
  
 #include <windows.h>
@@ -40,6 +38,26 @@
 #include <chrono>       // 【随机种子修复】高精度时钟作为熵源
 #include <cstdint>
 #include <functional>   // std::hash
+#include <memory>
+#include <deque>
+
+#include "fs_util.h"          // UTF-8/UTF-16转换、目录遍历
+#include "library_scanner.h"  // 多线程递归曲库扫描
+#include "library_catalog.h"  // 持久化曲库目录（mmap）
+#include "library_rescan.h"   // 基于mtime/大小的增量重扫
+#include "library_watcher.h"  // 文件系统实时监视
+#include "duplicate_finder.h"  // 按音频内容指纹检测重复曲目
+#include "track_list.h"       // 曲目路径池 + 按id显示的列表视图
+#include "track_table.h"      // 列式曲目表（折叠后的检索键 + 时长/格式/大小列）
+#include "trigram_index.h"    // 检索键的三元组倒排索引
+#include "search_worker.h"    // 后台求值的边输入边搜索
+#include "track_query.h"      // 字段查询（artist:/duration>/format:等条件）
+#include "track_bitmap.h"     // 曲目id集合的压缩位图（搜索结果、随机播放的候选集合）
+#include "text_fold.h"        // 检索键的大小写折叠
+#include "playback_chain.h"   // 无缝播放：各曲目解码器连接成的数据源链
+#include "track_prefetcher.h" // 后台预取下一首（引导段预解码 + 页缓存预读）
+#include "load_policy.h"      // 流式/整首解码的选择与内存预算
+#include "pcm_cache.h"        // 整首解码的PCM缓存（重播最近的曲目时不再解码）
 
 namespace fs = std::filesystem;
 
@@ -59,6 +77,13 @@ namespace fs = std::filesystem;
 // 新增：全局快捷键ID
 #define ID_HOTKEY_PREV    2001  // Ctrl+左方向键（上一首）
 #define ID_HOTKEY_NEXT    2002  // Ctrl+右方向键（下一首）
+// 后台扫描线程投递给主窗口的自定义消息
+#define WM_APP_SCAN_BATCH (WM_APP + 1)  // lParam: std::vector<std::wstring>*（一批新发现的音乐，相对music根目录）
+#define WM_APP_SCAN_DONE  (WM_APP + 2)  // lParam: std::wstring*（扫描结束统计信息）
+#define WM_APP_CATALOG_READY (WM_APP + 3) // lParam: CatalogUpdate*（校验或监视发现变化：新目录与增量）
+#define WM_APP_SEARCH_DONE (WM_APP + 4) // lParam: SearchResult*（后台搜索线程求值完成的结果）
+#define WM_APP_PREFETCH_READY (WM_APP + 5) // wParam: 曲目id，lParam: ma_result（后台加载完成的曲目）
+#define WM_APP_LIBRARY_READY (WM_APP + 6) // lParam: LibraryData*（后台由已有目录构建的路径池/曲目表，或随后建好的索引）
 
 // 播放状态枚举
 enum PlayState {
@@ -74,9 +99,16 @@ enum LoopMode {
     LOOP_RANDOM
 };
 
-// 核心变更：直接存储UTF-16宽字符路径（Windows原生路径格式）
-std::vector<std::wstring> g_musicList;          // 当前显示的音乐列表（可能是过滤后的）
-std::vector<std::wstring> g_originalMusicList;  // 原始音乐列表（未过滤）
+// 曲目路径只在路径池中存放一份（UTF-16，相对music根目录），列表只保存32位曲目id
+// 曲目id在本次运行中不变（播放链、预取与最近播放都记录id）：曲库更新时新曲目追加在末尾，修改的曲目原位替换，删除的曲目只记入g_removedTracks
+// 因此只有启动时由目录构建的路径池与g_catalog的id一致，之后按路径对应
+TrackPathPool g_trackPaths;         // 全部曲目（未过滤，含已删除的）
+TrackListView g_musicList;          // 当前显示的音乐列表（可能是过滤后的），元素为曲目id
+TrackTable g_trackTable;            // 与g_trackPaths按id对应的列式曲目表，搜索只扫描其中连续的检索键
+TrigramIndex g_trackIndex;          // g_trackTable检索键的三元组倒排索引，搜索只校验候选曲目
+bool g_trackIndexPending = false;   // 索引在后台建立中（此前搜索顺序扫描，曲库更新时不在UI线程上索引）
+std::vector<std::uint32_t> g_trackIndexStale; // 索引建立期间检索键被原位修改的曲目（索引换入后重新索引）
+TrackBitmap g_removedTracks;        // 已从曲库删除的曲目（搜索结果与列表中排除）
 int g_curIndex = -1;
 PlayState g_playState = STOPPED;
 LoopMode g_loopMode = LOOP_LIST;
@@ -86,7 +118,14 @@ HWND g_hMainWnd = NULL;            // 保存主窗口句柄
 HWND g_hProgressSlider = NULL;     // 保存进度条控件句柄
 HWND g_hMusicList = NULL;          // 新增：保存音乐列表框句柄，用于窗口大小自适应
 HWND g_hSearchEdit = NULL;         // 新增：保存搜索编辑框句柄，用于子类化
-std::wstring g_searchKeyword;      // 当前搜索关键词
+std::wstring g_searchKeyword;      // 最近输入的搜索关键词（后台求值完成前可能与列表内容不一致）
+std::string g_searchKey;           // 当前列表对应的折叠关键词（UTF-8），与曲目表中的检索键直接按字节比较
+std::unique_ptr<SearchWorker> g_searchWorker; // 边输入边搜索的后台求值线程（读取g_trackTable/g_trackIndex）
+std::vector<std::uint32_t> g_searchResults; // 复用的搜索结果缓冲区（得分最高的若干首，与列表视图交换，不重复分配）
+TrackBitmap g_searchRest;          // 其余搜索结果（按id升序的压缩位图）
+TrackBitmap g_recentlyPlayed;      // 最近播放过的曲目（随机播放时优先排除）
+std::deque<std::uint32_t> g_recentOrder; // 同上，按播放顺序，超出kRecentTracks时移除最早的
+constexpr size_t kRecentTracks = 64;
 
 // 【新增】默认窗口标题（统一管理）
 const std::wstring g_defaultWindowTitle = L"简易音乐播放器（UTF-16路径+MinGW兼容+单声道+搜索功能+全局快捷键）";
@@ -95,6 +134,12 @@ const std::wstring g_defaultWindowTitle = L"简易音乐播放器（UTF-16路径
 ma_engine g_engine;
 ma_sound g_sound;
 ma_bool32 g_soundInitialized = MA_FALSE;
+PlaybackChain g_chain;                       // g_sound的数据源：当前曲目的解码器，之后连接预先打开的下一首
+std::unique_ptr<TrackPrefetcher> g_prefetcher; // 后台准备下一首（打开并解码引导段），准备好后连接到链上
+std::shared_ptr<LoadPolicy> g_loadPolicy;    // 按目录信息与内存预算选择流式/整首解码（加载线程使用）
+std::shared_ptr<PcmCache> g_pcmCache;        // 解码后的PCM缓存（以文件路径为键；加载线程与释放播放过的曲目时放入）
+std::uint32_t g_nextTrackId = PlaybackChain::kNoTrack; // 已确定的下一首（随机播放时NextMusic也使用它）
+std::uint32_t g_loadingTrackId = PlaybackChain::kNoTrack; // 后台加载中、完成后开始播放的曲目（连续切歌时只保留最后一首）
 
 // 【恢复为原普通mutex】
 std::mutex g_engineMutex;                      // 保护g_engine的互斥锁
@@ -107,6 +152,18 @@ std::thread g_audioInitThread;                 // 音频引擎初始化线程
 float g_totalDuration = 0.0f;       // 缓存当前播放音乐的总时长（秒）
 DWORD g_lastProgressUpdate = 0;     // 上次更新进度的时间戳（用于节流）
 
+// 曲库扫描（后台线程递归遍历music目录，分批回传给UI线程）
+std::thread g_scanThread;
+std::unique_ptr<LibraryScanner> g_scanner;       // 全量扫描（没有可用目录时）
+std::unique_ptr<LibraryRescanner> g_rescanner;   // 增量重扫（已有目录时）
+
+// 持久化曲库目录：启动时直接映射使用，后台扫描只负责校验，有变化时才重建
+std::shared_ptr<const LibraryCatalog> g_catalog;
+std::string g_musicRootUtf8;        // music根目录（UTF-8），目录中的路径均相对于它
+std::wstring g_musicRootWide;       // 同上（UTF-16），与池中的相对路径拼接得到完整路径
+std::unique_ptr<LibraryWatcher> g_watcher; // 实时监视music目录，合并突发事件后增量更新目录
+std::unique_ptr<DuplicateFinder> g_duplicateFinder; // 扫描结束后补全音频指纹并统计重复曲目
+
 // -------------------------- 随机数生成器（修复种子问题） --------------------------
 // 【问题】原代码：std::mt19937 g_rng(std::random_device{}());
 // 在 MinGW (libstdc++ for Windows) 上，std::random_device 并不真正从硬件熵源取值，
@@ -190,15 +247,23 @@ static std::mt19937 CreateSecureRng() {
 std::mt19937 g_rng = CreateSecureRng();
 
 // -------------------------- 提前声明函数（修复所有未声明错误） --------------------------
-std::wstring GetFileName(const std::wstring& wFullPath);
 std::wstring CharToWStr(const char* szStr);
 std::wstring GetExeDir();
 void SearchMusic(const std::wstring& keyword);
-void UninitCurrentSound();
+void SearchMusicNow();
+void EvaluateSearchNow();
+void UpdateMusicListView();
+std::unique_lock<std::mutex> LockSearchData(bool invalidate);
+std::unique_ptr<TrackSource> UninitCurrentSound(std::uint32_t reuseTrack = PlaybackChain::kNoTrack);
 void CreateProgressTimer();
 void DestroyProgressTimer();
 void PlayMusic(int index);
+void ForgetRecentlyPlayed();
+void QueueNextTrack();
+void RequeueNextTrack(const TrackBitmap* changed = nullptr);
 void InitAudioEngine(); // 新增：音频引擎初始化函数
+void StopLibraryScan();
+void RefreshMusicListBox();
 LRESULT CALLBACK SearchEditSubclassProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam, UINT_PTR uIdSubclass, DWORD_PTR dwRefData); // 新增：编辑框子类过程
 
 // -------------------------- 多字节字符串转宽字符字符串 --------------------------
@@ -229,10 +294,154 @@ std::wstring GetExeDir() {
     return exePath.parent_path().wstring();
 }
 
-// -------------------------- 加载音乐列表（直接存储UTF-16路径） --------------------------
+// -------------------------- 辅助函数：曲库目录文件路径（与程序同目录） --------------------------
+std::wstring GetCatalogPath() {
+    return GetExeDir() + L"/library.cat";
+}
+
+// -------------------------- 停止后台曲库扫描（取消并等待线程退出） --------------------------
+void StopLibraryScan() {
+    if (g_scanner) {
+        g_scanner->Cancel();
+    }
+    if (g_rescanner) {
+        g_rescanner->Cancel();
+    }
+    if (g_duplicateFinder) {
+        g_duplicateFinder->Cancel();
+    }
+    if (g_scanThread.joinable()) {
+        g_scanThread.join();
+    }
+    g_scanner.reset();
+    g_rescanner.reset();
+    g_duplicateFinder.reset();
+    if (g_watcher) {
+        g_watcher->Stop(); // 同时写入尚未写盘的目录
+        g_watcher.reset();
+    }
+}
+
+// -------------------------- 构建并保存新目录（后台线程调用），失败时返回nullptr --------------------------
+std::shared_ptr<const LibraryCatalog> SaveCatalog(const std::string& catalogPath, std::vector<CatalogEntry> entries,
+                                                  std::vector<CatalogDirEntry> dirs, std::uint64_t generation) {
+    std::vector<std::uint8_t> image = LibraryCatalog::BuildImage(std::move(entries), std::move(dirs), generation);
+    LibraryCatalog::SaveImage(image, catalogPath);
+    return LibraryCatalog::FromImage(std::move(image));
+}
+
+// -------------------------- 曲库更新（后台线程投递给UI线程，由ApplyCatalogUpdate按增量应用） --------------------------
+// table非空时按路径池的id整体替换已有曲目的行（首次扫描结束补齐大小/时长/标签，或旧版目录补读之后），index为它的索引
+struct CatalogUpdate {
+    std::shared_ptr<const LibraryCatalog> catalog;
+    RescanDelta delta;
+    std::unique_ptr<TrackTable> table;
+    std::unique_ptr<TrigramIndex> index;
+};
+
+void PostCatalogUpdate(HWND hWnd, std::unique_ptr<CatalogUpdate> update) {
+    if (!update->catalog) return;
+    CatalogUpdate* message = update.release();
+    if (!PostMessageW(hWnd, WM_APP_CATALOG_READY, 0, (LPARAM)message)) {
+        delete message;
+    }
+}
+
+// 为table建立索引并随更新一起投递（后台线程调用）
+void PostCatalogUpdate(HWND hWnd, std::unique_ptr<CatalogUpdate> update, std::unique_ptr<TrackTable> table) {
+    update->index = std::make_unique<TrigramIndex>();
+    update->index->Build(*table);
+    update->table = std::move(table);
+    PostCatalogUpdate(hWnd, std::move(update));
+}
+
+// -------------------------- 补全音频指纹并统计重复曲目（后台线程调用），返回摘要文本 --------------------------
+// 只有音频数据区大小相同的文件才会被完整读取，已有指纹的曲目直接复用目录中保存的值
+std::wstring FindDuplicates(DuplicateFinder* finder, const std::string& rootUtf8, std::vector<CatalogEntry>& entries) {
+    DuplicateStats stats;
+    finder->Run(rootUtf8, entries, DuplicateOptions(), stats);
+    return L"重复曲目：" + std::to_wstring(stats.groups) + L" 组（其中逐字节相同 " +
+           std::to_wstring(stats.byteIdenticalGroups) + L"），可清理 " + std::to_wstring(stats.duplicateFiles) +
+           L" 个副本；计算指纹 " + std::to_wstring(stats.hashed) + L" 个文件，" +
+           std::to_wstring(static_cast<long long>(stats.MegabytesPerSecond())) + L" MB/s\n";
+}
+
+// -------------------------- 丢弃已修改或已删除文件的缓存PCM（后台线程调用） --------------------------
+void ForgetChangedPcm(const std::shared_ptr<PcmCache>& cache, const std::wstring& rootWide, const RescanDelta& delta) {
+    if (!cache) return;
+    auto erase = [&](const std::string& relPath) {
+        std::wstring fullPath = rootWide;
+        fullPath.push_back(static_cast<wchar_t>(kPathSep));
+        fullPath += Utf8ToWide(relPath);
+        cache->Erase(fullPath);
+    };
+    for (const auto& entry : delta.modified) erase(entry.path);
+    for (const auto& path : delta.removed) erase(path);
+}
+
+// -------------------------- 由已有目录构建的曲目数据（后台线程构建，投递给UI线程整体换入） --------------------------
+// 先投递路径池与曲目表（列表随即可用，搜索顺序扫描），索引建好后再单独投递
+struct LibraryData {
+    std::shared_ptr<const LibraryCatalog> catalog; // 路径池与曲目表对应的目录
+    std::unique_ptr<TrackPathPool> paths;
+    std::unique_ptr<TrackTable> table;
+    std::unique_ptr<TrigramIndex> index;
+};
+
+void PostLibraryData(HWND hWnd, std::unique_ptr<LibraryData> data) {
+    LibraryData* message = data.release();
+    if (!PostMessageW(hWnd, WM_APP_LIBRARY_READY, 0, (LPARAM)message)) {
+        delete message;
+    }
+}
+
+// 按目录顺序构建路径池与曲目表，再在曲目表的副本上建立索引（后台线程调用，已取消时不再建立索引）
+void BuildLibraryData(HWND hWnd, const std::shared_ptr<const LibraryCatalog>& catalog,
+                      const LibraryRescanner& rescanner) {
+    auto data = std::make_unique<LibraryData>();
+    data->catalog = catalog;
+    data->paths = std::make_unique<TrackPathPool>();
+    data->table = std::make_unique<TrackTable>();
+    size_t pathBytes = 0;
+    for (std::uint32_t id = 0; id < catalog->TrackCount(); ++id) {
+        pathBytes += catalog->TrackPath(id).size(); // UTF-8字节数不少于UTF-16字符数
+    }
+    data->paths->Reserve(catalog->TrackCount(), pathBytes);
+    for (std::uint32_t id = 0; id < catalog->TrackCount(); ++id) {
+        data->paths->Add(Utf8ToWide(catalog->TrackPath(id)));
+    }
+    data->table->Build(*catalog);
+    TrackTable table = *data->table; // UI线程换入后可能继续修改曲目表，索引在副本上建立
+    PostLibraryData(hWnd, std::move(data));
+    if (rescanner.IsCancelled()) return;
+
+    auto indexed = std::make_unique<LibraryData>();
+    indexed->index = std::make_unique<TrigramIndex>();
+    indexed->index->Build(table);
+    PostLibraryData(hWnd, std::move(indexed));
+}
+
+// -------------------------- 加载音乐列表（优先使用持久化目录，后台增量重扫校验） --------------------------
 void LoadMusicList() {
-    g_musicList.clear();
-    g_originalMusicList.clear(); // 清空原始列表
+    StopLibraryScan(); // 若上一次扫描尚未结束，先取消
+    g_catalog.reset();   // 路径池清空后不再与旧目录的id对应
+    g_musicList.Clear();
+    g_trackPaths.Clear(); // 清空原始列表
+    {
+        // 放弃进行中的搜索（结果中的id已失效），扫描期间新曲目按最近输入的关键词逐批过滤
+        std::unique_lock<std::mutex> dataLock = LockSearchData(true);
+        g_trackTable.Clear();
+        g_trackIndex.Clear();
+        g_trackIndexPending = false;
+        g_trackIndexStale.clear();
+        g_removedTracks.Clear();
+        ForgetRecentlyPlayed();
+        g_searchKey.clear();
+        AppendFoldedWide(g_searchKeyword, g_searchKey);
+    }
+    if (g_hMusicList != NULL) {
+        SendMessageW(g_hMusicList, LB_SETCOUNT, 0, 0);
+    }
     
     // 1. 拼接music文件夹路径（UTF-16）
     std::wstring musicDir = GetExeDir() + L"/music/"; // 使用/兼容跨平台，fs会自动处理
@@ -252,88 +461,370 @@ void LoadMusicList() {
         return;
     }
 
-    try {
-        // 2. 遍历文件夹，筛选音频文件
-        for (const auto& entry : fs::directory_iterator(musicDirPath)) {
-            if (entry.is_directory()) continue;
-
-            // 直接获取文件完整UTF-16路径（无编码转换）
-            std::wstring fullPath = entry.path().wstring();
-            // 获取扩展名（UTF-16）
-            std::wstring ext = entry.path().extension().wstring();
-            
-            // 扩展名转小写（宽字符版本）
-            std::transform(ext.begin(), ext.end(), ext.begin(), ::towlower);
+    // 2. 启动时直接映射上次保存的目录，无需等待磁盘遍历即可显示列表
+    //   路径池/曲目表/索引由后台线程构建（见下），UI线程只在WM_APP_LIBRARY_READY中换入
+    g_musicRootUtf8 = TrimTrailingSeparators(WideToUtf8(musicDir));
+    g_musicRootWide = Utf8ToWide(g_musicRootUtf8);
+    std::string catalogPath = WideToUtf8(GetCatalogPath());
+    std::shared_ptr<const LibraryCatalog> catalog = LibraryCatalog::Open(catalogPath);
+
+    // 3. 在后台线程校验目录，UI线程不阻塞
+    //   - 已有目录：增量重扫，只列举mtime变化的目录，未变化的子树不再遍历
+    //   - 没有目录（首次启动）：全量递归扫描，结果同时分批投递给UI线程边扫边显示
+    // 发现变化时重建并保存目录，再通过WM_APP_CATALOG_READY把新目录与增量交给UI线程；投递失败（窗口已销毁）时就地释放
+    HWND hWnd = g_hMainWnd;
+    std::string rootUtf8 = g_musicRootUtf8;
+    std::wstring rootWide = g_musicRootWide;
+    std::shared_ptr<PcmCache> cache = g_pcmCache;
+
+    // 4. 同时启动实时监视：校验期间发生的变化先累积，校验结束后（OnScanDone设置基准目录）再合并应用
+    g_watcher = std::make_unique<LibraryWatcher>(rootUtf8, catalogPath, WatchOptions(),
+        [hWnd, rootWide, cache](const std::shared_ptr<const LibraryCatalog>& fresh, const RescanDelta& delta) {
+            ForgetChangedPcm(cache, rootWide, delta);
+            auto update = std::make_unique<CatalogUpdate>();
+            update->catalog = fresh;
+            update->delta = delta;
+            PostCatalogUpdate(hWnd, std::move(update));
+        });
+    if (!g_watcher->Start()) {
+        g_watcher.reset(); // 不支持监视（例如网络路径），仅在启动时校验
+    }
+
+    if (catalog) {
+        g_rescanner = std::make_unique<LibraryRescanner>();
+        g_duplicateFinder = std::make_unique<DuplicateFinder>();
+        LibraryRescanner* rescanner = g_rescanner.get();
+        DuplicateFinder* finder = g_duplicateFinder.get();
+        g_scanThread = std::thread([rescanner, finder, hWnd, rootUtf8, rootWide, cache, catalogPath, catalog]() {
+            BuildLibraryData(hWnd, catalog, *rescanner);
+            RescanResult result = rescanner->Rescan(rootUtf8, *catalog, RescanOptions());
+            ForgetChangedPcm(cache, rootWide, result.delta);
+            std::wstring duplicates;
+            if (!result.changed && !rescanner->IsCancelled() && NeedsFingerprinting(*catalog)) {
+                // 目录未变化但缺少指纹（新增曲目或旧版目录）：补全后同样重建保存
+                result.entries = catalog->ToEntries();
+                result.dirs = catalog->ToDirEntries();
+                result.changed = true;
+            }
+            if (result.changed) {
+                duplicates = FindDuplicates(finder, rootUtf8, result.entries);
+            }
+            if (result.changed && !finder->IsCancelled()) {
+                auto update = std::make_unique<CatalogUpdate>();
+                update->delta = result.delta;
+                update->catalog = SaveCatalog(catalogPath, std::move(result.entries), std::move(result.dirs),
+                                              catalog->Generation() + 1);
+                if (update->catalog && (!catalog->HasTags() || !catalog->HasDurations() || !catalog->HasFormats())) {
+                    // 旧版目录缺少的标签/时长/格式已在重扫时全部补读：按路径池的id（即旧目录中的id）重建曲目表
+                    const LibraryCatalog& fresh = *update->catalog;
+                    auto table = std::make_unique<TrackTable>();
+                    for (std::uint32_t id = 0; id < catalog->TrackCount(); ++id) {
+                        const std::uint32_t freshId = fresh.FindTrack(catalog->TrackPath(id));
+                        if (freshId != LibraryCatalog::kInvalidTrack) {
+                            table->Append(fresh, freshId);
+                        } else {
+                            table->Append(*catalog, id); // 已删除，随增量从列表中移除
+                        }
+                    }
+                    PostCatalogUpdate(hWnd, std::move(update), std::move(table));
+                } else {
+                    PostCatalogUpdate(hWnd, std::move(update));
+                }
+            }
+            const RescanStats& stats = result.stats;
+            auto* summary = new std::wstring(
+                L"曲库增量重扫完成：新增 " + std::to_wstring(result.delta.added.size()) +
+                L"，删除 " + std::to_wstring(result.delta.removed.size()) +
+                L"，修改 " + std::to_wstring(result.delta.modified.size()) +
+                L"；检查 " + std::to_wstring(stats.dirsChecked) + L" 个目录（重新列举 " +
+                std::to_wstring(stats.dirsListed) + L"，跳过 " + std::to_wstring(stats.dirsSkipped) +
+                L"，新目录 " + std::to_wstring(stats.dirsNew) + L"），核对 " +
+                std::to_wstring(stats.filesChecked) + L" 个文件，耗时 " +
+                std::to_wstring(static_cast<int>(stats.seconds * 1000)) + L" ms\n" + duplicates);
+            if (!PostMessageW(hWnd, WM_APP_SCAN_DONE, 0, (LPARAM)summary)) {
+                delete summary;
+            }
+        });
+        return;
+    }
 
-            // 过滤支持的音频格式
-            if (ext == L".mp3" || ext == L".wav" || ext == L".flac" || ext == L".ogg") {
-                g_musicList.push_back(fullPath); // 存储原生UTF-16路径
-                g_originalMusicList.push_back(fullPath); // 保存到原始列表
+    g_scanner = std::make_unique<LibraryScanner>();
+    g_duplicateFinder = std::make_unique<DuplicateFinder>();
+    LibraryScanner* scanner = g_scanner.get();
+    DuplicateFinder* finder = g_duplicateFinder.get();
+    g_scanThread = std::thread([scanner, finder, hWnd, rootUtf8, catalogPath]() {
+        std::vector<CatalogEntry> entries;
+        std::vector<CatalogDirEntry> dirs;
+        ScanOptions scanOptions;
+        scanOptions.probeFiles = true; // 标签与时长在扫描线程中并行探测，随目录一起保存
+        ScanStats stats = scanner->Scan(rootUtf8, scanOptions,
+                                        [&](std::vector<ScannedFile>& batch, std::vector<ScannedDir>& doneDirs) {
+            for (const auto& dir : doneDirs) {
+                dirs.push_back(CatalogDirEntry{RelativePath(rootUtf8, dir.path), dir.mtime});
             }
+            if (batch.empty()) return;
+            auto* paths = new std::vector<std::wstring>();
+            paths->reserve(batch.size());
+            for (const auto& file : batch) {
+                CatalogEntry entry;
+                entry.path = RelativePath(rootUtf8, file.path);
+                entry.size = file.size;
+                entry.mtime = file.mtime;
+                entry.tags = file.tags;
+                entry.durationMs = file.durationMs;
+                entry.format = file.format;
+                entries.push_back(std::move(entry));
+                paths->push_back(Utf8ToWide(entries.back().path));
+            }
+            if (!PostMessageW(hWnd, WM_APP_SCAN_BATCH, 0, (LPARAM)paths)) {
+                delete paths;
+            }
+        });
+        std::wstring duplicates;
+        if (!scanner->IsCancelled()) {
+            duplicates = FindDuplicates(finder, rootUtf8, entries);
+        }
+        if (!scanner->IsCancelled() && !finder->IsCancelled()) {
+            // 路径池按扫描顺序逐批追加，曲目表按同一顺序补齐大小/时长/标签后整体替换
+            auto table = std::make_unique<TrackTable>();
+            for (const auto& entry : entries) table->Append(entry);
+            auto update = std::make_unique<CatalogUpdate>();
+            update->catalog = SaveCatalog(catalogPath, std::move(entries), std::move(dirs), 1);
+            PostCatalogUpdate(hWnd, std::move(update), std::move(table));
         }
 
-        // 填充音乐列表（如果列表框已创建）
-        if (g_hMusicList != NULL) {
-            // 先清空原有内容
-            SendMessageW(g_hMusicList, LB_RESETCONTENT, 0, 0);
-            // 重新填充
-            for (const auto& path : g_musicList) {
-                std::wstring fileName = GetFileName(path);
-                SendMessageW(g_hMusicList, LB_ADDSTRING, 0, (LPARAM)fileName.c_str());
+        auto* summary = new std::wstring(
+            L"曲库扫描完成：" + std::to_wstring(stats.files) + L" 首，" +
+            std::to_wstring(stats.directories) + L" 个目录，耗时 " +
+            std::to_wstring(static_cast<int>(stats.seconds * 1000)) + L" ms，" +
+            std::to_wstring(static_cast<long long>(stats.FilesPerSecond())) + L" 文件/秒\n" + duplicates);
+        if (!PostMessageW(hWnd, WM_APP_SCAN_DONE, 0, (LPARAM)summary)) {
+            delete summary;
+        }
+    });
+}
+
+// -------------------------- 换入后台构建的曲目数据（UI线程） --------------------------
+void OnLibraryData(LibraryData& data) {
+    if (data.paths && data.table) {
+        // 启动时列表为空、没有播放中的曲目，曲目id即目录中的id
+        std::unique_lock<std::mutex> dataLock = LockSearchData(true);
+        g_catalog = data.catalog;
+        g_trackPaths = std::move(*data.paths);
+        g_trackTable = std::move(*data.table);
+        g_trackIndex.Clear(); // 索引建好之前搜索退回顺序扫描
+        g_trackIndexPending = true;
+        g_trackIndexStale.clear();
+        SearchMusicNow();
+        return;
+    }
+    if (data.index && g_trackIndexPending) {
+        std::unique_lock<std::mutex> dataLock = LockSearchData(false);
+        g_trackIndex = std::move(*data.index);
+        g_trackIndex.Update(g_trackTable); // 建立索引期间追加到表末尾的曲目
+        g_trackIndex.Repost(g_trackTable, g_trackIndexStale); // 以及原位修改的曲目
+        g_trackIndexStale.clear();
+        g_trackIndexPending = false;
+    }
+}
+
+// -------------------------- 应用曲库更新（UI线程）：曲目id不变，只重新准备被删除或修改的曲目 --------------------------
+// 删除的曲目从列表中移除；修改的曲目原位替换曲目表中的行（id与列表位置不变），检索键改变（标签被编辑）时重新索引该行；
+// 新增的曲目追加在路径池/曲目表末尾，索引只增量索引新行
+// 正在播放的曲目被删除时继续播完（不再选中）；下一首或等待播放的曲目被删除/修改时才重新准备
+void ApplyCatalogUpdate(CatalogUpdate& update) {
+    const RescanDelta& delta = update.delta;
+    const bool replaced = update.table != nullptr && update.table->Size() == g_trackPaths.Size();
+    const std::uint32_t selectedId =
+        g_curIndex >= 0 && g_curIndex < (int)g_musicList.Size() ? g_musicList[g_curIndex] : TrackListView::kNotFound;
+    TrackBitmap removed;                // 本次删除的曲目
+    TrackBitmap changed;                // 本次删除或修改的曲目（链上与预取中的须放弃）
+    std::vector<std::uint32_t> appended;
+    {
+        // 已有曲目的行被替换或修改时，后台搜索进行中的求值与缓存的结果一并作废
+        const bool rowsChanged = replaced || !delta.modified.empty();
+        std::unique_lock<std::mutex> dataLock = LockSearchData(rowsChanged);
+        if (replaced) {
+            g_trackTable = std::move(*update.table);
+            g_trackIndex = std::move(*update.index);
+            g_trackIndexPending = false;
+            g_trackIndexStale.clear();
+        }
+        auto forget = [&](std::uint32_t id) {
+            g_trackPaths.Forget(id);
+            g_removedTracks.Add(id);
+            removed.Add(id);
+            changed.Add(id);
+        };
+        auto append = [&](const std::wstring& path, const CatalogEntry& entry) {
+            const std::uint32_t id = g_trackPaths.Add(path);
+            g_trackTable.Append(entry);
+            appended.push_back(id);
+        };
+        for (const auto& path : delta.removed) {
+            const std::uint32_t id = g_trackPaths.Find(Utf8ToWide(path));
+            if (id != TrackPathPool::kNotFound) forget(id);
+        }
+        std::vector<TrackRowUpdate> rows; // 原位替换的曲目
+        for (const auto& entry : delta.modified) {
+            const std::wstring path = Utf8ToWide(entry.path);
+            const std::uint32_t id = g_trackPaths.Find(path);
+            if (id == TrackPathPool::kNotFound) {
+                append(path, entry);
+                continue;
+            }
+            rows.push_back(TrackRowUpdate{id, &entry});
+            changed.Add(id);
+        }
+        std::vector<std::uint32_t> keyChanged;
+        g_trackTable.Replace(rows, keyChanged);
+        for (const auto& entry : delta.added) {
+            const std::wstring path = Utf8ToWide(entry.path);
+            const std::uint32_t id = g_trackPaths.Find(path);
+            if (id != TrackPathPool::kNotFound) forget(id); // 路径池中已有同一路径（不应出现），以新条目为准
+            append(path, entry);
+        }
+        if (!g_trackIndexPending) {
+            g_trackIndex.Update(g_trackTable); // 新曲目追加在表末尾，只需索引新行
+            g_trackIndex.Repost(g_trackTable, keyChanged); // 检索键改变的曲目按新检索键重新索引
+        } else {
+            g_trackIndexStale.insert(g_trackIndexStale.end(), keyChanged.begin(), keyChanged.end());
+        }
+        g_catalog = update.catalog;
+
+        if (rowsChanged) {
+            // 大小/时长/检索键变化，按字段条件（duration>等）筛选的结果可能不同：按最近输入的关键词重新过滤
+            EvaluateSearchNow();
+            UpdateMusicListView();
+        } else {
+            if (!removed.Empty()) g_musicList.Remove(removed);
+            const TrackQuery query(g_searchKey);
+            for (std::uint32_t id : appended) {
+                if (query.Matches(g_trackTable, id)) g_musicList.Append(id);
             }
         }
-    } catch (const fs::filesystem_error& e) {
-        // 错误信息转换为宽字符显示（修复：先转宽字符再拼接）
-        std::wstring errMsg = L"文件遍历错误：";
-        errMsg += CharToWStr(e.what()); // 使用辅助函数转换char*到wstring
-        MessageBoxW(NULL, errMsg.c_str(), L"错误", MB_ICONERROR);
+    }
+
+    // 列表位置可能移动：按曲目id重新定位选中项
+    const std::uint32_t index = g_musicList.IndexOf(selectedId);
+    g_curIndex = index == TrackListView::kNotFound ? -1 : static_cast<int>(index);
+    RefreshMusicListBox();
+    if (g_hMusicList != NULL && g_curIndex >= 0) {
+        SendMessageW(g_hMusicList, LB_SETCURSEL, g_curIndex, 0);
+    }
+    RequeueNextTrack(&changed);
+}
+
+// 辅助函数：曲目的完整路径（UTF-16，供miniaudio打开文件）
+static std::wstring GetTrackFullPath(std::uint32_t id) {
+    std::wstring_view relPath = g_trackPaths.Path(id);
+    std::wstring fullPath;
+    fullPath.reserve(g_musicRootWide.size() + 1 + relPath.size());
+    fullPath.append(g_musicRootWide).push_back(static_cast<wchar_t>(kPathSep));
+    fullPath.append(relPath);
+    return fullPath;
+}
+
+// -------------------------- 处理一批扫描结果（UI线程） --------------------------
+void OnScanBatch(std::vector<std::wstring>& paths) {
+    std::unique_lock<std::mutex> dataLock = LockSearchData(false); // 追加期间后台搜索不得读取曲目表/索引
+    const TrackQuery query(g_searchKey);
+    for (const auto& path : paths) {
+        // 新发现的文件若符合当前搜索条件，则同步追加到显示列表
+        // 大小/时长在扫描结束、由目录重建曲目表时补齐
+        std::uint32_t id = g_trackPaths.Add(path);
+        std::string name = WideToUtf8(g_trackPaths.Name(id));
+        g_trackTable.Append(name, 0, 0, AudioFormatFromName(name));
+        if (query.Matches(g_trackTable, id)) {
+            g_musicList.Append(id);
+        }
+    }
+    g_trackIndex.Update(g_trackTable); // 新曲目追加在表末尾，只需索引本批
+    dataLock.unlock();
+    RefreshMusicListBox();
+    if (g_hMusicList != NULL && g_curIndex >= 0 && g_curIndex < (int)g_musicList.Size()) {
+        SendMessageW(g_hMusicList, LB_SETCURSEL, g_curIndex, 0); // 追加条目后保持选中项
     }
 }
 
-// 辅助函数：从UTF-16路径中提取文件名（用于列表框显示）
-std::wstring GetFileName(const std::wstring& wFullPath) {
-    fs::path path(wFullPath);
-    return path.filename().wstring();
+// -------------------------- 扫描结束（UI线程） --------------------------
+void OnScanDone(const std::wstring& summary) {
+    if (g_scanThread.joinable()) {
+        g_scanThread.join();
+    }
+    g_scanner.reset();
+    g_rescanner.reset();
+    g_duplicateFinder.reset();
+
+    // 以校验后的目录作为实时监视的基准
+    if (g_watcher && g_catalog) {
+        g_watcher->SetCatalog(g_catalog);
+    }
+
+    // 输出扫描统计（可用DebugView查看）
+    OutputDebugStringW(summary.c_str());
+}
+
+// -------------------------- 刷新列表框（LBS_NODATA：只设置条目数，绘制时按id从路径池取文件名） --------------------------
+void RefreshMusicListBox() {
+    if (g_hMusicList == NULL) return;
+    SendMessageW(g_hMusicList, LB_SETCOUNT, g_musicList.Size(), 0);
+    InvalidateRect(g_hMusicList, NULL, TRUE);
+}
+
+// -------------------------- 绘制列表框条目（WM_DRAWITEM） --------------------------
+void DrawMusicListItem(const DRAWITEMSTRUCT* dis) {
+    const bool selected = (dis->itemState & ODS_SELECTED) != 0;
+    FillRect(dis->hDC, &dis->rcItem, GetSysColorBrush(selected ? COLOR_HIGHLIGHT : COLOR_WINDOW));
+    if (dis->itemID != (UINT)-1 && dis->itemID < g_musicList.Size()) {
+        std::wstring_view name = g_trackPaths.Name(g_musicList[dis->itemID]);
+        RECT rc = dis->rcItem;
+        rc.left += 2;
+        SetBkMode(dis->hDC, TRANSPARENT);
+        SetTextColor(dis->hDC, GetSysColor(selected ? COLOR_HIGHLIGHTTEXT : COLOR_WINDOWTEXT));
+        DrawTextW(dis->hDC, name.data(), static_cast<int>(name.size()), &rc,
+                  DT_LEFT | DT_SINGLELINE | DT_VCENTER | DT_NOPREFIX | DT_END_ELLIPSIS);
+    }
+    if (dis->itemState & ODS_FOCUS) {
+        DrawFocusRect(dis->hDC, &dis->rcItem);
+    }
 }
 
 // -------------------------- 搜索音乐功能（核心修改：无结果时不停止播放） --------------------------
-void SearchMusic(const std::wstring& keyword) {
-    g_searchKeyword = keyword;
-    g_musicList.clear();
+// 持有锁期间后台搜索线程不读取曲目表/索引；修改它们或在UI线程上查询索引之前须先加锁
+// invalidate：曲目表被清空/整体替换，或已有曲目的行被修改，进行中与缓存的搜索结果均作废（只追加新曲目时不必）
+std::unique_lock<std::mutex> LockSearchData(bool invalidate) {
+    if (!g_searchWorker) return std::unique_lock<std::mutex>();
+    if (invalidate) {
+        g_searchWorker->Cancel(); // 已投递、尚未处理的结果也随之作废
+    }
+    return g_searchWorker->LockData(invalidate);
+}
 
-    // 如果关键词为空，恢复原始列表
-    if (keyword.empty()) {
-        g_musicList = g_originalMusicList;
+// 以g_searchKey对应的结果设置列表视图（g_searchKey为空时显示全部，否则显示g_searchResults + g_searchRest），
+// 不含已从曲库删除的曲目
+void UpdateMusicListView() {
+    // 如果关键词为空，恢复原始列表（只切换视图模式，不复制）
+    if (g_searchKey.empty()) {
+        g_musicList.ShowAll(g_trackPaths.Size());
     } else {
-        // 转换关键词为小写，实现不区分大小写搜索
-        std::wstring lowerKeyword = keyword;
-        std::transform(lowerKeyword.begin(), lowerKeyword.end(), lowerKeyword.begin(), ::towlower);
-
-        // 遍历原始列表，筛选包含关键词的文件
-        for (const auto& path : g_originalMusicList) {
-            std::wstring fileName = GetFileName(path);
-            std::wstring lowerFileName = fileName;
-            std::transform(lowerFileName.begin(), lowerFileName.end(), lowerFileName.begin(), ::towlower);
-
-            // 检查文件名是否包含关键词
-            if (lowerFileName.find(lowerKeyword) != std::wstring::npos) {
-                g_musicList.push_back(path);
-            }
-        }
+        g_musicList.ShowFiltered(std::move(g_searchResults), std::move(g_searchRest));
     }
+    if (!g_removedTracks.Empty()) {
+        g_musicList.Remove(g_removedTracks);
+    }
+}
+
+// 以g_searchKey对应的结果刷新列表
+static void ShowSearchResults() {
+    UpdateMusicListView();
 
     // 更新列表框显示
-    if (g_hMusicList != NULL) {
-        SendMessageW(g_hMusicList, LB_RESETCONTENT, 0, 0);
-        for (const auto& path : g_musicList) {
-            std::wstring fileName = GetFileName(path);
-            SendMessageW(g_hMusicList, LB_ADDSTRING, 0, (LPARAM)fileName.c_str());
-        }
-    }
+    RefreshMusicListBox();
 
     // 【核心修改】调整无搜索结果的处理逻辑：仅重置索引，不停止播放
-    if (g_curIndex >= (int)g_musicList.size()) {
-        if (!g_musicList.empty()) {
+    if (g_curIndex >= (int)g_musicList.Size()) {
+        if (!g_musicList.Empty()) {
             g_curIndex = 0; // 重置到第一个搜索结果
         } else {
             // 无搜索结果时：仅重置索引，保留当前播放状态/音频资源/进度定时器
@@ -342,15 +833,66 @@ void SearchMusic(const std::wstring& keyword) {
             // 不调用UninitCurrentSound、不修改playState、不销毁定时器、不清空进度条、不修改按钮文字
         }
     }
+    RequeueNextTrack(); // 列表变化后下一首可能不同
+}
+
+// 边输入边搜索：关键词交给后台线程求值（继续输入时只在上次结果中筛选），结果由OnSearchResult发布
+// 新的输入会取代尚未完成的求值，列表只显示最新一次的结果
+void SearchMusic(const std::wstring& keyword) {
+    g_searchKeyword = keyword;
+    // 折叠关键词，实现不区分大小写搜索
+    std::string key;
+    AppendFoldedWide(keyword, key);
+    if (key.empty() || !g_searchWorker) {
+        // 清空关键词只需切换视图模式，直接在UI线程完成
+        std::unique_lock<std::mutex> dataLock = LockSearchData(false);
+        if (g_searchWorker) g_searchWorker->Cancel();
+        SearchMusicNow();
+        return;
+    }
+    g_searchWorker->Submit(std::move(key));
+}
+
+// 在UI线程上按g_searchKeyword求出g_searchKey对应的结果（调用方须持有LockSearchData返回的锁）
+void EvaluateSearchNow() {
+    g_searchKey.clear();
+    AppendFoldedWide(g_searchKeyword, g_searchKey);
+    if (!g_searchKey.empty()) {
+        // 三元组索引求出候选曲目后校验子串并按得分排列，再按字段条件（artist:/duration>等）筛选
+        SearchTracks(g_trackTable, g_trackIndex, TrackQuery(g_searchKey), g_searchResults);
+        SplitRankedIds(g_searchResults, g_searchRest);
+    }
+}
+
+// 在UI线程上按g_searchKeyword立即过滤（调用方须持有LockSearchData返回的锁）
+void SearchMusicNow() {
+    EvaluateSearchNow();
+    ShowSearchResults();
+}
+
+// 发布后台搜索的结果（UI线程）；已被更新的输入取代的结果直接丢弃
+void OnSearchResult(std::unique_ptr<SearchResult> result) {
+    if (!g_searchWorker || result->ticket != g_searchWorker->LatestTicket()) return;
+    // 求值之后扫描批次追加的曲目：OnScanBatch按当时列表的关键词过滤，这里按新关键词补齐
+    g_searchResults.clear();
+    TrackQuery(result->key).Scan(g_trackTable, result->tracks, g_trackTable.Size(), g_searchResults, QueryOptions());
+    for (std::uint32_t id : g_searchResults) result->rest.Add(id); // 新曲目id最大，追加在位图末尾
+    g_searchKey = std::move(result->key);
+    g_searchResults = std::move(result->ids);
+    g_searchRest = std::move(result->rest);
+    ShowSearchResults();
 }
 
 // 【优化2】修改UninitCurrentSound：清空缓存 + 恢复默认标题
-void UninitCurrentSound() {
+// reuseTrack：即将播放的曲目，已预先打开并连接在链上时取出返回（不释放）
+std::unique_ptr<TrackSource> UninitCurrentSound(std::uint32_t reuseTrack) {
     std::lock_guard<std::mutex> lock(g_engineMutex); // 恢复原普通mutex
     if (g_soundInitialized) {
         ma_sound_uninit(&g_sound);
         g_soundInitialized = MA_FALSE;
     }
+    std::unique_ptr<TrackSource> reused = g_chain.Take(reuseTrack);
+    g_chain.Reset(); // 数据源须在声音释放之后释放
     // 清空总时长缓存和进度更新时间戳
     g_totalDuration = 0.0f;
     g_lastProgressUpdate = 0;
@@ -359,6 +901,7 @@ void UninitCurrentSound() {
     if (g_playState == STOPPED && g_hMainWnd != NULL) {
         SetWindowTextW(g_hMainWnd, g_defaultWindowTitle.c_str());
     }
+    return reused;
 }
 
 // 安全创建进度定时器
@@ -379,12 +922,18 @@ void DestroyProgressTimer() {
     }
 }
 
+// 音频线程：每次读取结束时调用，数据源链据此释放断开的下一首
+static void OnEngineProcess(void*, float*, ma_uint64) {
+    g_chain.AudioProcessed();
+}
+
 // 【新增】音频引擎初始化函数（放到子线程执行）
 void InitAudioEngine() {
     std::lock_guard<std::mutex> lock(g_engineMutex); // 恢复原普通mutex
     ma_engine_config engineConfig = ma_engine_config_init();
     engineConfig.channels   = 1;        // Must be set when not using a device.
     engineConfig.sampleRate = 48000;    // 采样率（通用48000Hz）
+    engineConfig.onProcess  = OnEngineProcess; // 音频线程每次读取结束时通知数据源链
 
     // 初始化音频引擎（使用自定义配置）
     ma_result result = ma_engine_init(&engineConfig, &g_engine);
@@ -392,71 +941,169 @@ void InitAudioEngine() {
         g_engineInitSuccess = false;
     } else {
         g_engineInitSuccess = true;
+        // 链上的解码器直接输出引擎的格式，曲目之间无需重建格式转换
+        g_chain.SetOutputFormat(ma_engine_get_channels(&g_engine), ma_engine_get_sample_rate(&g_engine));
     }
 
     g_engineInitialized = true; // 标记初始化完成
     g_engineCV.notify_one();   // 通知主线程
 }
 
-// 【优化4】修改PlayMusic：缓存总时长 + 加锁保护g_engine + 更新窗口标题
-void PlayMusic(int index) {
-    if (index < 0 || index >= g_musicList.size()) return;
-    if (!g_engineInitSuccess) { // 引擎未初始化成功则返回
-        MessageBoxW(g_hMainWnd, L"音频引擎未初始化成功，无法播放音乐！", L"错误", MB_ICONERROR);
-        return;
-    }
+// 辅助函数：曲目的总时长（秒），无效时为0；调用方须持有g_engineMutex
+// 优先使用扫描时探测并保存在目录中的时长；ma_sound_get_length_in_seconds对没有
+// 索引信息的VBR MP3需要逐帧扫描整个文件，只在目录中没有时长时才调用
+static float TrackDurationSeconds(std::uint32_t trackId) {
+    std::uint32_t durationMs = g_trackTable.DurationMs(trackId); // 首次扫描中或时长未知时为0
+    if (durationMs > 0) return durationMs / 1000.0f;
+    float seconds = 0.0f;
+    ma_result durRes = ma_sound_get_length_in_seconds(&g_sound, &seconds); // 链头转发给正在播放的曲目
+    return durRes == MA_SUCCESS && seconds > 0.0f ? seconds : 0.0f;
+}
 
-    UninitCurrentSound(); // 释放当前播放的声音
+// 辅助函数：窗口标题显示正在播放的曲目
+static void ShowNowPlayingTitle(std::uint32_t trackId) {
+    std::wstring playingFileName(g_trackPaths.Name(trackId));
+    std::wstring newTitle = L"正在播放：" + playingFileName + L" - " + g_defaultWindowTitle;
+    SetWindowTextW(g_hMainWnd, newTitle.c_str());
+}
 
-    // 直接获取UTF-16路径（无编码转换）
-    std::wstring filePath = g_musicList[index];
-    if (filePath.empty()) {
-        MessageBoxW(g_hMainWnd, L"文件路径为空！", L"加载失败", MB_ICONERROR);
-        return;
+// 记录播放过的曲目（重新加载曲库时由ForgetRecentlyPlayed清空）
+static void RememberPlayed(std::uint32_t id) {
+    if (g_recentlyPlayed.Contains(id)) return;
+    g_recentlyPlayed.Add(id);
+    g_recentOrder.push_back(id);
+    if (g_recentOrder.size() > kRecentTracks) {
+        g_recentlyPlayed.Remove(g_recentOrder.front());
+        g_recentOrder.pop_front();
     }
+}
+
+void ForgetRecentlyPlayed() {
+    g_recentlyPlayed.Clear();
+    g_recentOrder.clear();
+}
+
+// 辅助函数：加载策略使用的目录信息（时长未知时为0，按流式加载）
+static TrackLoadInfo TrackLoadInfoFor(std::uint32_t trackId) {
+    TrackLoadInfo info;
+    info.format = g_trackTable.Format(trackId);
+    info.durationMs = g_trackTable.DurationMs(trackId);
+    info.fileSize = g_trackTable.FileSize(trackId);
+    return info;
+}
+
+// 辅助函数：输出播放过的曲目的加载开销（可用DebugView查看），用于调整加载策略
+static void LogTrackLoadStats(const TrackSource& track) {
+    const TrackLoadStats stats = track.Stats();
+    if (track.Id() >= g_trackPaths.Size()) return; // 曲库已重新加载
+    OutputDebugStringW((L"曲目加载：" + std::wstring(g_trackPaths.Name(track.Id())) +
+                        (stats.mode == LoadMode::Decode ? L"，整首解码" : L"，流式") +
+                        (stats.complete ? L"（全部在内存中）" : L"") + (stats.fromCache ? L"（缓存命中）" : L"") +
+                        (stats.captured ? L"（边播边保存）" : L"") +
+                        L"，常驻 " +
+                        std::to_wstring(stats.residentBytes / 1024) + L" KB，加载线程解码 " +
+                        std::to_wstring(stats.prepareDecodeNs / 1000000) + L" ms，音频线程解码 " +
+                        std::to_wstring(stats.streamDecodeNs / 1000000) + L" ms / " +
+                        std::to_wstring(stats.streamFrames) + L" 帧\n").c_str());
+}
+
+// 播放过的曲目释放之前（UI线程，音频线程已不再读取）：输出加载开销，边播边保存了整首的曲目放入PCM缓存
+static void OnTrackReleased(TrackSource& track) {
+    LogTrackLoadStats(track);
+    if (g_prefetcher) g_prefetcher->Retire(track);
+}
+
+// 辅助函数：提示曲目无法加载
+static void ShowLoadError(std::uint32_t trackId, ma_result result) {
+    // 增强错误提示：显示具体的文件名
+    std::wstring errMsg = L"无法加载音乐文件：\n" + std::wstring(g_trackPaths.Name(trackId));
+    errMsg += L"\n错误码：" + std::to_wstring(result); // 追加错误码便于调试
+    MessageBoxW(g_hMainWnd, errMsg.c_str(), L"错误", MB_ICONERROR);
+}
+
+// 以已加载的曲目开始播放：作为数据源链上的当前曲目，以链头创建g_sound（第一个采样来自内存中的引导段）
+static void StartPlayback(std::uint32_t trackId, std::unique_ptr<TrackSource> track) {
+    g_loadingTrackId = PlaybackChain::kNoTrack;
 
     // 关键修改：加锁访问g_engine
     std::lock_guard<std::mutex> lock(g_engineMutex); // 恢复原普通mutex
-    // 调用miniaudio宽字符版本API，直接传UTF-16路径
-    ma_result result = ma_sound_init_from_file_w(&g_engine, filePath.c_str(), 0, NULL, NULL, &g_sound);
+    g_chain.Open(std::move(track));
+    // 不使用变调：跳过ma_sound内部的重采样，链上的采样原样送入引擎
+    ma_result result = ma_sound_init_from_data_source(&g_engine, g_chain.Head(), MA_SOUND_FLAG_NO_PITCH, NULL, &g_sound);
     if (result != MA_SUCCESS) {
-        // 增强错误提示：显示具体的文件名
-        std::wstring errMsg = L"无法加载音乐文件：\n" + GetFileName(g_musicList[index]);
-        errMsg += L"\n错误码：" + std::to_wstring(result); // 追加错误码便于调试
-        MessageBoxW(g_hMainWnd, errMsg.c_str(), L"错误", MB_ICONERROR);
+        g_chain.Reset();
+        ShowLoadError(trackId, result);
         return;
     }
 
     g_soundInitialized = MA_TRUE;
     
     // 【核心优化】仅在播放开始时获取一次总时长并缓存
-    ma_result durRes = ma_sound_get_length_in_seconds(&g_sound, &g_totalDuration);
-    if (durRes != MA_SUCCESS || g_totalDuration <= 0.0f) {
-        g_totalDuration = 0.0f; // 标记无效时长
-    }
+    g_totalDuration = TrackDurationSeconds(trackId);
 
     ma_sound_set_volume(&g_sound, g_volume / 100.0f); // 设置音量
     ma_sound_set_looping(&g_sound, g_loopMode == LOOP_SINGLE ? MA_TRUE : MA_FALSE); // 设置单曲循环
     ma_sound_start(&g_sound); // 开始播放
 
-    // 更新全局状态
-    g_curIndex = index;
+    // 更新全局状态（加载期间列表可能已变化，按id重新定位）
+    const std::uint32_t index = g_musicList.IndexOf(trackId);
+    g_curIndex = index != TrackListView::kNotFound ? static_cast<int>(index) : -1;
     g_playState = PLAYING;
+    RememberPlayed(trackId); // 随机播放时优先排除
+    QueueNextTrack();        // 预取下一首，播完时无缝衔接、跳到下一首时从内存开始播放
     g_lastProgressUpdate = GetTickCount(); // 重置进度更新时间戳
     CreateProgressTimer(); // 启动进度更新定时器
 
     // 更新列表选中状态
-    if (g_hMusicList != NULL) {
-        SendMessageW(g_hMusicList, LB_SETCURSEL, index, 0);
+    if (g_hMusicList != NULL && g_curIndex >= 0) {
+        SendMessageW(g_hMusicList, LB_SETCURSEL, g_curIndex, 0);
     }
     
     // 更新播放按钮文字
     SetWindowTextW(GetDlgItem(g_hMainWnd, IDC_BTN_PLAYPAUSE), L"暂停");
 
     // 【核心新增】设置窗口标题为正在播放的音乐名
-    std::wstring playingFileName = GetFileName(g_musicList[index]);
-    std::wstring newTitle = L"正在播放：" + playingFileName + L" - " + g_defaultWindowTitle;
-    SetWindowTextW(g_hMainWnd, newTitle.c_str());
+    ShowNowPlayingTitle(trackId);
+}
+
+// 【优化4】修改PlayMusic：不在UI线程上打开文件与解码
+// 要播放的曲目已预取好时立即开始播放；否则交给后台加载（取代尚未完成的加载），完成后由OnPrefetchReady开始播放
+void PlayMusic(int index) {
+    if (index < 0 || index >= (int)g_musicList.Size()) return;
+    if (!g_engineInitSuccess || !g_prefetcher) { // 引擎未初始化成功则返回
+        MessageBoxW(g_hMainWnd, L"音频引擎未初始化成功，无法播放音乐！", L"错误", MB_ICONERROR);
+        return;
+    }
+
+    // 释放当前播放的声音；要播放的曲目已预先连接在链上（跳到下一首）时直接沿用
+    const std::uint32_t trackId = g_musicList[index];
+    std::unique_ptr<TrackSource> prepared = UninitCurrentSound(trackId);
+    if (prepared == nullptr) {
+        // 由路径池拼接完整的UTF-16路径（无编码转换）
+        std::wstring filePath = GetTrackFullPath(trackId);
+        if (filePath.empty()) {
+            g_loadingTrackId = PlaybackChain::kNoTrack;
+            g_prefetcher->Cancel();
+            MessageBoxW(g_hMainWnd, L"文件路径为空！", L"加载失败", MB_ICONERROR);
+            return;
+        }
+        // 已预取好时直接沿用；最近播放过且整首在内存中时以缓存的PCM开始播放；
+        // 正在预取的同一首不重新加载，只是不再整首解码；否则交给后台加载
+        prepared = g_prefetcher->TakeOrRequest(trackId, std::move(filePath), TrackLoadInfoFor(trackId), true);
+    }
+    g_curIndex = index;
+    g_nextTrackId = PlaybackChain::kNoTrack; // 开始播放后重新确定
+    if (prepared != nullptr) {
+        StartPlayback(trackId, std::move(prepared));
+        return;
+    }
+    g_loadingTrackId = trackId;
+
+    if (g_hMusicList != NULL) {
+        SendMessageW(g_hMusicList, LB_SETCURSEL, index, 0);
+    }
+    std::wstring loadingTitle = L"正在加载：" + std::wstring(g_trackPaths.Name(trackId)) + L" - " + g_defaultWindowTitle;
+    SetWindowTextW(g_hMainWnd, loadingTitle.c_str());
 }
 
 // 【优化5】修改TogglePlayPause：暂停时重置时间戳 + 加锁保护
@@ -466,9 +1113,10 @@ void TogglePlayPause() {
         return;
     }
 
-    if (!g_soundInitialized || g_musicList.empty()) {
+    if (!g_soundInitialized || g_musicList.Empty()) {
+        if (g_loadingTrackId != PlaybackChain::kNoTrack) return; // 正在后台加载，完成后自动开始播放
         // 无音乐加载时，默认播放第一首
-        if (!g_musicList.empty()) {
+        if (!g_musicList.Empty()) {
             PlayMusic(0);
             SetWindowTextW(GetDlgItem(g_hMainWnd, IDC_BTN_PLAYPAUSE), L"暂停");
         } else {
@@ -496,23 +1144,135 @@ void TogglePlayPause() {
     }
 }
 
+// 随机播放：当前列表 ∖ 最近播放（直接与列表视图的位图求差，不复制列表），全部播放过时退回为当前曲目以外的全部曲目
+static int PickRandomIndex() {
+    if (g_musicList.Size() <= 1) return 0;
+    const std::uint32_t current =
+        g_curIndex >= 0 && g_curIndex < (int)g_musicList.Size() ? g_musicList[g_curIndex] : TrackBitmap::kNotFound;
+    TrackBitmap excluded = g_recentlyPlayed;
+    if (current != TrackBitmap::kNotFound) excluded.Add(current);
+    TrackBitmap candidates = g_musicList.Except(excluded);
+    if (candidates.Empty()) {
+        excluded.Clear();
+        if (current != TrackBitmap::kNotFound) excluded.Add(current);
+        candidates = g_musicList.Except(excluded);
+    }
+    // 【改进】使用 std::uniform_int_distribution 替代 % 运算，消除模偏差
+    std::uniform_int_distribution<std::uint64_t> dist(0, candidates.Cardinality() - 1);
+    return static_cast<int>(g_musicList.IndexOf(candidates.Select(dist(g_rng))));
+}
+
+// 无缝播放：确定列表中的下一首（当前曲目开始时即确定），交给后台预取，准备好后（OnPrefetchReady）连接在当前曲目之后，
+// 音频线程播完当前曲目时直接接着播放；用户提前跳到下一首时PlayMusic也直接取用预取好的曲目
+// 单曲循环时不预取（只循环当前曲目）；下一首与已连接或已请求的相同时不重新准备
+// 调用方须持有g_engineMutex
+void QueueNextTrack() {
+    if (g_loadingTrackId != PlaybackChain::kNoTrack) return; // 加载线程正在加载要播放的曲目，预取会取代它
+    std::uint32_t trackId = PlaybackChain::kNoTrack;
+    if (g_soundInitialized && !g_chain.Empty() && g_loopMode != LOOP_SINGLE && !g_musicList.Empty()) {
+        if (g_loopMode == LOOP_RANDOM && g_nextTrackId != PlaybackChain::kNoTrack &&
+            g_nextTrackId != g_chain.CurrentTrack() && g_musicList.IndexOf(g_nextTrackId) != TrackListView::kNotFound) {
+            trackId = g_nextTrackId; // 已随机选好的下一首仍在列表中
+        } else {
+            const int nextIndex =
+                g_loopMode == LOOP_RANDOM ? PickRandomIndex() : (g_curIndex + 1) % (int)g_musicList.Size();
+            trackId = g_musicList[nextIndex];
+        }
+    }
+    g_nextTrackId = trackId;
+    if (trackId == g_chain.QueuedTrack()) return;
+    g_chain.Unqueue();
+    if (!g_prefetcher) return;
+    if (trackId == PlaybackChain::kNoTrack) {
+        g_prefetcher->Cancel();
+    } else if (g_prefetcher->RequestedTrack() != trackId) {
+        // 打开失败时不连接，播完后照旧由NextMusic打开（并提示错误）
+        g_prefetcher->Request(trackId, GetTrackFullPath(trackId), TrackLoadInfoFor(trackId), false);
+    }
+}
+
+// 后台加载完成：是等待播放的曲目时开始播放（失败时提示）；仍是要连接的下一首时连接在当前曲目之后
+// 已被取代的加载不会回调，这里再按id核对一次（消息投递之后可能又有新的请求）
+static void OnPrefetchReady(std::uint32_t trackId, ma_result result) {
+    if (!g_prefetcher || !g_engineInitSuccess) return;
+    if (trackId == g_loadingTrackId) {
+        if (result != MA_SUCCESS) {
+            g_loadingTrackId = PlaybackChain::kNoTrack;
+            ShowLoadError(trackId, result);
+            return;
+        }
+        std::unique_ptr<TrackSource> track = g_prefetcher->Take(trackId);
+        if (track != nullptr) {
+            StartPlayback(trackId, std::move(track));
+        }
+        return;
+    }
+    if (result != MA_SUCCESS || trackId != g_nextTrackId) return; // 下一首打开失败时，播完后照旧由NextMusic提示
+    std::lock_guard<std::mutex> lock(g_engineMutex);
+    if (!g_soundInitialized || g_chain.Empty() || g_chain.QueuedTrack() == trackId) return;
+    std::unique_ptr<TrackSource> track = g_prefetcher->Take(trackId);
+    if (track != nullptr) {
+        g_chain.Queue(std::move(track));
+    }
+}
+
+// 列表变化后重新连接下一首；changed为曲库更新中删除或修改的曲目（链上与预取中的这些曲目按旧文件准备，须放弃）
+// 等待播放的曲目被删除时放弃加载、恢复为停止状态；没有正在播放的曲目时直接返回
+void RequeueNextTrack(const TrackBitmap* changed) {
+    if (changed != nullptr && !changed->Empty()) {
+        if (g_loadingTrackId != PlaybackChain::kNoTrack && g_removedTracks.Contains(g_loadingTrackId)) {
+            g_loadingTrackId = PlaybackChain::kNoTrack;
+            if (g_prefetcher) g_prefetcher->Cancel();
+            g_playState = STOPPED;
+            SetWindowTextW(GetDlgItem(g_hMainWnd, IDC_BTN_PLAYPAUSE), L"播放");
+            SetWindowTextW(g_hMainWnd, g_defaultWindowTitle.c_str());
+        } else if (g_prefetcher && g_prefetcher->RequestedTrack() != g_loadingTrackId &&
+                   changed->Contains(g_prefetcher->RequestedTrack())) {
+            g_prefetcher->Cancel(); // PCM缓存中的旧数据已由ForgetChangedPcm丢弃
+        }
+        if (changed->Contains(g_nextTrackId)) {
+            g_nextTrackId = PlaybackChain::kNoTrack;
+        }
+    }
+    if (!g_engineInitSuccess || !g_soundInitialized) return;
+    std::lock_guard<std::mutex> lock(g_engineMutex);
+    if (changed != nullptr && changed->Contains(g_chain.QueuedTrack())) {
+        g_chain.Unqueue();
+    }
+    QueueNextTrack();
+}
+
+// 音频线程已无缝切换到预先连接的下一首：同步界面状态（选中项、时长、标题），再连接下一首
+// 调用方须持有g_engineMutex
+static void OnChainAdvanced() {
+    const std::uint32_t trackId = g_chain.CurrentTrack();
+    const std::uint32_t index = g_musicList.IndexOf(trackId);
+    g_curIndex = index != TrackListView::kNotFound ? static_cast<int>(index) : -1;
+    g_totalDuration = TrackDurationSeconds(trackId);
+    RememberPlayed(trackId);
+    QueueNextTrack();
+    if (g_hMusicList != NULL && g_curIndex >= 0) {
+        SendMessageW(g_hMusicList, LB_SETCURSEL, g_curIndex, 0);
+    }
+    ShowNowPlayingTitle(trackId);
+}
+
 // 下一首（兼容无搜索结果的情况）
 void NextMusic() {
     // 若当前列表为空，直接返回（保留当前播放状态）
-    if (g_musicList.empty() || !g_engineInitSuccess) return;
+    if (g_musicList.Empty() || !g_engineInitSuccess) return;
 
     int nextIndex = g_curIndex;
     switch (g_loopMode) {
         case LOOP_SINGLE: nextIndex = g_curIndex; break;
-        case LOOP_LIST: nextIndex = (g_curIndex + 1) % g_musicList.size(); break;
-        case LOOP_RANDOM:
-            if (g_musicList.size() > 1) {
-                // 【改进】使用 std::uniform_int_distribution 替代 % 运算，消除模偏差
-                const int n = static_cast<int>(g_musicList.size());
-                std::uniform_int_distribution<int> dist(0, n - 1);
-                do { nextIndex = dist(g_rng); } while (nextIndex == g_curIndex);
-            } else { nextIndex = 0; }
+        case LOOP_LIST: nextIndex = (g_curIndex + 1) % g_musicList.Size(); break;
+        case LOOP_RANDOM: {
+            // 优先使用已随机选好（并已预取）的下一首
+            const std::uint32_t queued = g_nextTrackId != PlaybackChain::kNoTrack ? g_musicList.IndexOf(g_nextTrackId)
+                                                                                    : TrackListView::kNotFound;
+            nextIndex = queued != TrackListView::kNotFound ? static_cast<int>(queued) : PickRandomIndex();
             break;
+        }
     }
     PlayMusic(nextIndex); // 自动更新标题
 }
@@ -520,20 +1280,13 @@ void NextMusic() {
 // 上一首（兼容无搜索结果的情况）
 void PrevMusic() {
     // 若当前列表为空，直接返回（保留当前播放状态）
-    if (g_musicList.empty() || !g_engineInitSuccess) return;
+    if (g_musicList.Empty() || !g_engineInitSuccess) return;
 
     int prevIndex = g_curIndex;
     switch (g_loopMode) {
         case LOOP_SINGLE: prevIndex = g_curIndex; break;
-        case LOOP_LIST: prevIndex = (g_curIndex - 1 + g_musicList.size()) % g_musicList.size(); break;
-        case LOOP_RANDOM:
-            if (g_musicList.size() > 1) {
-                // 【改进】使用 std::uniform_int_distribution 替代 % 运算，消除模偏差
-                const int n = static_cast<int>(g_musicList.size());
-                std::uniform_int_distribution<int> dist(0, n - 1);
-                do { prevIndex = dist(g_rng); } while (prevIndex == g_curIndex);
-            } else { prevIndex = 0; }
-            break;
+        case LOOP_LIST: prevIndex = (g_curIndex - 1 + g_musicList.Size()) % g_musicList.Size(); break;
+        case LOOP_RANDOM: prevIndex = PickRandomIndex(); break;
     }
     PlayMusic(prevIndex); // 自动更新标题
 }
@@ -543,7 +1296,7 @@ void UpdateProgressBar() {
     if (g_isDraggingProgress) return;
     // 基础校验：播放状态、资源初始化、总时长有效
     if (g_hMainWnd == NULL || g_playState != PLAYING || !g_soundInitialized || 
-        g_hProgressSlider == NULL || g_totalDuration <= 0.0f || !g_engineInitSuccess) {
+        g_hProgressSlider == NULL || !g_engineInitSuccess) {
         return;
     }
 
@@ -560,6 +1313,12 @@ void UpdateProgressBar() {
     // 【唯一核心修改】缩小锁粒度：仅在获取进度/判断结束时加锁，获取后立即解锁
     {
         std::lock_guard<std::mutex> lock(g_engineMutex);
+        // 音频线程已切换到下一首时先同步界面状态，之后取到的即新曲目的进度
+        if (g_chain.Advance()) {
+            OnChainAdvanced();
+        }
+        if (g_totalDuration <= 0.0f) return; // 总时长无效时不显示进度
+
         // 获取当前进度
         ma_result res = ma_sound_get_cursor_in_seconds(&g_sound, &curSeconds);
         if (res != MA_SUCCESS) return;
@@ -672,6 +1431,24 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam) {
                 MessageBoxW(0, L"音频引擎初始化失败！", L"错误", MB_ICONERROR);
                 return -1;
             }
+            lock.unlock(); // 之后创建控件、加载曲库不持有g_engineMutex
+
+            // 启动曲目加载线程（完成后投递回主窗口，由UI线程开始播放或连接到数据源链）
+            // 预取的下一首在内存预算之内整首解码，播放时音频线程不再解码
+            // 整首在内存中的曲目（包括流式播放时边播边保存到末尾的）放入PCM缓存，重播或来回切换时不再解码
+            // 缓存的PCM与整首解码共用内存预算，预算不足时先淘汰缓存
+            g_loadPolicy = std::make_shared<LoadPolicy>();
+            g_pcmCache = std::make_shared<PcmCache>();
+            g_loadPolicy->SetReclaimer([cache = g_pcmCache](std::uint64_t bytes) { return cache->Reclaim(bytes); });
+            PrefetchOptions prefetchOptions;
+            prefetchOptions.policy = g_loadPolicy;
+            prefetchOptions.cache = g_pcmCache;
+            g_prefetcher = std::make_unique<TrackPrefetcher>(prefetchOptions, [hWnd](std::uint32_t trackId, ma_result result) {
+                PostMessageW(hWnd, WM_APP_PREFETCH_READY, (WPARAM)trackId, (LPARAM)result);
+            });
+            g_chain.SetReleasedCallback(OnTrackReleased);
+            g_prefetcher->SetOutputFormat(g_chain.Channels(), g_chain.SampleRate());
+            g_prefetcher->Start();
 
             RECT rc;
             GetClientRect(hWnd, &rc);
@@ -680,10 +1457,22 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam) {
 
             // 1. 创建音乐列表（核心修改：移除LBS_DISABLENOSCROLL，用数值0x0400替代LBS_HASVERTICALSCROLL）
             g_hMusicList = CreateWindowW(L"LISTBOX", L"", 
-                WS_CHILD | WS_VISIBLE | WS_BORDER | LBS_NOTIFY | 0x0400 | WS_VSCROLL, // 0x0400 = LBS_HASVERTICALSCROLL
+                // LBS_NODATA + LBS_OWNERDRAWFIXED：列表框不保存字符串，只记录条目数，绘制时从路径池读取文件名
+                WS_CHILD | WS_VISIBLE | WS_BORDER | LBS_NOTIFY | 0x0400 | WS_VSCROLL | // 0x0400 = LBS_HASVERTICALSCROLL
+                    LBS_NODATA | LBS_OWNERDRAWFIXED,
                 0, 0, 300, height - 50, hWnd, (HMENU)IDC_LIST_MUSIC, 
                 ((LPCREATESTRUCT)lParam)->hInstance, NULL);
 
+            // 启动后台搜索线程（求值结果投递回主窗口，由UI线程发布到列表）
+            g_searchWorker = std::make_unique<SearchWorker>(g_trackTable, g_trackIndex,
+                [hWnd](std::unique_ptr<SearchResult> result) {
+                    SearchResult* message = result.release();
+                    if (!PostMessageW(hWnd, WM_APP_SEARCH_DONE, 0, (LPARAM)message)) {
+                        delete message;
+                    }
+                });
+            g_searchWorker->Start();
+
             // 加载音乐列表（此时列表框已创建，可直接填充）
             LoadMusicList();
 
@@ -797,7 +1586,7 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam) {
                     int curSel = SendMessageW(g_hMusicList, LB_GETCURSEL, 0, 0);
                     if (curSel == LB_ERR) curSel = 0;
                     int newSel = curSel - (delta / WHEEL_DELTA);
-                    newSel = std::max(0, std::min(newSel, (int)g_musicList.size() - 1));
+                    newSel = std::max(0, std::min(newSel, (int)g_musicList.Size() - 1));
                     SendMessageW(g_hMusicList, LB_SETCURSEL, newSel, 0);
                     // 滚动列表到选中项
                     SendMessageW(g_hMusicList, LB_SETTOPINDEX, newSel - 2, 0);
@@ -813,7 +1602,7 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam) {
 
             // 双击列表项播放音乐（列表为空时无响应）
             if (ctrlID == IDC_LIST_MUSIC && notifyCode == LBN_DBLCLK) {
-                if (g_hMusicList != NULL && !g_musicList.empty()) {
+                if (g_hMusicList != NULL && !g_musicList.Empty()) {
                     int selIndex = SendMessageW(g_hMusicList, LB_GETCURSEL, 0, 0);
                     if (selIndex != LB_ERR) {
                         PlayMusic(selIndex); // 自动更新标题
@@ -821,6 +1610,14 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam) {
                 }
             }
 
+            // 搜索框内容变化：边输入边搜索（后台求值，不阻塞输入）
+            if (ctrlID == IDC_EDIT_SEARCH && notifyCode == EN_CHANGE) {
+                WCHAR szKeyword[256] = {0};
+                GetWindowTextW((HWND)lParam, szKeyword, 256);
+                SearchMusic(szKeyword);
+                break;
+            }
+
             // 按钮/单选框点击处理
             switch (ctrlID) {
                 case IDC_BTN_SEARCH: {
@@ -855,6 +1652,7 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam) {
                     if (g_soundInitialized && g_engineInitSuccess) {
                         std::lock_guard<std::mutex> lock(g_engineMutex); // 恢复原普通mutex
                         ma_sound_set_looping(&g_sound, MA_TRUE);
+                        QueueNextTrack(); // 单曲循环时断开下一首
                     }
                     break;
                 }
@@ -869,6 +1667,8 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam) {
                     if (g_soundInitialized && g_engineInitSuccess) {
                         std::lock_guard<std::mutex> lock(g_engineMutex); // 恢复原普通mutex
                         ma_sound_set_looping(&g_sound, MA_FALSE);
+                        g_nextTrackId = PlaybackChain::kNoTrack; // 按新的播放模式重新选择下一首（相同时不重新连接）
+                        QueueNextTrack();
                     }
                     break;
                 }
@@ -883,6 +1683,8 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam) {
                     if (g_soundInitialized && g_engineInitSuccess) {
                         std::lock_guard<std::mutex> lock(g_engineMutex); // 恢复原普通mutex
                         ma_sound_set_looping(&g_sound, MA_FALSE);
+                        g_nextTrackId = PlaybackChain::kNoTrack; // 按新的播放模式重新选择下一首（相同时不重新连接）
+                        QueueNextTrack();
                     }
                     break;
                 }
@@ -912,6 +1714,74 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam) {
             break;
         }
 
+        // 音乐列表条目高度（LBS_OWNERDRAWFIXED在创建列表框时询问一次）
+        case WM_MEASUREITEM: {
+            auto* mis = reinterpret_cast<LPMEASUREITEMSTRUCT>(lParam);
+            if (mis->CtlID != IDC_LIST_MUSIC) {
+                return DefWindowProcW(hWnd, uMsg, wParam, lParam);
+            }
+            HDC hdc = GetDC(hWnd);
+            TEXTMETRICW tm;
+            GetTextMetricsW(hdc, &tm);
+            ReleaseDC(hWnd, hdc);
+            mis->itemHeight = tm.tmHeight + 2;
+            return TRUE;
+        }
+
+        // 绘制音乐列表条目
+        case WM_DRAWITEM: {
+            auto* dis = reinterpret_cast<LPDRAWITEMSTRUCT>(lParam);
+            if (dis->CtlID != IDC_LIST_MUSIC) {
+                return DefWindowProcW(hWnd, uMsg, wParam, lParam);
+            }
+            DrawMusicListItem(dis);
+            return TRUE;
+        }
+
+        // 后台扫描投递的一批音乐文件
+        case WM_APP_SCAN_BATCH: {
+            auto* paths = reinterpret_cast<std::vector<std::wstring>*>(lParam);
+            OnScanBatch(*paths);
+            delete paths;
+            break;
+        }
+
+        // 后台由已有目录构建好曲目数据
+        case WM_APP_LIBRARY_READY: {
+            auto* data = reinterpret_cast<LibraryData*>(lParam);
+            OnLibraryData(*data);
+            delete data;
+            break;
+        }
+
+        // 后台校验或监视发现目录变化，按增量更新列表
+        case WM_APP_CATALOG_READY: {
+            auto* update = reinterpret_cast<CatalogUpdate*>(lParam);
+            ApplyCatalogUpdate(*update);
+            delete update;
+            break;
+        }
+
+        // 后台搜索求值完成
+        case WM_APP_SEARCH_DONE: {
+            OnSearchResult(std::unique_ptr<SearchResult>(reinterpret_cast<SearchResult*>(lParam)));
+            break;
+        }
+
+        // 后台预取好下一首
+        case WM_APP_PREFETCH_READY: {
+            OnPrefetchReady(static_cast<std::uint32_t>(wParam), static_cast<ma_result>(lParam));
+            break;
+        }
+
+        // 后台扫描结束
+        case WM_APP_SCAN_DONE: {
+            auto* summary = reinterpret_cast<std::wstring*>(lParam);
+            OnScanDone(*summary);
+            delete summary;
+            break;
+        }
+
         // 定时器消息：更新进度条
         case WM_TIMER: {
             if (wParam == ID_TIMER_PROG) {
@@ -927,6 +1797,32 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam) {
             UnregisterHotKey(hWnd, ID_HOTKEY_NEXT);
 
             DestroyProgressTimer();
+            StopLibraryScan(); // 取消后台扫描，等待扫描线程退出
+            if (g_searchWorker) {
+                g_searchWorker->Stop(); // 等待搜索线程退出
+                // 输出搜索结果缓存的统计（可用DebugView查看）
+                const SearchCacheStats cache = g_searchWorker->CacheStats();
+                OutputDebugStringW((L"搜索缓存：命中 " + std::to_wstring(cache.hits) + L"，候选集合复用 " +
+                                    std::to_wstring(cache.baseHits) + L"，未命中 " + std::to_wstring(cache.misses) +
+                                    L"，淘汰 " + std::to_wstring(cache.evictions) + L"；" +
+                                    std::to_wstring(cache.entries) + L" 条，" +
+                                    std::to_wstring(cache.memoryBytes / 1024) + L" KB\n").c_str());
+            }
+            if (g_prefetcher) {
+                g_prefetcher->Stop(); // 等待预取线程退出
+                const LoadPolicyStats load = g_loadPolicy->Stats();
+                OutputDebugStringW((L"加载策略：流式 " + std::to_wstring(load.streamed) + L" 首，整首解码 " +
+                                    std::to_wstring(load.decoded) + L" 首（预算不足改为流式 " +
+                                    std::to_wstring(load.overBudget) + L" 首），边播边保存 " +
+                                    std::to_wstring(load.captured) + L" 首，预算峰值 " +
+                                    std::to_wstring(load.budgetPeak / 1024) + L" KB\n").c_str());
+                const PcmCacheStats pcm = g_pcmCache->Stats();
+                OutputDebugStringW((L"PCM缓存：命中 " + std::to_wstring(pcm.hits) + L"，未命中 " +
+                                    std::to_wstring(pcm.misses) + L"，放入 " + std::to_wstring(pcm.insertions) +
+                                    L"，淘汰 " + std::to_wstring(pcm.evictions) + L"；" +
+                                    std::to_wstring(pcm.entries) + L" 首，" +
+                                    std::to_wstring(pcm.memoryBytes / 1024) + L" KB\n").c_str());
+            }
             UninitCurrentSound();
             
             // 等待音频初始化线程结束，再释放引擎
@@ -0,0 +1,338 @@
+#include "media_probe.h"
+
+#include <cstring>
+#include <vector>
+
+namespace {
+
+constexpr size_t kProbeChunk = 64 * 1024;   // 每次读取的字节数（查找首帧、逐帧跳读、Ogg末页）
+constexpr int kCbrCheckFrames = 8;          // 连续这么多帧码率相同即按CBR估算
+
+std::uint32_t ReadBE32(const std::uint8_t* p) {
+    return (std::uint32_t(p[0]) << 24) | (std::uint32_t(p[1]) << 16) | (std::uint32_t(p[2]) << 8) | p[3];
+}
+
+std::uint32_t ReadLE32(const std::uint8_t* p) {
+    return std::uint32_t(p[0]) | (std::uint32_t(p[1]) << 8) | (std::uint32_t(p[2]) << 16) | (std::uint32_t(p[3]) << 24);
+}
+
+std::uint64_t ReadLE64(const std::uint8_t* p) {
+    return std::uint64_t(ReadLE32(p)) | (std::uint64_t(ReadLE32(p + 4)) << 32);
+}
+
+// 读取[offset, offset+size)，返回实际读取的数据（越过文件末尾时较短）
+std::vector<std::uint8_t> ReadRange(const FileReader& file, std::uint64_t offset, size_t size) {
+    std::vector<std::uint8_t> data(size);
+    data.resize(file.ReadAt(offset, data.data(), size));
+    return data;
+}
+
+std::uint32_t ToMs(std::uint64_t samples, std::uint32_t sampleRate) {
+    if (sampleRate == 0) return 0;
+    const std::uint64_t ms = samples * 1000 / sampleRate;
+    return ms > 0xffffffffu ? 0 : static_cast<std::uint32_t>(ms);
+}
+
+// 文件开头ID3v2标签的总长度（没有时为0）
+std::uint64_t Id3v2Size(const std::vector<std::uint8_t>& head) {
+    if (head.size() < 10 || std::memcmp(head.data(), "ID3", 3) != 0) return 0;
+    const std::uint32_t body = (std::uint32_t(head[6] & 0x7f) << 21) | (std::uint32_t(head[7] & 0x7f) << 14) |
+                               (std::uint32_t(head[8] & 0x7f) << 7) | (head[9] & 0x7f);
+    return 10 + body + ((head[3] == 4 && (head[5] & 0x10)) ? 10 : 0);
+}
+
+// ---------- MPEG音频帧头 ----------
+
+struct MpegFrame {
+    bool mpeg1 = false;
+    bool mono = false;
+    std::uint32_t bitrate = 0;      // kbps
+    std::uint32_t sampleRate = 0;
+    std::uint32_t samples = 0;      // 每帧采样数
+    std::uint32_t length = 0;       // 帧字节数
+};
+
+bool ParseMpegHeader(const std::uint8_t* p, MpegFrame& f) {
+    static const std::uint16_t kBitrates[2][3][16] = {
+        {   // MPEG1：Layer I / II / III
+            {0, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448, 0},
+            {0, 32, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 0},
+            {0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 0},
+        },
+        {   // MPEG2/2.5：Layer I / II / III
+            {0, 32, 48, 56, 64, 80, 96, 112, 128, 144, 160, 176, 192, 224, 256, 0},
+            {0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160, 0},
+            {0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160, 0},
+        },
+    };
+    static const std::uint32_t kSampleRates[4][3] = {
+        {11025, 12000, 8000},   // MPEG2.5
+        {0, 0, 0},              // 保留
+        {22050, 24000, 16000},  // MPEG2
+        {44100, 48000, 32000},  // MPEG1
+    };
+
+    if (p[0] != 0xff || (p[1] & 0xe0) != 0xe0) return false;
+    const unsigned version = (p[1] >> 3) & 3;
+    const unsigned layerBits = (p[1] >> 1) & 3;
+    const unsigned bitrateIndex = p[2] >> 4;
+    const unsigned rateIndex = (p[2] >> 2) & 3;
+    if (version == 1 || layerBits == 0 || bitrateIndex == 0 || bitrateIndex == 15 || rateIndex == 3) return false;
+    const unsigned layer = 4 - layerBits; // 1/2/3
+    const bool padding = (p[2] & 0x02) != 0;
+
+    f.mpeg1 = version == 3;
+    f.mono = (p[3] >> 6) == 3;
+    f.bitrate = kBitrates[f.mpeg1 ? 0 : 1][layer - 1][bitrateIndex];
+    f.sampleRate = kSampleRates[version][rateIndex];
+    if (layer == 1) {
+        f.samples = 384;
+        f.length = (12 * f.bitrate * 1000 / f.sampleRate + (padding ? 1 : 0)) * 4;
+    } else {
+        f.samples = (layer == 3 && !f.mpeg1) ? 576 : 1152;
+        f.length = f.samples / 8 * f.bitrate * 1000 / f.sampleRate + (padding ? 1 : 0);
+    }
+    return f.length >= 4;
+}
+
+// 在data中查找第一个有效帧：要求紧随其后的位置也是帧头，避免把数据中的0xFF误认为同步字
+bool FindFirstFrame(const std::vector<std::uint8_t>& data, size_t& pos, MpegFrame& frame) {
+    for (size_t i = 0; i + 4 <= data.size(); ++i) {
+        if (data[i] != 0xff || !ParseMpegHeader(&data[i], frame)) continue;
+        MpegFrame next;
+        const size_t nextPos = i + frame.length;
+        if (nextPos + 4 <= data.size() && !ParseMpegHeader(&data[nextPos], next)) continue;
+        pos = i;
+        return true;
+    }
+    return false;
+}
+
+// 首帧中的Xing/Info或VBRI头：得到总帧数（以及LAME记录的编码延迟/填充）
+bool ReadVbrHeader(const std::uint8_t* frame, size_t available, const MpegFrame& f, std::uint64_t& samples) {
+    const size_t xing = 4 + (f.mpeg1 ? (f.mono ? 17 : 32) : (f.mono ? 9 : 17));
+    if (xing + 8 <= available &&
+        (std::memcmp(frame + xing, "Xing", 4) == 0 || std::memcmp(frame + xing, "Info", 4) == 0)) {
+        const std::uint32_t flags = ReadBE32(frame + xing + 4);
+        if (!(flags & 0x1)) return false;
+        size_t pos = xing + 8;
+        if (pos + 4 > available) return false;
+        const std::uint32_t frames = ReadBE32(frame + pos);
+        pos += 4;
+        if (flags & 0x2) pos += 4;      // 字节数
+        if (flags & 0x4) pos += 100;    // TOC
+        if (flags & 0x8) pos += 4;      // 质量
+        samples = static_cast<std::uint64_t>(frames) * f.samples;
+        // LAME扩展：编码器版本后第21字节起为12位延迟 + 12位填充
+        if (pos + 24 <= available && (std::memcmp(frame + pos, "LAME", 4) == 0 ||
+                                      std::memcmp(frame + pos, "Lavf", 4) == 0 ||
+                                      std::memcmp(frame + pos, "Lavc", 4) == 0)) {
+            const std::uint8_t* d = frame + pos + 21;
+            const std::uint32_t delay = (std::uint32_t(d[0]) << 4) | (d[1] >> 4);
+            const std::uint32_t padding = (std::uint32_t(d[1] & 0x0f) << 8) | d[2];
+            if (delay + padding < samples) samples -= delay + padding;
+        }
+        return frames > 0;
+    }
+    const size_t vbri = 4 + 32;
+    if (vbri + 18 <= available && std::memcmp(frame + vbri, "VBRI", 4) == 0) {
+        const std::uint32_t frames = ReadBE32(frame + vbri + 14);
+        samples = static_cast<std::uint64_t>(frames) * f.samples;
+        return frames > 0;
+    }
+    return false;
+}
+
+std::uint32_t ProbeMpeg(const FileReader& file, std::uint64_t audioStart) {
+    std::vector<std::uint8_t> data = ReadRange(file, audioStart, kProbeChunk);
+    size_t first = 0;
+    MpegFrame frame;
+    if (!FindFirstFrame(data, first, frame)) return 0;
+    const std::uint64_t firstFrame = audioStart + first;
+
+    // 文件末尾的ID3v1不属于音频数据
+    std::uint64_t audioEnd = file.Size();
+    if (audioEnd >= 128) {
+        std::uint8_t tail[3];
+        if (file.ReadAt(audioEnd - 128, tail, 3) == 3 && std::memcmp(tail, "TAG", 3) == 0) audioEnd -= 128;
+    }
+
+    // 1. Xing/Info/VBRI头直接给出总帧数
+    std::uint64_t samples = 0;
+    if (ReadVbrHeader(&data[first], data.size() - first, frame, samples)) return ToMs(samples, frame.sampleRate);
+
+    // 2. 前若干帧码率一致时视为CBR，按音频字节数估算
+    bool constant = true;
+    size_t pos = first;
+    MpegFrame f = frame;
+    for (int i = 0; i < kCbrCheckFrames && pos + 4 <= data.size(); ++i) {
+        if (!ParseMpegHeader(&data[pos], f)) break;
+        if (f.bitrate != frame.bitrate) {
+            constant = false;
+            break;
+        }
+        pos += f.length;
+    }
+    if (constant) {
+        const std::uint64_t bytes = audioEnd > firstFrame ? audioEnd - firstFrame : 0;
+        return static_cast<std::uint32_t>(bytes * 8 / frame.bitrate); // kbps即每毫秒bit数
+    }
+
+    // 3. 没有头信息的VBR：逐帧跳读帧头累加采样数（只读帧头，不解码）
+    std::uint64_t offset = firstFrame;
+    size_t resync = 0;
+    samples = 0;
+    data.clear();
+    std::uint64_t dataStart = offset;
+    while (offset + 4 <= audioEnd) {
+        if (offset + 4 > dataStart + data.size()) {
+            dataStart = offset;
+            data = ReadRange(file, offset, kProbeChunk);
+            if (data.size() < 4) break;
+        }
+        const std::uint8_t* p = &data[offset - dataStart];
+        if (ParseMpegHeader(p, f)) {
+            samples += f.samples;
+            offset += f.length;
+            resync = 0;
+        } else {
+            if (++resync > kProbeChunk) break; // 长段无效数据，停止
+            ++offset;
+        }
+    }
+    return ToMs(samples, frame.sampleRate);
+}
+
+// ---------- FLAC：STREAMINFO中的采样率与总采样数 ----------
+
+std::uint32_t ProbeFlac(const FileReader& file, std::uint64_t start) {
+    const std::vector<std::uint8_t> d = ReadRange(file, start, 4 + 4 + 34);
+    if (d.size() < 42 || std::memcmp(d.data(), "fLaC", 4) != 0 || (d[4] & 0x7f) != 0) return 0;
+    const std::uint8_t* info = d.data() + 8;
+    const std::uint32_t sampleRate = (std::uint32_t(info[10]) << 12) | (std::uint32_t(info[11]) << 4) | (info[12] >> 4);
+    const std::uint64_t totalSamples = (std::uint64_t(info[13] & 0x0f) << 32) | ReadBE32(info + 14);
+    return ToMs(totalSamples, sampleRate);
+}
+
+// ---------- WAV：data块大小 / 每秒字节数 ----------
+
+std::uint32_t ProbeWav(const FileReader& file) {
+    std::uint64_t pos = 12;
+    std::uint32_t byteRate = 0;
+    for (int chunk = 0; chunk < 64; ++chunk) {
+        std::uint8_t h[16];
+        if (file.ReadAt(pos, h, 8) != 8) return 0;
+        const std::uint32_t size = ReadLE32(h + 4);
+        const std::uint64_t body = pos + 8;
+        if (std::memcmp(h, "fmt ", 4) == 0) {
+            if (size < 16 || file.ReadAt(body, h, 16) != 16) return 0;
+            byteRate = ReadLE32(h + 8);
+        } else if (std::memcmp(h, "data", 4) == 0) {
+            if (byteRate == 0) return 0;
+            // 流式写入的文件可能未回填大小（0或0xFFFFFFFF），以文件剩余长度为准
+            std::uint64_t dataSize = size;
+            if (dataSize == 0 || body + dataSize > file.Size()) dataSize = file.Size() - body;
+            return static_cast<std::uint32_t>(dataSize * 1000 / byteRate);
+        }
+        pos = body + size + (size & 1);
+    }
+    return 0;
+}
+
+// ---------- Ogg：末页granule位置 / 采样率 ----------
+
+std::uint32_t ProbeOgg(const FileReader& file, const std::vector<std::uint8_t>& head) {
+    if (head.size() < 28 + 19 || std::memcmp(head.data(), "OggS", 4) != 0) return 0;
+    const std::uint32_t serial = ReadLE32(&head[14]);
+    const size_t bodyStart = 27 + head[26];
+    if (bodyStart + 19 > head.size()) return 0;
+    const std::uint8_t* packet = &head[bodyStart];
+    std::uint32_t sampleRate = 0;
+    std::uint64_t preSkip = 0;
+    if (std::memcmp(packet, "\x01vorbis", 7) == 0) {
+        sampleRate = ReadLE32(packet + 12);
+    } else if (std::memcmp(packet, "OpusHead", 8) == 0) {
+        sampleRate = 48000; // Opus的granule始终以48kHz计
+        preSkip = packet[10] | (packet[11] << 8);
+    } else {
+        return 0;
+    }
+
+    const std::uint64_t tailStart = file.Size() > kProbeChunk ? file.Size() - kProbeChunk : 0;
+    const std::vector<std::uint8_t> tail = ReadRange(file, tailStart, kProbeChunk);
+    for (size_t i = tail.size() >= 27 ? tail.size() - 27 + 1 : 0; i-- > 0;) {
+        if (tail[i] != 'O' || std::memcmp(&tail[i], "OggS", 4) != 0) continue;
+        if (ReadLE32(&tail[i + 14]) != serial) continue;
+        const std::uint64_t granule = ReadLE64(&tail[i + 6]);
+        if (granule == ~0ull) continue; // 该页没有包在此结束
+        return ToMs(granule > preSkip ? granule - preSkip : 0, sampleRate);
+    }
+    return 0;
+}
+
+} // namespace
+
+AudioFormat SniffAudioFormat(const FileReader& file) {
+    const std::vector<std::uint8_t> head = ReadRange(file, 0, 12);
+    if (head.size() < 12) return AUDIO_FORMAT_UNKNOWN;
+    const std::uint64_t id3Size = Id3v2Size(head);
+    if (id3Size == 0 && std::memcmp(head.data(), "OggS", 4) == 0) return AUDIO_FORMAT_OGG;
+    if (id3Size == 0 && std::memcmp(head.data(), "RIFF", 4) == 0 && std::memcmp(&head[8], "WAVE", 4) == 0) {
+        return AUDIO_FORMAT_WAV;
+    }
+    std::uint8_t magic[4] = {0, 0, 0, 0};
+    if (file.ReadAt(id3Size, magic, 4) != 4) return AUDIO_FORMAT_UNKNOWN;
+    if (std::memcmp(magic, "fLaC", 4) == 0) return AUDIO_FORMAT_FLAC;
+    // MPEG音频帧同步字（11位1）且layer不为保留值；带ID3v2标签的文件即使标签后有填充也按MP3处理
+    if (magic[0] == 0xFF && (magic[1] & 0xE0) == 0xE0 && (magic[1] & 0x06) != 0) return AUDIO_FORMAT_MP3;
+    return id3Size != 0 ? AUDIO_FORMAT_MP3 : AUDIO_FORMAT_UNKNOWN;
+}
+
+// 按已识别的格式探测时长；未识别的文件按MPEG逐帧探测（与扩展名无关）
+static std::uint32_t ProbeDurationMs(const FileReader& file, AudioFormat format) {
+    const std::vector<std::uint8_t> head = ReadRange(file, 0, kProbeChunk);
+    if (head.size() < 12) return 0;
+    switch (format) {
+        case AUDIO_FORMAT_FLAC: return ProbeFlac(file, Id3v2Size(head));
+        case AUDIO_FORMAT_OGG: return ProbeOgg(file, head);
+        case AUDIO_FORMAT_WAV: return ProbeWav(file);
+        default: return ProbeMpeg(file, Id3v2Size(head));
+    }
+}
+
+std::uint32_t ProbeDurationMs(const FileReader& file) {
+    return ProbeDurationMs(file, SniffAudioFormat(file));
+}
+
+bool ProbeTrackFile(const std::string& pathUtf8, TrackTags& tags, std::uint32_t& durationMs, AudioFormat& format) {
+    FileReader file;
+    if (!file.Open(pathUtf8)) {
+        tags = TrackTags();
+        durationMs = 0;
+        format = AUDIO_FORMAT_UNKNOWN;
+        return false;
+    }
+    format = SniffAudioFormat(file);
+    ReadTrackTags(file, tags);
+    durationMs = ProbeDurationMs(file, format);
+    return true;
+}
+
+AudioFormat AudioFormatFromName(std::string_view name) {
+    const size_t dot = name.find_last_of('.');
+    if (dot == std::string_view::npos || name.size() - dot > 5) return AUDIO_FORMAT_UNKNOWN;
+    char ext[5] = {0};
+    for (size_t i = dot + 1; i < name.size(); ++i) {
+        const char c = name[i];
+        ext[i - dot - 1] = (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+    for (int f = AUDIO_FORMAT_UNKNOWN + 1; f < AUDIO_FORMAT_COUNT; ++f) {
+        if (std::strcmp(ext, AudioFormatName(static_cast<AudioFormat>(f))) == 0) return static_cast<AudioFormat>(f);
+    }
+    return AUDIO_FORMAT_UNKNOWN;
+}
+
+const char* AudioFormatName(AudioFormat format) {
+    static const char* const kNames[AUDIO_FORMAT_COUNT] = {"", "mp3", "flac", "wav", "ogg"};
+    return format < AUDIO_FORMAT_COUNT ? kNames[format] : "";
+}
@@ -0,0 +1,36 @@
+// 媒体文件探测：不解码音频，只读取文件头部/尾部的少量字节识别容器格式、得到时长
+// MP3：Xing/Info（含LAME延迟/填充修正）、VBRI，否则按帧头判断CBR或逐帧跳读；
+// FLAC：STREAMINFO；WAV：fmt字节率 + data块大小；Ogg：末页granule位置
+#pragma once
+
+#include "fs_util.h"
+#include "tag_reader.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// 音频格式（按字节保存在曲目表的格式列中）
+enum AudioFormat : std::uint8_t {
+    AUDIO_FORMAT_UNKNOWN = 0,
+    AUDIO_FORMAT_MP3,
+    AUDIO_FORMAT_FLAC,
+    AUDIO_FORMAT_WAV,
+    AUDIO_FORMAT_OGG,
+    AUDIO_FORMAT_COUNT
+};
+
+// 按扩展名判断格式（ASCII不区分大小写）
+AudioFormat AudioFormatFromName(std::string_view name);
+// 格式名（小写，如"mp3"），用于显示与查询
+const char* AudioFormatName(AudioFormat format);
+
+// 按文件头的魔数识别容器格式（跳过ID3v2标签），与扩展名无关；无法识别时返回AUDIO_FORMAT_UNKNOWN
+AudioFormat SniffAudioFormat(const FileReader& file);
+
+// 探测已打开文件的时长（毫秒）；无法确定时返回0
+std::uint32_t ProbeDurationMs(const FileReader& file);
+
+// 扫描时对单个文件的一次性探测：打开一次文件，识别格式、读取标签并探测时长
+// 文件无法打开时返回false
+bool ProbeTrackFile(const std::string& pathUtf8, TrackTags& tags, std::uint32_t& durationMs, AudioFormat& format);
@@ -0,0 +1,4 @@
+// miniaudio的实现只在此处展开一次（界面程序与工具共用player_core中的播放代码）
+#define MINIAUDIO_IMPLEMENTATION
+#define MA_ENABLE_WINDOWS_WIDECHAR_PATHS 1  // 启用miniaudio宽字符路径支持
+#include "miniaudio.h"
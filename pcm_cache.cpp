@@ -0,0 +1,88 @@
+#include "pcm_cache.h"
+
+PcmCache::PcmCache(size_t maxBytes) : m_maxBytes(maxBytes) {}
+
+std::shared_ptr<const PcmBuffer> PcmCache::Find(const std::wstring& path, std::uint32_t channels,
+                                                std::uint32_t sampleRate) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+        if (it->channels != channels || it->sampleRate != sampleRate || it->path != path) continue;
+        m_entries.splice(m_entries.begin(), m_entries, it);
+        m_hits.fetch_add(1, std::memory_order_relaxed);
+        return m_entries.front().pcm;
+    }
+    m_misses.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+}
+
+void PcmCache::Insert(const std::wstring& path, std::uint32_t channels, std::uint32_t sampleRate,
+                      std::shared_ptr<const PcmBuffer> pcm) {
+    if (pcm == nullptr) return;
+    std::vector<std::shared_ptr<const PcmBuffer>> released;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+        if (it->channels != channels || it->sampleRate != sampleRate || it->path != path) continue;
+        m_memoryBytes -= it->MemoryBytes();
+        released.push_back(std::move(it->pcm));
+        m_entries.erase(it);
+        break;
+    }
+    Entry entry{path, channels, sampleRate, std::move(pcm)};
+    const size_t bytes = entry.MemoryBytes();
+    if (bytes > m_maxBytes) return;
+    m_entries.push_front(std::move(entry));
+    m_memoryBytes += bytes;
+    m_insertions.fetch_add(1, std::memory_order_relaxed);
+    Evict(released);
+}
+
+void PcmCache::Erase(const std::wstring& path) {
+    std::vector<std::shared_ptr<const PcmBuffer>> released;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        if (it->path != path) {
+            ++it;
+            continue;
+        }
+        m_memoryBytes -= it->MemoryBytes();
+        released.push_back(std::move(it->pcm));
+        it = m_entries.erase(it);
+    }
+}
+
+void PcmCache::Evict(std::vector<std::shared_ptr<const PcmBuffer>>& released) {
+    while (m_memoryBytes > m_maxBytes) {
+        m_memoryBytes -= m_entries.back().MemoryBytes();
+        released.push_back(std::move(m_entries.back().pcm));
+        m_entries.pop_back();
+        m_evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+std::uint64_t PcmCache::Reclaim(std::uint64_t bytes) {
+    std::vector<std::shared_ptr<const PcmBuffer>> released;
+    std::uint64_t reclaimed = 0;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_entries.end(); it != m_entries.begin() && reclaimed < bytes;) {
+        --it;
+        if (it->pcm.use_count() > 1) continue;
+        reclaimed += it->pcm->reservation.Bytes();
+        m_memoryBytes -= it->MemoryBytes();
+        released.push_back(std::move(it->pcm));
+        it = m_entries.erase(it);
+        m_evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+    return reclaimed;
+}
+
+PcmCacheStats PcmCache::Stats() const {
+    PcmCacheStats stats;
+    stats.hits = m_hits.load(std::memory_order_relaxed);
+    stats.misses = m_misses.load(std::memory_order_relaxed);
+    stats.insertions = m_insertions.load(std::memory_order_relaxed);
+    stats.evictions = m_evictions.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    stats.entries = m_entries.size();
+    stats.memoryBytes = m_memoryBytes;
+    return stats;
+}
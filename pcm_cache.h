@@ -0,0 +1,83 @@
+// 解码后PCM的缓存（LRU，按字节数限制）：以文件的完整路径与输出格式（声道数、采样率）为键，保存整首解码的PCM
+// - 重播最近的曲目或在几首之间来回切换时，命中则直接从缓存的PCM开始播放（TrackSource::FromPcm），
+//   不打开文件、不解码
+// - PCM以共享指针保存，正在播放的曲目与缓存共用同一份数据，淘汰只是放弃缓存的引用
+// - 键与目录中的曲目id无关，目录重新编号后缓存仍然有效；文件被修改或删除时由调用方Erase
+// - PCM持有从加载策略的内存预算中预留的字节数（与整首解码共用预算），预算不足时由加载策略回收（Reclaim）
+// 成员函数可从任意线程调用
+#pragma once
+
+#include "load_policy.h"
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// 整首解码的PCM（f32交错存放），放入缓存之后不再修改；最后一个使用者（曲目或缓存）释放时归还预留的预算
+struct PcmBuffer {
+    std::vector<float> samples;
+    MemoryReservation reservation;
+};
+
+struct PcmCacheStats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t insertions = 0;
+    std::uint64_t evictions = 0;
+    size_t entries = 0;
+    size_t memoryBytes = 0;
+};
+
+class PcmCache {
+public:
+    explicit PcmCache(size_t maxBytes = 256u << 20);
+
+    // 命中时返回PCM（并移到最近使用），否则返回nullptr
+    std::shared_ptr<const PcmBuffer> Find(const std::wstring& path, std::uint32_t channels, std::uint32_t sampleRate);
+
+    // 加入整首的PCM（同一键的旧条目被替换），超出内存上限时淘汰最久未使用的条目；单首超过上限时不缓存
+    void Insert(const std::wstring& path, std::uint32_t channels, std::uint32_t sampleRate,
+                std::shared_ptr<const PcmBuffer> pcm);
+
+    // 文件已被修改或删除：丢弃它的全部条目
+    void Erase(const std::wstring& path);
+
+    // 这么大的PCM能否放入缓存（不超过上限）；超过时不必为放入缓存而保存整首
+    bool Fits(std::uint64_t bytes) const { return bytes <= m_maxBytes; }
+
+    // 从最久未使用的条目起淘汰，直到归还至少bytes字节的预算（正在播放、与曲目共用的PCM淘汰后不归还，跳过），
+    // 返回实际归还的字节数
+    std::uint64_t Reclaim(std::uint64_t bytes);
+
+    PcmCacheStats Stats() const;
+
+private:
+    struct Entry {
+        std::wstring path;
+        std::uint32_t channels;
+        std::uint32_t sampleRate;
+        std::shared_ptr<const PcmBuffer> pcm;
+
+        size_t MemoryBytes() const {
+            return sizeof(Entry) + path.capacity() * sizeof(wchar_t) + pcm->samples.capacity() * sizeof(float);
+        }
+    };
+
+    // 淘汰的条目移入released，由调用方在锁外释放（归还预算、释放大块内存）
+    void Evict(std::vector<std::shared_ptr<const PcmBuffer>>& released);
+
+    const size_t m_maxBytes;
+    mutable std::mutex m_mutex;         // 保护m_entries/m_memoryBytes
+    // 条目不多（每首数十MB），按最近使用顺序（最近的在前）线性查找
+    std::list<Entry> m_entries;
+    size_t m_memoryBytes = 0;
+
+    std::atomic<std::uint64_t> m_hits{0};
+    std::atomic<std::uint64_t> m_misses{0};
+    std::atomic<std::uint64_t> m_insertions{0};
+    std::atomic<std::uint64_t> m_evictions{0};
+};
@@ -0,0 +1,63 @@
+#include "pinyin.h"
+#include "pinyin_table.h"
+
+namespace {
+
+// 解码utf8[i]开始的一个码点并前进；非法字节按单字节返回（不会是汉字）
+std::uint32_t NextCodePoint(std::string_view utf8, size_t& i) {
+    const unsigned char c = static_cast<unsigned char>(utf8[i]);
+    size_t len = 1;
+    std::uint32_t cp = c;
+    if ((c & 0xE0) == 0xC0) { len = 2; cp = c & 0x1F; }
+    else if ((c & 0xF0) == 0xE0) { len = 3; cp = c & 0x0F; }
+    else if ((c & 0xF8) == 0xF0) { len = 4; cp = c & 0x07; }
+    if (len == 1 || i + len > utf8.size()) {
+        ++i;
+        return c;
+    }
+    for (size_t k = 1; k < len; ++k) {
+        const unsigned char t = static_cast<unsigned char>(utf8[i + k]);
+        if ((t & 0xC0) != 0x80) {
+            ++i;
+            return c;
+        }
+        cp = (cp << 6) | (t & 0x3F);
+    }
+    i += len;
+    return cp;
+}
+
+} // namespace
+
+std::string_view PinyinOf(std::uint32_t cp) {
+    if (cp < kHanFirst || cp > kHanLast) return std::string_view();
+    const std::uint16_t index = kHanPinyin[cp - kHanFirst];
+    return index != 0 ? std::string_view(kPinyinSyllables[index - 1]) : std::string_view();
+}
+
+bool ContainsHan(std::string_view utf8) {
+    for (size_t i = 0; i < utf8.size();) {
+        // 汉字的UTF-8首字节为0xE4..0xE9，其余字节直接跳过
+        const unsigned char c = static_cast<unsigned char>(utf8[i]);
+        if (c < 0xE4 || c > 0xE9) {
+            ++i;
+            continue;
+        }
+        if (!PinyinOf(NextCodePoint(utf8, i)).empty()) return true;
+    }
+    return false;
+}
+
+void AppendPinyinKeys(std::string_view utf8, std::string& full, std::string& initials) {
+    for (size_t i = 0; i < utf8.size();) {
+        const size_t begin = i;
+        const std::string_view pinyin = PinyinOf(NextCodePoint(utf8, i));
+        if (pinyin.empty()) {
+            full.append(utf8.substr(begin, i - begin));
+            initials.append(utf8.substr(begin, i - begin));
+        } else {
+            full.append(pinyin);
+            initials.push_back(pinyin[0]);
+        }
+    }
+}
@@ -0,0 +1,17 @@
+// 汉字拼音检索键：把文本中的汉字替换为拼音全拼（zhoujielun）或首字母（zjl），其余字符原样保留，
+// 追加到检索键中，输入拼音即可匹配中文文件名/标签，查询时没有额外开销
+// 拼音表只收录CJK统一汉字基本区，多音字取首选读音，ü记作v（与拼音输入法一致）
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// 汉字的拼音（小写ASCII，不含声调）；不是收录的汉字时返回空
+std::string_view PinyinOf(std::uint32_t cp);
+
+// UTF-8文本中是否含有收录的汉字
+bool ContainsHan(std::string_view utf8);
+
+// 把UTF-8文本的全拼形式追加到full、首字母形式追加到initials（非汉字字符两者都原样保留）
+void AppendPinyinKeys(std::string_view utf8, std::string& full, std::string& initials);
@@ -0,0 +1,149 @@
+#include "playback_chain.h"
+
+PlaybackChain::PlaybackChain() {
+    static const ma_data_source_vtable kHeadVtable = {OnRead, OnSeek, OnGetDataFormat, OnGetCursor, OnGetLength,
+                                                      NULL, 0};
+    ma_data_source_config config = ma_data_source_config_init();
+    config.vtable = &kHeadVtable;
+    ma_data_source_init(&config, &m_head.base);
+    m_head.owner = this;
+}
+
+PlaybackChain::~PlaybackChain() {
+    Reset();
+    ma_data_source_uninit(&m_head.base);
+}
+
+void PlaybackChain::SetOutputFormat(ma_uint32 channels, ma_uint32 sampleRate) {
+    m_channels = channels;
+    m_sampleRate = sampleRate;
+}
+
+void PlaybackChain::Open(std::unique_ptr<TrackSource> track) {
+    Reset();
+    m_current = std::move(track);
+    ma_data_source_set_current(&m_head.base, m_current->DataSource());
+}
+
+void PlaybackChain::Queue(std::unique_ptr<TrackSource> track) {
+    if (m_current == nullptr) return;
+    Unqueue();
+    ReleaseDetached();
+    m_queued = std::move(track);
+    // 音频线程读到当前曲目末尾时经由pNext切换到下一首（并把它定位到开头）
+    ma_data_source_set_next(m_current->DataSource(), m_queued->DataSource());
+}
+
+void PlaybackChain::Unqueue() {
+    if (m_queued == nullptr) return;
+    ma_data_source_set_next(m_current->DataSource(), NULL);
+    m_detached.push_back(Detached{std::move(m_queued), m_audioReads.load()});
+}
+
+void PlaybackChain::ReleaseDetached() {
+    const std::uint64_t reads = m_audioReads.load();
+    ma_data_source* reading = Reading();
+    for (size_t i = 0; i < m_detached.size();) {
+        // 音频线程已切换到断开的曲目时（断开之前的读取取得了pNext）留给Advance处理
+        if (reads > m_detached[i].reads && m_detached[i].track->DataSource() != reading) {
+            m_detached.erase(m_detached.begin() + i);
+        } else {
+            ++i;
+        }
+    }
+}
+
+bool PlaybackChain::Advance() {
+    ReleaseDetached();
+    ma_data_source* reading = Reading();
+    if (reading == nullptr || m_current == nullptr || reading == m_current->DataSource()) return false;
+
+    std::unique_ptr<TrackSource> next;
+    if (m_queued != nullptr && reading == m_queued->DataSource()) {
+        next = std::move(m_queued);
+    } else {
+        for (auto& detached : m_detached) {
+            if (reading == detached.track->DataSource()) next = std::move(detached.track);
+        }
+        if (next == nullptr) return false;
+    }
+    // 上一首、断开的曲目以及（切换到断开的曲目时）连接在上一首之后的曲目都已不可能再被读取
+    if (m_onReleased) m_onReleased(*m_current);
+    m_current = std::move(next);
+    m_queued.reset();
+    m_detached.clear();
+    return true;
+}
+
+std::unique_ptr<TrackSource> PlaybackChain::Take(std::uint32_t trackId) {
+    std::unique_ptr<TrackSource> track;
+    if (m_queued != nullptr && m_queued->Id() == trackId) {
+        track = std::move(m_queued);
+    } else {
+        for (size_t i = 0; i < m_detached.size(); ++i) {
+            if (m_detached[i].track->Id() != trackId) continue;
+            track = std::move(m_detached[i].track);
+            m_detached.erase(m_detached.begin() + i);
+            break;
+        }
+    }
+    if (track != nullptr) {
+        ma_data_source_seek_to_pcm_frame(track->DataSource(), 0); // 可能已被音频线程读过开头
+    }
+    return track;
+}
+
+void PlaybackChain::Reset() {
+    ma_data_source_set_current(&m_head.base, &m_head.base);
+    m_queued.reset();
+    m_detached.clear();
+    if (m_current != nullptr && m_onReleased) m_onReleased(*m_current);
+    m_current.reset();
+}
+
+ma_data_source* PlaybackChain::Reading() const {
+    ma_data_source* current = ma_data_source_get_current(&m_head.base);
+    return current == &m_head.base ? nullptr : current;
+}
+
+// ---------- 链头的回调（音频线程） ----------
+
+ma_result PlaybackChain::OnRead(ma_data_source*, void*, ma_uint64, ma_uint64* framesRead) {
+    *framesRead = 0; // 链为空
+    return MA_AT_END;
+}
+
+ma_result PlaybackChain::OnSeek(ma_data_source* source, ma_uint64 frameIndex) {
+    ma_data_source* reading = reinterpret_cast<ChainHead*>(source)->owner->Reading();
+    return reading != nullptr ? ma_data_source_seek_to_pcm_frame(reading, frameIndex) : MA_AT_END;
+}
+
+ma_result PlaybackChain::OnGetDataFormat(ma_data_source* source, ma_format* format, ma_uint32* channels,
+                                         ma_uint32* sampleRate, ma_channel* channelMap, size_t channelMapCap) {
+    const PlaybackChain* chain = reinterpret_cast<ChainHead*>(source)->owner;
+    *format = ma_format_f32;
+    *channels = chain->m_channels;
+    *sampleRate = chain->m_sampleRate;
+    if (channelMap != NULL) {
+        ma_channel_map_init_standard(ma_standard_channel_map_default, channelMap, channelMapCap, chain->m_channels);
+    }
+    return MA_SUCCESS;
+}
+
+ma_result PlaybackChain::OnGetCursor(ma_data_source* source, ma_uint64* cursor) {
+    ma_data_source* reading = reinterpret_cast<ChainHead*>(source)->owner->Reading();
+    if (reading == nullptr) {
+        *cursor = 0;
+        return MA_SUCCESS;
+    }
+    return ma_data_source_get_cursor_in_pcm_frames(reading, cursor);
+}
+
+ma_result PlaybackChain::OnGetLength(ma_data_source* source, ma_uint64* length) {
+    ma_data_source* reading = reinterpret_cast<ChainHead*>(source)->owner->Reading();
+    if (reading == nullptr) {
+        *length = 0;
+        return MA_NOT_IMPLEMENTED;
+    }
+    return ma_data_source_get_length_in_pcm_frames(reading, length);
+}
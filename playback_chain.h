@@ -0,0 +1,101 @@
+// 无缝播放的数据源链：ma_sound的数据源是固定的链头，链头之后用ma_data_source_set_next依次连接各曲目（TrackSource）
+// - 曲目统一输出引擎的格式（f32、引擎的声道数与采样率），链上各数据源的格式相同，
+//   音频线程读到当前曲目末尾时在同一次读取中接着读下一首，曲目之间不丢失也不插入任何采样
+// - 链头本身没有数据，定位/游标/长度转发给音频线程正在读取的曲目，
+//   ma_sound_seek_*/ma_sound_get_cursor_*/ma_sound_get_length_*照常可用；ma_sound_set_looping时只循环当前曲目
+// - 音频线程切换到下一首之后，由界面线程轮询Advance()得知切换并释放上一首
+// - 断开的下一首在音频线程完成一次读取（AudioProcessed）之后才释放：断开之前开始的读取可能已取得指向它的pNext
+// 成员函数只在界面线程调用（调用方持有引擎锁），AudioProcessed与链头的回调在音频线程执行
+#pragma once
+
+#include "miniaudio.h"
+#include "track_source.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+// 播放过的曲目释放之前调用（读取TrackSource::Stats、把边播边保存的PCM放入缓存等），音频线程已不再读取它
+using TrackReleasedCallback = std::function<void(TrackSource& track)>;
+
+class PlaybackChain {
+public:
+    static constexpr std::uint32_t kNoTrack = 0xFFFFFFFFu;
+
+    PlaybackChain();
+    ~PlaybackChain();
+    PlaybackChain(const PlaybackChain&) = delete;
+    PlaybackChain& operator=(const PlaybackChain&) = delete;
+
+    // 链头报告的格式（引擎的声道数与采样率），须与链上曲目的输出格式相同
+    void SetOutputFormat(ma_uint32 channels, ma_uint32 sampleRate);
+    ma_uint32 Channels() const { return m_channels; }
+    ma_uint32 SampleRate() const { return m_sampleRate; }
+
+    // 作为ma_sound数据源的链头
+    ma_data_source* Head() { return &m_head.base; }
+
+    // 当前曲目被切换掉或随链释放时回调（未播放过的下一首不回调）
+    void SetReleasedCallback(TrackReleasedCallback onReleased) { m_onReleased = std::move(onReleased); }
+
+    // 以已打开的曲目作为链上唯一的曲目（释放原有的全部曲目）；调用方须先释放使用链头的ma_sound
+    void Open(std::unique_ptr<TrackSource> track);
+
+    // 把已打开的下一首连接在当前曲目之后（取代之前连接的下一首）；链为空时不连接
+    void Queue(std::unique_ptr<TrackSource> track);
+
+    // 断开已连接的下一首（列表或播放模式改变时）
+    void Unqueue();
+
+    // 音频线程每次读取结束时调用（ma_engine的onProcess），之后可以释放此前断开的曲目
+    void AudioProcessed() { m_audioReads.fetch_add(1); }
+
+    // 音频线程已切换到下一首时释放上一首并返回true，此后CurrentTrack()为新的曲目
+    bool Advance();
+
+    // 取出链上（已连接或已断开的）指定曲目，供直接开始播放；没有时返回nullptr
+    // 调用方须先释放使用链头的ma_sound（之后通常接着Open）
+    std::unique_ptr<TrackSource> Take(std::uint32_t trackId);
+
+    // 释放链上的全部曲目；调用方须先释放使用链头的ma_sound
+    void Reset();
+
+    bool Empty() const { return m_current == nullptr; }
+    std::uint32_t CurrentTrack() const { return m_current ? m_current->Id() : kNoTrack; }
+    std::uint32_t QueuedTrack() const { return m_queued ? m_queued->Id() : kNoTrack; }
+
+private:
+    struct ChainHead {
+        ma_data_source_base base;   // 须为第一个成员
+        PlaybackChain* owner = nullptr;
+    };
+
+    // 音频线程正在读取的曲目的数据源（链为空时为nullptr）
+    ma_data_source* Reading() const;
+    // 释放断开之后音频线程已完成过读取的曲目
+    void ReleaseDetached();
+
+    static ma_result OnRead(ma_data_source* source, void* framesOut, ma_uint64 frameCount, ma_uint64* framesRead);
+    static ma_result OnSeek(ma_data_source* source, ma_uint64 frameIndex);
+    static ma_result OnGetDataFormat(ma_data_source* source, ma_format* format, ma_uint32* channels,
+                                     ma_uint32* sampleRate, ma_channel* channelMap, size_t channelMapCap);
+    static ma_result OnGetCursor(ma_data_source* source, ma_uint64* cursor);
+    static ma_result OnGetLength(ma_data_source* source, ma_uint64* length);
+
+    ChainHead m_head;
+    TrackReleasedCallback m_onReleased;
+    ma_uint32 m_channels = 2;
+    ma_uint32 m_sampleRate = 48000;
+    std::unique_ptr<TrackSource> m_current;
+    std::unique_ptr<TrackSource> m_queued;
+    // 断开后暂不释放的曲目：音频线程可能在断开前已读到指向它的pNext，
+    // 直到断开之后音频线程完成一次读取、下一次切换（Advance）或整条链释放时才能确定不再被读取
+    struct Detached {
+        std::unique_ptr<TrackSource> track;
+        std::uint64_t reads;        // 断开时m_audioReads的值
+    };
+    std::vector<Detached> m_detached;
+    std::atomic<std::uint64_t> m_audioReads{0};
+};
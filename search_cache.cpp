@@ -0,0 +1,72 @@
+#include "search_cache.h"
+
+size_t SearchCacheEntry::MemoryBytes() const {
+    return sizeof(SearchCacheEntry) + key.capacity() + text.capacity() +
+           (hits.capacity() + ids.capacity()) * sizeof(std::uint32_t);
+}
+
+SearchCache::SearchCache(size_t maxEntries, size_t maxBytes) : m_maxEntries(maxEntries), m_maxBytes(maxBytes) {}
+
+const SearchCacheEntry* SearchCache::Find(std::string_view key) {
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+        if (it->key != key) continue;
+        m_entries.splice(m_entries.begin(), m_entries, it);
+        m_hits.fetch_add(1, std::memory_order_relaxed);
+        return &m_entries.front();
+    }
+    return nullptr;
+}
+
+const SearchCacheEntry* SearchCache::FindBase(std::string_view text, size_t maxHits) {
+    const SearchCacheEntry* best = nullptr;
+    for (const auto& entry : m_entries) {
+        if (entry.text.empty() || entry.hits.size() > maxHits) continue;
+        if (best != nullptr && entry.text.size() <= best->text.size()) continue;
+        if (text.find(entry.text) != std::string_view::npos) best = &entry;
+    }
+    (best != nullptr ? m_baseHits : m_misses).fetch_add(1, std::memory_order_relaxed);
+    return best;
+}
+
+void SearchCache::Insert(SearchCacheEntry entry) {
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+        if (it->key != entry.key) continue;
+        m_memoryBytes -= it->MemoryBytes();
+        m_entries.erase(it);
+        break;
+    }
+    const size_t bytes = entry.MemoryBytes();
+    if (bytes <= m_maxBytes) {
+        m_entries.push_front(std::move(entry));
+        m_memoryBytes += bytes;
+        Evict();
+    }
+    m_entryCount.store(m_entries.size(), std::memory_order_relaxed);
+    m_memoryStat.store(m_memoryBytes, std::memory_order_relaxed);
+}
+
+void SearchCache::Evict() {
+    while (m_entries.size() > m_maxEntries || m_memoryBytes > m_maxBytes) {
+        m_memoryBytes -= m_entries.back().MemoryBytes();
+        m_entries.pop_back();
+        m_evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void SearchCache::Clear() {
+    m_entries.clear();
+    m_memoryBytes = 0;
+    m_entryCount.store(0, std::memory_order_relaxed);
+    m_memoryStat.store(0, std::memory_order_relaxed);
+}
+
+SearchCacheStats SearchCache::Stats() const {
+    SearchCacheStats stats;
+    stats.hits = m_hits.load(std::memory_order_relaxed);
+    stats.baseHits = m_baseHits.load(std::memory_order_relaxed);
+    stats.misses = m_misses.load(std::memory_order_relaxed);
+    stats.evictions = m_evictions.load(std::memory_order_relaxed);
+    stats.entries = m_entryCount.load(std::memory_order_relaxed);
+    stats.memoryBytes = m_memoryStat.load(std::memory_order_relaxed);
+    return stats;
+}
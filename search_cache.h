@@ -0,0 +1,69 @@
+// 搜索结果缓存（LRU）：以折叠后的完整关键词为键，保存最终结果与其中普通文本的子串命中
+// - 同一关键词再次出现（重新输入、按回车）时直接取结果，只需补充判断之后追加到曲目表末尾的曲目
+// - 未命中时，取普通文本包含于新普通文本中的最长已缓存文本（通常是前缀，例如继续输入），
+//   以它的子串命中作为候选集合，不必查询索引或扫描全表
+// 曲目id重新编号（整体替换曲目表）后缓存全部失效，由调用方Clear()
+// 条目的读写只在持有曲目表锁的线程上进行；计数器可从任意线程读取
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct SearchCacheEntry {
+    std::string key;                    // 折叠后的完整关键词（含字段条件）
+    std::string text;                   // 其中的普通文本
+    std::vector<std::uint32_t> hits;    // 普通文本的子串命中（升序），只有字段条件时为空
+    std::vector<std::uint32_t> ids;     // 最终结果（与SearchResult::ids相同的顺序）
+    std::uint32_t tracks = 0;           // 求值时曲目表中的曲目数
+
+    size_t MemoryBytes() const;
+};
+
+struct SearchCacheStats {
+    std::uint64_t hits = 0;             // 完整关键词命中
+    std::uint64_t baseHits = 0;         // 未命中，但找到了候选集合
+    std::uint64_t misses = 0;           // 未命中且没有候选集合
+    std::uint64_t evictions = 0;
+    size_t entries = 0;
+    size_t memoryBytes = 0;
+};
+
+class SearchCache {
+public:
+    SearchCache(size_t maxEntries = 64, size_t maxBytes = 64u << 20);
+
+    // 完整关键词命中时返回条目（并移到最近使用），否则返回nullptr；返回的指针在下一次Insert/Clear前有效
+    const SearchCacheEntry* Find(std::string_view key);
+
+    // 普通文本包含于text中、子串命中不超过maxHits首的最长已缓存文本；没有时返回nullptr
+    // 在Find未命中之后调用（据此统计baseHits/misses）
+    const SearchCacheEntry* FindBase(std::string_view text, size_t maxHits);
+
+    // 加入条目（同一关键词的旧条目被替换），超出条目数或内存上限时淘汰最久未使用的条目
+    // 单个条目超过内存上限时不缓存
+    void Insert(SearchCacheEntry entry);
+
+    void Clear();
+
+    SearchCacheStats Stats() const;
+
+private:
+    void Evict();
+
+    size_t m_maxEntries;
+    size_t m_maxBytes;
+    // 条目不多，按最近使用顺序（最近的在前）线性查找；FindBase本就需要检查每个条目
+    std::list<SearchCacheEntry> m_entries;
+    size_t m_memoryBytes = 0;
+
+    std::atomic<std::uint64_t> m_hits{0};
+    std::atomic<std::uint64_t> m_baseHits{0};
+    std::atomic<std::uint64_t> m_misses{0};
+    std::atomic<std::uint64_t> m_evictions{0};
+    std::atomic<size_t> m_entryCount{0};
+    std::atomic<size_t> m_memoryStat{0};
+};
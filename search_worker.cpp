@@ -0,0 +1,178 @@
+#include "search_worker.h"
+#include "fuzzy_search.h"
+#include "track_query.h"
+
+#include <algorithm>
+
+namespace {
+
+constexpr std::uint32_t kScanChunk = 1u << 16;     // 顺序扫描每段的曲目数（1M曲目下每段约2ms）
+constexpr size_t kNarrowCheckInterval = 4096;       // 筛选上次结果时每隔多少首检查一次
+
+} // namespace
+
+SearchWorker::SearchWorker(const TrackTable& table, const TrigramIndex& index, SearchResultCallback onResult)
+    : m_table(table), m_index(index), m_onResult(std::move(onResult)) {}
+
+SearchWorker::~SearchWorker() {
+    Stop();
+}
+
+void SearchWorker::Start() {
+    m_thread = std::thread(&SearchWorker::WorkerLoop, this);
+}
+
+void SearchWorker::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_stopping) return;
+        m_stopping = true;
+        m_pendingTicket = 0;
+        m_latest.fetch_add(1); // 让进行中的求值在下一个分段处退出
+    }
+    m_cv.notify_all();
+    if (m_thread.joinable()) m_thread.join();
+}
+
+std::uint64_t SearchWorker::Submit(std::string foldedKey) {
+    std::uint64_t ticket;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ticket = m_latest.fetch_add(1) + 1;
+        m_pending = std::move(foldedKey);
+        m_pendingTicket = ticket;
+    }
+    m_cv.notify_all();
+    return ticket;
+}
+
+void SearchWorker::Cancel() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pendingTicket = 0;
+    m_latest.fetch_add(1);
+}
+
+std::unique_lock<std::mutex> SearchWorker::LockData(bool renumbered) {
+    m_lockWaiters.fetch_add(1);
+    std::unique_lock<std::mutex> lock(m_dataMutex);
+    m_lockWaiters.fetch_sub(1);
+    if (renumbered) {
+        ++m_epoch;
+        m_cache.Clear(); // 缓存中的曲目id全部失效
+    }
+    return lock;
+}
+
+void SearchWorker::WorkerLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_cv.wait(lock, [this] { return m_stopping || m_pendingTicket != 0; });
+        if (m_stopping) break;
+        const std::string key = std::move(m_pending);
+        const std::uint64_t ticket = m_pendingTicket;
+        m_pendingTicket = 0;
+        lock.unlock();
+
+        auto result = std::make_unique<SearchResult>();
+        bool done;
+        {
+            std::unique_lock<std::mutex> dataLock(m_dataMutex);
+            done = Evaluate(ticket, key, *result, dataLock);
+        }
+        // 求值完成后又有新关键词时直接丢弃，只发布最新一次的结果
+        if (done && m_latest.load() == ticket) {
+            SplitRankedIds(result->ids, result->rest); // 在工作线程上转换为列表视图使用的形式
+            m_onResult(std::move(result));
+        }
+
+        lock.lock();
+    }
+}
+
+bool SearchWorker::Checkpoint(std::uint64_t ticket, std::uint64_t epoch, std::unique_lock<std::mutex>& dataLock) {
+    if (m_latest.load() != ticket) return false;
+    if (m_lockWaiters.load() > 0) {
+        // std::mutex不保证公平，等待者拿到锁之后再重新加锁
+        dataLock.unlock();
+        while (m_lockWaiters.load() > 0) std::this_thread::yield();
+        dataLock.lock();
+        if (m_epoch != epoch || m_latest.load() != ticket) return false;
+    }
+    return true;
+}
+
+bool SearchWorker::Evaluate(std::uint64_t ticket, const std::string& key, SearchResult& result,
+                            std::unique_lock<std::mutex>& dataLock) {
+    const std::uint64_t epoch = m_epoch;
+    const std::uint32_t tracks = m_table.Size();
+    result.ticket = ticket;
+    result.key = key;
+    result.tracks = tracks;
+    std::vector<std::uint32_t>& ids = result.ids;
+
+    const TrackQuery query(key);
+    const std::string& text = query.Text();
+    QueryOptions queryOptions;
+    queryOptions.chunkSize = kScanChunk / 8; // 每个分段再拆给多个线程
+    queryOptions.isCancelled = [this, ticket] { return m_latest.load() != ticket; };
+
+    // 0. 同一关键词已缓存：直接取结果，只补充之后追加的曲目（与OnSearchResult补齐的方式相同）
+    if (const SearchCacheEntry* cached = m_cache.Find(key)) {
+        ids = cached->ids;
+        return query.Scan(m_table, cached->tracks, tracks, ids, queryOptions);
+    }
+
+    SearchCacheEntry entry;
+    entry.key = key;
+    entry.text = text;
+    entry.tracks = tracks;
+
+    if (text.empty()) {
+        // 只有字段条件：分段按列求值
+        for (std::uint32_t first = 0; first < tracks; first += std::min(kScanChunk, tracks - first)) {
+            if (!Checkpoint(ticket, epoch, dataLock)) return false;
+            if (!query.Scan(m_table, first, first + std::min(kScanChunk, tracks - first), ids, queryOptions)) {
+                return false;
+            }
+        }
+    } else {
+        // 1. 新的普通文本包含某个已缓存的普通文本时，命中集合必然是其子串命中的子集（加上之后追加的曲目）
+        //    候选集合很大而新关键词可用索引时，索引查询比逐个校验更快
+        //    达到命中上限的条目只有部分命中，不能作为候选集合
+        std::uint32_t scanFrom = 0;
+        const size_t maxBase = std::min<size_t>(text.size() < 3 ? tracks : tracks / 8, kDenseHitLimit - 1);
+        const SearchCacheEntry* base = m_cache.FindBase(text, maxBase);
+        if (base != nullptr) {
+            // Checkpoint成功返回时曲目id未被重新编号，缓存未被清空，base仍然有效
+            for (size_t i = 0; i < base->hits.size(); ++i) {
+                if (i % kNarrowCheckInterval == 0 && !Checkpoint(ticket, epoch, dataLock)) return false;
+                if (m_table.KeyContains(base->hits[i], text)) ids.push_back(base->hits[i]);
+            }
+            scanFrom = base->tracks;
+        } else if (text.size() >= 3) {
+            m_index.Search(m_table, text, ids, kDenseHitLimit);
+            scanFrom = tracks;
+        }
+
+        // 2. 其余部分分段顺序扫描（短关键词的全部曲目，或候选集合之后追加的曲目），达到命中上限即停
+        for (std::uint32_t first = scanFrom; first < tracks && ids.size() < kDenseHitLimit;
+             first += std::min(kScanChunk, tracks - first)) {
+            if (!Checkpoint(ticket, epoch, dataLock)) return false;
+            m_table.Search(text, ids, first, first + std::min(kScanChunk, tracks - first));
+        }
+        if (ids.size() > kDenseHitLimit) ids.resize(kDenseHitLimit);
+        entry.hits = ids;
+
+        // 3. 按模糊得分排列（子串命中太少时还会补充模糊匹配的曲目）
+        FuzzyOptions options;
+        options.isCancelled = queryOptions.isCancelled;
+        if (!RankSearchResults(m_table, text, ids, options)) return false;
+
+        // 4. 按字段条件筛选（保持排列顺序）
+        if (!query.Filter(m_table, ids, queryOptions)) return false;
+    }
+
+    entry.ids = ids;
+    m_cache.Insert(std::move(entry));
+    return true;
+}
@@ -0,0 +1,88 @@
+// 边输入边搜索：关键词在后台线程上求值，新的关键词到来时放弃尚未完成的求值，只发布最新一次的结果
+// - 求值结果存入LRU缓存（search_cache）：重复的关键词直接取结果；新关键词包含已缓存的关键词时（例如继续输入），
+//   只在其子串命中与之后追加的曲目中筛选，不重新扫描
+// - 短关键词（无法使用索引）分段顺序扫描，每段之间检查是否已被取代
+// - 子串命中至多取id最小的kDenseHitLimit首（常见词/单字母命中太多，全部校验会超出按键间隔）
+// - 子串命中再按模糊得分排列（fuzzy_search），命中太少时补充模糊匹配的曲目
+// - 关键词可带字段条件（track_query），以上各步只针对其中的普通文本，最后按条件筛选
+// 曲目表与索引归调用方（UI线程）所有：修改它们或在调用方线程上搜索之前须持有LockData()返回的锁
+#pragma once
+
+#include "search_cache.h"
+#include "track_bitmap.h"
+#include "track_table.h"
+#include "trigram_index.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct SearchResult {
+    std::uint64_t ticket = 0;           // Submit返回的序号，调用方据此丢弃已被取代的结果
+    std::string key;                    // 折叠后的关键词
+    std::vector<std::uint32_t> ids;     // 得分最高的若干首（按得分顺序，见SplitRankedIds）
+    TrackBitmap rest;                   // 其余命中的曲目（按id升序），列表中排在ids之后
+    std::uint32_t tracks = 0;           // 求值时曲目表中的曲目数，之后追加的曲目须由调用方补充判断
+};
+
+// 结果回调：在工作线程上调用（通常投递给UI线程）
+using SearchResultCallback = std::function<void(std::unique_ptr<SearchResult> result)>;
+
+class SearchWorker {
+public:
+    SearchWorker(const TrackTable& table, const TrigramIndex& index, SearchResultCallback onResult);
+    ~SearchWorker();
+
+    SearchWorker(const SearchWorker&) = delete;
+    SearchWorker& operator=(const SearchWorker&) = delete;
+
+    void Start();
+    void Stop();
+
+    // 提交已折叠的关键词，取代之前提交的关键词；返回本次的序号
+    std::uint64_t Submit(std::string foldedKey);
+    // 放弃所有已提交的关键词（包括已投递、尚未被处理的结果），例如关键词被清空
+    void Cancel();
+    // 最近一次Submit/Cancel的序号：结果的ticket与之不同即已过期
+    std::uint64_t LatestTicket() const { return m_latest.load(); }
+
+    // 结果缓存的命中/内存计数（可从任意线程调用）
+    SearchCacheStats CacheStats() const { return m_cache.Stats(); }
+
+    // 等待工作线程让出曲目表与索引并返回锁（工作线程在分段之间让出，等待时间很短）
+    // renumbered为true表示曲目id将被重新编号或已有曲目的行将被修改（整体替换曲目表、曲库更新）：同时放弃进行中的求值并清空结果缓存，
+    // 调用方随后应自行重新搜索并Cancel()
+    std::unique_lock<std::mutex> LockData(bool renumbered);
+
+private:
+    void WorkerLoop();
+    // 求值key，被取代时返回false；调用时持有dataLock，分段之间可能暂时释放
+    bool Evaluate(std::uint64_t ticket, const std::string& key, SearchResult& result,
+                  std::unique_lock<std::mutex>& dataLock);
+    // 分段之间：被取代时返回false；有线程等待LockData时暂时让出锁
+    bool Checkpoint(std::uint64_t ticket, std::uint64_t epoch, std::unique_lock<std::mutex>& dataLock);
+
+    const TrackTable& m_table;
+    const TrigramIndex& m_index;
+    SearchResultCallback m_onResult;
+
+    std::mutex m_mutex;                 // 保护m_pending/m_pendingTicket/m_stopping
+    std::condition_variable m_cv;
+    std::string m_pending;
+    std::uint64_t m_pendingTicket = 0;  // 0表示没有待求值的关键词
+    bool m_stopping = false;
+    std::atomic<std::uint64_t> m_latest{0};
+
+    std::mutex m_dataMutex;             // 保护曲目表/索引的读写，以及结果缓存的条目
+    std::atomic<int> m_lockWaiters{0};
+    std::uint64_t m_epoch = 0;          // 曲目id重新编号的次数（缓存的版本）
+    SearchCache m_cache;
+
+    std::thread m_thread;
+};
@@ -0,0 +1,534 @@
+#include "tag_reader.h"
+#include "fs_util.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+constexpr size_t kHeadSize = 16 * 1024;          // 首次读取的文件头大小，多数文件的文本标签都在其中
+constexpr size_t kMaxFetch = 256 * 1024;         // 单个标签块最多读取的字节数（跳过封面等大块数据）
+constexpr std::uint32_t kMaxId3Unsync = 1 << 20; // 整体反同步的ID3v2.3标签最多读取1MB
+
+// 按偏移读取文件的小缓冲层：文件头读取一次并常驻，其余位置按需读取到临时缓冲
+class TagSource {
+public:
+    explicit TagSource(const FileReader& file) : m_file(file) {
+        m_head.resize(static_cast<size_t>(std::min<std::uint64_t>(kHeadSize, file.Size())));
+        m_head.resize(file.ReadAt(0, m_head.data(), m_head.size()));
+    }
+
+    std::uint64_t Size() const { return m_file.Size(); }
+
+    // 返回[offset, offset+size)的数据；不足size字节时返回nullptr
+    // 文件头之外的数据位于临时缓冲，下次Fetch后失效
+    const std::uint8_t* Fetch(std::uint64_t offset, size_t size) {
+        if (offset + size <= m_head.size()) return m_head.data() + offset;
+        if (size > kMaxFetch * 4) return nullptr;
+        m_scratch.resize(size);
+        if (m_file.ReadAt(offset, m_scratch.data(), size) != size) return nullptr;
+        return m_scratch.data();
+    }
+
+private:
+    const FileReader& m_file;
+    std::vector<std::uint8_t> m_head;
+    std::vector<std::uint8_t> m_scratch;
+};
+
+std::uint32_t ReadBE32(const std::uint8_t* p) {
+    return (std::uint32_t(p[0]) << 24) | (std::uint32_t(p[1]) << 16) | (std::uint32_t(p[2]) << 8) | p[3];
+}
+
+std::uint32_t ReadBE24(const std::uint8_t* p) {
+    return (std::uint32_t(p[0]) << 16) | (std::uint32_t(p[1]) << 8) | p[2];
+}
+
+std::uint32_t ReadLE32(const std::uint8_t* p) {
+    return std::uint32_t(p[0]) | (std::uint32_t(p[1]) << 8) | (std::uint32_t(p[2]) << 16) | (std::uint32_t(p[3]) << 24);
+}
+
+// ID3v2的同步安全整数（每字节7位）
+std::uint32_t ReadSyncSafe(const std::uint8_t* p) {
+    return (std::uint32_t(p[0] & 0x7f) << 21) | (std::uint32_t(p[1] & 0x7f) << 14) |
+           (std::uint32_t(p[2] & 0x7f) << 7) | (p[3] & 0x7f);
+}
+
+// ---------- 文本解码 ----------
+
+void AppendUtf8(std::string& out, std::uint32_t cp) {
+    if (cp < 0x80) {
+        out.push_back(static_cast<char>(cp));
+    } else if (cp < 0x800) {
+        out.push_back(static_cast<char>(0xc0 | (cp >> 6)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3f)));
+    } else if (cp < 0x10000) {
+        out.push_back(static_cast<char>(0xe0 | (cp >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3f)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3f)));
+    } else {
+        out.push_back(static_cast<char>(0xf0 | (cp >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3f)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3f)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3f)));
+    }
+}
+
+bool IsValidUtf8(std::string_view s) {
+    for (size_t i = 0; i < s.size();) {
+        const unsigned char c = static_cast<unsigned char>(s[i]);
+        size_t len = c < 0x80 ? 1 : (c >> 5) == 0x6 ? 2 : (c >> 4) == 0xe ? 3 : (c >> 3) == 0x1e ? 4 : 0;
+        if (len == 0 || i + len > s.size()) return false;
+        for (size_t k = 1; k < len; ++k) {
+            if ((static_cast<unsigned char>(s[i + k]) & 0xc0) != 0x80) return false;
+        }
+        i += len;
+    }
+    return true;
+}
+
+// 声明为ISO-8859-1的文本：不少工具实际写入的是UTF-8，能按UTF-8解析时原样保留，否则按Latin-1转换
+std::string DecodeLatin1(std::string_view s) {
+    if (IsValidUtf8(s)) return std::string(s);
+    std::string out;
+    out.reserve(s.size() * 2);
+    for (char c : s) AppendUtf8(out, static_cast<unsigned char>(c));
+    return out;
+}
+
+std::string DecodeUtf16(const std::uint8_t* p, size_t size, bool bigEndian) {
+    if (size >= 2 && ((p[0] == 0xff && p[1] == 0xfe) || (p[0] == 0xfe && p[1] == 0xff))) {
+        bigEndian = p[0] == 0xfe;
+        p += 2;
+        size -= 2;
+    }
+    std::string out;
+    out.reserve(size);
+    for (size_t i = 0; i + 1 < size; i += 2) {
+        std::uint32_t unit = bigEndian ? (p[i] << 8) | p[i + 1] : p[i] | (p[i + 1] << 8);
+        if (unit >= 0xd800 && unit < 0xdc00 && i + 3 < size) {
+            const std::uint32_t low = bigEndian ? (p[i + 2] << 8) | p[i + 3] : p[i + 2] | (p[i + 3] << 8);
+            if (low >= 0xdc00 && low < 0xe000) {
+                unit = 0x10000 + ((unit - 0xd800) << 10) + (low - 0xdc00);
+                i += 2;
+            }
+        }
+        AppendUtf8(out, unit);
+    }
+    return out;
+}
+
+// 去掉末尾的0和空白（ID3v1/INFO的定长字段以0或空格填充）
+void TrimRight(std::string& s) {
+    while (!s.empty() && (s.back() == '\0' || s.back() == ' ')) s.pop_back();
+}
+
+std::uint16_t ParseLeadingNumber(std::string_view s) {
+    size_t i = 0;
+    while (i < s.size() && s[i] == ' ') ++i;
+    std::uint32_t value = 0;
+    size_t digits = 0;
+    for (; i < s.size() && s[i] >= '0' && s[i] <= '9' && digits < 5; ++i, ++digits) {
+        value = value * 10 + (s[i] - '0');
+    }
+    return static_cast<std::uint16_t>(value > 0xffff ? 0 : value);
+}
+
+// ID3v1基本流派表（0~79）
+const char* const kId3Genres[] = {
+    "Blues", "Classic Rock", "Country", "Dance", "Disco", "Funk", "Grunge", "Hip-Hop", "Jazz", "Metal",
+    "New Age", "Oldies", "Other", "Pop", "R&B", "Rap", "Reggae", "Rock", "Techno", "Industrial",
+    "Alternative", "Ska", "Death Metal", "Pranks", "Soundtrack", "Euro-Techno", "Ambient", "Trip-Hop", "Vocal",
+    "Jazz+Funk", "Fusion", "Trance", "Classical", "Instrumental", "Acid", "House", "Game", "Sound Clip", "Gospel",
+    "Noise", "AlternRock", "Bass", "Soul", "Punk", "Space", "Meditative", "Instrumental Pop", "Instrumental Rock",
+    "Ethnic", "Gothic", "Darkwave", "Techno-Industrial", "Electronic", "Pop-Folk", "Eurodance", "Dream",
+    "Southern Rock", "Comedy", "Cult", "Gangsta", "Top 40", "Christian Rap", "Pop/Funk", "Jungle",
+    "Native American", "Cabaret", "New Wave", "Psychadelic", "Rave", "Showtunes", "Trailer", "Lo-Fi", "Tribal",
+    "Acid Punk", "Acid Jazz", "Polka", "Retro", "Musical", "Rock & Roll", "Hard Rock",
+};
+constexpr unsigned kId3GenreCount = sizeof(kId3Genres) / sizeof(kId3Genres[0]);
+
+// TCON可能是"(13)"、"13"或"(13)Pop"形式，数字部分映射到流派表
+std::string NormalizeGenre(const std::string& genre) {
+    std::string_view s = genre;
+    if (!s.empty() && s[0] == '(') {
+        const size_t close = s.find(')');
+        if (close != std::string_view::npos) {
+            std::string_view rest = s.substr(close + 1);
+            if (!rest.empty()) return std::string(rest);
+            s = s.substr(1, close - 1);
+        }
+    }
+    if (s.empty() || s.find_first_not_of("0123456789") != std::string_view::npos || s.size() > 3) return genre;
+    const unsigned index = ParseLeadingNumber(s);
+    return index < kId3GenreCount ? kId3Genres[index] : genre;
+}
+
+// 字段只取第一次出现的值（ID3v2优先于ID3v1）
+void SetText(TrackTags& tags, TagField field, std::string value) {
+    TrimRight(value);
+    if (tags.text[field].empty() && !value.empty()) {
+        tags.text[field] = field == TAG_GENRE ? NormalizeGenre(value) : std::move(value);
+    }
+}
+
+void SetYear(TrackTags& tags, std::string_view value) {
+    if (tags.year == 0) tags.year = ParseLeadingNumber(value.substr(0, 4));
+}
+
+void SetTrackNumber(TrackTags& tags, std::string_view value) {
+    if (tags.trackNumber == 0) tags.trackNumber = ParseLeadingNumber(value);
+}
+
+// ---------- ID3v2 ----------
+
+// 去除反同步（0xFF 0x00 -> 0xFF）
+void RemoveUnsync(std::vector<std::uint8_t>& data) {
+    size_t out = 0;
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[out++] = data[i];
+        if (data[i] == 0xff && i + 1 < data.size() && data[i + 1] == 0x00) ++i;
+    }
+    data.resize(out);
+}
+
+// 文本帧：首字节为编码，其后可能是以结束符分隔的多个值
+std::string DecodeId3Text(const std::uint8_t* p, size_t size) {
+    if (size < 1) return std::string();
+    const std::uint8_t encoding = p[0];
+    ++p;
+    --size;
+    std::string out;
+    const size_t unit = (encoding == 1 || encoding == 2) ? 2 : 1;
+    size_t begin = 0;
+    for (size_t i = 0; i + unit <= size; i += unit) {
+        const bool terminator = unit == 1 ? p[i] == 0 : (p[i] == 0 && p[i + 1] == 0);
+        const bool last = i + unit * 2 > size;
+        if (!terminator && !last) continue;
+        const size_t end = terminator ? i : i + unit;
+        if (end > begin) {
+            std::string value;
+            if (encoding == 1 || encoding == 2) {
+                value = DecodeUtf16(p + begin, end - begin, encoding == 2);
+            } else if (encoding == 3) {
+                value.assign(reinterpret_cast<const char*>(p + begin), end - begin);
+            } else {
+                value = DecodeLatin1(std::string_view(reinterpret_cast<const char*>(p + begin), end - begin));
+            }
+            TrimRight(value);
+            if (!value.empty()) {
+                if (!out.empty()) out += "; ";
+                out += value;
+            }
+        }
+        begin = i + unit;
+    }
+    return out;
+}
+
+void ApplyId3Frame(TrackTags& tags, std::string_view id, const std::uint8_t* data, size_t size) {
+    if (id == "TIT2" || id == "TT2") {
+        SetText(tags, TAG_TITLE, DecodeId3Text(data, size));
+    } else if (id == "TPE1" || id == "TP1") {
+        SetText(tags, TAG_ARTIST, DecodeId3Text(data, size));
+    } else if (id == "TALB" || id == "TAL") {
+        SetText(tags, TAG_ALBUM, DecodeId3Text(data, size));
+    } else if (id == "TCON" || id == "TCO") {
+        SetText(tags, TAG_GENRE, DecodeId3Text(data, size));
+    } else if (id == "TYER" || id == "TDRC" || id == "TYE") {
+        SetYear(tags, DecodeId3Text(data, size));
+    } else if (id == "TRCK" || id == "TRK") {
+        SetTrackNumber(tags, DecodeId3Text(data, size));
+    }
+}
+
+bool IsWantedId3Frame(std::string_view id) {
+    return id == "TIT2" || id == "TPE1" || id == "TALB" || id == "TCON" || id == "TYER" || id == "TDRC" ||
+           id == "TRCK" || id == "TT2" || id == "TP1" || id == "TAL" || id == "TCO" || id == "TYE" || id == "TRK";
+}
+
+// 逐帧遍历标签：只读取需要的文本帧，封面等大帧直接跳过
+// fetch(offset, size)返回标签内[offset, offset+size)的数据
+template <typename Fetch>
+void WalkId3Frames(TrackTags& tags, std::uint8_t major, std::uint32_t begin, std::uint32_t end, Fetch&& fetch) {
+    const std::uint32_t headerSize = major == 2 ? 6 : 10;
+    std::vector<std::uint8_t> payload;
+    for (std::uint32_t pos = begin; pos + headerSize <= end;) {
+        const std::uint8_t* h = fetch(pos, headerSize);
+        if (h == nullptr || h[0] == 0) break; // 填充区
+        const std::string_view id(reinterpret_cast<const char*>(h), major == 2 ? 3 : 4);
+        std::uint32_t size = major == 2 ? ReadBE24(h + 3) : major == 4 ? ReadSyncSafe(h + 4) : ReadBE32(h + 4);
+        const std::uint8_t formatFlags = major == 2 ? 0 : h[9];
+        pos += headerSize;
+        if (size > end - pos) break;
+        if (!IsWantedId3Frame(id)) {
+            pos += size;
+            continue;
+        }
+        const std::string idCopy(id);
+        // 压缩/加密帧不处理
+        const bool compressed = major == 3 ? (formatFlags & 0xc0) != 0 : major == 4 && (formatFlags & 0x0c) != 0;
+        const std::uint8_t* data = compressed ? nullptr : fetch(pos, std::min<std::uint32_t>(size, kMaxFetch));
+        if (data != nullptr) {
+            payload.assign(data, data + std::min<std::uint32_t>(size, kMaxFetch));
+            if (major == 4 && (formatFlags & 0x01) && payload.size() >= 4) {
+                payload.erase(payload.begin(), payload.begin() + 4); // 数据长度指示
+            }
+            if (major == 4 && (formatFlags & 0x02)) RemoveUnsync(payload);
+            ApplyId3Frame(tags, idCopy, payload.data(), payload.size());
+        }
+        pos += size;
+    }
+}
+
+// 解析offset处的ID3v2标签，返回标签总长度（含头部/尾部）；不是ID3v2时返回0
+std::uint32_t ParseId3v2(TagSource& src, std::uint64_t offset, TrackTags& tags) {
+    const std::uint8_t* h = src.Fetch(offset, 10);
+    if (h == nullptr || std::memcmp(h, "ID3", 3) != 0 || h[3] < 2 || h[3] > 4) return 0;
+    const std::uint8_t major = h[3];
+    const std::uint8_t flags = h[5];
+    const std::uint32_t bodySize = ReadSyncSafe(h + 6);
+    const std::uint32_t totalSize = 10 + bodySize + ((major == 4 && (flags & 0x10)) ? 10 : 0);
+
+    std::uint32_t begin = 0; // 相对标签体
+    if (major == 2 && (flags & 0x40)) return totalSize; // v2.2压缩标签，无法解析
+    if (major >= 3 && (flags & 0x40)) {
+        const std::uint8_t* ext = src.Fetch(offset + 10, 4);
+        if (ext == nullptr) return totalSize;
+        begin = major == 4 ? ReadSyncSafe(ext) : ReadBE32(ext) + 4;
+        if (begin >= bodySize) return totalSize;
+    }
+
+    if (major < 4 && (flags & 0x80)) {
+        // v2.2/2.3整体反同步：帧头也受影响，只能整体读入后还原
+        std::vector<std::uint8_t> body(std::min(bodySize, kMaxId3Unsync));
+        const std::uint8_t* data = src.Fetch(offset + 10, body.size());
+        if (data == nullptr) return totalSize;
+        body.assign(data, data + body.size());
+        RemoveUnsync(body);
+        const std::uint32_t end = static_cast<std::uint32_t>(body.size());
+        WalkId3Frames(tags, major, std::min(begin, end), end, [&body](std::uint32_t pos, std::uint32_t size) {
+            return pos + size <= body.size() ? body.data() + pos : nullptr;
+        });
+        return totalSize;
+    }
+
+    const std::uint64_t bodyOffset = offset + 10;
+    WalkId3Frames(tags, major, begin, bodySize, [&src, bodyOffset](std::uint32_t pos, std::uint32_t size) {
+        return src.Fetch(bodyOffset + pos, size);
+    });
+    return totalSize;
+}
+
+// ---------- ID3v1（文件末尾128字节） ----------
+
+void ParseId3v1(TagSource& src, TrackTags& tags) {
+    if (src.Size() < 128) return;
+    const std::uint8_t* p = src.Fetch(src.Size() - 128, 128);
+    if (p == nullptr || std::memcmp(p, "TAG", 3) != 0) return;
+    auto field = [p](size_t offset, size_t size) {
+        std::string_view raw(reinterpret_cast<const char*>(p + offset), size);
+        raw = raw.substr(0, raw.find('\0'));
+        return DecodeLatin1(raw);
+    };
+    SetText(tags, TAG_TITLE, field(3, 30));
+    SetText(tags, TAG_ARTIST, field(33, 30));
+    SetText(tags, TAG_ALBUM, field(63, 30));
+    SetYear(tags, std::string_view(reinterpret_cast<const char*>(p + 93), 4));
+    if (p[125] == 0 && p[126] != 0 && tags.trackNumber == 0) tags.trackNumber = p[126]; // ID3v1.1
+    if (p[127] < kId3GenreCount) SetText(tags, TAG_GENRE, kId3Genres[p[127]]);
+}
+
+// ---------- Vorbis注释（FLAC与Ogg共用） ----------
+
+bool KeyEquals(std::string_view key, const char* upper) {
+    const size_t n = std::strlen(upper);
+    if (key.size() != n) return false;
+    for (size_t i = 0; i < n; ++i) {
+        char c = key[i];
+        if (c >= 'a' && c <= 'z') c = static_cast<char>(c - 'a' + 'A');
+        if (c != upper[i]) return false;
+    }
+    return true;
+}
+
+// 多值字段（如多个ARTIST）以"; "连接
+void AppendText(TrackTags& tags, TagField field, std::string_view value) {
+    std::string& dst = tags.text[field];
+    if (value.empty()) return;
+    if (!dst.empty()) dst += "; ";
+    dst.append(value.data(), value.size());
+}
+
+// 数据可能因封面过大被截断，越界即停止
+void ParseVorbisComment(const std::uint8_t* p, size_t size, TrackTags& tags) {
+    if (size < 8) return;
+    const std::uint32_t vendorLength = ReadLE32(p);
+    if (vendorLength > size - 8) return;
+    size_t pos = 4 + vendorLength;
+    const std::uint32_t count = ReadLE32(p + pos);
+    pos += 4;
+    for (std::uint32_t i = 0; i < count && pos + 4 <= size; ++i) {
+        const std::uint32_t length = ReadLE32(p + pos);
+        pos += 4;
+        if (length > size - pos) break;
+        const std::string_view comment(reinterpret_cast<const char*>(p + pos), length);
+        pos += length;
+        const size_t eq = comment.find('=');
+        if (eq == std::string_view::npos) continue;
+        const std::string_view key = comment.substr(0, eq);
+        const std::string_view value = comment.substr(eq + 1);
+        if (KeyEquals(key, "TITLE")) {
+            AppendText(tags, TAG_TITLE, value);
+        } else if (KeyEquals(key, "ARTIST")) {
+            AppendText(tags, TAG_ARTIST, value);
+        } else if (KeyEquals(key, "ALBUM")) {
+            AppendText(tags, TAG_ALBUM, value);
+        } else if (KeyEquals(key, "GENRE")) {
+            AppendText(tags, TAG_GENRE, value);
+        } else if (KeyEquals(key, "DATE") || KeyEquals(key, "YEAR")) {
+            SetYear(tags, value);
+        } else if (KeyEquals(key, "TRACKNUMBER")) {
+            SetTrackNumber(tags, value);
+        }
+    }
+}
+
+// ---------- FLAC元数据块 ----------
+
+void ParseFlac(TagSource& src, std::uint64_t offset, TrackTags& tags) {
+    std::uint64_t pos = offset + 4; // "fLaC"
+    for (int block = 0; block < 128; ++block) {
+        const std::uint8_t* h = src.Fetch(pos, 4);
+        if (h == nullptr) return;
+        const bool last = (h[0] & 0x80) != 0;
+        const std::uint8_t type = h[0] & 0x7f;
+        const std::uint32_t length = ReadBE24(h + 1);
+        pos += 4;
+        if (type == 4) { // VORBIS_COMMENT
+            const size_t want = std::min<std::uint32_t>(length, kMaxFetch);
+            const std::uint8_t* data = src.Fetch(pos, want);
+            if (data != nullptr) ParseVorbisComment(data, want, tags);
+            return;
+        }
+        if (last) return;
+        pos += length;
+    }
+}
+
+// ---------- Ogg：第二个逻辑包是注释头 ----------
+
+void ParseOgg(TagSource& src, TrackTags& tags) {
+    std::vector<std::uint8_t> packet;
+    int packetIndex = 0;
+    std::uint32_t serial = 0;
+    std::uint64_t pos = 0;
+    for (int page = 0; page < 64; ++page) {
+        const std::uint8_t* h = src.Fetch(pos, 27);
+        if (h == nullptr || std::memcmp(h, "OggS", 4) != 0) return;
+        const std::uint32_t pageSerial = ReadLE32(h + 14);
+        const std::uint8_t segments = h[26];
+        if (page == 0) serial = pageSerial;
+        const std::uint8_t* lacingPtr = src.Fetch(pos + 27, segments);
+        if (lacingPtr == nullptr) return;
+        std::uint8_t lacing[255];
+        std::memcpy(lacing, lacingPtr, segments);
+        std::uint64_t dataPos = pos + 27 + segments;
+        std::uint32_t pageBodySize = 0;
+        for (std::uint8_t i = 0; i < segments; ++i) pageBodySize += lacing[i];
+
+        if (pageSerial == serial) {
+            std::uint64_t segPos = dataPos;
+            for (std::uint8_t i = 0; i < segments; ++i) {
+                if (packetIndex == 1 && lacing[i] > 0 && packet.size() < kMaxFetch) {
+                    const std::uint8_t* seg = src.Fetch(segPos, lacing[i]);
+                    if (seg == nullptr) return;
+                    packet.insert(packet.end(), seg, seg + lacing[i]);
+                }
+                segPos += lacing[i];
+                if (lacing[i] < 255) { // 包结束
+                    if (packetIndex == 1) {
+                        if (packet.size() > 7 && std::memcmp(packet.data(), "\x03vorbis", 7) == 0) {
+                            ParseVorbisComment(packet.data() + 7, packet.size() - 7, tags);
+                        } else if (packet.size() > 8 && std::memcmp(packet.data(), "OpusTags", 8) == 0) {
+                            ParseVorbisComment(packet.data() + 8, packet.size() - 8, tags);
+                        }
+                        return;
+                    }
+                    ++packetIndex;
+                }
+            }
+        }
+        pos = dataPos + pageBodySize;
+    }
+}
+
+// ---------- WAV：LIST/INFO块与内嵌的"id3 "块 ----------
+
+void ParseWav(TagSource& src, TrackTags& tags) {
+    std::uint64_t pos = 12;
+    for (int chunk = 0; chunk < 64; ++chunk) {
+        const std::uint8_t* h = src.Fetch(pos, 8);
+        if (h == nullptr) return;
+        const std::string_view id(reinterpret_cast<const char*>(h), 4);
+        const std::uint32_t size = ReadLE32(h + 4);
+        const std::uint64_t body = pos + 8;
+        if (id == "LIST" && size >= 4) {
+            const size_t want = std::min<std::uint32_t>(size, kMaxFetch);
+            const std::uint8_t* data = src.Fetch(body, want);
+            if (data != nullptr && std::memcmp(data, "INFO", 4) == 0) {
+                for (size_t p = 4; p + 8 <= want;) {
+                    const std::string_view sub(reinterpret_cast<const char*>(data + p), 4);
+                    const std::uint32_t len = ReadLE32(data + p + 4);
+                    if (len > want - p - 8) break;
+                    std::string_view raw(reinterpret_cast<const char*>(data + p + 8), len);
+                    raw = raw.substr(0, raw.find('\0'));
+                    if (sub == "INAM") SetText(tags, TAG_TITLE, DecodeLatin1(raw));
+                    else if (sub == "IART") SetText(tags, TAG_ARTIST, DecodeLatin1(raw));
+                    else if (sub == "IPRD") SetText(tags, TAG_ALBUM, DecodeLatin1(raw));
+                    else if (sub == "IGNR") SetText(tags, TAG_GENRE, DecodeLatin1(raw));
+                    else if (sub == "ICRD") SetYear(tags, raw);
+                    else if (sub == "ITRK" || sub == "IPRT") SetTrackNumber(tags, raw);
+                    p += 8 + len + (len & 1);
+                }
+            }
+        } else if (id == "id3 " || id == "ID3 ") {
+            ParseId3v2(src, body, tags);
+        }
+        pos = body + size + (size & 1);
+    }
+}
+
+} // namespace
+
+bool ReadTrackTags(const std::string& pathUtf8, TrackTags& tags) {
+    tags = TrackTags();
+    FileReader file;
+    if (!file.Open(pathUtf8)) return false;
+    ReadTrackTags(file, tags);
+    return true;
+}
+
+void ReadTrackTags(const FileReader& file, TrackTags& tags) {
+    tags = TrackTags();
+    TagSource src(file);
+
+    // 文件开头可能是ID3v2（MP3常见，FLAC偶见），之后按魔数判断容器
+    const std::uint32_t id3Size = ParseId3v2(src, 0, tags);
+    const std::uint8_t* magic = src.Fetch(id3Size, 12);
+    if (magic != nullptr && std::memcmp(magic, "fLaC", 4) == 0) {
+        ParseFlac(src, id3Size, tags);
+    } else if (magic != nullptr && id3Size == 0 && std::memcmp(magic, "OggS", 4) == 0) {
+        ParseOgg(src, tags);
+    } else if (magic != nullptr && id3Size == 0 && std::memcmp(magic, "RIFF", 4) == 0 &&
+               std::memcmp(magic + 8, "WAVE", 4) == 0) {
+        ParseWav(src, tags);
+    } else {
+        // MPEG音频：ID3v2缺少的字段用文件末尾的ID3v1补齐
+        const bool complete = !tags.text[TAG_TITLE].empty() && !tags.text[TAG_ARTIST].empty() &&
+                              !tags.text[TAG_ALBUM].empty();
+        if (!complete) ParseId3v1(src, tags);
+    }
+}
@@ -0,0 +1,37 @@
+// 标签读取：只读取文件头部/尾部的标签区域（按偏移定长读取，不解码音频）
+// 支持ID3v2.2/2.3/2.4、ID3v1、FLAC VORBIS_COMMENT、Ogg（Vorbis/Opus）注释包、WAV LIST/INFO
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// 文本字段（列存储中每个字段一列）
+enum TagField : std::uint32_t {
+    TAG_TITLE = 0,
+    TAG_ARTIST,
+    TAG_ALBUM,
+    TAG_GENRE,
+    TAG_FIELD_COUNT
+};
+
+// 单曲标签（文本均为UTF-8；多值字段以"; "连接；缺失为空串/0）
+struct TrackTags {
+    std::string text[TAG_FIELD_COUNT];
+    std::uint16_t year = 0;
+    std::uint16_t trackNumber = 0;
+
+    bool Empty() const {
+        for (const auto& t : text) {
+            if (!t.empty()) return false;
+        }
+        return year == 0 && trackNumber == 0;
+    }
+};
+
+class FileReader;
+
+// 读取pathUtf8的标签；文件无法打开时返回false，没有可识别的标签时返回true且tags为空
+// 线程安全，可在扫描线程中并发调用
+bool ReadTrackTags(const std::string& pathUtf8, TrackTags& tags);
+// 同上，使用已打开的文件（与时长探测等共用一次打开）
+void ReadTrackTags(const FileReader& file, TrackTags& tags);
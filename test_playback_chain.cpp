@@ -0,0 +1,137 @@
+// 无缝播放测试：离线引擎（noDevice）播放两首连接在数据源链上的合成曲目，
+// 经ma_engine_read_pcm_frames读过曲目边界，输出须与两首曲目首尾相接完全一致（不丢失、不插入任何采样）
+// - 第一首以WAV文件打开，引导段短于曲目，边界处的数据来自解码器；同时边播边保存（CaptureStream），
+//   释放时保存的PCM须是完整的第一首
+// - 第二首以内存中的PCM创建（TrackSource::FromPcm）
+// - 连接的下一首先被另一首取代（Queue/Unqueue），确认断开的曲目不会被读到
+#include "playback_chain.h"
+#include "track_source.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr ma_uint32 kSampleRate = 48000;
+constexpr ma_uint64 kFramesA = 30011;          // 不是读取块大小的整数倍，边界落在一次读取中间
+constexpr ma_uint64 kFramesB = 20011;
+constexpr ma_uint64 kReadFrames = 333;
+
+PlaybackChain g_chain;
+
+void OnEngineProcess(void*, float*, ma_uint64) {
+    g_chain.AudioProcessed();
+}
+
+// 每帧的值互不相同（f32可精确表示），丢失或重复的帧都会被发现
+float SampleA(ma_uint64 i) { return static_cast<float>(i) / 65536.0f; }
+float SampleB(ma_uint64 i) { return -static_cast<float>(i + 1) / 65536.0f; }
+
+bool WriteWav(const fs::path& path, ma_uint64 frames) {
+    ma_encoder_config config = ma_encoder_config_init(ma_encoding_format_wav, ma_format_f32, 1, kSampleRate);
+    ma_encoder encoder;
+    if (ma_encoder_init_file(path.string().c_str(), &config, &encoder) != MA_SUCCESS) return false;
+    std::vector<float> samples(static_cast<size_t>(frames));
+    for (ma_uint64 i = 0; i < frames; ++i) samples[i] = SampleA(i);
+    ma_encoder_write_pcm_frames(&encoder, samples.data(), frames, NULL);
+    ma_encoder_uninit(&encoder);
+    return true;
+}
+
+int Fail(const char* message) {
+    std::fprintf(stderr, "FAIL: %s\n", message);
+    return 1;
+}
+
+// 第一首释放时边播边保存的PCM（与缓存放入的相同）
+std::shared_ptr<const PcmBuffer> g_capturedA;
+
+void OnReleased(TrackSource& track) {
+    if (track.Id() == 1 && track.Captured()) g_capturedA = track.SharePcm();
+}
+
+} // namespace
+
+int main() {
+    const fs::path wavPath = fs::temp_directory_path() / "test_playback_chain_a.wav";
+    if (!WriteWav(wavPath, kFramesA)) return Fail("cannot write test wav");
+
+    ma_engine_config engineConfig = ma_engine_config_init();
+    engineConfig.noDevice = MA_TRUE;
+    engineConfig.channels = 1;
+    engineConfig.sampleRate = kSampleRate;
+    engineConfig.onProcess = OnEngineProcess;
+    ma_engine engine;
+    if (ma_engine_init(&engineConfig, &engine) != MA_SUCCESS) return Fail("engine init");
+    g_chain.SetOutputFormat(1, kSampleRate);
+
+    std::unique_ptr<TrackSource> trackA;
+    if (TrackSource::Open(1, wavPath.wstring(), AUDIO_FORMAT_WAV, 1, kSampleRate, trackA) != MA_SUCCESS) {
+        return Fail("open track A");
+    }
+    trackA->DecodeLeadIn(kSampleRate / 10);
+    if (trackA->Complete()) return Fail("lead-in should be shorter than track A");
+    trackA->CaptureStream(MemoryReservation(), kFramesA + kSampleRate);
+    g_chain.SetReleasedCallback(OnReleased);
+
+    auto pcmB = std::make_shared<PcmBuffer>();
+    for (ma_uint64 i = 0; i < kFramesB; ++i) pcmB->samples.push_back(SampleB(i));
+    auto pcmDecoy = std::make_shared<PcmBuffer>();
+    pcmDecoy->samples.assign(1000, 1.0f);
+    std::unique_ptr<TrackSource> trackB;
+    std::unique_ptr<TrackSource> decoy;
+    if (TrackSource::FromPcm(2, L"b", pcmB, 1, kSampleRate, trackB) != MA_SUCCESS ||
+        TrackSource::FromPcm(3, L"decoy", pcmDecoy, 1, kSampleRate, decoy) != MA_SUCCESS) {
+        return Fail("create PCM tracks");
+    }
+
+    g_chain.Open(std::move(trackA));
+    ma_sound sound;
+    if (ma_sound_init_from_data_source(&engine, g_chain.Head(), MA_SOUND_FLAG_NO_PITCH | MA_SOUND_FLAG_NO_SPATIALIZATION,
+                                       NULL, &sound) != MA_SUCCESS) {
+        return Fail("sound init");
+    }
+    ma_sound_start(&sound);
+    g_chain.Queue(std::move(decoy));
+    g_chain.Queue(std::move(trackB)); // 取代之前连接的下一首
+
+    std::vector<float> output;
+    std::vector<float> block(kReadFrames);
+    bool advanced = false;
+    while (output.size() < kFramesA + kFramesB) {
+        ma_uint64 read = 0;
+        if (ma_engine_read_pcm_frames(&engine, block.data(), kReadFrames, &read) != MA_SUCCESS || read == 0) break;
+        output.insert(output.end(), block.begin(), block.begin() + static_cast<size_t>(read));
+        if (g_chain.Advance()) {
+            advanced = true;
+            if (g_chain.CurrentTrack() != 2) return Fail("advanced to the wrong track");
+        }
+    }
+
+    ma_sound_uninit(&sound);
+    g_chain.Reset();
+    ma_engine_uninit(&engine);
+    fs::remove(wavPath);
+
+    if (!advanced) return Fail("chain did not advance to track B");
+    if (g_capturedA == nullptr) return Fail("track A was not captured while streaming");
+    if (g_capturedA->samples.size() != kFramesA) return Fail("captured PCM has the wrong length");
+    for (ma_uint64 i = 0; i < kFramesA; ++i) {
+        if (g_capturedA->samples[i] != SampleA(i)) return Fail("captured PCM differs from track A");
+    }
+    if (output.size() < kFramesA + kFramesB) return Fail("output shorter than both tracks");
+    for (ma_uint64 i = 0; i < kFramesA + kFramesB; ++i) {
+        const float expected = i < kFramesA ? SampleA(i) : SampleB(i - kFramesA);
+        if (output[i] != expected) {
+            std::fprintf(stderr, "FAIL: frame %llu is %f, expected %f\n", (unsigned long long)i, output[i], expected);
+            return 1;
+        }
+    }
+    std::printf("ok: %llu frames continuous across the track boundary, track A captured\n",
+                (unsigned long long)(kFramesA + kFramesB));
+    return 0;
+}
@@ -0,0 +1,181 @@
+#include "text_fold.h"
+#include "text_fold_table.h"
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TEXT_FOLD_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+#ifdef TEXT_FOLD_SSE2
+// 折叠从p开始的连续整块ASCII（每块16字节，A-Z加0x20），遇到含非ASCII字节的块即停止；返回已处理的字节数
+size_t FoldAsciiBlocks(const char* p, size_t n, std::string& out) {
+    const __m128i upperA = _mm_set1_epi8('A' - 1);
+    const __m128i upperZ = _mm_set1_epi8('Z' + 1);
+    const __m128i caseBit = _mm_set1_epi8(0x20);
+    size_t done = 0;
+    for (; done + 16 <= n; done += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + done));
+        if (_mm_movemask_epi8(v) != 0) break; // 含非ASCII字节（有符号比较下为负）
+        const __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(v, upperA), _mm_cmplt_epi8(v, upperZ));
+        const size_t at = out.size();
+        out.resize(at + 16);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[at]), _mm_add_epi8(v, _mm_and_si128(upper, caseBit)));
+    }
+    return done;
+}
+#endif
+
+void AppendUtf8(std::uint32_t cp, std::string& out) {
+    if (cp < 0x80) {
+        out.push_back(static_cast<char>(cp));
+    } else if (cp < 0x800) {
+        out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else if (cp < 0x10000) {
+        out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else {
+        out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    }
+}
+
+// 解码s[i]开始的一个UTF-8码点；非法序列返回false（调用方按单字节原样处理）
+bool DecodeUtf8(std::string_view s, size_t& i, std::uint32_t& cp) {
+    const unsigned char c = static_cast<unsigned char>(s[i]);
+    size_t len;
+    if (c < 0x80) { cp = c; ++i; return true; }
+    if ((c & 0xE0) == 0xC0) { len = 2; cp = c & 0x1F; }
+    else if ((c & 0xF0) == 0xE0) { len = 3; cp = c & 0x0F; }
+    else if ((c & 0xF8) == 0xF0) { len = 4; cp = c & 0x07; }
+    else return false;
+    if (i + len > s.size()) return false;
+    for (size_t k = 1; k < len; ++k) {
+        const unsigned char t = static_cast<unsigned char>(s[i + k]);
+        if ((t & 0xC0) != 0x80) return false;
+        cp = (cp << 6) | (t & 0x3F);
+    }
+    i += len;
+    return true;
+}
+
+// 码点的折叠映射：返回false表示不变，否则[begin, end)为映射结果（可能为空或多个码点）
+bool LookupFold(std::uint32_t cp, const std::uint32_t*& begin, const std::uint32_t*& end) {
+    std::uint32_t entry;
+    if (cp < 0x10000) {
+        const std::uint8_t page = kFoldPageIndex[cp >> 8];
+        if (page == 0) return false; // 汉字、韩文音节等整页不变
+        const std::uint16_t slot = kFoldPages[page - 1][cp & 0xFF];
+        if (slot == 0) return false;
+        entry = slot - 1u;
+    } else {
+        const auto it = std::lower_bound(std::begin(kFoldSupplementary), std::end(kFoldSupplementary), cp,
+                                         [](const FoldSupplementary& e, std::uint32_t key) { return e.cp < key; });
+        if (it == std::end(kFoldSupplementary) || it->cp != cp) return false;
+        entry = it->entry;
+    }
+    begin = kFoldCodePoints + kFoldOffsets[entry];
+    end = kFoldCodePoints + kFoldOffsets[entry + 1];
+    return true;
+}
+
+// 标准组合：first + second的预组合字符，不能组合时返回0
+std::uint32_t Compose(std::uint32_t first, std::uint32_t second) {
+    // 韩文：L + V -> LV，LV + T -> LVT
+    if (first >= 0x1100 && first <= 0x1112 && second >= 0x1161 && second <= 0x1175) {
+        return 0xAC00 + ((first - 0x1100) * 21 + (second - 0x1161)) * 28;
+    }
+    if (first >= 0xAC00 && first <= 0xD7A3 && (first - 0xAC00) % 28 == 0 && second >= 0x11A8 && second <= 0x11C2) {
+        return first + (second - 0x11A7);
+    }
+    if (!std::binary_search(std::begin(kComposeSeconds), std::end(kComposeSeconds), second)) return 0;
+    const auto it = std::lower_bound(std::begin(kComposePairs), std::end(kComposePairs), ComposePair{first, second, 0},
+                                     [](const ComposePair& a, const ComposePair& b) {
+                                         return a.first != b.first ? a.first < b.first : a.second < b.second;
+                                     });
+    return it != std::end(kComposePairs) && it->first == first && it->second == second ? it->composite : 0;
+}
+
+// 输出一个已折叠的码点：能与out中紧邻的前一个码点（不早于floor）组合时替换为预组合字符
+// 组合只处理紧跟在基字符后的组合符（NFD文件名与半角浊音符号均是如此），不做规范重排
+void AppendComposed(std::uint32_t cp, std::string& out, size_t floor) {
+    if (cp >= 0x300 && out.size() > floor) {
+        size_t start = out.size() - 1;
+        while (start > floor && (static_cast<unsigned char>(out[start]) & 0xC0) == 0x80) --start;
+        size_t i = start;
+        std::uint32_t previous;
+        if (DecodeUtf8(out, i, previous) && i == out.size()) {
+            if (const std::uint32_t composite = Compose(previous, cp)) {
+                out.resize(start);
+                AppendUtf8(composite, out);
+                return;
+            }
+        }
+    }
+    AppendUtf8(cp, out);
+}
+
+// 折叠一个非ASCII码点并追加
+void AppendFoldedCodePoint(std::uint32_t cp, std::string& out, size_t floor) {
+    const std::uint32_t* begin;
+    const std::uint32_t* end;
+    if (!LookupFold(cp, begin, end)) {
+        AppendComposed(cp, out, floor);
+        return;
+    }
+    for (; begin != end; ++begin) AppendComposed(*begin, out, floor);
+}
+
+} // namespace
+
+void AppendFoldedUtf8(std::string_view utf8, std::string& out) {
+    const size_t floor = out.size(); // 不与之前已有的内容组合
+    for (size_t i = 0; i < utf8.size();) {
+        const unsigned char c = static_cast<unsigned char>(utf8[i]);
+        if (c < 0x80) { // ASCII快速路径
+#ifdef TEXT_FOLD_SSE2
+            if (const size_t blockBytes = FoldAsciiBlocks(utf8.data() + i, utf8.size() - i, out)) {
+                i += blockBytes; // 整块ASCII一次折叠16字节
+                continue;
+            }
+#endif
+            out.push_back(static_cast<char>((c >= 'A' && c <= 'Z') ? c + 32 : c));
+            ++i;
+            continue;
+        }
+        std::uint32_t cp;
+        if (DecodeUtf8(utf8, i, cp)) {
+            AppendFoldedCodePoint(cp, out, floor);
+        } else {
+            out.push_back(static_cast<char>(c));
+            ++i;
+        }
+    }
+}
+
+void AppendFoldedWide(std::wstring_view text, std::string& out) {
+    const size_t floor = out.size();
+    for (size_t i = 0; i < text.size(); ++i) {
+        std::uint32_t cp = static_cast<std::uint32_t>(text[i]);
+        // UTF-16代理对（仅wchar_t为16位的平台会出现）
+        if (cp >= 0xD800 && cp <= 0xDBFF && i + 1 < text.size()) {
+            const std::uint32_t lo = static_cast<std::uint32_t>(text[i + 1]);
+            if (lo >= 0xDC00 && lo <= 0xDFFF) {
+                cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+                ++i;
+            }
+        }
+        if (cp < 0x80) {
+            out.push_back(static_cast<char>((cp >= 'A' && cp <= 'Z') ? cp + 32 : cp));
+        } else {
+            AppendFoldedCodePoint(cp, out, floor);
+        }
+    }
+}
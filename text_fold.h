@@ -0,0 +1,15 @@
+// 搜索用文本折叠：把文件名/关键词转换为大小写、全角/半角、兼容形式无关的UTF-8检索键
+// - 每个码点按NFKC + 大小写折叠映射（text_fold_table.h）：ＡＢＣ与abc、ﬁ与fi、①与1、ｶ与カ、兼容汉字与统一汉字相同，
+//   软连字符、零宽字符、变体选择符等被去掉
+// - 紧跟在基字符后的组合符与之组合（e + ́ -> é，ｶﾞ -> ガ，韩文字母 -> 音节），NFD文件名与NFC输入一致
+// 折叠只在建立曲目表与输入关键词时做一次，之后直接按字节做子串匹配（UTF-8自同步，字节匹配即码点匹配）
+#pragma once
+
+#include <string>
+#include <string_view>
+
+// 把UTF-8文本折叠后追加到out（非法字节原样保留）
+void AppendFoldedUtf8(std::string_view utf8, std::string& out);
+
+// 把宽字符文本（Windows为UTF-16，其他平台为UTF-32）折叠为UTF-8追加到out，用于界面输入的关键词
+void AppendFoldedWide(std::wstring_view text, std::string& out);
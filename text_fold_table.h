@@ -0,0 +1,2018 @@
+// 搜索键的Unicode折叠表（由Python unicodedata按Unicode 14.0.0生成）：
+// 每个码点映射为NFKC(casefold(NFKC(c)))，即兼容分解（全角/半角、连字、上下标、带圈数字、兼容汉字等）+ 大小写折叠，
+// 默认可忽略字符（软连字符、零宽字符、变体选择符等）映射为空；ASCII在代码中处理，不在表内
+// 只由text_fold.cpp包含
+#pragma once
+
+#include <cstdint>
+
+namespace {
+
+// 基本多文种平面按256个码点分页：kFoldPageIndex[cp >> 8]为kFoldPages中的页号+1（0表示整页无映射），
+// 页内kFoldPages[页][cp & 0xFF]为映射的下标+1（0表示不变）
+constexpr std::uint8_t kFoldPageIndex[256] = {
+    1, 2, 3, 4, 5, 6, 7, 0, 0, 8, 9, 10, 0, 0, 11, 12, 13, 14, 0, 15, 0, 0, 0, 16, 17, 0, 0, 0, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 0, 0, 0, 0, 0, 27, 0, 28, 29, 30, 31, 32, 33, 34, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 36, 37, 0, 0, 0, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 40, 41, 42, 43, 44, 45,
+};
+
+constexpr std::uint16_t kFoldPages[45][256] = {
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+        2, 0, 3, 0, 0, 4, 0, 5, 0, 0, 6, 7, 8, 9, 0, 0, 10, 11, 12, 0, 13, 14, 15, 0,
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 0,
+        39, 40, 41, 42, 43, 44, 45, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        47, 0, 48, 0, 49, 0, 50, 0, 51, 0, 52, 0, 53, 0, 54, 0, 55, 0, 56, 0, 57, 0, 58, 0,
+        59, 0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0, 65, 0, 66, 0, 67, 0, 68, 0, 69, 0, 70, 0,
+        71, 0, 72, 73, 74, 0, 75, 0, 0, 76, 0, 77, 0, 78, 0, 79, 80, 81, 0, 82, 0, 83, 0, 84,
+        0, 85, 86, 0, 87, 0, 88, 0, 89, 0, 90, 0, 91, 0, 92, 0, 93, 0, 94, 0, 95, 0, 96, 0,
+        97, 0, 98, 0, 99, 0, 100, 0, 101, 0, 102, 0, 103, 0, 104, 0, 105, 0, 106, 0, 107, 0, 108, 0,
+        109, 110, 0, 111, 0, 112, 0, 113, 0, 114, 115, 0, 116, 0, 117, 118, 0, 119, 120, 121, 0, 0, 122, 123,
+        124, 125, 0, 126, 127, 0, 128, 129, 130, 0, 0, 0, 131, 132, 0, 133, 134, 0, 135, 0, 136, 0, 137, 138,
+        0, 139, 0, 0, 140, 0, 141, 142, 0, 143, 144, 145, 0, 146, 0, 147, 148, 0, 0, 0, 149, 0, 0, 0,
+        0, 0, 0, 0, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 0, 160, 0, 161, 0, 162, 0, 163, 0, 164,
+        0, 165, 0, 166, 0, 0, 167, 0, 168, 0, 169, 0, 170, 0, 171, 0, 172, 0, 173, 0, 174, 0, 175, 0,
+        0, 176, 177, 178, 179, 0, 180, 181, 182, 0, 183, 0, 184, 0, 185, 0,
+    },
+    {
+        186, 0, 187, 0, 188, 0, 189, 0, 190, 0, 191, 0, 192, 0, 193, 0, 194, 0, 195, 0, 196, 0, 197, 0,
+        198, 0, 199, 0, 200, 0, 201, 0, 202, 0, 203, 0, 204, 0, 205, 0, 206, 0, 207, 0, 208, 0, 209, 0,
+        210, 0, 211, 0, 0, 0, 0, 0, 0, 0, 212, 213, 0, 214, 215, 0, 0, 216, 0, 217, 218, 219, 220, 0,
+        221, 0, 222, 0, 223, 0, 224, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 225, 226, 227, 228, 229, 230, 231, 232, 233, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        234, 235, 236, 237, 238, 239, 0, 0, 240, 241, 242, 243, 244, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 245, 246, 0, 247, 248, 249, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 250, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 251, 0, 252, 0, 253, 0, 254, 0,
+        0, 0, 255, 0, 0, 0, 256, 257, 0, 0, 0, 0, 258, 259, 260, 261, 262, 263, 264, 0, 265, 0, 266, 267,
+        0, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 0, 285, 286, 287, 288, 289,
+        290, 291, 292, 293, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 294, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 295, 296, 297, 298, 299, 300, 301, 302, 0,
+        303, 0, 304, 0, 305, 0, 306, 0, 307, 0, 308, 0, 309, 0, 310, 0, 311, 0, 312, 0, 313, 0, 314, 0,
+        315, 316, 317, 0, 318, 319, 0, 320, 0, 321, 322, 0, 0, 323, 324, 325,
+    },
+    {
+        326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349,
+        350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        374, 0, 375, 0, 376, 0, 377, 0, 378, 0, 379, 0, 380, 0, 381, 0, 382, 0, 383, 0, 384, 0, 385, 0,
+        386, 0, 387, 0, 388, 0, 389, 0, 390, 0, 0, 0, 0, 0, 0, 0, 0, 0, 391, 0, 392, 0, 393, 0,
+        394, 0, 395, 0, 396, 0, 397, 0, 398, 0, 399, 0, 400, 0, 401, 0, 402, 0, 403, 0, 404, 0, 405, 0,
+        406, 0, 407, 0, 408, 0, 409, 0, 410, 0, 411, 0, 412, 0, 413, 0, 414, 0, 415, 0, 416, 0, 417, 0,
+        418, 419, 0, 420, 0, 421, 0, 422, 0, 423, 0, 424, 0, 425, 0, 0, 426, 0, 427, 0, 428, 0, 429, 0,
+        430, 0, 431, 0, 432, 0, 433, 0, 434, 0, 435, 0, 436, 0, 437, 0, 438, 0, 439, 0, 440, 0, 441, 0,
+        442, 0, 443, 0, 444, 0, 445, 0, 446, 0, 447, 0, 448, 0, 449, 0,
+    },
+    {
+        450, 0, 451, 0, 452, 0, 453, 0, 454, 0, 455, 0, 456, 0, 457, 0, 458, 0, 459, 0, 460, 0, 461, 0,
+        462, 0, 463, 0, 464, 0, 465, 0, 466, 0, 467, 0, 468, 0, 469, 0, 470, 0, 471, 0, 472, 0, 473, 0,
+        0, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496,
+        497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 512, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 513, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 514, 515, 516,
+        517, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 518, 519, 520, 521, 522, 523, 524, 525,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 526, 527, 0, 528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 529, 0, 0, 530, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 531, 532, 533, 0, 0, 534, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 535, 536, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 537, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 538, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 539, 540, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 541, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 542, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 543, 0, 0, 0, 0, 544, 0, 0, 0, 0, 545, 0, 0, 0, 0, 546, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 547, 0, 0, 0, 0, 0, 0, 0, 0, 0, 548, 0, 549, 550, 551,
+        552, 553, 0, 0, 0, 0, 0, 0, 0, 554, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 555, 0, 0, 0, 0, 0, 0, 0, 0, 0, 556, 0, 0, 0, 0, 557, 0, 0, 0, 0, 558,
+        0, 0, 0, 0, 559, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 560, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 561, 562, 563, 564, 565, 566, 567, 568,
+        569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592,
+        593, 594, 595, 596, 597, 598, 0, 599, 0, 0, 0, 0, 0, 600, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 601, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 602,
+        603, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 604, 605, 606, 607, 608, 609, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 610, 611, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 612, 613, 614, 615, 616, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 617, 618, 619, 620, 621, 622, 623, 624, 625, 0, 0, 0, 0, 0, 0, 0,
+        626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648, 649,
+        650, 651, 652, 653, 654, 655, 656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 0, 0, 669, 670, 671,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 672, 673, 674, 0,
+        675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 0, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697,
+        698, 699, 700, 701, 702, 703, 0, 704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720,
+        721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        732, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745,
+        746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        770, 0, 771, 0, 772, 0, 773, 0, 774, 0, 775, 0, 776, 0, 777, 0, 778, 0, 779, 0, 780, 0, 781, 0,
+        782, 0, 783, 0, 784, 0, 785, 0, 786, 0, 787, 0, 788, 0, 789, 0, 790, 0, 791, 0, 792, 0, 793, 0,
+        794, 0, 795, 0, 796, 0, 797, 0, 798, 0, 799, 0, 800, 0, 801, 0, 802, 0, 803, 0, 804, 0, 805, 0,
+        806, 0, 807, 0, 808, 0, 809, 0, 810, 0, 811, 0, 812, 0, 813, 0, 814, 0, 815, 0, 816, 0, 817, 0,
+        818, 0, 819, 0, 820, 0, 821, 0, 822, 0, 823, 0, 824, 0, 825, 0, 826, 0, 827, 0, 828, 0, 829, 0,
+        830, 0, 831, 0, 832, 0, 833, 0, 834, 0, 835, 0, 836, 0, 837, 0, 838, 0, 839, 0, 840, 0, 841, 0,
+        842, 0, 843, 0, 844, 0, 0, 0, 0, 0, 845, 846, 0, 0, 847, 0, 848, 0, 849, 0, 850, 0, 851, 0,
+        852, 0, 853, 0, 854, 0, 855, 0, 856, 0, 857, 0, 858, 0, 859, 0, 860, 0, 861, 0, 862, 0, 863, 0,
+        864, 0, 865, 0, 866, 0, 867, 0, 868, 0, 869, 0, 870, 0, 871, 0, 872, 0, 873, 0, 874, 0, 875, 0,
+        876, 0, 877, 0, 878, 0, 879, 0, 880, 0, 881, 0, 882, 0, 883, 0, 884, 0, 885, 0, 886, 0, 887, 0,
+        888, 0, 889, 0, 890, 0, 891, 0, 892, 0, 893, 0, 894, 0, 895, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 896, 897, 898, 899, 900, 901, 902, 903, 0, 0, 0, 0, 0, 0, 0, 0,
+        904, 905, 906, 907, 908, 909, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 910, 911, 912, 913, 914, 915, 916, 917,
+        0, 0, 0, 0, 0, 0, 0, 0, 918, 919, 920, 921, 922, 923, 924, 925, 0, 0, 0, 0, 0, 0, 0, 0,
+        926, 927, 928, 929, 930, 931, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 932, 0, 933, 0, 934, 0, 935,
+        0, 0, 0, 0, 0, 0, 0, 0, 936, 937, 938, 939, 940, 941, 942, 943, 0, 944, 0, 945, 0, 946, 0, 947,
+        0, 948, 0, 949, 0, 950, 0, 0, 951, 952, 953, 954, 955, 956, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966,
+        967, 968, 969, 970, 971, 972, 973, 974, 975, 976, 977, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990,
+        991, 992, 993, 994, 995, 996, 997, 998, 0, 0, 999, 1000, 1001, 0, 0, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010,
+        1011, 1012, 1013, 1014, 1015, 0, 0, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 0, 0, 0, 1025, 0, 0, 0, 0,
+        1026, 1027, 1028, 1029, 0, 1030, 1031, 1032, 0, 0, 0, 1033, 0, 0, 0, 0, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041,
+        0, 0, 1042, 1043, 1044, 0, 0, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 0,
+    },
+    {
+        1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 0, 1069, 0, 0, 0, 0, 0, 1070,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1071, 1072, 1073, 0, 0, 0, 1074, 1075, 1076, 1077, 1078, 1079,
+        0, 0, 0, 1080, 1081, 0, 1082, 1083, 0, 0, 0, 0, 1084, 0, 1085, 0, 0, 0, 0, 0, 0, 0, 0, 1086,
+        1087, 1088, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1089, 0, 0, 0, 0, 0, 0, 0, 1090,
+        1091, 1092, 1093, 1094, 1095, 0, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 0, 0, 1108, 1109, 1110, 1111,
+        1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 0,
+        1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1148, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1149, 1150, 1151, 1152, 0, 1153, 1154, 1155, 0, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 0, 1167, 1168, 0,
+        0, 1169, 1170, 1171, 1172, 1173, 0, 0, 1174, 1175, 1176, 0, 1177, 0, 1178, 0, 1179, 0, 1180, 1181, 1182, 1183, 0, 1184,
+        1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 0, 1195, 1196, 1197, 1198, 1199, 1200, 0, 0, 0, 0, 1201, 1202, 1203,
+        1204, 1205, 0, 0, 0, 0, 0, 0, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221,
+        1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245,
+        1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 0, 0, 0, 1254, 0, 0, 0, 0, 0, 1255, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1256, 1257, 0, 1258,
+        1259, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1260, 1261, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285,
+        1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309,
+        1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333,
+        1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357,
+        1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381,
+        1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1402, 1403, 1404, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1405, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429,
+        1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1454, 0, 1455, 1456, 1457, 0, 0, 1458, 0, 1459, 0, 1460, 0, 1461, 1462, 1463, 1464, 0, 1465, 0, 0, 1466, 0, 0,
+        0, 0, 0, 0, 1467, 1468, 1469, 1470, 1471, 0, 1472, 0, 1473, 0, 1474, 0, 1475, 0, 1476, 0, 1477, 0, 1478, 0,
+        1479, 0, 1480, 0, 1481, 0, 1482, 0, 1483, 0, 1484, 0, 1485, 0, 1486, 0, 1487, 0, 1488, 0, 1489, 0, 1490, 0,
+        1491, 0, 1492, 0, 1493, 0, 1494, 0, 1495, 0, 1496, 0, 1497, 0, 1498, 0, 1499, 0, 1500, 0, 1501, 0, 1502, 0,
+        1503, 0, 1504, 0, 1505, 0, 1506, 0, 1507, 0, 1508, 0, 1509, 0, 1510, 0, 1511, 0, 1512, 0, 1513, 0, 1514, 0,
+        1515, 0, 1516, 0, 1517, 0, 1518, 0, 1519, 0, 1520, 0, 0, 0, 0, 0, 0, 0, 0, 1521, 0, 1522, 0, 0,
+        0, 0, 1523, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1524, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1525, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1526, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550,
+        1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574,
+        1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598,
+        1599, 1600, 1601, 1602, 1603, 1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622,
+        1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646,
+        1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670,
+        1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694,
+        1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718,
+        1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1741, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1742, 0, 1743, 1744, 1745, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1746, 1747, 0, 0, 1748, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1749,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772,
+        1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796,
+        1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819, 1820,
+        1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 0,
+        0, 0, 1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881,
+        1882, 1883, 1884, 1885, 1886, 1887, 1888, 0, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904,
+        1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928,
+        0, 0, 0, 0, 0, 0, 0, 0, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944,
+        1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968,
+        1969, 1970, 1971, 1972, 1973, 1974, 1975, 0, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991,
+        1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015,
+        2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039,
+        2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063,
+        2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087,
+        2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103,
+    },
+    {
+        2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127,
+        2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151,
+        2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 2175,
+        2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199,
+        2200, 2201, 2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220, 2221, 2222, 2223,
+        2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247,
+        2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271,
+        2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295,
+        2296, 2297, 2298, 2299, 2300, 2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319,
+        2320, 2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343,
+        2344, 2345, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2360, 0, 2361, 0, 2362, 0, 2363, 0,
+        2364, 0, 2365, 0, 2366, 0, 2367, 0, 2368, 0, 2369, 0, 2370, 0, 2371, 0, 2372, 0, 2373, 0, 2374, 0, 2375, 0,
+        2376, 0, 2377, 0, 2378, 0, 2379, 0, 2380, 0, 2381, 0, 2382, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 2383, 0, 2384, 0, 2385, 0, 2386, 0, 2387, 0, 2388, 0, 2389, 0, 2390, 0,
+        2391, 0, 2392, 0, 2393, 0, 2394, 0, 2395, 0, 2396, 0, 2397, 2398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2399, 0, 2400, 0, 2401, 0, 2402, 0, 2403, 0, 2404, 0, 2405, 0,
+        0, 0, 2406, 0, 2407, 0, 2408, 0, 2409, 0, 2410, 0, 2411, 0, 2412, 0, 2413, 0, 2414, 0, 2415, 0, 2416, 0,
+        2417, 0, 2418, 0, 2419, 0, 2420, 0, 2421, 0, 2422, 0, 2423, 0, 2424, 0, 2425, 0, 2426, 0, 2427, 0, 2428, 0,
+        2429, 0, 2430, 0, 2431, 0, 2432, 0, 2433, 0, 2434, 0, 2435, 0, 2436, 0, 2437, 0, 0, 0, 0, 0, 0, 0,
+        0, 2438, 0, 2439, 0, 2440, 2441, 0, 2442, 0, 2443, 0, 2444, 0, 2445, 0, 0, 0, 0, 2446, 0, 2447, 0, 0,
+        2448, 0, 2449, 0, 0, 0, 2450, 0, 2451, 0, 2452, 0, 2453, 0, 2454, 0, 2455, 0, 2456, 0, 2457, 0, 2458, 0,
+        2459, 0, 2460, 2461, 2462, 2463, 2464, 0, 2465, 2466, 2467, 2468, 2469, 0, 2470, 0, 2471, 0, 2472, 0, 2473, 0, 2474, 0,
+        2475, 0, 2476, 0, 2477, 2478, 2479, 2480, 0, 2481, 0, 0, 0, 0, 0, 0, 2482, 0, 0, 0, 0, 0, 2483, 0,
+        2484, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 2485, 2486, 2487, 2488, 0, 0, 2489, 2490, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2491, 2492, 2493, 2494,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 2495, 0, 0, 0, 0, 0, 0, 2496, 2497, 2498, 2499, 2500, 2501, 2502, 2503,
+        2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527,
+        2528, 2529, 2530, 2531, 2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551,
+        2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597, 2598, 2599,
+        2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607, 2608, 2609, 2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623,
+        2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643, 2644, 2645, 2646, 2647,
+        2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671,
+        2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691, 2692, 2693, 2694, 2695,
+        2696, 2697, 2698, 2699, 2700, 2701, 2702, 2703, 2704, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713, 2714, 2715, 2716, 2717, 2718, 2719,
+        2720, 2721, 2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729, 2730, 2731, 2732, 2733, 2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743,
+        2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751, 2752, 2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763, 2764, 2765, 2766, 2767,
+        2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777, 2778, 2779, 2780, 2781, 2782, 2783, 2784, 2785, 2786, 2787, 2788, 2789, 2790, 2791,
+        2792, 2793, 2794, 2795, 2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810, 2811, 2812, 2813, 2814, 2815,
+        2816, 2817, 2818, 2819, 2820, 2821, 2822, 2823, 2824, 2825, 2826, 2827, 2828, 2829, 2830, 2831,
+    },
+    {
+        2832, 2833, 2834, 2835, 2836, 2837, 2838, 2839, 2840, 2841, 2842, 2843, 2844, 2845, 0, 0, 2846, 0, 2847, 0, 0, 2848, 2849, 2850,
+        2851, 2852, 2853, 2854, 2855, 2856, 2857, 0, 2858, 0, 2859, 0, 0, 2860, 2861, 0, 0, 0, 2862, 2863, 2864, 2865, 2866, 2867,
+        2868, 2869, 2870, 2871, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 2879, 2880, 2881, 2882, 2883, 2884, 2885, 2886, 2887, 2888, 2889, 2890, 2891,
+        2892, 2893, 2894, 2895, 2896, 2897, 2898, 2899, 2900, 2901, 2902, 2903, 2904, 2905, 2906, 2907, 2908, 2909, 2910, 2911, 2912, 2913, 2914, 2915,
+        2916, 2917, 2918, 2919, 2920, 2921, 2922, 2923, 2924, 2925, 2926, 2927, 2928, 2929, 0, 0, 2930, 2931, 2932, 2933, 2934, 2935, 2936, 2937,
+        2938, 2939, 2940, 2941, 2942, 2943, 2944, 2945, 2946, 2947, 2948, 2949, 2950, 2951, 2952, 2953, 2954, 2955, 2956, 2957, 2958, 2959, 2960, 2961,
+        2962, 2963, 2964, 2965, 2966, 2967, 2968, 2969, 2970, 2971, 2972, 2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983, 2984, 2985,
+        2986, 2987, 2988, 2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997, 2998, 2999, 3000, 3001, 3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009,
+        3010, 3011, 3012, 3013, 3014, 3015, 3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032, 3033,
+        3034, 3035, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        3036, 3037, 3038, 3039, 3040, 3041, 3042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3043, 3044, 3045, 3046, 3047,
+        0, 0, 0, 0, 0, 3048, 0, 3049, 3050, 3051, 3052, 3053, 3054, 3055, 3056, 3057, 3058, 3059, 3060, 3061, 3062, 3063, 3064, 3065,
+        3066, 3067, 3068, 3069, 3070, 3071, 3072, 0, 3073, 3074, 3075, 3076, 3077, 0, 3078, 0, 3079, 3080, 0, 3081, 3082, 0, 3083, 3084,
+        3085, 3086, 3087, 3088, 3089, 3090, 3091, 3092, 3093, 3094, 3095, 3096, 3097, 3098, 3099, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107, 3108,
+        3109, 3110, 3111, 3112, 3113, 3114, 3115, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3123, 3124, 3125, 3126, 3127, 3128, 3129, 3130, 3131, 3132,
+        3133, 3134, 3135, 3136, 3137, 3138, 3139, 3140, 3141, 3142, 3143, 3144, 3145, 3146, 3147, 3148, 3149, 3150, 3151, 3152, 3153, 3154, 3155, 3156,
+        3157, 3158, 3159, 3160, 3161, 3162, 3163, 3164, 3165, 3166, 3167, 3168, 3169, 3170, 3171, 3172, 3173, 3174, 3175, 3176, 3177, 3178, 3179, 3180,
+        3181, 3182, 3183, 3184, 3185, 3186, 3187, 3188, 3189, 3190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3191, 3192, 3193, 3194, 3195,
+        3196, 3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204, 3205, 3206, 3207, 3208, 3209, 3210, 3211, 3212, 3213, 3214, 3215, 3216, 3217, 3218, 3219,
+        3220, 3221, 3222, 3223, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234, 3235,
+    },
+    {
+        3236, 3237, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3245, 3246, 3247, 3248, 3249, 3250, 3251, 3252, 3253, 3254, 3255, 3256, 3257, 3258, 3259,
+        3260, 3261, 3262, 3263, 3264, 3265, 3266, 3267, 3268, 3269, 3270, 3271, 3272, 3273, 3274, 3275, 3276, 3277, 3278, 3279, 3280, 3281, 3282, 3283,
+        3284, 3285, 3286, 3287, 3288, 3289, 3290, 3291, 3292, 3293, 3294, 3295, 3296, 3297, 3298, 3299, 3300, 3301, 3302, 3303, 3304, 3305, 3306, 3307,
+        3308, 3309, 3310, 3311, 3312, 3313, 3314, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3322, 3323, 3324, 3325, 3326, 3327, 3328, 3329, 3330, 3331,
+        3332, 3333, 3334, 3335, 3336, 3337, 3338, 3339, 3340, 3341, 3342, 3343, 3344, 3345, 3346, 3347, 3348, 3349, 3350, 3351, 3352, 3353, 3354, 3355,
+        3356, 3357, 3358, 3359, 3360, 3361, 3362, 3363, 3364, 3365, 3366, 3367, 3368, 3369, 3370, 3371, 3372, 3373, 3374, 3375, 3376, 3377, 3378, 3379,
+        3380, 3381, 3382, 3383, 3384, 3385, 3386, 3387, 3388, 3389, 3390, 3391, 3392, 3393, 3394, 3395, 3396, 3397, 3398, 3399, 3400, 3401, 3402, 3403,
+        3404, 3405, 3406, 3407, 3408, 3409, 3410, 3411, 3412, 3413, 3414, 3415, 3416, 3417, 3418, 3419, 3420, 3421, 3422, 3423, 3424, 3425, 3426, 3427,
+        3428, 3429, 3430, 3431, 3432, 3433, 3434, 3435, 3436, 3437, 3438, 3439, 3440, 3441, 3442, 3443, 3444, 3445, 3446, 3447, 3448, 3449, 3450, 3451,
+        3452, 3453, 3454, 3455, 3456, 3457, 3458, 3459, 3460, 3461, 3462, 3463, 3464, 3465, 3466, 3467, 3468, 3469, 3470, 3471, 3472, 3473, 3474, 3475,
+        3476, 3477, 3478, 3479, 3480, 3481, 3482, 3483, 3484, 3485, 3486, 3487, 3488, 3489, 3490, 3491,
+    },
+    {
+        3492, 3493, 3494, 3495, 3496, 3497, 3498, 3499, 3500, 3501, 3502, 3503, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 3511, 3512, 3513, 3514, 3515,
+        3516, 3517, 3518, 3519, 3520, 3521, 3522, 3523, 3524, 3525, 3526, 3527, 3528, 3529, 3530, 3531, 3532, 3533, 3534, 3535, 3536, 3537, 3538, 3539,
+        3540, 3541, 3542, 3543, 3544, 3545, 3546, 3547, 3548, 3549, 3550, 3551, 3552, 3553, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 3554, 3555, 3556, 3557, 3558, 3559, 3560, 3561, 3562, 3563, 3564, 3565, 3566, 3567, 3568, 3569,
+        3570, 3571, 3572, 3573, 3574, 3575, 3576, 3577, 3578, 3579, 3580, 3581, 3582, 3583, 3584, 3585, 3586, 3587, 3588, 3589, 3590, 3591, 3592, 3593,
+        3594, 3595, 3596, 3597, 3598, 3599, 3600, 3601, 3602, 3603, 3604, 3605, 3606, 3607, 3608, 3609, 3610, 3611, 3612, 3613, 3614, 3615, 3616, 3617,
+        0, 0, 3618, 3619, 3620, 3621, 3622, 3623, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631, 3632, 3633, 3634, 3635, 3636, 3637, 3638, 3639,
+        3640, 3641, 3642, 3643, 3644, 3645, 3646, 3647, 3648, 3649, 3650, 3651, 3652, 3653, 3654, 3655, 3656, 3657, 3658, 3659, 3660, 3661, 3662, 3663,
+        3664, 3665, 3666, 3667, 3668, 3669, 3670, 3671, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3672, 3673, 3674, 3675, 3676, 3677, 3678, 3679, 3680, 3681, 3682, 3683, 3684, 0, 0, 0,
+    },
+    {
+        3685, 3686, 3687, 3688, 3689, 3690, 3691, 3692, 3693, 3694, 3695, 3696, 3697, 3698, 3699, 3700, 3701, 3702, 3703, 3704, 3705, 3706, 3707, 3708,
+        3709, 3710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3711, 3712, 3713, 3714, 3715, 3716, 3717, 3718, 3719, 3720, 3721, 3722, 3723, 3724, 3725, 3726, 3727, 3728, 3729, 3730, 3731, 0, 0, 3732,
+        3733, 3734, 3735, 3736, 3737, 3738, 3739, 3740, 3741, 3742, 3743, 0, 3744, 3745, 3746, 3747, 3748, 3749, 3750, 3751, 3752, 3753, 3754, 3755,
+        3756, 3757, 3758, 3759, 3760, 3761, 3762, 0, 3763, 3764, 3765, 3766, 0, 0, 0, 0, 3767, 3768, 3769, 0, 3770, 0, 3771, 3772,
+        3773, 3774, 3775, 3776, 3777, 3778, 3779, 3780, 3781, 3782, 3783, 3784, 3785, 3786, 3787, 3788, 3789, 3790, 3791, 3792, 3793, 3794, 3795, 3796,
+        3797, 3798, 3799, 3800, 3801, 3802, 3803, 3804, 3805, 3806, 3807, 3808, 3809, 3810, 3811, 3812, 3813, 3814, 3815, 3816, 3817, 3818, 3819, 3820,
+        3821, 3822, 3823, 3824, 3825, 3826, 3827, 3828, 3829, 3830, 3831, 3832, 3833, 3834, 3835, 3836, 3837, 3838, 3839, 3840, 3841, 3842, 3843, 3844,
+        3845, 3846, 3847, 3848, 3849, 3850, 3851, 3852, 3853, 3854, 3855, 3856, 3857, 3858, 3859, 3860, 3861, 3862, 3863, 3864, 3865, 3866, 3867, 3868,
+        3869, 3870, 3871, 3872, 3873, 3874, 3875, 3876, 3877, 3878, 3879, 3880, 3881, 3882, 3883, 3884, 3885, 3886, 3887, 3888, 3889, 3890, 3891, 3892,
+        3893, 3894, 3895, 3896, 3897, 3898, 3899, 3900, 3901, 3902, 3903, 3904, 3905, 0, 0, 3906,
+    },
+    {
+        0, 3907, 3908, 3909, 3910, 3911, 3912, 3913, 3914, 3915, 3916, 3917, 3918, 3919, 3920, 3921, 3922, 3923, 3924, 3925, 3926, 3927, 3928, 3929,
+        3930, 3931, 3932, 3933, 3934, 3935, 3936, 3937, 3938, 3939, 3940, 3941, 3942, 3943, 3944, 3945, 3946, 3947, 3948, 3949, 3950, 3951, 3952, 3953,
+        3954, 3955, 3956, 3957, 3958, 3959, 3960, 3961, 3962, 3963, 3964, 3965, 3966, 3967, 3968, 3969, 3970, 3971, 3972, 3973, 3974, 3975, 3976, 3977,
+        3978, 3979, 3980, 3981, 3982, 3983, 3984, 3985, 3986, 3987, 3988, 3989, 3990, 3991, 3992, 3993, 3994, 3995, 3996, 3997, 3998, 3999, 4000, 4001,
+        4002, 4003, 4004, 4005, 4006, 4007, 4008, 4009, 4010, 4011, 4012, 4013, 4014, 4015, 4016, 4017, 4018, 4019, 4020, 4021, 4022, 4023, 4024, 4025,
+        4026, 4027, 4028, 4029, 4030, 4031, 4032, 4033, 4034, 4035, 4036, 4037, 4038, 4039, 4040, 4041, 4042, 4043, 4044, 4045, 4046, 4047, 4048, 4049,
+        4050, 4051, 4052, 4053, 4054, 4055, 4056, 4057, 4058, 4059, 4060, 4061, 4062, 4063, 4064, 4065, 4066, 4067, 4068, 4069, 4070, 4071, 4072, 4073,
+        4074, 4075, 4076, 4077, 4078, 4079, 4080, 4081, 4082, 4083, 4084, 4085, 4086, 4087, 4088, 4089, 4090, 4091, 4092, 4093, 4094, 4095, 4096, 0,
+        0, 0, 4097, 4098, 4099, 4100, 4101, 4102, 0, 0, 4103, 4104, 4105, 4106, 4107, 4108, 0, 0, 4109, 4110, 4111, 4112, 4113, 4114,
+        0, 0, 4115, 4116, 4117, 0, 0, 0, 4118, 4119, 4120, 4121, 4122, 4123, 4124, 0, 4125, 4126, 4127, 4128, 4129, 4130, 4131, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+};
+
+// 辅助平面的映射（按码点升序，二分查找）
+struct FoldSupplementary {
+    std::uint32_t cp;
+    std::uint16_t entry; // 映射的下标
+};
+constexpr FoldSupplementary kFoldSupplementary[] = {
+    {0x10400, 4131}, {0x10401, 4132}, {0x10402, 4133}, {0x10403, 4134}, {0x10404, 4135}, {0x10405, 4136}, {0x10406, 4137}, {0x10407, 4138},
+    {0x10408, 4139}, {0x10409, 4140}, {0x1040A, 4141}, {0x1040B, 4142}, {0x1040C, 4143}, {0x1040D, 4144}, {0x1040E, 4145}, {0x1040F, 4146},
+    {0x10410, 4147}, {0x10411, 4148}, {0x10412, 4149}, {0x10413, 4150}, {0x10414, 4151}, {0x10415, 4152}, {0x10416, 4153}, {0x10417, 4154},
+    {0x10418, 4155}, {0x10419, 4156}, {0x1041A, 4157}, {0x1041B, 4158}, {0x1041C, 4159}, {0x1041D, 4160}, {0x1041E, 4161}, {0x1041F, 4162},
+    {0x10420, 4163}, {0x10421, 4164}, {0x10422, 4165}, {0x10423, 4166}, {0x10424, 4167}, {0x10425, 4168}, {0x10426, 4169}, {0x10427, 4170},
+    {0x104B0, 4171}, {0x104B1, 4172}, {0x104B2, 4173}, {0x104B3, 4174}, {0x104B4, 4175}, {0x104B5, 4176}, {0x104B6, 4177}, {0x104B7, 4178},
+    {0x104B8, 4179}, {0x104B9, 4180}, {0x104BA, 4181}, {0x104BB, 4182}, {0x104BC, 4183}, {0x104BD, 4184}, {0x104BE, 4185}, {0x104BF, 4186},
+    {0x104C0, 4187}, {0x104C1, 4188}, {0x104C2, 4189}, {0x104C3, 4190}, {0x104C4, 4191}, {0x104C5, 4192}, {0x104C6, 4193}, {0x104C7, 4194},
+    {0x104C8, 4195}, {0x104C9, 4196}, {0x104CA, 4197}, {0x104CB, 4198}, {0x104CC, 4199}, {0x104CD, 4200}, {0x104CE, 4201}, {0x104CF, 4202},
+    {0x104D0, 4203}, {0x104D1, 4204}, {0x104D2, 4205}, {0x104D3, 4206}, {0x10570, 4207}, {0x10571, 4208}, {0x10572, 4209}, {0x10573, 4210},
+    {0x10574, 4211}, {0x10575, 4212}, {0x10576, 4213}, {0x10577, 4214}, {0x10578, 4215}, {0x10579, 4216}, {0x1057A, 4217}, {0x1057C, 4218},
+    {0x1057D, 4219}, {0x1057E, 4220}, {0x1057F, 4221}, {0x10580, 4222}, {0x10581, 4223}, {0x10582, 4224}, {0x10583, 4225}, {0x10584, 4226},
+    {0x10585, 4227}, {0x10586, 4228}, {0x10587, 4229}, {0x10588, 4230}, {0x10589, 4231}, {0x1058A, 4232}, {0x1058C, 4233}, {0x1058D, 4234},
+    {0x1058E, 4235}, {0x1058F, 4236}, {0x10590, 4237}, {0x10591, 4238}, {0x10592, 4239}, {0x10594, 4240}, {0x10595, 4241}, {0x10781, 4242},
+    {0x10782, 4243}, {0x10783, 4244}, {0x10784, 4245}, {0x10785, 4246}, {0x10787, 4247}, {0x10788, 4248}, {0x10789, 4249}, {0x1078A, 4250},
+    {0x1078B, 4251}, {0x1078C, 4252}, {0x1078D, 4253}, {0x1078E, 4254}, {0x1078F, 4255}, {0x10790, 4256}, {0x10791, 4257}, {0x10792, 4258},
+    {0x10793, 4259}, {0x10794, 4260}, {0x10795, 4261}, {0x10796, 4262}, {0x10797, 4263}, {0x10798, 4264}, {0x10799, 4265}, {0x1079A, 4266},
+    {0x1079B, 4267}, {0x1079C, 4268}, {0x1079D, 4269}, {0x1079E, 4270}, {0x1079F, 4271}, {0x107A0, 4272}, {0x107A1, 4273}, {0x107A2, 4274},
+    {0x107A3, 4275}, {0x107A4, 4276}, {0x107A5, 4277}, {0x107A6, 4278}, {0x107A7, 4279}, {0x107A8, 4280}, {0x107A9, 4281}, {0x107AA, 4282},
+    {0x107AB, 4283}, {0x107AC, 4284}, {0x107AD, 4285}, {0x107AE, 4286}, {0x107AF, 4287}, {0x107B0, 4288}, {0x107B2, 4289}, {0x107B3, 4290},
+    {0x107B4, 4291}, {0x107B5, 4292}, {0x107B6, 4293}, {0x107B7, 4294}, {0x107B8, 4295}, {0x107B9, 4296}, {0x107BA, 4297}, {0x10C80, 4298},
+    {0x10C81, 4299}, {0x10C82, 4300}, {0x10C83, 4301}, {0x10C84, 4302}, {0x10C85, 4303}, {0x10C86, 4304}, {0x10C87, 4305}, {0x10C88, 4306},
+    {0x10C89, 4307}, {0x10C8A, 4308}, {0x10C8B, 4309}, {0x10C8C, 4310}, {0x10C8D, 4311}, {0x10C8E, 4312}, {0x10C8F, 4313}, {0x10C90, 4314},
+    {0x10C91, 4315}, {0x10C92, 4316}, {0x10C93, 4317}, {0x10C94, 4318}, {0x10C95, 4319}, {0x10C96, 4320}, {0x10C97, 4321}, {0x10C98, 4322},
+    {0x10C99, 4323}, {0x10C9A, 4324}, {0x10C9B, 4325}, {0x10C9C, 4326}, {0x10C9D, 4327}, {0x10C9E, 4328}, {0x10C9F, 4329}, {0x10CA0, 4330},
+    {0x10CA1, 4331}, {0x10CA2, 4332}, {0x10CA3, 4333}, {0x10CA4, 4334}, {0x10CA5, 4335}, {0x10CA6, 4336}, {0x10CA7, 4337}, {0x10CA8, 4338},
+    {0x10CA9, 4339}, {0x10CAA, 4340}, {0x10CAB, 4341}, {0x10CAC, 4342}, {0x10CAD, 4343}, {0x10CAE, 4344}, {0x10CAF, 4345}, {0x10CB0, 4346},
+    {0x10CB1, 4347}, {0x10CB2, 4348}, {0x118A0, 4349}, {0x118A1, 4350}, {0x118A2, 4351}, {0x118A3, 4352}, {0x118A4, 4353}, {0x118A5, 4354},
+    {0x118A6, 4355}, {0x118A7, 4356}, {0x118A8, 4357}, {0x118A9, 4358}, {0x118AA, 4359}, {0x118AB, 4360}, {0x118AC, 4361}, {0x118AD, 4362},
+    {0x118AE, 4363}, {0x118AF, 4364}, {0x118B0, 4365}, {0x118B1, 4366}, {0x118B2, 4367}, {0x118B3, 4368}, {0x118B4, 4369}, {0x118B5, 4370},
+    {0x118B6, 4371}, {0x118B7, 4372}, {0x118B8, 4373}, {0x118B9, 4374}, {0x118BA, 4375}, {0x118BB, 4376}, {0x118BC, 4377}, {0x118BD, 4378},
+    {0x118BE, 4379}, {0x118BF, 4380}, {0x16E40, 4381}, {0x16E41, 4382}, {0x16E42, 4383}, {0x16E43, 4384}, {0x16E44, 4385}, {0x16E45, 4386},
+    {0x16E46, 4387}, {0x16E47, 4388}, {0x16E48, 4389}, {0x16E49, 4390}, {0x16E4A, 4391}, {0x16E4B, 4392}, {0x16E4C, 4393}, {0x16E4D, 4394},
+    {0x16E4E, 4395}, {0x16E4F, 4396}, {0x16E50, 4397}, {0x16E51, 4398}, {0x16E52, 4399}, {0x16E53, 4400}, {0x16E54, 4401}, {0x16E55, 4402},
+    {0x16E56, 4403}, {0x16E57, 4404}, {0x16E58, 4405}, {0x16E59, 4406}, {0x16E5A, 4407}, {0x16E5B, 4408}, {0x16E5C, 4409}, {0x16E5D, 4410},
+    {0x16E5E, 4411}, {0x16E5F, 4412}, {0x1D15E, 4413}, {0x1D15F, 4414}, {0x1D160, 4415}, {0x1D161, 4416}, {0x1D162, 4417}, {0x1D163, 4418},
+    {0x1D164, 4419}, {0x1D1BB, 4420}, {0x1D1BC, 4421}, {0x1D1BD, 4422}, {0x1D1BE, 4423}, {0x1D1BF, 4424}, {0x1D1C0, 4425}, {0x1D400, 4426},
+    {0x1D401, 4427}, {0x1D402, 4428}, {0x1D403, 4429}, {0x1D404, 4430}, {0x1D405, 4431}, {0x1D406, 4432}, {0x1D407, 4433}, {0x1D408, 4434},
+    {0x1D409, 4435}, {0x1D40A, 4436}, {0x1D40B, 4437}, {0x1D40C, 4438}, {0x1D40D, 4439}, {0x1D40E, 4440}, {0x1D40F, 4441}, {0x1D410, 4442},
+    {0x1D411, 4443}, {0x1D412, 4444}, {0x1D413, 4445}, {0x1D414, 4446}, {0x1D415, 4447}, {0x1D416, 4448}, {0x1D417, 4449}, {0x1D418, 4450},
+    {0x1D419, 4451}, {0x1D41A, 4452}, {0x1D41B, 4453}, {0x1D41C, 4454}, {0x1D41D, 4455}, {0x1D41E, 4456}, {0x1D41F, 4457}, {0x1D420, 4458},
+    {0x1D421, 4459}, {0x1D422, 4460}, {0x1D423, 4461}, {0x1D424, 4462}, {0x1D425, 4463}, {0x1D426, 4464}, {0x1D427, 4465}, {0x1D428, 4466},
+    {0x1D429, 4467}, {0x1D42A, 4468}, {0x1D42B, 4469}, {0x1D42C, 4470}, {0x1D42D, 4471}, {0x1D42E, 4472}, {0x1D42F, 4473}, {0x1D430, 4474},
+    {0x1D431, 4475}, {0x1D432, 4476}, {0x1D433, 4477}, {0x1D434, 4478}, {0x1D435, 4479}, {0x1D436, 4480}, {0x1D437, 4481}, {0x1D438, 4482},
+    {0x1D439, 4483}, {0x1D43A, 4484}, {0x1D43B, 4485}, {0x1D43C, 4486}, {0x1D43D, 4487}, {0x1D43E, 4488}, {0x1D43F, 4489}, {0x1D440, 4490},
+    {0x1D441, 4491}, {0x1D442, 4492}, {0x1D443, 4493}, {0x1D444, 4494}, {0x1D445, 4495}, {0x1D446, 4496}, {0x1D447, 4497}, {0x1D448, 4498},
+    {0x1D449, 4499}, {0x1D44A, 4500}, {0x1D44B, 4501}, {0x1D44C, 4502}, {0x1D44D, 4503}, {0x1D44E, 4504}, {0x1D44F, 4505}, {0x1D450, 4506},
+    {0x1D451, 4507}, {0x1D452, 4508}, {0x1D453, 4509}, {0x1D454, 4510}, {0x1D456, 4511}, {0x1D457, 4512}, {0x1D458, 4513}, {0x1D459, 4514},
+    {0x1D45A, 4515}, {0x1D45B, 4516}, {0x1D45C, 4517}, {0x1D45D, 4518}, {0x1D45E, 4519}, {0x1D45F, 4520}, {0x1D460, 4521}, {0x1D461, 4522},
+    {0x1D462, 4523}, {0x1D463, 4524}, {0x1D464, 4525}, {0x1D465, 4526}, {0x1D466, 4527}, {0x1D467, 4528}, {0x1D468, 4529}, {0x1D469, 4530},
+    {0x1D46A, 4531}, {0x1D46B, 4532}, {0x1D46C, 4533}, {0x1D46D, 4534}, {0x1D46E, 4535}, {0x1D46F, 4536}, {0x1D470, 4537}, {0x1D471, 4538},
+    {0x1D472, 4539}, {0x1D473, 4540}, {0x1D474, 4541}, {0x1D475, 4542}, {0x1D476, 4543}, {0x1D477, 4544}, {0x1D478, 4545}, {0x1D479, 4546},
+    {0x1D47A, 4547}, {0x1D47B, 4548}, {0x1D47C, 4549}, {0x1D47D, 4550}, {0x1D47E, 4551}, {0x1D47F, 4552}, {0x1D480, 4553}, {0x1D481, 4554},
+    {0x1D482, 4555}, {0x1D483, 4556}, {0x1D484, 4557}, {0x1D485, 4558}, {0x1D486, 4559}, {0x1D487, 4560}, {0x1D488, 4561}, {0x1D489, 4562},
+    {0x1D48A, 4563}, {0x1D48B, 4564}, {0x1D48C, 4565}, {0x1D48D, 4566}, {0x1D48E, 4567}, {0x1D48F, 4568}, {0x1D490, 4569}, {0x1D491, 4570},
+    {0x1D492, 4571}, {0x1D493, 4572}, {0x1D494, 4573}, {0x1D495, 4574}, {0x1D496, 4575}, {0x1D497, 4576}, {0x1D498, 4577}, {0x1D499, 4578},
+    {0x1D49A, 4579}, {0x1D49B, 4580}, {0x1D49C, 4581}, {0x1D49E, 4582}, {0x1D49F, 4583}, {0x1D4A2, 4584}, {0x1D4A5, 4585}, {0x1D4A6, 4586},
+    {0x1D4A9, 4587}, {0x1D4AA, 4588}, {0x1D4AB, 4589}, {0x1D4AC, 4590}, {0x1D4AE, 4591}, {0x1D4AF, 4592}, {0x1D4B0, 4593}, {0x1D4B1, 4594},
+    {0x1D4B2, 4595}, {0x1D4B3, 4596}, {0x1D4B4, 4597}, {0x1D4B5, 4598}, {0x1D4B6, 4599}, {0x1D4B7, 4600}, {0x1D4B8, 4601}, {0x1D4B9, 4602},
+    {0x1D4BB, 4603}, {0x1D4BD, 4604}, {0x1D4BE, 4605}, {0x1D4BF, 4606}, {0x1D4C0, 4607}, {0x1D4C1, 4608}, {0x1D4C2, 4609}, {0x1D4C3, 4610},
+    {0x1D4C5, 4611}, {0x1D4C6, 4612}, {0x1D4C7, 4613}, {0x1D4C8, 4614}, {0x1D4C9, 4615}, {0x1D4CA, 4616}, {0x1D4CB, 4617}, {0x1D4CC, 4618},
+    {0x1D4CD, 4619}, {0x1D4CE, 4620}, {0x1D4CF, 4621}, {0x1D4D0, 4622}, {0x1D4D1, 4623}, {0x1D4D2, 4624}, {0x1D4D3, 4625}, {0x1D4D4, 4626},
+    {0x1D4D5, 4627}, {0x1D4D6, 4628}, {0x1D4D7, 4629}, {0x1D4D8, 4630}, {0x1D4D9, 4631}, {0x1D4DA, 4632}, {0x1D4DB, 4633}, {0x1D4DC, 4634},
+    {0x1D4DD, 4635}, {0x1D4DE, 4636}, {0x1D4DF, 4637}, {0x1D4E0, 4638}, {0x1D4E1, 4639}, {0x1D4E2, 4640}, {0x1D4E3, 4641}, {0x1D4E4, 4642},
+    {0x1D4E5, 4643}, {0x1D4E6, 4644}, {0x1D4E7, 4645}, {0x1D4E8, 4646}, {0x1D4E9, 4647}, {0x1D4EA, 4648}, {0x1D4EB, 4649}, {0x1D4EC, 4650},
+    {0x1D4ED, 4651}, {0x1D4EE, 4652}, {0x1D4EF, 4653}, {0x1D4F0, 4654}, {0x1D4F1, 4655}, {0x1D4F2, 4656}, {0x1D4F3, 4657}, {0x1D4F4, 4658},
+    {0x1D4F5, 4659}, {0x1D4F6, 4660}, {0x1D4F7, 4661}, {0x1D4F8, 4662}, {0x1D4F9, 4663}, {0x1D4FA, 4664}, {0x1D4FB, 4665}, {0x1D4FC, 4666},
+    {0x1D4FD, 4667}, {0x1D4FE, 4668}, {0x1D4FF, 4669}, {0x1D500, 4670}, {0x1D501, 4671}, {0x1D502, 4672}, {0x1D503, 4673}, {0x1D504, 4674},
+    {0x1D505, 4675}, {0x1D507, 4676}, {0x1D508, 4677}, {0x1D509, 4678}, {0x1D50A, 4679}, {0x1D50D, 4680}, {0x1D50E, 4681}, {0x1D50F, 4682},
+    {0x1D510, 4683}, {0x1D511, 4684}, {0x1D512, 4685}, {0x1D513, 4686}, {0x1D514, 4687}, {0x1D516, 4688}, {0x1D517, 4689}, {0x1D518, 4690},
+    {0x1D519, 4691}, {0x1D51A, 4692}, {0x1D51B, 4693}, {0x1D51C, 4694}, {0x1D51E, 4695}, {0x1D51F, 4696}, {0x1D520, 4697}, {0x1D521, 4698},
+    {0x1D522, 4699}, {0x1D523, 4700}, {0x1D524, 4701}, {0x1D525, 4702}, {0x1D526, 4703}, {0x1D527, 4704}, {0x1D528, 4705}, {0x1D529, 4706},
+    {0x1D52A, 4707}, {0x1D52B, 4708}, {0x1D52C, 4709}, {0x1D52D, 4710}, {0x1D52E, 4711}, {0x1D52F, 4712}, {0x1D530, 4713}, {0x1D531, 4714},
+    {0x1D532, 4715}, {0x1D533, 4716}, {0x1D534, 4717}, {0x1D535, 4718}, {0x1D536, 4719}, {0x1D537, 4720}, {0x1D538, 4721}, {0x1D539, 4722},
+    {0x1D53B, 4723}, {0x1D53C, 4724}, {0x1D53D, 4725}, {0x1D53E, 4726}, {0x1D540, 4727}, {0x1D541, 4728}, {0x1D542, 4729}, {0x1D543, 4730},
+    {0x1D544, 4731}, {0x1D546, 4732}, {0x1D54A, 4733}, {0x1D54B, 4734}, {0x1D54C, 4735}, {0x1D54D, 4736}, {0x1D54E, 4737}, {0x1D54F, 4738},
+    {0x1D550, 4739}, {0x1D552, 4740}, {0x1D553, 4741}, {0x1D554, 4742}, {0x1D555, 4743}, {0x1D556, 4744}, {0x1D557, 4745}, {0x1D558, 4746},
+    {0x1D559, 4747}, {0x1D55A, 4748}, {0x1D55B, 4749}, {0x1D55C, 4750}, {0x1D55D, 4751}, {0x1D55E, 4752}, {0x1D55F, 4753}, {0x1D560, 4754},
+    {0x1D561, 4755}, {0x1D562, 4756}, {0x1D563, 4757}, {0x1D564, 4758}, {0x1D565, 4759}, {0x1D566, 4760}, {0x1D567, 4761}, {0x1D568, 4762},
+    {0x1D569, 4763}, {0x1D56A, 4764}, {0x1D56B, 4765}, {0x1D56C, 4766}, {0x1D56D, 4767}, {0x1D56E, 4768}, {0x1D56F, 4769}, {0x1D570, 4770},
+    {0x1D571, 4771}, {0x1D572, 4772}, {0x1D573, 4773}, {0x1D574, 4774}, {0x1D575, 4775}, {0x1D576, 4776}, {0x1D577, 4777}, {0x1D578, 4778},
+    {0x1D579, 4779}, {0x1D57A, 4780}, {0x1D57B, 4781}, {0x1D57C, 4782}, {0x1D57D, 4783}, {0x1D57E, 4784}, {0x1D57F, 4785}, {0x1D580, 4786},
+    {0x1D581, 4787}, {0x1D582, 4788}, {0x1D583, 4789}, {0x1D584, 4790}, {0x1D585, 4791}, {0x1D586, 4792}, {0x1D587, 4793}, {0x1D588, 4794},
+    {0x1D589, 4795}, {0x1D58A, 4796}, {0x1D58B, 4797}, {0x1D58C, 4798}, {0x1D58D, 4799}, {0x1D58E, 4800}, {0x1D58F, 4801}, {0x1D590, 4802},
+    {0x1D591, 4803}, {0x1D592, 4804}, {0x1D593, 4805}, {0x1D594, 4806}, {0x1D595, 4807}, {0x1D596, 4808}, {0x1D597, 4809}, {0x1D598, 4810},
+    {0x1D599, 4811}, {0x1D59A, 4812}, {0x1D59B, 4813}, {0x1D59C, 4814}, {0x1D59D, 4815}, {0x1D59E, 4816}, {0x1D59F, 4817}, {0x1D5A0, 4818},
+    {0x1D5A1, 4819}, {0x1D5A2, 4820}, {0x1D5A3, 4821}, {0x1D5A4, 4822}, {0x1D5A5, 4823}, {0x1D5A6, 4824}, {0x1D5A7, 4825}, {0x1D5A8, 4826},
+    {0x1D5A9, 4827}, {0x1D5AA, 4828}, {0x1D5AB, 4829}, {0x1D5AC, 4830}, {0x1D5AD, 4831}, {0x1D5AE, 4832}, {0x1D5AF, 4833}, {0x1D5B0, 4834},
+    {0x1D5B1, 4835}, {0x1D5B2, 4836}, {0x1D5B3, 4837}, {0x1D5B4, 4838}, {0x1D5B5, 4839}, {0x1D5B6, 4840}, {0x1D5B7, 4841}, {0x1D5B8, 4842},
+    {0x1D5B9, 4843}, {0x1D5BA, 4844}, {0x1D5BB, 4845}, {0x1D5BC, 4846}, {0x1D5BD, 4847}, {0x1D5BE, 4848}, {0x1D5BF, 4849}, {0x1D5C0, 4850},
+    {0x1D5C1, 4851}, {0x1D5C2, 4852}, {0x1D5C3, 4853}, {0x1D5C4, 4854}, {0x1D5C5, 4855}, {0x1D5C6, 4856}, {0x1D5C7, 4857}, {0x1D5C8, 4858},
+    {0x1D5C9, 4859}, {0x1D5CA, 4860}, {0x1D5CB, 4861}, {0x1D5CC, 4862}, {0x1D5CD, 4863}, {0x1D5CE, 4864}, {0x1D5CF, 4865}, {0x1D5D0, 4866},
+    {0x1D5D1, 4867}, {0x1D5D2, 4868}, {0x1D5D3, 4869}, {0x1D5D4, 4870}, {0x1D5D5, 4871}, {0x1D5D6, 4872}, {0x1D5D7, 4873}, {0x1D5D8, 4874},
+    {0x1D5D9, 4875}, {0x1D5DA, 4876}, {0x1D5DB, 4877}, {0x1D5DC, 4878}, {0x1D5DD, 4879}, {0x1D5DE, 4880}, {0x1D5DF, 4881}, {0x1D5E0, 4882},
+    {0x1D5E1, 4883}, {0x1D5E2, 4884}, {0x1D5E3, 4885}, {0x1D5E4, 4886}, {0x1D5E5, 4887}, {0x1D5E6, 4888}, {0x1D5E7, 4889}, {0x1D5E8, 4890},
+    {0x1D5E9, 4891}, {0x1D5EA, 4892}, {0x1D5EB, 4893}, {0x1D5EC, 4894}, {0x1D5ED, 4895}, {0x1D5EE, 4896}, {0x1D5EF, 4897}, {0x1D5F0, 4898},
+    {0x1D5F1, 4899}, {0x1D5F2, 4900}, {0x1D5F3, 4901}, {0x1D5F4, 4902}, {0x1D5F5, 4903}, {0x1D5F6, 4904}, {0x1D5F7, 4905}, {0x1D5F8, 4906},
+    {0x1D5F9, 4907}, {0x1D5FA, 4908}, {0x1D5FB, 4909}, {0x1D5FC, 4910}, {0x1D5FD, 4911}, {0x1D5FE, 4912}, {0x1D5FF, 4913}, {0x1D600, 4914},
+    {0x1D601, 4915}, {0x1D602, 4916}, {0x1D603, 4917}, {0x1D604, 4918}, {0x1D605, 4919}, {0x1D606, 4920}, {0x1D607, 4921}, {0x1D608, 4922},
+    {0x1D609, 4923}, {0x1D60A, 4924}, {0x1D60B, 4925}, {0x1D60C, 4926}, {0x1D60D, 4927}, {0x1D60E, 4928}, {0x1D60F, 4929}, {0x1D610, 4930},
+    {0x1D611, 4931}, {0x1D612, 4932}, {0x1D613, 4933}, {0x1D614, 4934}, {0x1D615, 4935}, {0x1D616, 4936}, {0x1D617, 4937}, {0x1D618, 4938},
+    {0x1D619, 4939}, {0x1D61A, 4940}, {0x1D61B, 4941}, {0x1D61C, 4942}, {0x1D61D, 4943}, {0x1D61E, 4944}, {0x1D61F, 4945}, {0x1D620, 4946},
+    {0x1D621, 4947}, {0x1D622, 4948}, {0x1D623, 4949}, {0x1D624, 4950}, {0x1D625, 4951}, {0x1D626, 4952}, {0x1D627, 4953}, {0x1D628, 4954},
+    {0x1D629, 4955}, {0x1D62A, 4956}, {0x1D62B, 4957}, {0x1D62C, 4958}, {0x1D62D, 4959}, {0x1D62E, 4960}, {0x1D62F, 4961}, {0x1D630, 4962},
+    {0x1D631, 4963}, {0x1D632, 4964}, {0x1D633, 4965}, {0x1D634, 4966}, {0x1D635, 4967}, {0x1D636, 4968}, {0x1D637, 4969}, {0x1D638, 4970},
+    {0x1D639, 4971}, {0x1D63A, 4972}, {0x1D63B, 4973}, {0x1D63C, 4974}, {0x1D63D, 4975}, {0x1D63E, 4976}, {0x1D63F, 4977}, {0x1D640, 4978},
+    {0x1D641, 4979}, {0x1D642, 4980}, {0x1D643, 4981}, {0x1D644, 4982}, {0x1D645, 4983}, {0x1D646, 4984}, {0x1D647, 4985}, {0x1D648, 4986},
+    {0x1D649, 4987}, {0x1D64A, 4988}, {0x1D64B, 4989}, {0x1D64C, 4990}, {0x1D64D, 4991}, {0x1D64E, 4992}, {0x1D64F, 4993}, {0x1D650, 4994},
+    {0x1D651, 4995}, {0x1D652, 4996}, {0x1D653, 4997}, {0x1D654, 4998}, {0x1D655, 4999}, {0x1D656, 5000}, {0x1D657, 5001}, {0x1D658, 5002},
+    {0x1D659, 5003}, {0x1D65A, 5004}, {0x1D65B, 5005}, {0x1D65C, 5006}, {0x1D65D, 5007}, {0x1D65E, 5008}, {0x1D65F, 5009}, {0x1D660, 5010},
+    {0x1D661, 5011}, {0x1D662, 5012}, {0x1D663, 5013}, {0x1D664, 5014}, {0x1D665, 5015}, {0x1D666, 5016}, {0x1D667, 5017}, {0x1D668, 5018},
+    {0x1D669, 5019}, {0x1D66A, 5020}, {0x1D66B, 5021}, {0x1D66C, 5022}, {0x1D66D, 5023}, {0x1D66E, 5024}, {0x1D66F, 5025}, {0x1D670, 5026},
+    {0x1D671, 5027}, {0x1D672, 5028}, {0x1D673, 5029}, {0x1D674, 5030}, {0x1D675, 5031}, {0x1D676, 5032}, {0x1D677, 5033}, {0x1D678, 5034},
+    {0x1D679, 5035}, {0x1D67A, 5036}, {0x1D67B, 5037}, {0x1D67C, 5038}, {0x1D67D, 5039}, {0x1D67E, 5040}, {0x1D67F, 5041}, {0x1D680, 5042},
+    {0x1D681, 5043}, {0x1D682, 5044}, {0x1D683, 5045}, {0x1D684, 5046}, {0x1D685, 5047}, {0x1D686, 5048}, {0x1D687, 5049}, {0x1D688, 5050},
+    {0x1D689, 5051}, {0x1D68A, 5052}, {0x1D68B, 5053}, {0x1D68C, 5054}, {0x1D68D, 5055}, {0x1D68E, 5056}, {0x1D68F, 5057}, {0x1D690, 5058},
+    {0x1D691, 5059}, {0x1D692, 5060}, {0x1D693, 5061}, {0x1D694, 5062}, {0x1D695, 5063}, {0x1D696, 5064}, {0x1D697, 5065}, {0x1D698, 5066},
+    {0x1D699, 5067}, {0x1D69A, 5068}, {0x1D69B, 5069}, {0x1D69C, 5070}, {0x1D69D, 5071}, {0x1D69E, 5072}, {0x1D69F, 5073}, {0x1D6A0, 5074},
+    {0x1D6A1, 5075}, {0x1D6A2, 5076}, {0x1D6A3, 5077}, {0x1D6A4, 5078}, {0x1D6A5, 5079}, {0x1D6A8, 5080}, {0x1D6A9, 5081}, {0x1D6AA, 5082},
+    {0x1D6AB, 5083}, {0x1D6AC, 5084}, {0x1D6AD, 5085}, {0x1D6AE, 5086}, {0x1D6AF, 5087}, {0x1D6B0, 5088}, {0x1D6B1, 5089}, {0x1D6B2, 5090},
+    {0x1D6B3, 5091}, {0x1D6B4, 5092}, {0x1D6B5, 5093}, {0x1D6B6, 5094}, {0x1D6B7, 5095}, {0x1D6B8, 5096}, {0x1D6B9, 5097}, {0x1D6BA, 5098},
+    {0x1D6BB, 5099}, {0x1D6BC, 5100}, {0x1D6BD, 5101}, {0x1D6BE, 5102}, {0x1D6BF, 5103}, {0x1D6C0, 5104}, {0x1D6C1, 5105}, {0x1D6C2, 5106},
+    {0x1D6C3, 5107}, {0x1D6C4, 5108}, {0x1D6C5, 5109}, {0x1D6C6, 5110}, {0x1D6C7, 5111}, {0x1D6C8, 5112}, {0x1D6C9, 5113}, {0x1D6CA, 5114},
+    {0x1D6CB, 5115}, {0x1D6CC, 5116}, {0x1D6CD, 5117}, {0x1D6CE, 5118}, {0x1D6CF, 5119}, {0x1D6D0, 5120}, {0x1D6D1, 5121}, {0x1D6D2, 5122},
+    {0x1D6D3, 5123}, {0x1D6D4, 5124}, {0x1D6D5, 5125}, {0x1D6D6, 5126}, {0x1D6D7, 5127}, {0x1D6D8, 5128}, {0x1D6D9, 5129}, {0x1D6DA, 5130},
+    {0x1D6DB, 5131}, {0x1D6DC, 5132}, {0x1D6DD, 5133}, {0x1D6DE, 5134}, {0x1D6DF, 5135}, {0x1D6E0, 5136}, {0x1D6E1, 5137}, {0x1D6E2, 5138},
+    {0x1D6E3, 5139}, {0x1D6E4, 5140}, {0x1D6E5, 5141}, {0x1D6E6, 5142}, {0x1D6E7, 5143}, {0x1D6E8, 5144}, {0x1D6E9, 5145}, {0x1D6EA, 5146},
+    {0x1D6EB, 5147}, {0x1D6EC, 5148}, {0x1D6ED, 5149}, {0x1D6EE, 5150}, {0x1D6EF, 5151}, {0x1D6F0, 5152}, {0x1D6F1, 5153}, {0x1D6F2, 5154},
+    {0x1D6F3, 5155}, {0x1D6F4, 5156}, {0x1D6F5, 5157}, {0x1D6F6, 5158}, {0x1D6F7, 5159}, {0x1D6F8, 5160}, {0x1D6F9, 5161}, {0x1D6FA, 5162},
+    {0x1D6FB, 5163}, {0x1D6FC, 5164}, {0x1D6FD, 5165}, {0x1D6FE, 5166}, {0x1D6FF, 5167}, {0x1D700, 5168}, {0x1D701, 5169}, {0x1D702, 5170},
+    {0x1D703, 5171}, {0x1D704, 5172}, {0x1D705, 5173}, {0x1D706, 5174}, {0x1D707, 5175}, {0x1D708, 5176}, {0x1D709, 5177}, {0x1D70A, 5178},
+    {0x1D70B, 5179}, {0x1D70C, 5180}, {0x1D70D, 5181}, {0x1D70E, 5182}, {0x1D70F, 5183}, {0x1D710, 5184}, {0x1D711, 5185}, {0x1D712, 5186},
+    {0x1D713, 5187}, {0x1D714, 5188}, {0x1D715, 5189}, {0x1D716, 5190}, {0x1D717, 5191}, {0x1D718, 5192}, {0x1D719, 5193}, {0x1D71A, 5194},
+    {0x1D71B, 5195}, {0x1D71C, 5196}, {0x1D71D, 5197}, {0x1D71E, 5198}, {0x1D71F, 5199}, {0x1D720, 5200}, {0x1D721, 5201}, {0x1D722, 5202},
+    {0x1D723, 5203}, {0x1D724, 5204}, {0x1D725, 5205}, {0x1D726, 5206}, {0x1D727, 5207}, {0x1D728, 5208}, {0x1D729, 5209}, {0x1D72A, 5210},
+    {0x1D72B, 5211}, {0x1D72C, 5212}, {0x1D72D, 5213}, {0x1D72E, 5214}, {0x1D72F, 5215}, {0x1D730, 5216}, {0x1D731, 5217}, {0x1D732, 5218},
+    {0x1D733, 5219}, {0x1D734, 5220}, {0x1D735, 5221}, {0x1D736, 5222}, {0x1D737, 5223}, {0x1D738, 5224}, {0x1D739, 5225}, {0x1D73A, 5226},
+    {0x1D73B, 5227}, {0x1D73C, 5228}, {0x1D73D, 5229}, {0x1D73E, 5230}, {0x1D73F, 5231}, {0x1D740, 5232}, {0x1D741, 5233}, {0x1D742, 5234},
+    {0x1D743, 5235}, {0x1D744, 5236}, {0x1D745, 5237}, {0x1D746, 5238}, {0x1D747, 5239}, {0x1D748, 5240}, {0x1D749, 5241}, {0x1D74A, 5242},
+    {0x1D74B, 5243}, {0x1D74C, 5244}, {0x1D74D, 5245}, {0x1D74E, 5246}, {0x1D74F, 5247}, {0x1D750, 5248}, {0x1D751, 5249}, {0x1D752, 5250},
+    {0x1D753, 5251}, {0x1D754, 5252}, {0x1D755, 5253}, {0x1D756, 5254}, {0x1D757, 5255}, {0x1D758, 5256}, {0x1D759, 5257}, {0x1D75A, 5258},
+    {0x1D75B, 5259}, {0x1D75C, 5260}, {0x1D75D, 5261}, {0x1D75E, 5262}, {0x1D75F, 5263}, {0x1D760, 5264}, {0x1D761, 5265}, {0x1D762, 5266},
+    {0x1D763, 5267}, {0x1D764, 5268}, {0x1D765, 5269}, {0x1D766, 5270}, {0x1D767, 5271}, {0x1D768, 5272}, {0x1D769, 5273}, {0x1D76A, 5274},
+    {0x1D76B, 5275}, {0x1D76C, 5276}, {0x1D76D, 5277}, {0x1D76E, 5278}, {0x1D76F, 5279}, {0x1D770, 5280}, {0x1D771, 5281}, {0x1D772, 5282},
+    {0x1D773, 5283}, {0x1D774, 5284}, {0x1D775, 5285}, {0x1D776, 5286}, {0x1D777, 5287}, {0x1D778, 5288}, {0x1D779, 5289}, {0x1D77A, 5290},
+    {0x1D77B, 5291}, {0x1D77C, 5292}, {0x1D77D, 5293}, {0x1D77E, 5294}, {0x1D77F, 5295}, {0x1D780, 5296}, {0x1D781, 5297}, {0x1D782, 5298},
+    {0x1D783, 5299}, {0x1D784, 5300}, {0x1D785, 5301}, {0x1D786, 5302}, {0x1D787, 5303}, {0x1D788, 5304}, {0x1D789, 5305}, {0x1D78A, 5306},
+    {0x1D78B, 5307}, {0x1D78C, 5308}, {0x1D78D, 5309}, {0x1D78E, 5310}, {0x1D78F, 5311}, {0x1D790, 5312}, {0x1D791, 5313}, {0x1D792, 5314},
+    {0x1D793, 5315}, {0x1D794, 5316}, {0x1D795, 5317}, {0x1D796, 5318}, {0x1D797, 5319}, {0x1D798, 5320}, {0x1D799, 5321}, {0x1D79A, 5322},
+    {0x1D79B, 5323}, {0x1D79C, 5324}, {0x1D79D, 5325}, {0x1D79E, 5326}, {0x1D79F, 5327}, {0x1D7A0, 5328}, {0x1D7A1, 5329}, {0x1D7A2, 5330},
+    {0x1D7A3, 5331}, {0x1D7A4, 5332}, {0x1D7A5, 5333}, {0x1D7A6, 5334}, {0x1D7A7, 5335}, {0x1D7A8, 5336}, {0x1D7A9, 5337}, {0x1D7AA, 5338},
+    {0x1D7AB, 5339}, {0x1D7AC, 5340}, {0x1D7AD, 5341}, {0x1D7AE, 5342}, {0x1D7AF, 5343}, {0x1D7B0, 5344}, {0x1D7B1, 5345}, {0x1D7B2, 5346},
+    {0x1D7B3, 5347}, {0x1D7B4, 5348}, {0x1D7B5, 5349}, {0x1D7B6, 5350}, {0x1D7B7, 5351}, {0x1D7B8, 5352}, {0x1D7B9, 5353}, {0x1D7BA, 5354},
+    {0x1D7BB, 5355}, {0x1D7BC, 5356}, {0x1D7BD, 5357}, {0x1D7BE, 5358}, {0x1D7BF, 5359}, {0x1D7C0, 5360}, {0x1D7C1, 5361}, {0x1D7C2, 5362},
+    {0x1D7C3, 5363}, {0x1D7C4, 5364}, {0x1D7C5, 5365}, {0x1D7C6, 5366}, {0x1D7C7, 5367}, {0x1D7C8, 5368}, {0x1D7C9, 5369}, {0x1D7CA, 5370},
+    {0x1D7CB, 5371}, {0x1D7CE, 5372}, {0x1D7CF, 5373}, {0x1D7D0, 5374}, {0x1D7D1, 5375}, {0x1D7D2, 5376}, {0x1D7D3, 5377}, {0x1D7D4, 5378},
+    {0x1D7D5, 5379}, {0x1D7D6, 5380}, {0x1D7D7, 5381}, {0x1D7D8, 5382}, {0x1D7D9, 5383}, {0x1D7DA, 5384}, {0x1D7DB, 5385}, {0x1D7DC, 5386},
+    {0x1D7DD, 5387}, {0x1D7DE, 5388}, {0x1D7DF, 5389}, {0x1D7E0, 5390}, {0x1D7E1, 5391}, {0x1D7E2, 5392}, {0x1D7E3, 5393}, {0x1D7E4, 5394},
+    {0x1D7E5, 5395}, {0x1D7E6, 5396}, {0x1D7E7, 5397}, {0x1D7E8, 5398}, {0x1D7E9, 5399}, {0x1D7EA, 5400}, {0x1D7EB, 5401}, {0x1D7EC, 5402},
+    {0x1D7ED, 5403}, {0x1D7EE, 5404}, {0x1D7EF, 5405}, {0x1D7F0, 5406}, {0x1D7F1, 5407}, {0x1D7F2, 5408}, {0x1D7F3, 5409}, {0x1D7F4, 5410},
+    {0x1D7F5, 5411}, {0x1D7F6, 5412}, {0x1D7F7, 5413}, {0x1D7F8, 5414}, {0x1D7F9, 5415}, {0x1D7FA, 5416}, {0x1D7FB, 5417}, {0x1D7FC, 5418},
+    {0x1D7FD, 5419}, {0x1D7FE, 5420}, {0x1D7FF, 5421}, {0x1E900, 5422}, {0x1E901, 5423}, {0x1E902, 5424}, {0x1E903, 5425}, {0x1E904, 5426},
+    {0x1E905, 5427}, {0x1E906, 5428}, {0x1E907, 5429}, {0x1E908, 5430}, {0x1E909, 5431}, {0x1E90A, 5432}, {0x1E90B, 5433}, {0x1E90C, 5434},
+    {0x1E90D, 5435}, {0x1E90E, 5436}, {0x1E90F, 5437}, {0x1E910, 5438}, {0x1E911, 5439}, {0x1E912, 5440}, {0x1E913, 5441}, {0x1E914, 5442},
+    {0x1E915, 5443}, {0x1E916, 5444}, {0x1E917, 5445}, {0x1E918, 5446}, {0x1E919, 5447}, {0x1E91A, 5448}, {0x1E91B, 5449}, {0x1E91C, 5450},
+    {0x1E91D, 5451}, {0x1E91E, 5452}, {0x1E91F, 5453}, {0x1E920, 5454}, {0x1E921, 5455}, {0x1EE00, 5456}, {0x1EE01, 5457}, {0x1EE02, 5458},
+    {0x1EE03, 5459}, {0x1EE05, 5460}, {0x1EE06, 5461}, {0x1EE07, 5462}, {0x1EE08, 5463}, {0x1EE09, 5464}, {0x1EE0A, 5465}, {0x1EE0B, 5466},
+    {0x1EE0C, 5467}, {0x1EE0D, 5468}, {0x1EE0E, 5469}, {0x1EE0F, 5470}, {0x1EE10, 5471}, {0x1EE11, 5472}, {0x1EE12, 5473}, {0x1EE13, 5474},
+    {0x1EE14, 5475}, {0x1EE15, 5476}, {0x1EE16, 5477}, {0x1EE17, 5478}, {0x1EE18, 5479}, {0x1EE19, 5480}, {0x1EE1A, 5481}, {0x1EE1B, 5482},
+    {0x1EE1C, 5483}, {0x1EE1D, 5484}, {0x1EE1E, 5485}, {0x1EE1F, 5486}, {0x1EE21, 5487}, {0x1EE22, 5488}, {0x1EE24, 5489}, {0x1EE27, 5490},
+    {0x1EE29, 5491}, {0x1EE2A, 5492}, {0x1EE2B, 5493}, {0x1EE2C, 5494}, {0x1EE2D, 5495}, {0x1EE2E, 5496}, {0x1EE2F, 5497}, {0x1EE30, 5498},
+    {0x1EE31, 5499}, {0x1EE32, 5500}, {0x1EE34, 5501}, {0x1EE35, 5502}, {0x1EE36, 5503}, {0x1EE37, 5504}, {0x1EE39, 5505}, {0x1EE3B, 5506},
+    {0x1EE42, 5507}, {0x1EE47, 5508}, {0x1EE49, 5509}, {0x1EE4B, 5510}, {0x1EE4D, 5511}, {0x1EE4E, 5512}, {0x1EE4F, 5513}, {0x1EE51, 5514},
+    {0x1EE52, 5515}, {0x1EE54, 5516}, {0x1EE57, 5517}, {0x1EE59, 5518}, {0x1EE5B, 5519}, {0x1EE5D, 5520}, {0x1EE5F, 5521}, {0x1EE61, 5522},
+    {0x1EE62, 5523}, {0x1EE64, 5524}, {0x1EE67, 5525}, {0x1EE68, 5526}, {0x1EE69, 5527}, {0x1EE6A, 5528}, {0x1EE6C, 5529}, {0x1EE6D, 5530},
+    {0x1EE6E, 5531}, {0x1EE6F, 5532}, {0x1EE70, 5533}, {0x1EE71, 5534}, {0x1EE72, 5535}, {0x1EE74, 5536}, {0x1EE75, 5537}, {0x1EE76, 5538},
+    {0x1EE77, 5539}, {0x1EE79, 5540}, {0x1EE7A, 5541}, {0x1EE7B, 5542}, {0x1EE7C, 5543}, {0x1EE7E, 5544}, {0x1EE80, 5545}, {0x1EE81, 5546},
+    {0x1EE82, 5547}, {0x1EE83, 5548}, {0x1EE84, 5549}, {0x1EE85, 5550}, {0x1EE86, 5551}, {0x1EE87, 5552}, {0x1EE88, 5553}, {0x1EE89, 5554},
+    {0x1EE8B, 5555}, {0x1EE8C, 5556}, {0x1EE8D, 5557}, {0x1EE8E, 5558}, {0x1EE8F, 5559}, {0x1EE90, 5560}, {0x1EE91, 5561}, {0x1EE92, 5562},
+    {0x1EE93, 5563}, {0x1EE94, 5564}, {0x1EE95, 5565}, {0x1EE96, 5566}, {0x1EE97, 5567}, {0x1EE98, 5568}, {0x1EE99, 5569}, {0x1EE9A, 5570},
+    {0x1EE9B, 5571}, {0x1EEA1, 5572}, {0x1EEA2, 5573}, {0x1EEA3, 5574}, {0x1EEA5, 5575}, {0x1EEA6, 5576}, {0x1EEA7, 5577}, {0x1EEA8, 5578},
+    {0x1EEA9, 5579}, {0x1EEAB, 5580}, {0x1EEAC, 5581}, {0x1EEAD, 5582}, {0x1EEAE, 5583}, {0x1EEAF, 5584}, {0x1EEB0, 5585}, {0x1EEB1, 5586},
+    {0x1EEB2, 5587}, {0x1EEB3, 5588}, {0x1EEB4, 5589}, {0x1EEB5, 5590}, {0x1EEB6, 5591}, {0x1EEB7, 5592}, {0x1EEB8, 5593}, {0x1EEB9, 5594},
+    {0x1EEBA, 5595}, {0x1EEBB, 5596}, {0x1F100, 5597}, {0x1F101, 5598}, {0x1F102, 5599}, {0x1F103, 5600}, {0x1F104, 5601}, {0x1F105, 5602},
+    {0x1F106, 5603}, {0x1F107, 5604}, {0x1F108, 5605}, {0x1F109, 5606}, {0x1F10A, 5607}, {0x1F110, 5608}, {0x1F111, 5609}, {0x1F112, 5610},
+    {0x1F113, 5611}, {0x1F114, 5612}, {0x1F115, 5613}, {0x1F116, 5614}, {0x1F117, 5615}, {0x1F118, 5616}, {0x1F119, 5617}, {0x1F11A, 5618},
+    {0x1F11B, 5619}, {0x1F11C, 5620}, {0x1F11D, 5621}, {0x1F11E, 5622}, {0x1F11F, 5623}, {0x1F120, 5624}, {0x1F121, 5625}, {0x1F122, 5626},
+    {0x1F123, 5627}, {0x1F124, 5628}, {0x1F125, 5629}, {0x1F126, 5630}, {0x1F127, 5631}, {0x1F128, 5632}, {0x1F129, 5633}, {0x1F12A, 5634},
+    {0x1F12B, 5635}, {0x1F12C, 5636}, {0x1F12D, 5637}, {0x1F12E, 5638}, {0x1F130, 5639}, {0x1F131, 5640}, {0x1F132, 5641}, {0x1F133, 5642},
+    {0x1F134, 5643}, {0x1F135, 5644}, {0x1F136, 5645}, {0x1F137, 5646}, {0x1F138, 5647}, {0x1F139, 5648}, {0x1F13A, 5649}, {0x1F13B, 5650},
+    {0x1F13C, 5651}, {0x1F13D, 5652}, {0x1F13E, 5653}, {0x1F13F, 5654}, {0x1F140, 5655}, {0x1F141, 5656}, {0x1F142, 5657}, {0x1F143, 5658},
+    {0x1F144, 5659}, {0x1F145, 5660}, {0x1F146, 5661}, {0x1F147, 5662}, {0x1F148, 5663}, {0x1F149, 5664}, {0x1F14A, 5665}, {0x1F14B, 5666},
+    {0x1F14C, 5667}, {0x1F14D, 5668}, {0x1F14E, 5669}, {0x1F14F, 5670}, {0x1F16A, 5671}, {0x1F16B, 5672}, {0x1F16C, 5673}, {0x1F190, 5674},
+    {0x1F200, 5675}, {0x1F201, 5676}, {0x1F202, 5677}, {0x1F210, 5678}, {0x1F211, 5679}, {0x1F212, 5680}, {0x1F213, 5681}, {0x1F214, 5682},
+    {0x1F215, 5683}, {0x1F216, 5684}, {0x1F217, 5685}, {0x1F218, 5686}, {0x1F219, 5687}, {0x1F21A, 5688}, {0x1F21B, 5689}, {0x1F21C, 5690},
+    {0x1F21D, 5691}, {0x1F21E, 5692}, {0x1F21F, 5693}, {0x1F220, 5694}, {0x1F221, 5695}, {0x1F222, 5696}, {0x1F223, 5697}, {0x1F224, 5698},
+    {0x1F225, 5699}, {0x1F226, 5700}, {0x1F227, 5701}, {0x1F228, 5702}, {0x1F229, 5703}, {0x1F22A, 5704}, {0x1F22B, 5705}, {0x1F22C, 5706},
+    {0x1F22D, 5707}, {0x1F22E, 5708}, {0x1F22F, 5709}, {0x1F230, 5710}, {0x1F231, 5711}, {0x1F232, 5712}, {0x1F233, 5713}, {0x1F234, 5714},
+    {0x1F235, 5715}, {0x1F236, 5716}, {0x1F237, 5717}, {0x1F238, 5718}, {0x1F239, 5719}, {0x1F23A, 5720}, {0x1F23B, 5721}, {0x1F240, 5722},
+    {0x1F241, 5723}, {0x1F242, 5724}, {0x1F243, 5725}, {0x1F244, 5726}, {0x1F245, 5727}, {0x1F246, 5728}, {0x1F247, 5729}, {0x1F248, 5730},
+    {0x1F250, 5731}, {0x1F251, 5732}, {0x1FBF0, 5733}, {0x1FBF1, 5734}, {0x1FBF2, 5735}, {0x1FBF3, 5736}, {0x1FBF4, 5737}, {0x1FBF5, 5738},
+    {0x1FBF6, 5739}, {0x1FBF7, 5740}, {0x1FBF8, 5741}, {0x1FBF9, 5742}, {0x2F800, 5743}, {0x2F801, 5744}, {0x2F802, 5745}, {0x2F803, 5746},
+    {0x2F804, 5747}, {0x2F805, 5748}, {0x2F806, 5749}, {0x2F807, 5750}, {0x2F808, 5751}, {0x2F809, 5752}, {0x2F80A, 5753}, {0x2F80B, 5754},
+    {0x2F80C, 5755}, {0x2F80D, 5756}, {0x2F80E, 5757}, {0x2F80F, 5758}, {0x2F810, 5759}, {0x2F811, 5760}, {0x2F812, 5761}, {0x2F813, 5762},
+    {0x2F814, 5763}, {0x2F815, 5764}, {0x2F816, 5765}, {0x2F817, 5766}, {0x2F818, 5767}, {0x2F819, 5768}, {0x2F81A, 5769}, {0x2F81B, 5770},
+    {0x2F81C, 5771}, {0x2F81D, 5772}, {0x2F81E, 5773}, {0x2F81F, 5774}, {0x2F820, 5775}, {0x2F821, 5776}, {0x2F822, 5777}, {0x2F823, 5778},
+    {0x2F824, 5779}, {0x2F825, 5780}, {0x2F826, 5781}, {0x2F827, 5782}, {0x2F828, 5783}, {0x2F829, 5784}, {0x2F82A, 5785}, {0x2F82B, 5786},
+    {0x2F82C, 5787}, {0x2F82D, 5788}, {0x2F82E, 5789}, {0x2F82F, 5790}, {0x2F830, 5791}, {0x2F831, 5792}, {0x2F832, 5793}, {0x2F833, 5794},
+    {0x2F834, 5795}, {0x2F835, 5796}, {0x2F836, 5797}, {0x2F837, 5798}, {0x2F838, 5799}, {0x2F839, 5800}, {0x2F83A, 5801}, {0x2F83B, 5802},
+    {0x2F83C, 5803}, {0x2F83D, 5804}, {0x2F83E, 5805}, {0x2F83F, 5806}, {0x2F840, 5807}, {0x2F841, 5808}, {0x2F842, 5809}, {0x2F843, 5810},
+    {0x2F844, 5811}, {0x2F845, 5812}, {0x2F846, 5813}, {0x2F847, 5814}, {0x2F848, 5815}, {0x2F849, 5816}, {0x2F84A, 5817}, {0x2F84B, 5818},
+    {0x2F84C, 5819}, {0x2F84D, 5820}, {0x2F84E, 5821}, {0x2F84F, 5822}, {0x2F850, 5823}, {0x2F851, 5824}, {0x2F852, 5825}, {0x2F853, 5826},
+    {0x2F854, 5827}, {0x2F855, 5828}, {0x2F856, 5829}, {0x2F857, 5830}, {0x2F858, 5831}, {0x2F859, 5832}, {0x2F85A, 5833}, {0x2F85B, 5834},
+    {0x2F85C, 5835}, {0x2F85D, 5836}, {0x2F85E, 5837}, {0x2F85F, 5838}, {0x2F860, 5839}, {0x2F861, 5840}, {0x2F862, 5841}, {0x2F863, 5842},
+    {0x2F864, 5843}, {0x2F865, 5844}, {0x2F866, 5845}, {0x2F867, 5846}, {0x2F868, 5847}, {0x2F869, 5848}, {0x2F86A, 5849}, {0x2F86B, 5850},
+    {0x2F86C, 5851}, {0x2F86D, 5852}, {0x2F86E, 5853}, {0x2F86F, 5854}, {0x2F870, 5855}, {0x2F871, 5856}, {0x2F872, 5857}, {0x2F873, 5858},
+    {0x2F874, 5859}, {0x2F875, 5860}, {0x2F876, 5861}, {0x2F877, 5862}, {0x2F878, 5863}, {0x2F879, 5864}, {0x2F87A, 5865}, {0x2F87B, 5866},
+    {0x2F87C, 5867}, {0x2F87D, 5868}, {0x2F87E, 5869}, {0x2F87F, 5870}, {0x2F880, 5871}, {0x2F881, 5872}, {0x2F882, 5873}, {0x2F883, 5874},
+    {0x2F884, 5875}, {0x2F885, 5876}, {0x2F886, 5877}, {0x2F887, 5878}, {0x2F888, 5879}, {0x2F889, 5880}, {0x2F88A, 5881}, {0x2F88B, 5882},
+    {0x2F88C, 5883}, {0x2F88D, 5884}, {0x2F88E, 5885}, {0x2F88F, 5886}, {0x2F890, 5887}, {0x2F891, 5888}, {0x2F892, 5889}, {0x2F893, 5890},
+    {0x2F894, 5891}, {0x2F895, 5892}, {0x2F896, 5893}, {0x2F897, 5894}, {0x2F898, 5895}, {0x2F899, 5896}, {0x2F89A, 5897}, {0x2F89B, 5898},
+    {0x2F89C, 5899}, {0x2F89D, 5900}, {0x2F89E, 5901}, {0x2F89F, 5902}, {0x2F8A0, 5903}, {0x2F8A1, 5904}, {0x2F8A2, 5905}, {0x2F8A3, 5906},
+    {0x2F8A4, 5907}, {0x2F8A5, 5908}, {0x2F8A6, 5909}, {0x2F8A7, 5910}, {0x2F8A8, 5911}, {0x2F8A9, 5912}, {0x2F8AA, 5913}, {0x2F8AB, 5914},
+    {0x2F8AC, 5915}, {0x2F8AD, 5916}, {0x2F8AE, 5917}, {0x2F8AF, 5918}, {0x2F8B0, 5919}, {0x2F8B1, 5920}, {0x2F8B2, 5921}, {0x2F8B3, 5922},
+    {0x2F8B4, 5923}, {0x2F8B5, 5924}, {0x2F8B6, 5925}, {0x2F8B7, 5926}, {0x2F8B8, 5927}, {0x2F8B9, 5928}, {0x2F8BA, 5929}, {0x2F8BB, 5930},
+    {0x2F8BC, 5931}, {0x2F8BD, 5932}, {0x2F8BE, 5933}, {0x2F8BF, 5934}, {0x2F8C0, 5935}, {0x2F8C1, 5936}, {0x2F8C2, 5937}, {0x2F8C3, 5938},
+    {0x2F8C4, 5939}, {0x2F8C5, 5940}, {0x2F8C6, 5941}, {0x2F8C7, 5942}, {0x2F8C8, 5943}, {0x2F8C9, 5944}, {0x2F8CA, 5945}, {0x2F8CB, 5946},
+    {0x2F8CC, 5947}, {0x2F8CD, 5948}, {0x2F8CE, 5949}, {0x2F8CF, 5950}, {0x2F8D0, 5951}, {0x2F8D1, 5952}, {0x2F8D2, 5953}, {0x2F8D3, 5954},
+    {0x2F8D4, 5955}, {0x2F8D5, 5956}, {0x2F8D6, 5957}, {0x2F8D7, 5958}, {0x2F8D8, 5959}, {0x2F8D9, 5960}, {0x2F8DA, 5961}, {0x2F8DB, 5962},
+    {0x2F8DC, 5963}, {0x2F8DD, 5964}, {0x2F8DE, 5965}, {0x2F8DF, 5966}, {0x2F8E0, 5967}, {0x2F8E1, 5968}, {0x2F8E2, 5969}, {0x2F8E3, 5970},
+    {0x2F8E4, 5971}, {0x2F8E5, 5972}, {0x2F8E6, 5973}, {0x2F8E7, 5974}, {0x2F8E8, 5975}, {0x2F8E9, 5976}, {0x2F8EA, 5977}, {0x2F8EB, 5978},
+    {0x2F8EC, 5979}, {0x2F8ED, 5980}, {0x2F8EE, 5981}, {0x2F8EF, 5982}, {0x2F8F0, 5983}, {0x2F8F1, 5984}, {0x2F8F2, 5985}, {0x2F8F3, 5986},
+    {0x2F8F4, 5987}, {0x2F8F5, 5988}, {0x2F8F6, 5989}, {0x2F8F7, 5990}, {0x2F8F8, 5991}, {0x2F8F9, 5992}, {0x2F8FA, 5993}, {0x2F8FB, 5994},
+    {0x2F8FC, 5995}, {0x2F8FD, 5996}, {0x2F8FE, 5997}, {0x2F8FF, 5998}, {0x2F900, 5999}, {0x2F901, 6000}, {0x2F902, 6001}, {0x2F903, 6002},
+    {0x2F904, 6003}, {0x2F905, 6004}, {0x2F906, 6005}, {0x2F907, 6006}, {0x2F908, 6007}, {0x2F909, 6008}, {0x2F90A, 6009}, {0x2F90B, 6010},
+    {0x2F90C, 6011}, {0x2F90D, 6012}, {0x2F90E, 6013}, {0x2F90F, 6014}, {0x2F910, 6015}, {0x2F911, 6016}, {0x2F912, 6017}, {0x2F913, 6018},
+    {0x2F914, 6019}, {0x2F915, 6020}, {0x2F916, 6021}, {0x2F917, 6022}, {0x2F918, 6023}, {0x2F919, 6024}, {0x2F91A, 6025}, {0x2F91B, 6026},
+    {0x2F91C, 6027}, {0x2F91D, 6028}, {0x2F91E, 6029}, {0x2F91F, 6030}, {0x2F920, 6031}, {0x2F921, 6032}, {0x2F922, 6033}, {0x2F923, 6034},
+    {0x2F924, 6035}, {0x2F925, 6036}, {0x2F926, 6037}, {0x2F927, 6038}, {0x2F928, 6039}, {0x2F929, 6040}, {0x2F92A, 6041}, {0x2F92B, 6042},
+    {0x2F92C, 6043}, {0x2F92D, 6044}, {0x2F92E, 6045}, {0x2F92F, 6046}, {0x2F930, 6047}, {0x2F931, 6048}, {0x2F932, 6049}, {0x2F933, 6050},
+    {0x2F934, 6051}, {0x2F935, 6052}, {0x2F936, 6053}, {0x2F937, 6054}, {0x2F938, 6055}, {0x2F939, 6056}, {0x2F93A, 6057}, {0x2F93B, 6058},
+    {0x2F93C, 6059}, {0x2F93D, 6060}, {0x2F93E, 6061}, {0x2F93F, 6062}, {0x2F940, 6063}, {0x2F941, 6064}, {0x2F942, 6065}, {0x2F943, 6066},
+    {0x2F944, 6067}, {0x2F945, 6068}, {0x2F946, 6069}, {0x2F947, 6070}, {0x2F948, 6071}, {0x2F949, 6072}, {0x2F94A, 6073}, {0x2F94B, 6074},
+    {0x2F94C, 6075}, {0x2F94D, 6076}, {0x2F94E, 6077}, {0x2F94F, 6078}, {0x2F950, 6079}, {0x2F951, 6080}, {0x2F952, 6081}, {0x2F953, 6082},
+    {0x2F954, 6083}, {0x2F955, 6084}, {0x2F956, 6085}, {0x2F957, 6086}, {0x2F958, 6087}, {0x2F959, 6088}, {0x2F95A, 6089}, {0x2F95B, 6090},
+    {0x2F95C, 6091}, {0x2F95D, 6092}, {0x2F95E, 6093}, {0x2F95F, 6094}, {0x2F960, 6095}, {0x2F961, 6096}, {0x2F962, 6097}, {0x2F963, 6098},
+    {0x2F964, 6099}, {0x2F965, 6100}, {0x2F966, 6101}, {0x2F967, 6102}, {0x2F968, 6103}, {0x2F969, 6104}, {0x2F96A, 6105}, {0x2F96B, 6106},
+    {0x2F96C, 6107}, {0x2F96D, 6108}, {0x2F96E, 6109}, {0x2F96F, 6110}, {0x2F970, 6111}, {0x2F971, 6112}, {0x2F972, 6113}, {0x2F973, 6114},
+    {0x2F974, 6115}, {0x2F975, 6116}, {0x2F976, 6117}, {0x2F977, 6118}, {0x2F978, 6119}, {0x2F979, 6120}, {0x2F97A, 6121}, {0x2F97B, 6122},
+    {0x2F97C, 6123}, {0x2F97D, 6124}, {0x2F97E, 6125}, {0x2F97F, 6126}, {0x2F980, 6127}, {0x2F981, 6128}, {0x2F982, 6129}, {0x2F983, 6130},
+    {0x2F984, 6131}, {0x2F985, 6132}, {0x2F986, 6133}, {0x2F987, 6134}, {0x2F988, 6135}, {0x2F989, 6136}, {0x2F98A, 6137}, {0x2F98B, 6138},
+    {0x2F98C, 6139}, {0x2F98D, 6140}, {0x2F98E, 6141}, {0x2F98F, 6142}, {0x2F990, 6143}, {0x2F991, 6144}, {0x2F992, 6145}, {0x2F993, 6146},
+    {0x2F994, 6147}, {0x2F995, 6148}, {0x2F996, 6149}, {0x2F997, 6150}, {0x2F998, 6151}, {0x2F999, 6152}, {0x2F99A, 6153}, {0x2F99B, 6154},
+    {0x2F99C, 6155}, {0x2F99D, 6156}, {0x2F99E, 6157}, {0x2F99F, 6158}, {0x2F9A0, 6159}, {0x2F9A1, 6160}, {0x2F9A2, 6161}, {0x2F9A3, 6162},
+    {0x2F9A4, 6163}, {0x2F9A5, 6164}, {0x2F9A6, 6165}, {0x2F9A7, 6166}, {0x2F9A8, 6167}, {0x2F9A9, 6168}, {0x2F9AA, 6169}, {0x2F9AB, 6170},
+    {0x2F9AC, 6171}, {0x2F9AD, 6172}, {0x2F9AE, 6173}, {0x2F9AF, 6174}, {0x2F9B0, 6175}, {0x2F9B1, 6176}, {0x2F9B2, 6177}, {0x2F9B3, 6178},
+    {0x2F9B4, 6179}, {0x2F9B5, 6180}, {0x2F9B6, 6181}, {0x2F9B7, 6182}, {0x2F9B8, 6183}, {0x2F9B9, 6184}, {0x2F9BA, 6185}, {0x2F9BB, 6186},
+    {0x2F9BC, 6187}, {0x2F9BD, 6188}, {0x2F9BE, 6189}, {0x2F9BF, 6190}, {0x2F9C0, 6191}, {0x2F9C1, 6192}, {0x2F9C2, 6193}, {0x2F9C3, 6194},
+    {0x2F9C4, 6195}, {0x2F9C5, 6196}, {0x2F9C6, 6197}, {0x2F9C7, 6198}, {0x2F9C8, 6199}, {0x2F9C9, 6200}, {0x2F9CA, 6201}, {0x2F9CB, 6202},
+    {0x2F9CC, 6203}, {0x2F9CD, 6204}, {0x2F9CE, 6205}, {0x2F9CF, 6206}, {0x2F9D0, 6207}, {0x2F9D1, 6208}, {0x2F9D2, 6209}, {0x2F9D3, 6210},
+    {0x2F9D4, 6211}, {0x2F9D5, 6212}, {0x2F9D6, 6213}, {0x2F9D7, 6214}, {0x2F9D8, 6215}, {0x2F9D9, 6216}, {0x2F9DA, 6217}, {0x2F9DB, 6218},
+    {0x2F9DC, 6219}, {0x2F9DD, 6220}, {0x2F9DE, 6221}, {0x2F9DF, 6222}, {0x2F9E0, 6223}, {0x2F9E1, 6224}, {0x2F9E2, 6225}, {0x2F9E3, 6226},
+    {0x2F9E4, 6227}, {0x2F9E5, 6228}, {0x2F9E6, 6229}, {0x2F9E7, 6230}, {0x2F9E8, 6231}, {0x2F9E9, 6232}, {0x2F9EA, 6233}, {0x2F9EB, 6234},
+    {0x2F9EC, 6235}, {0x2F9ED, 6236}, {0x2F9EE, 6237}, {0x2F9EF, 6238}, {0x2F9F0, 6239}, {0x2F9F1, 6240}, {0x2F9F2, 6241}, {0x2F9F3, 6242},
+    {0x2F9F4, 6243}, {0x2F9F5, 6244}, {0x2F9F6, 6245}, {0x2F9F7, 6246}, {0x2F9F8, 6247}, {0x2F9F9, 6248}, {0x2F9FA, 6249}, {0x2F9FB, 6250},
+    {0x2F9FC, 6251}, {0x2F9FD, 6252}, {0x2F9FE, 6253}, {0x2F9FF, 6254}, {0x2FA00, 6255}, {0x2FA01, 6256}, {0x2FA02, 6257}, {0x2FA03, 6258},
+    {0x2FA04, 6259}, {0x2FA05, 6260}, {0x2FA06, 6261}, {0x2FA07, 6262}, {0x2FA08, 6263}, {0x2FA09, 6264}, {0x2FA0A, 6265}, {0x2FA0B, 6266},
+    {0x2FA0C, 6267}, {0x2FA0D, 6268}, {0x2FA0E, 6269}, {0x2FA0F, 6270}, {0x2FA10, 6271}, {0x2FA11, 6272}, {0x2FA12, 6273}, {0x2FA13, 6274},
+    {0x2FA14, 6275}, {0x2FA15, 6276}, {0x2FA16, 6277}, {0x2FA17, 6278}, {0x2FA18, 6279}, {0x2FA19, 6280}, {0x2FA1A, 6281}, {0x2FA1B, 6282},
+    {0x2FA1C, 6283}, {0x2FA1D, 6284},
+};
+
+// 第i个映射为kFoldCodePoints[kFoldOffsets[i], kFoldOffsets[i + 1])
+constexpr std::uint16_t kFoldOffsets[] = {
+    0, 1, 3, 4, 4, 6, 7, 8, 10, 11, 13, 14, 15, 18, 21, 24, 25, 26, 27, 28,
+    29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 82, 84, 86, 87, 88, 89, 90, 91, 93,
+    95, 96, 97, 98, 99, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+    116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
+    136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155,
+    156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 167, 169, 171, 173, 175, 177, 179, 181, 183, 184,
+    185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 202, 204, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227,
+    228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247,
+    248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 263, 265, 267, 269, 271, 273,
+    274, 275, 276, 277, 278, 279, 280, 281, 283, 284, 284, 285, 286, 287, 288, 290, 291, 292, 294, 297,
+    298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
+    318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337,
+    338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357,
+    358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377,
+    378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397,
+    398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417,
+    418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437,
+    438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457,
+    458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477,
+    478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+    498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517,
+    518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537,
+    538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 551, 551, 553, 555, 557, 559, 561, 563,
+    565, 567, 569, 571, 573, 575, 577, 579, 581, 583, 585, 587, 589, 591, 593, 595, 597, 599, 601, 603,
+    605, 606, 608, 610, 612, 614, 616, 618, 620, 622, 624, 627, 629, 632, 634, 636, 638, 640, 642, 644,
+    646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659, 660, 661, 662, 663, 664, 665,
+    666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685,
+    686, 687, 687, 687, 688, 689, 690, 691, 692, 693, 693, 693, 693, 693, 693, 693, 693, 694, 695, 696,
+    697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716,
+    717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736,
+    737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756,
+    757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776,
+    777, 778, 779, 780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795, 796,
+    797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814, 815, 816,
+    817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831, 832, 833, 834, 835, 836,
+    837, 838, 839, 840, 841, 842, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856,
+    857, 858, 859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876,
+    877, 878, 879, 880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 895, 896,
+    897, 898, 899, 900, 901, 902, 903, 904, 905, 906, 907, 908, 909, 910, 911, 912, 913, 914, 915, 916,
+    917, 918, 919, 920, 921, 923, 924, 926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938,
+    939, 940, 941, 942, 943, 944, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958,
+    959, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 975, 976, 977, 978,
+    979, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991, 992, 993, 994, 995, 996, 997, 998,
+    999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018,
+    1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1031, 1033, 1035, 1037, 1039, 1041, 1043, 1045, 1047,
+    1049, 1051, 1053, 1055, 1057, 1059, 1061, 1063, 1065, 1067, 1069, 1071, 1073, 1075, 1077, 1079, 1081, 1083, 1085, 1087,
+    1089, 1091, 1093, 1095, 1097, 1099, 1101, 1103, 1105, 1107, 1109, 1111, 1113, 1115, 1117, 1119, 1121, 1123, 1125, 1127,
+    1129, 1131, 1133, 1134, 1135, 1136, 1137, 1139, 1141, 1142, 1144, 1146, 1149, 1151, 1153, 1155, 1157, 1158, 1159, 1160,
+    1161, 1163, 1166, 1169, 1172, 1173, 1174, 1175, 1176, 1177, 1180, 1183, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1195,
+    1198, 1199, 1201, 1203, 1205, 1207, 1208, 1209, 1210, 1211, 1213, 1215, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224,
+    1225, 1226, 1227, 1228, 1228, 1228, 1228, 1228, 1228, 1229, 1231, 1232, 1234, 1237, 1237, 1237, 1237, 1237, 1237, 1238,
+    1240, 1243, 1245, 1248, 1250, 1252, 1254, 1256, 1258, 1262, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263,
+    1263, 1263, 1263, 1263, 1263, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277,
+    1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297,
+    1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1307, 1310, 1313, 1314, 1316, 1319, 1322, 1323, 1325, 1326, 1327, 1328,
+    1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1338, 1339, 1340, 1341, 1342, 1343, 1345, 1348, 1350, 1351, 1352, 1353,
+    1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1371, 1372, 1373, 1374, 1375,
+    1376, 1377, 1378, 1379, 1380, 1381, 1384, 1387, 1391, 1394, 1397, 1400, 1403, 1406, 1409, 1412, 1415, 1418, 1421, 1424,
+    1427, 1429, 1430, 1432, 1435, 1437, 1438, 1440, 1443, 1447, 1449, 1450, 1452, 1455, 1456, 1457, 1458, 1459, 1460, 1462,
+    1465, 1467, 1468, 1470, 1473, 1477, 1479, 1480, 1482, 1485, 1486, 1487, 1488, 1489, 1490, 1493, 1495, 1498, 1500, 1503,
+    1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1516, 1518, 1520, 1522, 1524, 1526, 1528, 1530, 1532,
+    1534, 1536, 1539, 1542, 1545, 1548, 1551, 1554, 1557, 1560, 1563, 1567, 1571, 1575, 1579, 1583, 1587, 1591, 1595, 1599,
+    1603, 1607, 1609, 1611, 1613, 1615, 1617, 1619, 1621, 1623, 1625, 1628, 1631, 1634, 1637, 1640, 1643, 1646, 1649, 1652,
+    1655, 1658, 1661, 1664, 1667, 1670, 1673, 1676, 1679, 1682, 1685, 1688, 1691, 1694, 1697, 1700, 1703, 1706, 1709, 1712,
+    1715, 1718, 1721, 1724, 1727, 1730, 1733, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748,
+    1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768,
+    1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788,
+    1789, 1793, 1796, 1798, 1801, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817,
+    1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837,
+    1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857,
+    1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877,
+    1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897,
+    1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917,
+    1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937,
+    1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957,
+    1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977,
+    1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997,
+    1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017,
+    2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037,
+    2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057,
+    2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077,
+    2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097,
+    2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117,
+    2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137,
+    2138, 2139, 2140, 2141, 2142, 2143, 2145, 2147, 2149, 2151, 2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161,
+    2162, 2163, 2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181,
+    2182, 2183, 2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201,
+    2202, 2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220,
+    2221, 2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240,
+    2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258, 2261, 2264,
+    2267, 2270, 2273, 2276, 2279, 2282, 2285, 2288, 2291, 2294, 2297, 2300, 2303, 2306, 2309, 2312, 2315, 2318, 2321, 2324,
+    2327, 2330, 2333, 2336, 2339, 2342, 2345, 2349, 2353, 2356, 2359, 2362, 2365, 2368, 2371, 2374, 2377, 2380, 2383, 2386,
+    2389, 2392, 2395, 2398, 2401, 2404, 2407, 2410, 2413, 2416, 2419, 2422, 2425, 2428, 2431, 2434, 2437, 2440, 2443, 2446,
+    2449, 2452, 2455, 2458, 2461, 2462, 2463, 2464, 2465, 2468, 2470, 2472, 2474, 2476, 2478, 2480, 2482, 2484, 2486, 2488,
+    2490, 2492, 2494, 2496, 2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513,
+    2514, 2515, 2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2528, 2530, 2531, 2532, 2533, 2534, 2535,
+    2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553, 2554, 2555,
+    2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575,
+    2576, 2577, 2578, 2579, 2580, 2582, 2584, 2586, 2588, 2590, 2592, 2594, 2596, 2598, 2600, 2602, 2604, 2606, 2608, 2610,
+    2612, 2614, 2616, 2618, 2620, 2622, 2624, 2626, 2628, 2631, 2634, 2637, 2639, 2642, 2644, 2647, 2648, 2649, 2650, 2651,
+    2652, 2653, 2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671,
+    2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691,
+    2692, 2693, 2694, 2696, 2700, 2704, 2708, 2711, 2715, 2718, 2721, 2726, 2730, 2733, 2736, 2739, 2743, 2747, 2750, 2753,
+    2755, 2758, 2762, 2766, 2768, 2773, 2779, 2784, 2787, 2792, 2797, 2801, 2804, 2807, 2810, 2814, 2819, 2823, 2826, 2829,
+    2832, 2834, 2836, 2838, 2840, 2843, 2846, 2851, 2854, 2858, 2863, 2866, 2868, 2870, 2875, 2879, 2884, 2887, 2892, 2894,
+    2897, 2900, 2903, 2906, 2909, 2913, 2916, 2918, 2921, 2924, 2927, 2931, 2934, 2937, 2940, 2945, 2949, 2951, 2956, 2958,
+    2962, 2966, 2969, 2972, 2975, 2979, 2981, 2984, 2988, 2990, 2995, 2998, 3000, 3002, 3004, 3006, 3008, 3010, 3012, 3014,
+    3016, 3018, 3021, 3024, 3027, 3030, 3033, 3036, 3039, 3042, 3045, 3048, 3051, 3054, 3057, 3060, 3063, 3066, 3068, 3070,
+    3073, 3075, 3077, 3079, 3082, 3085, 3087, 3089, 3091, 3093, 3095, 3099, 3101, 3103, 3105, 3107, 3109, 3111, 3113, 3115,
+    3118, 3122, 3124, 3126, 3128, 3130, 3132, 3134, 3136, 3139, 3142, 3145, 3148, 3150, 3152, 3154, 3156, 3158, 3160, 3162,
+    3164, 3166, 3168, 3171, 3174, 3176, 3179, 3182, 3185, 3187, 3190, 3193, 3197, 3199, 3202, 3205, 3208, 3211, 3216, 3222,
+    3224, 3226, 3228, 3230, 3232, 3234, 3236, 3238, 3240, 3242, 3244, 3246, 3248, 3250, 3252, 3254, 3256, 3258, 3262, 3264,
+    3266, 3268, 3272, 3275, 3277, 3279, 3281, 3283, 3285, 3287, 3289, 3291, 3293, 3295, 3298, 3300, 3302, 3305, 3308, 3310,
+    3314, 3317, 3319, 3321, 3323, 3325, 3328, 3331, 3333, 3335, 3337, 3339, 3341, 3343, 3345, 3347, 3349, 3352, 3355, 3358,
+    3361, 3364, 3367, 3370, 3373, 3376, 3379, 3382, 3385, 3388, 3391, 3394, 3397, 3400, 3403, 3406, 3409, 3412, 3415, 3418,
+    3419, 3420, 3421, 3422, 3423, 3424, 3425, 3426, 3427, 3428, 3429, 3430, 3431, 3432, 3433, 3434, 3435, 3436, 3437, 3438,
+    3439, 3440, 3441, 3442, 3443, 3444, 3445, 3446, 3447, 3448, 3449, 3450, 3451, 3452, 3453, 3454, 3455, 3456, 3457, 3458,
+    3459, 3460, 3461, 3462, 3463, 3464, 3465, 3466, 3467, 3468, 3469, 3470, 3471, 3472, 3473, 3474, 3475, 3476, 3477, 3478,
+    3479, 3480, 3481, 3482, 3483, 3484, 3485, 3486, 3487, 3488, 3489, 3490, 3491, 3492, 3493, 3494, 3495, 3496, 3497, 3498,
+    3499, 3500, 3501, 3502, 3503, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 3511, 3512, 3513, 3514, 3515, 3516, 3517, 3518,
+    3519, 3520, 3521, 3522, 3523, 3524, 3525, 3526, 3527, 3528, 3529, 3530, 3531, 3532, 3533, 3534, 3535, 3536, 3537, 3538,
+    3539, 3540, 3541, 3542, 3543, 3544, 3545, 3546, 3547, 3548, 3549, 3550, 3551, 3552, 3553, 3554, 3555, 3556, 3557, 3558,
+    3559, 3560, 3561, 3562, 3563, 3564, 3565, 3566, 3567, 3568, 3569, 3570, 3571, 3572, 3573, 3574, 3575, 3576, 3577, 3578,
+    3579, 3580, 3581, 3582, 3583, 3584, 3585, 3586, 3587, 3588, 3589, 3590, 3591, 3592, 3593, 3594, 3595, 3596, 3597, 3598,
+    3599, 3600, 3601, 3602, 3603, 3604, 3605, 3606, 3607, 3608, 3609, 3610, 3611, 3612, 3613, 3614, 3615, 3616, 3617, 3618,
+    3619, 3620, 3621, 3622, 3623, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631, 3632, 3633, 3634, 3635, 3636, 3637, 3638,
+    3639, 3640, 3641, 3642, 3643, 3644, 3645, 3646, 3647, 3648, 3649, 3650, 3651, 3652, 3653, 3654, 3655, 3656, 3657, 3658,
+    3659, 3660, 3661, 3662, 3663, 3664, 3665, 3666, 3667, 3668, 3669, 3670, 3671, 3672, 3673, 3674, 3675, 3676, 3677, 3678,
+    3679, 3680, 3681, 3682, 3683, 3684, 3685, 3686, 3687, 3688, 3689, 3690, 3691, 3692, 3693, 3694, 3695, 3696, 3697, 3698,
+    3699, 3700, 3701, 3702, 3703, 3704, 3705, 3706, 3707, 3708, 3709, 3710, 3711, 3712, 3713, 3714, 3715, 3716, 3717, 3718,
+    3719, 3720, 3721, 3722, 3723, 3724, 3725, 3726, 3727, 3728, 3729, 3730, 3731, 3732, 3733, 3734, 3735, 3736, 3737, 3738,
+    3739, 3740, 3741, 3742, 3743, 3744, 3745, 3746, 3747, 3748, 3749, 3750, 3751, 3752, 3753, 3754, 3755, 3756, 3757, 3758,
+    3759, 3760, 3761, 3762, 3763, 3764, 3765, 3766, 3767, 3768, 3769, 3770, 3771, 3772, 3773, 3774, 3775, 3776, 3777, 3778,
+    3779, 3780, 3781, 3782, 3783, 3784, 3785, 3786, 3787, 3788, 3789, 3790, 3791, 3792, 3793, 3794, 3795, 3796, 3797, 3798,
+    3799, 3800, 3801, 3802, 3803, 3804, 3805, 3806, 3807, 3808, 3809, 3810, 3811, 3812, 3813, 3814, 3815, 3816, 3817, 3818,
+    3819, 3820, 3821, 3822, 3823, 3824, 3825, 3826, 3827, 3828, 3829, 3830, 3831, 3832, 3833, 3834, 3835, 3836, 3837, 3838,
+    3839, 3840, 3841, 3842, 3843, 3844, 3845, 3846, 3847, 3848, 3849, 3850, 3851, 3852, 3853, 3854, 3855, 3856, 3857, 3858,
+    3859, 3860, 3861, 3862, 3863, 3864, 3865, 3866, 3867, 3868, 3869, 3870, 3871, 3872, 3873, 3874, 3875, 3876, 3877, 3878,
+    3879, 3880, 3881, 3882, 3883, 3884, 3885, 3886, 3887, 3888, 3889, 3890, 3891, 3892, 3893, 3894, 3895, 3896, 3897, 3898,
+    3899, 3900, 3901, 3902, 3903, 3904, 3905, 3906, 3907, 3908, 3909, 3910, 3911, 3912, 3913, 3914, 3915, 3916, 3917, 3918,
+    3919, 3920, 3921, 3922, 3923, 3924, 3925, 3926, 3927, 3928, 3929, 3930, 3931, 3932, 3933, 3934, 3935, 3936, 3937, 3938,
+    3939, 3940, 3941, 3942, 3943, 3944, 3945, 3946, 3947, 3948, 3949, 3950, 3951, 3952, 3953, 3954, 3955, 3956, 3957, 3958,
+    3959, 3960, 3961, 3962, 3963, 3964, 3965, 3966, 3967, 3968, 3969, 3970, 3971, 3972, 3973, 3974, 3975, 3976, 3977, 3978,
+    3979, 3980, 3981, 3982, 3983, 3984, 3985, 3986, 3987, 3988, 3989, 3990, 3991, 3992, 3993, 3994, 3995, 3996, 3997, 3998,
+    3999, 4000, 4001, 4002, 4003, 4004, 4005, 4006, 4007, 4008, 4009, 4010, 4011, 4012, 4013, 4014, 4015, 4016, 4017, 4018,
+    4019, 4020, 4021, 4022, 4023, 4024, 4025, 4026, 4027, 4028, 4029, 4030, 4031, 4032, 4033, 4034, 4035, 4036, 4037, 4038,
+    4039, 4040, 4041, 4042, 4043, 4044, 4045, 4046, 4047, 4048, 4049, 4050, 4051, 4052, 4053, 4054, 4055, 4056, 4057, 4058,
+    4059, 4060, 4061, 4062, 4063, 4064, 4065, 4066, 4067, 4068, 4069, 4070, 4071, 4072, 4073, 4074, 4075, 4076, 4077, 4078,
+    4079, 4080, 4081, 4082, 4083, 4084, 4085, 4086, 4087, 4088, 4089, 4090, 4091, 4092, 4093, 4094, 4096, 4098, 4100, 4103,
+    4106, 4108, 4110, 4112, 4114, 4116, 4118, 4120, 4122, 4124, 4125, 4126, 4127, 4128, 4129, 4130, 4131, 4132, 4133, 4134,
+    4136, 4138, 4141, 4144, 4146, 4148, 4150, 4152, 4154, 4156, 4158, 4160, 4162, 4164, 4166, 4168, 4170, 4172, 4174, 4176,
+    4178, 4180, 4182, 4184, 4186, 4188, 4190, 4192, 4194, 4196, 4198, 4200, 4202, 4203, 4204, 4205, 4206, 4207, 4208, 4209,
+    4210, 4211, 4212, 4213, 4214, 4215, 4216, 4217, 4218, 4219, 4220, 4221, 4222, 4223, 4224, 4225, 4226, 4227, 4228, 4229,
+    4230, 4231, 4232, 4233, 4234, 4235, 4236, 4237, 4238, 4239, 4240, 4241, 4242, 4243, 4244, 4245, 4246, 4247, 4248, 4249,
+    4250, 4251, 4252, 4253, 4254, 4255, 4256, 4257, 4258, 4259, 4260, 4261, 4262, 4263, 4264, 4265, 4266, 4267, 4268, 4269,
+    4270, 4271, 4272, 4273, 4274, 4275, 4276, 4277, 4278, 4279, 4280, 4281, 4282, 4283, 4284, 4285, 4286, 4287, 4288, 4289,
+    4290, 4291, 4292, 4293, 4294, 4295, 4296, 4297, 4298, 4299, 4300, 4301, 4302, 4303, 4304, 4305, 4306, 4307, 4308, 4309,
+    4310, 4312, 4313, 4314, 4315, 4316, 4317, 4318, 4319, 4320, 4321, 4322, 4323, 4324, 4326, 4328, 4330, 4332, 4334, 4336,
+    4338, 4340, 4342, 4344, 4346, 4348, 4350, 4352, 4354, 4356, 4358, 4360, 4361, 4362, 4363, 4364, 4366, 4368, 4370, 4372,
+    4374, 4376, 4378, 4380, 4382, 4384, 4386, 4388, 4390, 4392, 4394, 4396, 4398, 4400, 4402, 4404, 4406, 4408, 4410, 4412,
+    4414, 4416, 4418, 4420, 4422, 4424, 4426, 4428, 4430, 4432, 4434, 4436, 4438, 4440, 4442, 4444, 4446, 4448, 4450, 4452,
+    4454, 4456, 4458, 4460, 4462, 4464, 4466, 4468, 4470, 4472, 4474, 4476, 4478, 4480, 4482, 4484, 4486, 4488, 4490, 4492,
+    4494, 4496, 4498, 4500, 4502, 4504, 4506, 4508, 4510, 4512, 4514, 4516, 4518, 4520, 4522, 4524, 4526, 4528, 4530, 4532,
+    4534, 4536, 4538, 4540, 4542, 4544, 4546, 4548, 4550, 4552, 4555, 4558, 4561, 4564, 4567, 4570, 4572, 4574, 4576, 4578,
+    4580, 4582, 4584, 4586, 4588, 4590, 4592, 4594, 4596, 4598, 4600, 4602, 4604, 4606, 4608, 4610, 4612, 4614, 4616, 4618,
+    4620, 4622, 4624, 4626, 4628, 4630, 4632, 4634, 4636, 4638, 4640, 4642, 4644, 4646, 4648, 4650, 4652, 4654, 4656, 4658,
+    4660, 4662, 4664, 4666, 4668, 4670, 4672, 4674, 4676, 4678, 4680, 4682, 4684, 4686, 4688, 4690, 4692, 4694, 4696, 4698,
+    4700, 4702, 4704, 4706, 4708, 4710, 4712, 4714, 4716, 4718, 4720, 4722, 4724, 4726, 4728, 4730, 4732, 4734, 4736, 4738,
+    4740, 4742, 4744, 4746, 4748, 4750, 4752, 4754, 4756, 4758, 4760, 4762, 4764, 4766, 4768, 4770, 4772, 4774, 4776, 4778,
+    4780, 4782, 4784, 4786, 4788, 4790, 4792, 4794, 4796, 4798, 4800, 4802, 4804, 4806, 4808, 4810, 4812, 4814, 4816, 4818,
+    4820, 4822, 4824, 4826, 4828, 4830, 4832, 4834, 4836, 4838, 4840, 4842, 4844, 4846, 4848, 4850, 4852, 4854, 4857, 4860,
+    4863, 4865, 4867, 4869, 4871, 4873, 4875, 4877, 4879, 4881, 4883, 4885, 4887, 4889, 4891, 4893, 4895, 4897, 4899, 4901,
+    4903, 4905, 4907, 4909, 4911, 4913, 4915, 4917, 4919, 4921, 4923, 4925, 4927, 4929, 4931, 4933, 4935, 4937, 4939, 4941,
+    4943, 4945, 4947, 4949, 4951, 4953, 4955, 4957, 4959, 4961, 4963, 4965, 4967, 4969, 4971, 4973, 4975, 4977, 4979, 4981,
+    4983, 4985, 4987, 4989, 4991, 4993, 4995, 4997, 4999, 5001, 5003, 5005, 5007, 5009, 5012, 5015, 5018, 5021, 5024, 5027,
+    5030, 5033, 5036, 5039, 5042, 5045, 5048, 5051, 5054, 5057, 5060, 5063, 5066, 5069, 5072, 5075, 5078, 5081, 5084, 5087,
+    5090, 5093, 5096, 5099, 5102, 5105, 5108, 5111, 5114, 5117, 5120, 5123, 5126, 5129, 5132, 5135, 5138, 5141, 5144, 5147,
+    5150, 5153, 5156, 5159, 5162, 5165, 5168, 5171, 5174, 5177, 5180, 5183, 5186, 5189, 5192, 5195, 5198, 5201, 5204, 5207,
+    5210, 5213, 5216, 5219, 5222, 5225, 5228, 5231, 5234, 5237, 5240, 5243, 5246, 5249, 5252, 5255, 5258, 5261, 5264, 5267,
+    5270, 5273, 5276, 5279, 5282, 5285, 5288, 5291, 5294, 5297, 5300, 5303, 5306, 5309, 5312, 5315, 5318, 5321, 5324, 5327,
+    5330, 5333, 5336, 5339, 5342, 5345, 5348, 5351, 5354, 5357, 5360, 5363, 5366, 5369, 5373, 5377, 5381, 5385, 5389, 5393,
+    5397, 5400, 5418, 5426, 5430, 5430, 5430, 5430, 5430, 5430, 5430, 5430, 5430, 5430, 5430, 5430, 5430, 5430, 5430, 5430,
+    5430, 5431, 5432, 5433, 5434, 5435, 5436, 5437, 5438, 5439, 5442, 5444, 5445, 5446, 5447, 5448, 5449, 5450, 5451, 5452,
+    5453, 5454, 5455, 5456, 5457, 5458, 5459, 5460, 5461, 5462, 5463, 5464, 5465, 5466, 5468, 5470, 5472, 5474, 5475, 5476,
+    5477, 5478, 5479, 5480, 5481, 5482, 5483, 5484, 5485, 5486, 5487, 5488, 5489, 5490, 5491, 5492, 5493, 5494, 5495, 5496,
+    5497, 5498, 5499, 5500, 5501, 5502, 5503, 5505, 5507, 5509, 5511, 5513, 5515, 5517, 5519, 5521, 5523, 5525, 5527, 5529,
+    5531, 5532, 5533, 5534, 5535, 5536, 5537, 5538, 5539, 5540, 5541, 5542, 5543, 5544, 5545, 5546, 5547, 5548, 5549, 5550,
+    5551, 5552, 5553, 5554, 5555, 5556, 5557, 5558, 5559, 5560, 5561, 5562, 5563, 5564, 5565, 5566, 5567, 5568, 5569, 5570,
+    5571, 5572, 5573, 5574, 5575, 5576, 5577, 5578, 5579, 5580, 5581, 5582, 5583, 5584, 5585, 5586, 5587, 5588, 5589, 5590,
+    5591, 5592, 5593, 5594, 5595, 5596, 5597, 5598, 5599, 5600, 5601, 5602, 5603, 5604, 5605, 5606, 5607, 5608, 5609, 5610,
+    5611, 5612, 5613, 5614, 5615, 5616, 5617, 5618, 5619, 5620, 5621, 5622, 5623, 5624, 5625, 5626, 5627, 5628, 5629, 5630,
+    5631, 5632, 5633, 5634, 5635, 5636, 5637, 5638, 5639, 5640, 5641, 5642, 5643, 5644, 5645, 5646, 5647, 5648, 5650, 5652,
+    5654, 5656, 5658, 5660, 5662, 5664, 5664, 5665, 5666, 5667, 5668, 5669, 5670, 5671, 5672, 5673, 5674, 5675, 5676, 5677,
+    5678, 5679, 5680, 5681, 5682, 5683, 5684, 5685, 5686, 5687, 5688, 5689, 5690, 5691, 5692, 5693, 5694, 5695, 5696, 5697,
+    5698, 5699, 5700, 5701, 5702, 5703, 5704, 5705, 5706, 5707, 5708, 5709, 5710, 5711, 5712, 5713, 5714, 5715, 5716, 5717,
+    5718, 5719, 5720, 5721, 5722, 5723, 5724, 5725, 5726, 5727, 5728, 5729, 5730, 5731, 5732, 5733, 5734, 5735, 5736, 5737,
+    5738, 5739, 5740, 5741, 5742, 5743, 5744, 5745, 5746, 5747, 5748, 5749, 5750, 5751, 5752, 5753, 5754, 5755, 5756, 5757,
+    5758, 5759, 5760, 5761, 5762, 5763, 5764, 5765, 5766, 5767, 5768, 5769, 5770, 5771, 5772, 5773, 5774, 5775, 5776, 5777,
+    5778, 5779, 5780, 5781, 5782, 5783, 5784, 5785, 5786, 5787, 5788, 5789, 5790, 5791, 5792, 5793, 5794, 5795, 5796, 5797,
+    5798, 5799, 5800, 5801, 5802, 5803, 5804, 5805, 5806, 5807, 5808, 5809, 5810, 5811, 5812, 5813, 5814, 5815, 5816, 5817,
+    5818, 5819, 5820, 5821, 5822, 5823, 5823, 5824, 5825, 5826, 5827, 5828, 5829, 5830, 5831, 5832, 5833, 5834, 5835, 5836,
+    5837, 5838, 5839, 5840, 5841, 5842, 5843, 5844, 5845, 5846, 5847, 5848, 5849, 5850, 5851, 5852, 5853, 5854, 5855, 5856,
+    5857, 5858, 5859, 5860, 5861, 5862, 5863, 5864, 5865, 5866, 5867, 5868, 5869, 5870, 5871, 5872, 5873, 5874, 5875, 5876,
+    5877, 5879, 5880, 5881, 5882, 5883, 5884, 5885, 5886, 5887, 5888, 5889, 5890, 5891, 5892, 5893, 5894, 5895, 5896, 5897,
+    5898, 5899, 5900, 5901, 5902, 5903, 5904, 5905, 5906, 5907, 5908, 5909, 5910, 5911, 5912, 5913, 5914, 5915, 5916, 5917,
+    5918, 5919, 5920, 5921, 5922, 5923, 5924, 5925, 5926, 5927, 5928, 5929, 5930, 5931, 5932, 5933, 5934, 5935, 5936, 5937,
+    5938, 5939, 5940, 5941, 5942, 5943, 5944, 5945, 5946, 5947, 5948, 5949, 5950, 5951, 5952, 5953, 5954, 5955, 5956, 5957,
+    5958, 5959, 5960, 5961, 5962, 5963, 5964, 5965, 5966, 5967, 5968, 5969, 5970, 5971, 5972, 5973, 5974, 5975, 5976, 5977,
+    5978, 5979, 5980, 5981, 5982, 5983, 5984, 5985, 5986, 5987, 5988, 5989, 5990, 5991, 5992, 5993, 5994, 5995, 5996, 5997,
+    5998, 5999, 6000, 6001, 6002, 6003, 6004, 6005, 6006, 6007, 6008, 6009, 6010, 6011, 6012, 6013, 6014, 6015, 6016, 6017,
+    6018, 6019, 6020, 6021, 6022, 6023, 6024, 6025, 6026, 6027, 6028, 6029, 6030, 6031, 6032, 6033, 6034, 6035, 6036, 6037,
+    6038, 6039, 6040, 6041, 6042, 6043, 6044, 6045, 6046, 6047, 6048, 6049, 6050, 6051, 6052, 6053, 6054, 6055, 6056, 6057,
+    6058, 6059, 6060, 6061, 6062, 6063, 6064, 6065, 6066, 6067, 6068, 6069, 6070, 6071, 6072, 6073, 6074, 6075, 6076, 6077,
+    6078, 6079, 6080, 6081, 6082, 6083, 6084, 6085, 6086, 6087, 6088, 6089, 6090, 6091, 6092, 6093, 6094, 6095, 6096, 6097,
+    6098, 6099, 6100, 6101, 6102, 6103, 6104, 6105, 6106, 6107, 6108, 6109, 6110, 6111, 6112, 6113, 6114, 6115, 6116, 6117,
+    6118, 6119, 6120, 6121, 6122, 6123, 6124, 6125, 6126, 6127, 6128, 6129, 6130, 6131, 6132, 6133, 6134, 6135, 6136, 6137,
+    6138, 6139, 6140, 6141, 6142, 6143, 6144, 6145, 6146, 6147, 6148, 6149, 6150, 6151, 6152, 6153, 6154, 6155, 6156, 6157,
+    6158, 6159, 6160, 6161, 6162, 6163, 6164, 6165, 6166, 6167, 6168, 6169, 6170, 6171, 6173, 6175, 6178, 6181, 6184, 6187,
+    6190, 6192, 6194, 6197, 6200, 6203, 6206, 6207, 6208, 6209, 6210, 6211, 6212, 6213, 6214, 6215, 6216, 6217, 6218, 6219,
+    6220, 6221, 6222, 6223, 6224, 6225, 6226, 6227, 6228, 6229, 6230, 6231, 6232, 6233, 6234, 6235, 6236, 6237, 6238, 6239,
+    6240, 6241, 6242, 6243, 6244, 6245, 6246, 6247, 6248, 6249, 6250, 6251, 6252, 6253, 6254, 6255, 6256, 6257, 6258, 6259,
+    6260, 6261, 6262, 6263, 6264, 6265, 6266, 6267, 6268, 6269, 6270, 6271, 6272, 6273, 6274, 6275, 6276, 6277, 6278, 6279,
+    6280, 6281, 6282, 6283, 6284, 6285, 6286, 6287, 6288, 6289, 6290, 6291, 6292, 6293, 6294, 6295, 6296, 6297, 6298, 6299,
+    6300, 6301, 6302, 6303, 6304, 6305, 6306, 6307, 6308, 6309, 6310, 6311, 6312, 6313, 6314, 6315, 6316, 6317, 6318, 6319,
+    6320, 6321, 6322, 6323, 6324, 6325, 6326, 6327, 6328, 6329, 6330, 6331, 6332, 6333, 6334, 6335, 6336, 6337, 6338, 6339,
+    6340, 6341, 6342, 6343, 6344, 6345, 6346, 6347, 6348, 6349, 6350, 6351, 6352, 6353, 6354, 6355, 6356, 6357, 6358, 6359,
+    6360, 6361, 6362, 6363, 6364, 6365, 6366, 6367, 6368, 6369, 6370, 6371, 6372, 6373, 6374, 6375, 6376, 6377, 6378, 6379,
+    6380, 6381, 6382, 6383, 6384, 6385, 6386, 6387, 6388, 6389, 6390, 6391, 6392, 6393, 6394, 6395, 6396, 6397, 6398, 6399,
+    6400, 6401, 6402, 6403, 6404, 6405, 6406, 6407, 6408, 6409, 6410, 6411, 6412, 6413, 6414, 6415, 6416, 6417, 6418, 6419,
+    6420, 6421, 6422, 6423, 6424, 6425, 6426, 6427, 6428, 6429, 6430, 6431, 6432, 6433, 6434, 6435, 6436, 6437, 6438, 6439,
+    6440, 6441, 6442, 6443, 6444, 6445, 6446, 6447, 6448, 6449, 6450, 6451, 6452, 6453, 6454, 6455, 6456, 6457, 6458, 6459,
+    6460, 6461, 6462, 6463, 6464, 6465, 6466, 6467, 6468, 6469, 6470, 6471, 6472, 6473, 6474, 6475, 6476, 6477, 6478, 6479,
+    6480, 6481, 6482, 6483, 6484, 6485, 6486, 6487, 6488, 6489, 6490, 6491, 6492, 6493, 6494, 6495, 6496, 6497, 6498, 6499,
+    6500, 6501, 6502, 6503, 6504, 6505, 6506, 6507, 6508, 6509, 6510, 6511, 6512, 6513, 6514, 6515, 6516, 6517, 6518, 6519,
+    6520, 6521, 6522, 6523, 6524, 6525, 6526, 6527, 6528, 6529, 6530, 6531, 6532, 6533, 6534, 6535, 6536, 6537, 6538, 6539,
+    6540, 6541, 6542, 6543, 6544, 6545, 6546, 6547, 6548, 6549, 6550, 6551, 6552, 6553, 6554, 6555, 6556, 6557, 6558, 6559,
+    6560, 6561, 6562, 6563, 6564, 6565, 6566, 6567, 6568, 6569, 6570, 6571, 6572, 6573, 6574, 6575, 6576, 6577, 6578, 6579,
+    6580, 6581, 6582, 6583, 6584, 6585, 6586, 6587, 6588, 6589, 6590, 6591, 6592, 6593, 6594, 6595, 6596, 6597, 6598, 6599,
+    6600, 6601, 6602, 6603, 6604, 6605, 6606, 6607, 6608, 6609, 6610, 6611, 6612, 6613, 6614, 6615, 6616, 6617, 6618, 6619,
+    6620, 6621, 6622, 6623, 6624, 6625, 6626, 6627, 6628, 6629, 6630, 6631, 6632, 6633, 6634, 6635, 6636, 6637, 6638, 6639,
+    6640, 6641, 6642, 6643, 6644, 6645, 6646, 6647, 6648, 6649, 6650, 6651, 6652, 6653, 6654, 6655, 6656, 6657, 6658, 6659,
+    6660, 6661, 6662, 6663, 6664, 6665, 6666, 6667, 6668, 6669, 6670, 6671, 6672, 6673, 6674, 6675, 6676, 6677, 6678, 6679,
+    6680, 6681, 6682, 6683, 6684, 6685, 6686, 6687, 6688, 6689, 6690, 6691, 6692, 6693, 6694, 6695, 6696, 6697, 6698, 6699,
+    6700, 6701, 6702, 6703, 6704, 6705, 6706, 6707, 6708, 6709, 6710, 6711, 6712, 6713, 6714, 6715, 6716, 6717, 6718, 6719,
+    6720, 6721, 6722, 6723, 6724, 6725, 6726, 6727, 6728, 6729, 6730, 6731, 6732, 6733, 6734, 6735, 6736, 6737, 6738, 6739,
+    6740, 6741, 6742, 6743, 6744, 6745, 6746, 6747, 6748, 6749, 6750, 6751, 6752, 6753, 6754, 6755, 6756, 6757, 6758, 6759,
+    6760, 6761, 6762, 6763, 6764, 6765, 6766, 6767, 6768, 6769, 6770, 6771, 6772, 6773, 6774, 6775, 6776, 6777, 6778, 6779,
+    6780, 6781, 6782, 6783, 6784, 6785, 6786, 6787, 6788, 6789, 6790, 6791, 6792, 6793, 6794, 6795, 6796, 6797, 6798, 6799,
+    6800, 6801, 6802, 6803, 6804, 6805, 6806, 6807, 6808, 6809, 6810, 6811, 6812, 6813, 6814, 6815, 6816, 6817, 6818, 6819,
+    6820, 6821, 6822, 6823, 6824, 6825, 6826, 6827, 6828, 6829, 6830, 6831, 6832, 6833, 6834, 6835, 6836, 6837, 6838, 6839,
+    6840, 6841, 6842, 6843, 6844, 6845, 6846, 6847, 6848, 6849, 6850, 6851, 6852, 6853, 6854, 6855, 6856, 6857, 6858, 6859,
+    6860, 6861, 6862, 6863, 6864, 6865, 6866, 6867, 6868, 6869, 6870, 6871, 6872, 6873, 6874, 6875, 6876, 6877, 6878, 6879,
+    6880, 6881, 6882, 6883, 6884, 6885, 6886, 6887, 6888, 6889, 6890, 6891, 6892, 6893, 6894, 6895, 6896, 6897, 6898, 6899,
+    6900, 6901, 6902, 6903, 6904, 6905, 6906, 6907, 6908, 6909, 6910, 6911, 6912, 6913, 6914, 6915, 6916, 6917, 6918, 6919,
+    6920, 6921, 6922, 6923, 6924, 6925, 6926, 6927, 6928, 6929, 6930, 6931, 6932, 6933, 6934, 6935, 6936, 6937, 6938, 6939,
+    6940, 6941, 6942, 6943, 6944, 6945, 6946, 6947, 6948, 6949, 6950, 6951, 6952, 6953, 6954, 6955, 6956, 6957, 6958, 6959,
+    6960, 6961, 6962, 6963, 6964, 6965, 6966, 6967, 6968, 6969, 6970, 6971, 6972, 6973, 6974, 6975, 6976, 6977, 6978, 6979,
+    6980, 6981, 6982, 6983, 6984, 6985, 6986, 6987, 6988, 6989, 6990, 6991, 6992, 6993, 6994, 6995, 6996, 6997, 6998, 6999,
+    7000, 7001, 7002, 7003, 7004, 7005, 7006, 7007, 7008, 7009, 7010, 7011, 7012, 7013, 7014, 7015, 7016, 7017, 7018, 7019,
+    7020, 7021, 7022, 7023, 7024, 7025, 7026, 7027, 7028, 7029, 7030, 7031, 7032, 7033, 7034, 7035, 7036, 7037, 7038, 7039,
+    7040, 7041, 7042, 7043, 7044, 7045, 7046, 7047, 7048, 7049, 7050, 7051, 7052, 7053, 7054, 7055, 7056, 7057, 7058, 7059,
+    7060, 7061, 7062, 7063, 7064, 7065, 7066, 7067, 7068, 7069, 7070, 7071, 7072, 7073, 7074, 7075, 7076, 7077, 7078, 7079,
+    7080, 7081, 7082, 7083, 7084, 7085, 7086, 7087, 7088, 7089, 7090, 7091, 7092, 7093, 7094, 7095, 7096, 7097, 7098, 7099,
+    7100, 7101, 7102, 7103, 7104, 7105, 7106, 7107, 7108, 7109, 7110, 7111, 7112, 7113, 7114, 7115, 7116, 7117, 7118, 7119,
+    7120, 7121, 7122, 7123, 7124, 7125, 7126, 7127, 7128, 7129, 7130, 7131, 7132, 7133, 7134, 7135, 7136, 7137, 7138, 7139,
+    7140, 7141, 7142, 7143, 7144, 7145, 7146, 7147, 7148, 7149, 7150, 7151, 7152, 7153, 7154, 7155, 7156, 7157, 7158, 7159,
+    7160, 7161, 7162, 7163, 7164, 7165, 7166, 7167, 7168, 7169, 7170, 7171, 7172, 7173, 7174, 7175, 7176, 7177, 7178, 7179,
+    7180, 7181, 7182, 7183, 7184, 7185, 7186, 7187, 7188, 7189, 7190, 7191, 7192, 7193, 7194, 7195, 7196, 7197, 7198, 7199,
+    7200, 7201, 7202, 7203, 7204, 7205, 7206, 7207, 7208, 7209, 7210, 7211, 7212, 7213, 7214, 7215, 7216, 7217, 7218, 7219,
+    7220, 7221, 7222, 7223, 7224, 7225, 7226, 7227, 7228, 7229, 7230, 7231, 7232, 7233, 7234, 7235, 7236, 7237, 7238, 7239,
+    7240, 7241, 7242, 7243, 7244, 7245, 7246, 7247, 7248, 7249, 7250, 7251, 7252, 7253, 7254, 7255, 7256, 7257, 7258, 7259,
+    7260, 7261, 7262, 7263, 7264, 7265, 7266, 7267, 7268, 7269, 7270, 7271, 7272, 7273, 7274, 7275, 7276, 7277, 7278, 7279,
+    7280, 7281, 7282, 7283, 7284, 7285, 7286, 7287, 7288, 7289, 7290, 7291, 7292, 7293, 7294, 7295, 7296, 7297, 7298, 7299,
+    7300, 7301, 7302, 7303, 7304, 7305, 7306, 7307, 7308, 7309, 7310, 7311, 7312, 7313, 7314, 7315, 7316, 7317, 7318, 7319,
+    7320, 7321, 7322, 7323, 7324, 7325, 7326, 7327, 7328, 7329, 7330, 7331, 7332, 7333, 7334, 7335, 7336, 7337, 7338, 7339,
+    7340, 7341, 7342, 7343, 7344, 7345, 7346, 7347, 7348, 7349, 7350, 7351, 7352, 7353, 7354, 7355, 7356, 7357, 7358, 7359,
+    7360, 7361, 7362, 7363, 7364, 7365, 7366, 7367, 7368, 7369, 7370, 7371, 7372, 7373, 7374, 7375, 7376, 7377, 7379, 7381,
+    7383, 7385, 7387, 7389, 7391, 7393, 7395, 7397, 7399, 7402, 7405, 7408, 7411, 7414, 7417, 7420, 7423, 7426, 7429, 7432,
+    7435, 7438, 7441, 7444, 7447, 7450, 7453, 7456, 7459, 7462, 7465, 7468, 7471, 7474, 7477, 7480, 7481, 7482, 7484, 7486,
+    7487, 7488, 7489, 7490, 7491, 7492, 7493, 7494, 7495, 7496, 7497, 7498, 7499, 7500, 7501, 7502, 7503, 7504, 7505, 7506,
+    7507, 7508, 7509, 7510, 7511, 7512, 7514, 7516, 7518, 7520, 7523, 7525, 7527, 7529, 7531, 7533, 7535, 7537, 7538, 7539,
+    7540, 7541, 7542, 7543, 7544, 7545, 7546, 7547, 7548, 7549, 7550, 7551, 7552, 7553, 7554, 7555, 7556, 7557, 7558, 7559,
+    7560, 7561, 7562, 7563, 7564, 7565, 7566, 7567, 7568, 7569, 7570, 7571, 7572, 7573, 7574, 7575, 7576, 7577, 7578, 7579,
+    7580, 7581, 7582, 7585, 7588, 7591, 7594, 7597, 7600, 7603, 7606, 7609, 7610, 7611, 7612, 7613, 7614, 7615, 7616, 7617,
+    7618, 7619, 7620, 7621, 7622, 7623, 7624, 7625, 7626, 7627, 7628, 7629, 7630, 7631, 7632, 7633, 7634, 7635, 7636, 7637,
+    7638, 7639, 7640, 7641, 7642, 7643, 7644, 7645, 7646, 7647, 7648, 7649, 7650, 7651, 7652, 7653, 7654, 7655, 7656, 7657,
+    7658, 7659, 7660, 7661, 7662, 7663, 7664, 7665, 7666, 7667, 7668, 7669, 7670, 7671, 7672, 7673, 7674, 7675, 7676, 7677,
+    7678, 7679, 7680, 7681, 7682, 7683, 7684, 7685, 7686, 7687, 7688, 7689, 7690, 7691, 7692, 7693, 7694, 7695, 7696, 7697,
+    7698, 7699, 7700, 7701, 7702, 7703, 7704, 7705, 7706, 7707, 7708, 7709, 7710, 7711, 7712, 7713, 7714, 7715, 7716, 7717,
+    7718, 7719, 7720, 7721, 7722, 7723, 7724, 7725, 7726, 7727, 7728, 7729, 7730, 7731, 7732, 7733, 7734, 7735, 7736, 7737,
+    7738, 7739, 7740, 7741, 7742, 7743, 7744, 7745, 7746, 7747, 7748, 7749, 7750, 7751, 7752, 7753, 7754, 7755, 7756, 7757,
+    7758, 7759, 7760, 7761, 7762, 7763, 7764, 7765, 7766, 7767, 7768, 7769, 7770, 7771, 7772, 7773, 7774, 7775, 7776, 7777,
+    7778, 7779, 7780, 7781, 7782, 7783, 7784, 7785, 7786, 7787, 7788, 7789, 7790, 7791, 7792, 7793, 7794, 7795, 7796, 7797,
+    7798, 7799, 7800, 7801, 7802, 7803, 7804, 7805, 7806, 7807, 7808, 7809, 7810, 7811, 7812, 7813, 7814, 7815, 7816, 7817,
+    7818, 7819, 7820, 7821, 7822, 7823, 7824, 7825, 7826, 7827, 7828, 7829, 7830, 7831, 7832, 7833, 7834, 7835, 7836, 7837,
+    7838, 7839, 7840, 7841, 7842, 7843, 7844, 7845, 7846, 7847, 7848, 7849, 7850, 7851, 7852, 7853, 7854, 7855, 7856, 7857,
+    7858, 7859, 7860, 7861, 7862, 7863, 7864, 7865, 7866, 7867, 7868, 7869, 7870, 7871, 7872, 7873, 7874, 7875, 7876, 7877,
+    7878, 7879, 7880, 7881, 7882, 7883, 7884, 7885, 7886, 7887, 7888, 7889, 7890, 7891, 7892, 7893, 7894, 7895, 7896, 7897,
+    7898, 7899, 7900, 7901, 7902, 7903, 7904, 7905, 7906, 7907, 7908, 7909, 7910, 7911, 7912, 7913, 7914, 7915, 7916, 7917,
+    7918, 7919, 7920, 7921, 7922, 7923, 7924, 7925, 7926, 7927, 7928, 7929, 7930, 7931, 7932, 7933, 7934, 7935, 7936, 7937,
+    7938, 7939, 7940, 7941, 7942, 7943, 7944, 7945, 7946, 7947, 7948, 7949, 7950, 7951, 7952, 7953, 7954, 7955, 7956, 7957,
+    7958, 7959, 7960, 7961, 7962, 7963, 7964, 7965, 7966, 7967, 7968, 7969, 7970, 7971, 7972, 7973, 7974, 7975, 7976, 7977,
+    7978, 7979, 7980, 7981, 7982, 7983, 7984, 7985, 7986, 7987, 7988, 7989, 7990, 7991, 7992, 7993, 7994, 7995, 7996, 7997,
+    7998, 7999, 8000, 8001, 8002, 8003, 8004, 8005, 8006, 8007, 8008, 8009, 8010, 8011, 8012, 8013, 8014, 8015, 8016, 8017,
+    8018, 8019, 8020, 8021, 8022, 8023, 8024, 8025, 8026, 8027, 8028, 8029, 8030, 8031, 8032, 8033, 8034, 8035, 8036, 8037,
+    8038, 8039, 8040, 8041, 8042, 8043, 8044, 8045, 8046, 8047, 8048, 8049, 8050, 8051, 8052, 8053, 8054, 8055, 8056, 8057,
+    8058, 8059, 8060, 8061, 8062, 8063, 8064, 8065, 8066, 8067, 8068, 8069, 8070, 8071, 8072, 8073, 8074, 8075, 8076, 8077,
+    8078, 8079, 8080, 8081, 8082, 8083, 8084, 8085, 8086, 8087, 8088, 8089, 8090, 8091, 8092, 8093, 8094, 8095, 8096, 8097,
+    8098, 8099, 8100, 8101, 8102, 8103, 8104, 8105, 8106, 8107, 8108, 8109, 8110, 8111, 8112, 8113, 8114, 8115, 8116, 8117,
+    8118, 8119, 8120, 8121, 8122, 8123, 8124, 8125, 8126, 8127, 8128, 8129, 8130, 8131, 8132, 8133, 8134, 8135, 8136, 8137,
+    8138, 8139, 8140, 8141, 8142, 8143, 8144, 8145, 8146, 8147, 8148, 8149, 8150, 8151, 8152, 8153, 8154, 8155, 8156, 8157,
+    8158, 8159, 8160, 8161, 8162, 8163,
+};
+
+constexpr std::uint32_t kFoldCodePoints[] = {
+    0x20, 0x20, 0x308, 0x61, 0x20, 0x304, 0x32, 0x33, 0x20, 0x301, 0x3BC, 0x20,
+    0x327, 0x31, 0x6F, 0x31, 0x2044, 0x34, 0x31, 0x2044, 0x32, 0x33, 0x2044, 0x34,
+    0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB,
+    0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF8,
+    0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0x73, 0x73, 0x101, 0x103, 0x105, 0x107,
+    0x109, 0x10B, 0x10D, 0x10F, 0x111, 0x113, 0x115, 0x117, 0x119, 0x11B, 0x11D, 0x11F,
+    0x121, 0x123, 0x125, 0x127, 0x129, 0x12B, 0x12D, 0x12F, 0x69, 0x307, 0x69, 0x6A,
+    0x69, 0x6A, 0x135, 0x137, 0x13A, 0x13C, 0x13E, 0x6C, 0xB7, 0x6C, 0xB7, 0x142,
+    0x144, 0x146, 0x148, 0x2BC, 0x6E, 0x14B, 0x14D, 0x14F, 0x151, 0x153, 0x155, 0x157,
+    0x159, 0x15B, 0x15D, 0x15F, 0x161, 0x163, 0x165, 0x167, 0x169, 0x16B, 0x16D, 0x16F,
+    0x171, 0x173, 0x175, 0x177, 0xFF, 0x17A, 0x17C, 0x17E, 0x73, 0x253, 0x183, 0x185,
+    0x254, 0x188, 0x256, 0x257, 0x18C, 0x1DD, 0x259, 0x25B, 0x192, 0x260, 0x263, 0x269,
+    0x268, 0x199, 0x26F, 0x272, 0x275, 0x1A1, 0x1A3, 0x1A5, 0x280, 0x1A8, 0x283, 0x1AD,
+    0x288, 0x1B0, 0x28A, 0x28B, 0x1B4, 0x1B6, 0x292, 0x1B9, 0x1BD, 0x64, 0x17E, 0x64,
+    0x17E, 0x64, 0x17E, 0x6C, 0x6A, 0x6C, 0x6A, 0x6C, 0x6A, 0x6E, 0x6A, 0x6E,
+    0x6A, 0x6E, 0x6A, 0x1CE, 0x1D0, 0x1D2, 0x1D4, 0x1D6, 0x1D8, 0x1DA, 0x1DC, 0x1DF,
+    0x1E1, 0x1E3, 0x1E5, 0x1E7, 0x1E9, 0x1EB, 0x1ED, 0x1EF, 0x64, 0x7A, 0x64, 0x7A,
+    0x64, 0x7A, 0x1F5, 0x195, 0x1BF, 0x1F9, 0x1FB, 0x1FD, 0x1FF, 0x201, 0x203, 0x205,
+    0x207, 0x209, 0x20B, 0x20D, 0x20F, 0x211, 0x213, 0x215, 0x217, 0x219, 0x21B, 0x21D,
+    0x21F, 0x19E, 0x223, 0x225, 0x227, 0x229, 0x22B, 0x22D, 0x22F, 0x231, 0x233, 0x2C65,
+    0x23C, 0x19A, 0x2C66, 0x242, 0x180, 0x289, 0x28C, 0x247, 0x249, 0x24B, 0x24D, 0x24F,
+    0x68, 0x266, 0x6A, 0x72, 0x279, 0x27B, 0x281, 0x77, 0x79, 0x20, 0x306, 0x20,
+    0x307, 0x20, 0x30A, 0x20, 0x328, 0x20, 0x303, 0x20, 0x30B, 0x263, 0x6C, 0x73,
+    0x78, 0x295, 0x300, 0x301, 0x313, 0x308, 0x301, 0x3B9, 0x371, 0x373, 0x2B9, 0x377,
+    0x20, 0x3B9, 0x3B, 0x3F3, 0x20, 0x301, 0x20, 0x308, 0x301, 0x3AC, 0xB7, 0x3AD,
+    0x3AE, 0x3AF, 0x3CC, 0x3CD, 0x3CE, 0x3B1, 0x3B2, 0x3B3, 0x3B4, 0x3B5, 0x3B6, 0x3B7,
+    0x3B8, 0x3B9, 0x3BA, 0x3BB, 0x3BC, 0x3BD, 0x3BE, 0x3BF, 0x3C0, 0x3C1, 0x3C3, 0x3C4,
+    0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x3CA, 0x3CB, 0x3C3, 0x3D7, 0x3B2, 0x3B8, 0x3C5,
+    0x3CD, 0x3CB, 0x3C6, 0x3C0, 0x3D9, 0x3DB, 0x3DD, 0x3DF, 0x3E1, 0x3E3, 0x3E5, 0x3E7,
+    0x3E9, 0x3EB, 0x3ED, 0x3EF, 0x3BA, 0x3C1, 0x3C3, 0x3B8, 0x3B5, 0x3F8, 0x3C3, 0x3FB,
+    0x37B, 0x37C, 0x37D, 0x450, 0x451, 0x452, 0x453, 0x454, 0x455, 0x456, 0x457, 0x458,
+    0x459, 0x45A, 0x45B, 0x45C, 0x45D, 0x45E, 0x45F, 0x430, 0x431, 0x432, 0x433, 0x434,
+    0x435, 0x436, 0x437, 0x438, 0x439, 0x43A, 0x43B, 0x43C, 0x43D, 0x43E, 0x43F, 0x440,
+    0x441, 0x442, 0x443, 0x444, 0x445, 0x446, 0x447, 0x448, 0x449, 0x44A, 0x44B, 0x44C,
+    0x44D, 0x44E, 0x44F, 0x461, 0x463, 0x465, 0x467, 0x469, 0x46B, 0x46D, 0x46F, 0x471,
+    0x473, 0x475, 0x477, 0x479, 0x47B, 0x47D, 0x47F, 0x481, 0x48B, 0x48D, 0x48F, 0x491,
+    0x493, 0x495, 0x497, 0x499, 0x49B, 0x49D, 0x49F, 0x4A1, 0x4A3, 0x4A5, 0x4A7, 0x4A9,
+    0x4AB, 0x4AD, 0x4AF, 0x4B1, 0x4B3, 0x4B5, 0x4B7, 0x4B9, 0x4BB, 0x4BD, 0x4BF, 0x4CF,
+    0x4C2, 0x4C4, 0x4C6, 0x4C8, 0x4CA, 0x4CC, 0x4CE, 0x4D1, 0x4D3, 0x4D5, 0x4D7, 0x4D9,
+    0x4DB, 0x4DD, 0x4DF, 0x4E1, 0x4E3, 0x4E5, 0x4E7, 0x4E9, 0x4EB, 0x4ED, 0x4EF, 0x4F1,
+    0x4F3, 0x4F5, 0x4F7, 0x4F9, 0x4FB, 0x4FD, 0x4FF, 0x501, 0x503, 0x505, 0x507, 0x509,
+    0x50B, 0x50D, 0x50F, 0x511, 0x513, 0x515, 0x517, 0x519, 0x51B, 0x51D, 0x51F, 0x521,
+    0x523, 0x525, 0x527, 0x529, 0x52B, 0x52D, 0x52F, 0x561, 0x562, 0x563, 0x564, 0x565,
+    0x566, 0x567, 0x568, 0x569, 0x56A, 0x56B, 0x56C, 0x56D, 0x56E, 0x56F, 0x570, 0x571,
+    0x572, 0x573, 0x574, 0x575, 0x576, 0x577, 0x578, 0x579, 0x57A, 0x57B, 0x57C, 0x57D,
+    0x57E, 0x57F, 0x580, 0x581, 0x582, 0x583, 0x584, 0x585, 0x586, 0x565, 0x582, 0x627,
+    0x674, 0x648, 0x674, 0x6C7, 0x674, 0x64A, 0x674, 0x915, 0x93C, 0x916, 0x93C, 0x917,
+    0x93C, 0x91C, 0x93C, 0x921, 0x93C, 0x922, 0x93C, 0x92B, 0x93C, 0x92F, 0x93C, 0x9A1,
+    0x9BC, 0x9A2, 0x9BC, 0x9AF, 0x9BC, 0xA32, 0xA3C, 0xA38, 0xA3C, 0xA16, 0xA3C, 0xA17,
+    0xA3C, 0xA1C, 0xA3C, 0xA2B, 0xA3C, 0xB21, 0xB3C, 0xB22, 0xB3C, 0xE4D, 0xE32, 0xECD,
+    0xEB2, 0xEAB, 0xE99, 0xEAB, 0xEA1, 0xF0B, 0xF42, 0xFB7, 0xF4C, 0xFB7, 0xF51, 0xFB7,
+    0xF56, 0xFB7, 0xF5B, 0xFB7, 0xF40, 0xFB5, 0xF71, 0xF72, 0xF71, 0xF74, 0xFB2, 0xF80,
+    0xFB2, 0xF71, 0xF80, 0xFB3, 0xF80, 0xFB3, 0xF71, 0xF80, 0xF71, 0xF80, 0xF92, 0xFB7,
+    0xF9C, 0xFB7, 0xFA1, 0xFB7, 0xFA6, 0xFB7, 0xFAB, 0xFB7, 0xF90, 0xFB5, 0x2D00, 0x2D01,
+    0x2D02, 0x2D03, 0x2D04, 0x2D05, 0x2D06, 0x2D07, 0x2D08, 0x2D09, 0x2D0A, 0x2D0B, 0x2D0C, 0x2D0D,
+    0x2D0E, 0x2D0F, 0x2D10, 0x2D11, 0x2D12, 0x2D13, 0x2D14, 0x2D15, 0x2D16, 0x2D17, 0x2D18, 0x2D19,
+    0x2D1A, 0x2D1B, 0x2D1C, 0x2D1D, 0x2D1E, 0x2D1F, 0x2D20, 0x2D21, 0x2D22, 0x2D23, 0x2D24, 0x2D25,
+    0x2D27, 0x2D2D, 0x10DC, 0x13F0, 0x13F1, 0x13F2, 0x13F3, 0x13F4, 0x13F5, 0x432, 0x434, 0x43E,
+    0x441, 0x442, 0x442, 0x44A, 0x463, 0xA64B, 0x10D0, 0x10D1, 0x10D2, 0x10D3, 0x10D4, 0x10D5,
+    0x10D6, 0x10D7, 0x10D8, 0x10D9, 0x10DA, 0x10DB, 0x10DC, 0x10DD, 0x10DE, 0x10DF, 0x10E0, 0x10E1,
+    0x10E2, 0x10E3, 0x10E4, 0x10E5, 0x10E6, 0x10E7, 0x10E8, 0x10E9, 0x10EA, 0x10EB, 0x10EC, 0x10ED,
+    0x10EE, 0x10EF, 0x10F0, 0x10F1, 0x10F2, 0x10F3, 0x10F4, 0x10F5, 0x10F6, 0x10F7, 0x10F8, 0x10F9,
+    0x10FA, 0x10FD, 0x10FE, 0x10FF, 0x61, 0xE6, 0x62, 0x64, 0x65, 0x1DD, 0x67, 0x68,
+    0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x223, 0x70, 0x72, 0x74, 0x75,
+    0x77, 0x61, 0x250, 0x251, 0x1D02, 0x62, 0x64, 0x65, 0x259, 0x25B, 0x25C, 0x67,
+    0x6B, 0x6D, 0x14B, 0x6F, 0x254, 0x1D16, 0x1D17, 0x70, 0x74, 0x75, 0x1D1D, 0x26F,
+    0x76, 0x1D25, 0x3B2, 0x3B3, 0x3B4, 0x3C6, 0x3C7, 0x69, 0x72, 0x75, 0x76, 0x3B2,
+    0x3B3, 0x3C1, 0x3C6, 0x3C7, 0x43D, 0x252, 0x63, 0x255, 0xF0, 0x25C, 0x66, 0x25F,
+    0x261, 0x265, 0x268, 0x269, 0x26A, 0x1D7B, 0x29D, 0x26D, 0x1D85, 0x29F, 0x271, 0x270,
+    0x272, 0x273, 0x274, 0x275, 0x278, 0x282, 0x283, 0x1AB, 0x289, 0x28A, 0x1D1C, 0x28B,
+    0x28C, 0x7A, 0x290, 0x291, 0x292, 0x3B8, 0x1E01, 0x1E03, 0x1E05, 0x1E07, 0x1E09, 0x1E0B,
+    0x1E0D, 0x1E0F, 0x1E11, 0x1E13, 0x1E15, 0x1E17, 0x1E19, 0x1E1B, 0x1E1D, 0x1E1F, 0x1E21, 0x1E23,
+    0x1E25, 0x1E27, 0x1E29, 0x1E2B, 0x1E2D, 0x1E2F, 0x1E31, 0x1E33, 0x1E35, 0x1E37, 0x1E39, 0x1E3B,
+    0x1E3D, 0x1E3F, 0x1E41, 0x1E43, 0x1E45, 0x1E47, 0x1E49, 0x1E4B, 0x1E4D, 0x1E4F, 0x1E51, 0x1E53,
+    0x1E55, 0x1E57, 0x1E59, 0x1E5B, 0x1E5D, 0x1E5F, 0x1E61, 0x1E63, 0x1E65, 0x1E67, 0x1E69, 0x1E6B,
+    0x1E6D, 0x1E6F, 0x1E71, 0x1E73, 0x1E75, 0x1E77, 0x1E79, 0x1E7B, 0x1E7D, 0x1E7F, 0x1E81, 0x1E83,
+    0x1E85, 0x1E87, 0x1E89, 0x1E8B, 0x1E8D, 0x1E8F, 0x1E91, 0x1E93, 0x1E95, 0x61, 0x2BE, 0x1E61,
+    0x73, 0x73, 0x1EA1, 0x1EA3, 0x1EA5, 0x1EA7, 0x1EA9, 0x1EAB, 0x1EAD, 0x1EAF, 0x1EB1, 0x1EB3,
+    0x1EB5, 0x1EB7, 0x1EB9, 0x1EBB, 0x1EBD, 0x1EBF, 0x1EC1, 0x1EC3, 0x1EC5, 0x1EC7, 0x1EC9, 0x1ECB,
+    0x1ECD, 0x1ECF, 0x1ED1, 0x1ED3, 0x1ED5, 0x1ED7, 0x1ED9, 0x1EDB, 0x1EDD, 0x1EDF, 0x1EE1, 0x1EE3,
+    0x1EE5, 0x1EE7, 0x1EE9, 0x1EEB, 0x1EED, 0x1EEF, 0x1EF1, 0x1EF3, 0x1EF5, 0x1EF7, 0x1EF9, 0x1EFB,
+    0x1EFD, 0x1EFF, 0x1F00, 0x1F01, 0x1F02, 0x1F03, 0x1F04, 0x1F05, 0x1F06, 0x1F07, 0x1F10, 0x1F11,
+    0x1F12, 0x1F13, 0x1F14, 0x1F15, 0x1F20, 0x1F21, 0x1F22, 0x1F23, 0x1F24, 0x1F25, 0x1F26, 0x1F27,
+    0x1F30, 0x1F31, 0x1F32, 0x1F33, 0x1F34, 0x1F35, 0x1F36, 0x1F37, 0x1F40, 0x1F41, 0x1F42, 0x1F43,
+    0x1F44, 0x1F45, 0x1F51, 0x1F53, 0x1F55, 0x1F57, 0x1F60, 0x1F61, 0x1F62, 0x1F63, 0x1F64, 0x1F65,
+    0x1F66, 0x1F67, 0x3AC, 0x3AD, 0x3AE, 0x3AF, 0x3CC, 0x3CD, 0x3CE, 0x1F00, 0x3B9, 0x1F01,
+    0x3B9, 0x1F02, 0x3B9, 0x1F03, 0x3B9, 0x1F04, 0x3B9, 0x1F05, 0x3B9, 0x1F06, 0x3B9, 0x1F07,
+    0x3B9, 0x1F00, 0x3B9, 0x1F01, 0x3B9, 0x1F02, 0x3B9, 0x1F03, 0x3B9, 0x1F04, 0x3B9, 0x1F05,
+    0x3B9, 0x1F06, 0x3B9, 0x1F07, 0x3B9, 0x1F20, 0x3B9, 0x1F21, 0x3B9, 0x1F22, 0x3B9, 0x1F23,
+    0x3B9, 0x1F24, 0x3B9, 0x1F25, 0x3B9, 0x1F26, 0x3B9, 0x1F27, 0x3B9, 0x1F20, 0x3B9, 0x1F21,
+    0x3B9, 0x1F22, 0x3B9, 0x1F23, 0x3B9, 0x1F24, 0x3B9, 0x1F25, 0x3B9, 0x1F26, 0x3B9, 0x1F27,
+    0x3B9, 0x1F60, 0x3B9, 0x1F61, 0x3B9, 0x1F62, 0x3B9, 0x1F63, 0x3B9, 0x1F64, 0x3B9, 0x1F65,
+    0x3B9, 0x1F66, 0x3B9, 0x1F67, 0x3B9, 0x1F60, 0x3B9, 0x1F61, 0x3B9, 0x1F62, 0x3B9, 0x1F63,
+    0x3B9, 0x1F64, 0x3B9, 0x1F65, 0x3B9, 0x1F66, 0x3B9, 0x1F67, 0x3B9, 0x1F70, 0x3B9, 0x3B1,
+    0x3B9, 0x3AC, 0x3B9, 0x1FB6, 0x3B9, 0x1FB0, 0x1FB1, 0x1F70, 0x3AC, 0x3B1, 0x3B9, 0x20,
+    0x313, 0x3B9, 0x20, 0x313, 0x20, 0x342, 0x20, 0x308, 0x342, 0x1F74, 0x3B9, 0x3B7,
+    0x3B9, 0x3AE, 0x3B9, 0x1FC6, 0x3B9, 0x1F72, 0x3AD, 0x1F74, 0x3AE, 0x3B7, 0x3B9, 0x20,
+    0x313, 0x300, 0x20, 0x313, 0x301, 0x20, 0x313, 0x342, 0x390, 0x1FD0, 0x1FD1, 0x1F76,
+    0x3AF, 0x20, 0x314, 0x300, 0x20, 0x314, 0x301, 0x20, 0x314, 0x342, 0x3B0, 0x1FE0,
+    0x1FE1, 0x1F7A, 0x3CD, 0x1FE5, 0x20, 0x308, 0x300, 0x20, 0x308, 0x301, 0x60, 0x1F7C,
+    0x3B9, 0x3C9, 0x3B9, 0x3CE, 0x3B9, 0x1FF6, 0x3B9, 0x1F78, 0x3CC, 0x1F7C, 0x3CE, 0x3C9,
+    0x3B9, 0x20, 0x301, 0x20, 0x314, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x2010, 0x20, 0x333, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x20, 0x2032, 0x2032, 0x2032, 0x2032, 0x2032, 0x2035, 0x2035, 0x2035, 0x2035, 0x2035,
+    0x21, 0x21, 0x20, 0x305, 0x3F, 0x3F, 0x3F, 0x21, 0x21, 0x3F, 0x2032, 0x2032,
+    0x2032, 0x2032, 0x20, 0x30, 0x69, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x2B,
+    0x2212, 0x3D, 0x28, 0x29, 0x6E, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+    0x37, 0x38, 0x39, 0x2B, 0x2212, 0x3D, 0x28, 0x29, 0x61, 0x65, 0x6F, 0x78,
+    0x259, 0x68, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x73, 0x74, 0x72, 0x73, 0x61,
+    0x2F, 0x63, 0x61, 0x2F, 0x73, 0x63, 0xB0, 0x63, 0x63, 0x2F, 0x6F, 0x63,
+    0x2F, 0x75, 0x25B, 0xB0, 0x66, 0x67, 0x68, 0x68, 0x68, 0x68, 0x127, 0x69,
+    0x69, 0x6C, 0x6C, 0x6E, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x72, 0x72, 0x73,
+    0x6D, 0x74, 0x65, 0x6C, 0x74, 0x6D, 0x7A, 0x3C9, 0x7A, 0x6B, 0xE5, 0x62,
+    0x63, 0x65, 0x65, 0x66, 0x214E, 0x6D, 0x6F, 0x5D0, 0x5D1, 0x5D2, 0x5D3, 0x69,
+    0x66, 0x61, 0x78, 0x3C0, 0x3B3, 0x3B3, 0x3C0, 0x2211, 0x64, 0x64, 0x65, 0x69,
+    0x6A, 0x31, 0x2044, 0x37, 0x31, 0x2044, 0x39, 0x31, 0x2044, 0x31, 0x30, 0x31,
+    0x2044, 0x33, 0x32, 0x2044, 0x33, 0x31, 0x2044, 0x35, 0x32, 0x2044, 0x35, 0x33,
+    0x2044, 0x35, 0x34, 0x2044, 0x35, 0x31, 0x2044, 0x36, 0x35, 0x2044, 0x36, 0x31,
+    0x2044, 0x38, 0x33, 0x2044, 0x38, 0x35, 0x2044, 0x38, 0x37, 0x2044, 0x38, 0x31,
+    0x2044, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x76, 0x76, 0x76, 0x69,
+    0x76, 0x69, 0x69, 0x76, 0x69, 0x69, 0x69, 0x69, 0x78, 0x78, 0x78, 0x69,
+    0x78, 0x69, 0x69, 0x6C, 0x63, 0x64, 0x6D, 0x69, 0x69, 0x69, 0x69, 0x69,
+    0x69, 0x69, 0x76, 0x76, 0x76, 0x69, 0x76, 0x69, 0x69, 0x76, 0x69, 0x69,
+    0x69, 0x69, 0x78, 0x78, 0x78, 0x69, 0x78, 0x69, 0x69, 0x6C, 0x63, 0x64,
+    0x6D, 0x2184, 0x30, 0x2044, 0x33, 0x222B, 0x222B, 0x222B, 0x222B, 0x222B, 0x222E, 0x222E,
+    0x222E, 0x222E, 0x222E, 0x3008, 0x3009, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x31, 0x30, 0x31, 0x31, 0x31, 0x32, 0x31, 0x33, 0x31, 0x34,
+    0x31, 0x35, 0x31, 0x36, 0x31, 0x37, 0x31, 0x38, 0x31, 0x39, 0x32, 0x30,
+    0x28, 0x31, 0x29, 0x28, 0x32, 0x29, 0x28, 0x33, 0x29, 0x28, 0x34, 0x29,
+    0x28, 0x35, 0x29, 0x28, 0x36, 0x29, 0x28, 0x37, 0x29, 0x28, 0x38, 0x29,
+    0x28, 0x39, 0x29, 0x28, 0x31, 0x30, 0x29, 0x28, 0x31, 0x31, 0x29, 0x28,
+    0x31, 0x32, 0x29, 0x28, 0x31, 0x33, 0x29, 0x28, 0x31, 0x34, 0x29, 0x28,
+    0x31, 0x35, 0x29, 0x28, 0x31, 0x36, 0x29, 0x28, 0x31, 0x37, 0x29, 0x28,
+    0x31, 0x38, 0x29, 0x28, 0x31, 0x39, 0x29, 0x28, 0x32, 0x30, 0x29, 0x31,
+    0x2E, 0x32, 0x2E, 0x33, 0x2E, 0x34, 0x2E, 0x35, 0x2E, 0x36, 0x2E, 0x37,
+    0x2E, 0x38, 0x2E, 0x39, 0x2E, 0x31, 0x30, 0x2E, 0x31, 0x31, 0x2E, 0x31,
+    0x32, 0x2E, 0x31, 0x33, 0x2E, 0x31, 0x34, 0x2E, 0x31, 0x35, 0x2E, 0x31,
+    0x36, 0x2E, 0x31, 0x37, 0x2E, 0x31, 0x38, 0x2E, 0x31, 0x39, 0x2E, 0x32,
+    0x30, 0x2E, 0x28, 0x61, 0x29, 0x28, 0x62, 0x29, 0x28, 0x63, 0x29, 0x28,
+    0x64, 0x29, 0x28, 0x65, 0x29, 0x28, 0x66, 0x29, 0x28, 0x67, 0x29, 0x28,
+    0x68, 0x29, 0x28, 0x69, 0x29, 0x28, 0x6A, 0x29, 0x28, 0x6B, 0x29, 0x28,
+    0x6C, 0x29, 0x28, 0x6D, 0x29, 0x28, 0x6E, 0x29, 0x28, 0x6F, 0x29, 0x28,
+    0x70, 0x29, 0x28, 0x71, 0x29, 0x28, 0x72, 0x29, 0x28, 0x73, 0x29, 0x28,
+    0x74, 0x29, 0x28, 0x75, 0x29, 0x28, 0x76, 0x29, 0x28, 0x77, 0x29, 0x28,
+    0x78, 0x29, 0x28, 0x79, 0x29, 0x28, 0x7A, 0x29, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+    0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
+    0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A,
+    0x30, 0x222B, 0x222B, 0x222B, 0x222B, 0x3A, 0x3A, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+    0x3D, 0x2ADD, 0x338, 0x2C30, 0x2C31, 0x2C32, 0x2C33, 0x2C34, 0x2C35, 0x2C36, 0x2C37, 0x2C38,
+    0x2C39, 0x2C3A, 0x2C3B, 0x2C3C, 0x2C3D, 0x2C3E, 0x2C3F, 0x2C40, 0x2C41, 0x2C42, 0x2C43, 0x2C44,
+    0x2C45, 0x2C46, 0x2C47, 0x2C48, 0x2C49, 0x2C4A, 0x2C4B, 0x2C4C, 0x2C4D, 0x2C4E, 0x2C4F, 0x2C50,
+    0x2C51, 0x2C52, 0x2C53, 0x2C54, 0x2C55, 0x2C56, 0x2C57, 0x2C58, 0x2C59, 0x2C5A, 0x2C5B, 0x2C5C,
+    0x2C5D, 0x2C5E, 0x2C5F, 0x2C61, 0x26B, 0x1D7D, 0x27D, 0x2C68, 0x2C6A, 0x2C6C, 0x251, 0x271,
+    0x250, 0x252, 0x2C73, 0x2C76, 0x6A, 0x76, 0x23F, 0x240, 0x2C81, 0x2C83, 0x2C85, 0x2C87,
+    0x2C89, 0x2C8B, 0x2C8D, 0x2C8F, 0x2C91, 0x2C93, 0x2C95, 0x2C97, 0x2C99, 0x2C9B, 0x2C9D, 0x2C9F,
+    0x2CA1, 0x2CA3, 0x2CA5, 0x2CA7, 0x2CA9, 0x2CAB, 0x2CAD, 0x2CAF, 0x2CB1, 0x2CB3, 0x2CB5, 0x2CB7,
+    0x2CB9, 0x2CBB, 0x2CBD, 0x2CBF, 0x2CC1, 0x2CC3, 0x2CC5, 0x2CC7, 0x2CC9, 0x2CCB, 0x2CCD, 0x2CCF,
+    0x2CD1, 0x2CD3, 0x2CD5, 0x2CD7, 0x2CD9, 0x2CDB, 0x2CDD, 0x2CDF, 0x2CE1, 0x2CE3, 0x2CEC, 0x2CEE,
+    0x2CF3, 0x2D61, 0x6BCD, 0x9F9F, 0x4E00, 0x4E28, 0x4E36, 0x4E3F, 0x4E59, 0x4E85, 0x4E8C, 0x4EA0,
+    0x4EBA, 0x513F, 0x5165, 0x516B, 0x5182, 0x5196, 0x51AB, 0x51E0, 0x51F5, 0x5200, 0x529B, 0x52F9,
+    0x5315, 0x531A, 0x5338, 0x5341, 0x535C, 0x5369, 0x5382, 0x53B6, 0x53C8, 0x53E3, 0x56D7, 0x571F,
+    0x58EB, 0x5902, 0x590A, 0x5915, 0x5927, 0x5973, 0x5B50, 0x5B80, 0x5BF8, 0x5C0F, 0x5C22, 0x5C38,
+    0x5C6E, 0x5C71, 0x5DDB, 0x5DE5, 0x5DF1, 0x5DFE, 0x5E72, 0x5E7A, 0x5E7F, 0x5EF4, 0x5EFE, 0x5F0B,
+    0x5F13, 0x5F50, 0x5F61, 0x5F73, 0x5FC3, 0x6208, 0x6236, 0x624B, 0x652F, 0x6534, 0x6587, 0x6597,
+    0x65A4, 0x65B9, 0x65E0, 0x65E5, 0x66F0, 0x6708, 0x6728, 0x6B20, 0x6B62, 0x6B79, 0x6BB3, 0x6BCB,
+    0x6BD4, 0x6BDB, 0x6C0F, 0x6C14, 0x6C34, 0x706B, 0x722A, 0x7236, 0x723B, 0x723F, 0x7247, 0x7259,
+    0x725B, 0x72AC, 0x7384, 0x7389, 0x74DC, 0x74E6, 0x7518, 0x751F, 0x7528, 0x7530, 0x758B, 0x7592,
+    0x7676, 0x767D, 0x76AE, 0x76BF, 0x76EE, 0x77DB, 0x77E2, 0x77F3, 0x793A, 0x79B8, 0x79BE, 0x7A74,
+    0x7ACB, 0x7AF9, 0x7C73, 0x7CF8, 0x7F36, 0x7F51, 0x7F8A, 0x7FBD, 0x8001, 0x800C, 0x8012, 0x8033,
+    0x807F, 0x8089, 0x81E3, 0x81EA, 0x81F3, 0x81FC, 0x820C, 0x821B, 0x821F, 0x826E, 0x8272, 0x8278,
+    0x864D, 0x866B, 0x8840, 0x884C, 0x8863, 0x897E, 0x898B, 0x89D2, 0x8A00, 0x8C37, 0x8C46, 0x8C55,
+    0x8C78, 0x8C9D, 0x8D64, 0x8D70, 0x8DB3, 0x8EAB, 0x8ECA, 0x8F9B, 0x8FB0, 0x8FB5, 0x9091, 0x9149,
+    0x91C6, 0x91CC, 0x91D1, 0x9577, 0x9580, 0x961C, 0x96B6, 0x96B9, 0x96E8, 0x9751, 0x975E, 0x9762,
+    0x9769, 0x97CB, 0x97ED, 0x97F3, 0x9801, 0x98A8, 0x98DB, 0x98DF, 0x9996, 0x9999, 0x99AC, 0x9AA8,
+    0x9AD8, 0x9ADF, 0x9B25, 0x9B2F, 0x9B32, 0x9B3C, 0x9B5A, 0x9CE5, 0x9E75, 0x9E7F, 0x9EA5, 0x9EBB,
+    0x9EC3, 0x9ECD, 0x9ED1, 0x9EF9, 0x9EFD, 0x9F0E, 0x9F13, 0x9F20, 0x9F3B, 0x9F4A, 0x9F52, 0x9F8D,
+    0x9F9C, 0x9FA0, 0x20, 0x3012, 0x5341, 0x5344, 0x5345, 0x20, 0x3099, 0x20, 0x309A, 0x3088,
+    0x308A, 0x30B3, 0x30C8, 0x1100, 0x1101, 0x11AA, 0x1102, 0x11AC, 0x11AD, 0x1103, 0x1104, 0x1105,
+    0x11B0, 0x11B1, 0x11B2, 0x11B3, 0x11B4, 0x11B5, 0x111A, 0x1106, 0x1107, 0x1108, 0x1121, 0x1109,
+    0x110A, 0x110B, 0x110C, 0x110D, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0x1161, 0x1162, 0x1163,
+    0x1164, 0x1165, 0x1166, 0x1167, 0x1168, 0x1169, 0x116A, 0x116B, 0x116C, 0x116D, 0x116E, 0x116F,
+    0x1170, 0x1171, 0x1172, 0x1173, 0x1174, 0x1175, 0x1114, 0x1115, 0x11C7, 0x11C8, 0x11CC, 0x11CE,
+    0x11D3, 0x11D7, 0x11D9, 0x111C, 0x11DD, 0x11DF, 0x111D, 0x111E, 0x1120, 0x1122, 0x1123, 0x1127,
+    0x1129, 0x112B, 0x112C, 0x112D, 0x112E, 0x112F, 0x1132, 0x1136, 0x1140, 0x1147, 0x114C, 0x11F1,
+    0x11F2, 0x1157, 0x1158, 0x1159, 0x1184, 0x1185, 0x1188, 0x1191, 0x1192, 0x1194, 0x119E, 0x11A1,
+    0x4E00, 0x4E8C, 0x4E09, 0x56DB, 0x4E0A, 0x4E2D, 0x4E0B, 0x7532, 0x4E59, 0x4E19, 0x4E01, 0x5929,
+    0x5730, 0x4EBA, 0x28, 0x1100, 0x29, 0x28, 0x1102, 0x29, 0x28, 0x1103, 0x29, 0x28,
+    0x1105, 0x29, 0x28, 0x1106, 0x29, 0x28, 0x1107, 0x29, 0x28, 0x1109, 0x29, 0x28,
+    0x110B, 0x29, 0x28, 0x110C, 0x29, 0x28, 0x110E, 0x29, 0x28, 0x110F, 0x29, 0x28,
+    0x1110, 0x29, 0x28, 0x1111, 0x29, 0x28, 0x1112, 0x29, 0x28, 0xAC00, 0x29, 0x28,
+    0xB098, 0x29, 0x28, 0xB2E4, 0x29, 0x28, 0xB77C, 0x29, 0x28, 0xB9C8, 0x29, 0x28,
+    0xBC14, 0x29, 0x28, 0xC0AC, 0x29, 0x28, 0xC544, 0x29, 0x28, 0xC790, 0x29, 0x28,
+    0xCC28, 0x29, 0x28, 0xCE74, 0x29, 0x28, 0xD0C0, 0x29, 0x28, 0xD30C, 0x29, 0x28,
+    0xD558, 0x29, 0x28, 0xC8FC, 0x29, 0x28, 0xC624, 0xC804, 0x29, 0x28, 0xC624, 0xD6C4,
+    0x29, 0x28, 0x4E00, 0x29, 0x28, 0x4E8C, 0x29, 0x28, 0x4E09, 0x29, 0x28, 0x56DB,
+    0x29, 0x28, 0x4E94, 0x29, 0x28, 0x516D, 0x29, 0x28, 0x4E03, 0x29, 0x28, 0x516B,
+    0x29, 0x28, 0x4E5D, 0x29, 0x28, 0x5341, 0x29, 0x28, 0x6708, 0x29, 0x28, 0x706B,
+    0x29, 0x28, 0x6C34, 0x29, 0x28, 0x6728, 0x29, 0x28, 0x91D1, 0x29, 0x28, 0x571F,
+    0x29, 0x28, 0x65E5, 0x29, 0x28, 0x682A, 0x29, 0x28, 0x6709, 0x29, 0x28, 0x793E,
+    0x29, 0x28, 0x540D, 0x29, 0x28, 0x7279, 0x29, 0x28, 0x8CA1, 0x29, 0x28, 0x795D,
+    0x29, 0x28, 0x52B4, 0x29, 0x28, 0x4EE3, 0x29, 0x28, 0x547C, 0x29, 0x28, 0x5B66,
+    0x29, 0x28, 0x76E3, 0x29, 0x28, 0x4F01, 0x29, 0x28, 0x8CC7, 0x29, 0x28, 0x5354,
+    0x29, 0x28, 0x796D, 0x29, 0x28, 0x4F11, 0x29, 0x28, 0x81EA, 0x29, 0x28, 0x81F3,
+    0x29, 0x554F, 0x5E7C, 0x6587, 0x7B8F, 0x70, 0x74, 0x65, 0x32, 0x31, 0x32, 0x32,
+    0x32, 0x33, 0x32, 0x34, 0x32, 0x35, 0x32, 0x36, 0x32, 0x37, 0x32, 0x38,
+    0x32, 0x39, 0x33, 0x30, 0x33, 0x31, 0x33, 0x32, 0x33, 0x33, 0x33, 0x34,
+    0x33, 0x35, 0x1100, 0x1102, 0x1103, 0x1105, 0x1106, 0x1107, 0x1109, 0x110B, 0x110C, 0x110E,
+    0x110F, 0x1110, 0x1111, 0x1112, 0xAC00, 0xB098, 0xB2E4, 0xB77C, 0xB9C8, 0xBC14, 0xC0AC, 0xC544,
+    0xC790, 0xCC28, 0xCE74, 0xD0C0, 0xD30C, 0xD558, 0xCC38, 0xACE0, 0xC8FC, 0xC758, 0xC6B0, 0x4E00,
+    0x4E8C, 0x4E09, 0x56DB, 0x4E94, 0x516D, 0x4E03, 0x516B, 0x4E5D, 0x5341, 0x6708, 0x706B, 0x6C34,
+    0x6728, 0x91D1, 0x571F, 0x65E5, 0x682A, 0x6709, 0x793E, 0x540D, 0x7279, 0x8CA1, 0x795D, 0x52B4,
+    0x79D8, 0x7537, 0x5973, 0x9069, 0x512A, 0x5370, 0x6CE8, 0x9805, 0x4F11, 0x5199, 0x6B63, 0x4E0A,
+    0x4E2D, 0x4E0B, 0x5DE6, 0x53F3, 0x533B, 0x5B97, 0x5B66, 0x76E3, 0x4F01, 0x8CC7, 0x5354, 0x591C,
+    0x33, 0x36, 0x33, 0x37, 0x33, 0x38, 0x33, 0x39, 0x34, 0x30, 0x34, 0x31,
+    0x34, 0x32, 0x34, 0x33, 0x34, 0x34, 0x34, 0x35, 0x34, 0x36, 0x34, 0x37,
+    0x34, 0x38, 0x34, 0x39, 0x35, 0x30, 0x31, 0x6708, 0x32, 0x6708, 0x33, 0x6708,
+    0x34, 0x6708, 0x35, 0x6708, 0x36, 0x6708, 0x37, 0x6708, 0x38, 0x6708, 0x39, 0x6708,
+    0x31, 0x30, 0x6708, 0x31, 0x31, 0x6708, 0x31, 0x32, 0x6708, 0x68, 0x67, 0x65,
+    0x72, 0x67, 0x65, 0x76, 0x6C, 0x74, 0x64, 0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA,
+    0x30AB, 0x30AD, 0x30AF, 0x30B1, 0x30B3, 0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD, 0x30BF, 0x30C1,
+    0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE, 0x30CF, 0x30D2, 0x30D5, 0x30D8,
+    0x30DB, 0x30DE, 0x30DF, 0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30E9, 0x30EA, 0x30EB,
+    0x30EC, 0x30ED, 0x30EF, 0x30F0, 0x30F1, 0x30F2, 0x4EE4, 0x548C, 0x30A2, 0x30D1, 0x30FC, 0x30C8,
+    0x30A2, 0x30EB, 0x30D5, 0x30A1, 0x30A2, 0x30F3, 0x30DA, 0x30A2, 0x30A2, 0x30FC, 0x30EB, 0x30A4,
+    0x30CB, 0x30F3, 0x30B0, 0x30A4, 0x30F3, 0x30C1, 0x30A6, 0x30A9, 0x30F3, 0x30A8, 0x30B9, 0x30AF,
+    0x30FC, 0x30C9, 0x30A8, 0x30FC, 0x30AB, 0x30FC, 0x30AA, 0x30F3, 0x30B9, 0x30AA, 0x30FC, 0x30E0,
+    0x30AB, 0x30A4, 0x30EA, 0x30AB, 0x30E9, 0x30C3, 0x30C8, 0x30AB, 0x30ED, 0x30EA, 0x30FC, 0x30AC,
+    0x30ED, 0x30F3, 0x30AC, 0x30F3, 0x30DE, 0x30AE, 0x30AC, 0x30AE, 0x30CB, 0x30FC, 0x30AD, 0x30E5,
+    0x30EA, 0x30FC, 0x30AE, 0x30EB, 0x30C0, 0x30FC, 0x30AD, 0x30ED, 0x30AD, 0x30ED, 0x30B0, 0x30E9,
+    0x30E0, 0x30AD, 0x30ED, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x30AD, 0x30ED, 0x30EF, 0x30C3, 0x30C8,
+    0x30B0, 0x30E9, 0x30E0, 0x30B0, 0x30E9, 0x30E0, 0x30C8, 0x30F3, 0x30AF, 0x30EB, 0x30BC, 0x30A4,
+    0x30ED, 0x30AF, 0x30ED, 0x30FC, 0x30CD, 0x30B1, 0x30FC, 0x30B9, 0x30B3, 0x30EB, 0x30CA, 0x30B3,
+    0x30FC, 0x30DD, 0x30B5, 0x30A4, 0x30AF, 0x30EB, 0x30B5, 0x30F3, 0x30C1, 0x30FC, 0x30E0, 0x30B7,
+    0x30EA, 0x30F3, 0x30B0, 0x30BB, 0x30F3, 0x30C1, 0x30BB, 0x30F3, 0x30C8, 0x30C0, 0x30FC, 0x30B9,
+    0x30C7, 0x30B7, 0x30C9, 0x30EB, 0x30C8, 0x30F3, 0x30CA, 0x30CE, 0x30CE, 0x30C3, 0x30C8, 0x30CF,
+    0x30A4, 0x30C4, 0x30D1, 0x30FC, 0x30BB, 0x30F3, 0x30C8, 0x30D1, 0x30FC, 0x30C4, 0x30D0, 0x30FC,
+    0x30EC, 0x30EB, 0x30D4, 0x30A2, 0x30B9, 0x30C8, 0x30EB, 0x30D4, 0x30AF, 0x30EB, 0x30D4, 0x30B3,
+    0x30D3, 0x30EB, 0x30D5, 0x30A1, 0x30E9, 0x30C3, 0x30C9, 0x30D5, 0x30A3, 0x30FC, 0x30C8, 0x30D6,
+    0x30C3, 0x30B7, 0x30A7, 0x30EB, 0x30D5, 0x30E9, 0x30F3, 0x30D8, 0x30AF, 0x30BF, 0x30FC, 0x30EB,
+    0x30DA, 0x30BD, 0x30DA, 0x30CB, 0x30D2, 0x30D8, 0x30EB, 0x30C4, 0x30DA, 0x30F3, 0x30B9, 0x30DA,
+    0x30FC, 0x30B8, 0x30D9, 0x30FC, 0x30BF, 0x30DD, 0x30A4, 0x30F3, 0x30C8, 0x30DC, 0x30EB, 0x30C8,
+    0x30DB, 0x30F3, 0x30DD, 0x30F3, 0x30C9, 0x30DB, 0x30FC, 0x30EB, 0x30DB, 0x30FC, 0x30F3, 0x30DE,
+    0x30A4, 0x30AF, 0x30ED, 0x30DE, 0x30A4, 0x30EB, 0x30DE, 0x30C3, 0x30CF, 0x30DE, 0x30EB, 0x30AF,
+    0x30DE, 0x30F3, 0x30B7, 0x30E7, 0x30F3, 0x30DF, 0x30AF, 0x30ED, 0x30F3, 0x30DF, 0x30EA, 0x30DF,
+    0x30EA, 0x30D0, 0x30FC, 0x30EB, 0x30E1, 0x30AC, 0x30E1, 0x30AC, 0x30C8, 0x30F3, 0x30E1, 0x30FC,
+    0x30C8, 0x30EB, 0x30E4, 0x30FC, 0x30C9, 0x30E4, 0x30FC, 0x30EB, 0x30E6, 0x30A2, 0x30F3, 0x30EA,
+    0x30C3, 0x30C8, 0x30EB, 0x30EA, 0x30E9, 0x30EB, 0x30D4, 0x30FC, 0x30EB, 0x30FC, 0x30D6, 0x30EB,
+    0x30EC, 0x30E0, 0x30EC, 0x30F3, 0x30C8, 0x30B2, 0x30F3, 0x30EF, 0x30C3, 0x30C8, 0x30, 0x70B9,
+    0x31, 0x70B9, 0x32, 0x70B9, 0x33, 0x70B9, 0x34, 0x70B9, 0x35, 0x70B9, 0x36, 0x70B9,
+    0x37, 0x70B9, 0x38, 0x70B9, 0x39, 0x70B9, 0x31, 0x30, 0x70B9, 0x31, 0x31, 0x70B9,
+    0x31, 0x32, 0x70B9, 0x31, 0x33, 0x70B9, 0x31, 0x34, 0x70B9, 0x31, 0x35, 0x70B9,
+    0x31, 0x36, 0x70B9, 0x31, 0x37, 0x70B9, 0x31, 0x38, 0x70B9, 0x31, 0x39, 0x70B9,
+    0x32, 0x30, 0x70B9, 0x32, 0x31, 0x70B9, 0x32, 0x32, 0x70B9, 0x32, 0x33, 0x70B9,
+    0x32, 0x34, 0x70B9, 0x68, 0x70, 0x61, 0x64, 0x61, 0x61, 0x75, 0x62, 0x61,
+    0x72, 0x6F, 0x76, 0x70, 0x63, 0x64, 0x6D, 0x64, 0x6D, 0x32, 0x64, 0x6D,
+    0x33, 0x69, 0x75, 0x5E73, 0x6210, 0x662D, 0x548C, 0x5927, 0x6B63, 0x660E, 0x6CBB, 0x682A,
+    0x5F0F, 0x4F1A, 0x793E, 0x70, 0x61, 0x6E, 0x61, 0x3BC, 0x61, 0x6D, 0x61, 0x6B,
+    0x61, 0x6B, 0x62, 0x6D, 0x62, 0x67, 0x62, 0x63, 0x61, 0x6C, 0x6B, 0x63,
+    0x61, 0x6C, 0x70, 0x66, 0x6E, 0x66, 0x3BC, 0x66, 0x3BC, 0x67, 0x6D, 0x67,
+    0x6B, 0x67, 0x68, 0x7A, 0x6B, 0x68, 0x7A, 0x6D, 0x68, 0x7A, 0x67, 0x68,
+    0x7A, 0x74, 0x68, 0x7A, 0x3BC, 0x6C, 0x6D, 0x6C, 0x64, 0x6C, 0x6B, 0x6C,
+    0x66, 0x6D, 0x6E, 0x6D, 0x3BC, 0x6D, 0x6D, 0x6D, 0x63, 0x6D, 0x6B, 0x6D,
+    0x6D, 0x6D, 0x32, 0x63, 0x6D, 0x32, 0x6D, 0x32, 0x6B, 0x6D, 0x32, 0x6D,
+    0x6D, 0x33, 0x63, 0x6D, 0x33, 0x6D, 0x33, 0x6B, 0x6D, 0x33, 0x6D, 0x2215,
+    0x73, 0x6D, 0x2215, 0x73, 0x32, 0x70, 0x61, 0x6B, 0x70, 0x61, 0x6D, 0x70,
+    0x61, 0x67, 0x70, 0x61, 0x72, 0x61, 0x64, 0x72, 0x61, 0x64, 0x2215, 0x73,
+    0x72, 0x61, 0x64, 0x2215, 0x73, 0x32, 0x70, 0x73, 0x6E, 0x73, 0x3BC, 0x73,
+    0x6D, 0x73, 0x70, 0x76, 0x6E, 0x76, 0x3BC, 0x76, 0x6D, 0x76, 0x6B, 0x76,
+    0x6D, 0x76, 0x70, 0x77, 0x6E, 0x77, 0x3BC, 0x77, 0x6D, 0x77, 0x6B, 0x77,
+    0x6D, 0x77, 0x6B, 0x3C9, 0x6D, 0x3C9, 0x61, 0x2E, 0x6D, 0x2E, 0x62, 0x71,
+    0x63, 0x63, 0x63, 0x64, 0x63, 0x2215, 0x6B, 0x67, 0x63, 0x6F, 0x2E, 0x64,
+    0x62, 0x67, 0x79, 0x68, 0x61, 0x68, 0x70, 0x69, 0x6E, 0x6B, 0x6B, 0x6B,
+    0x6D, 0x6B, 0x74, 0x6C, 0x6D, 0x6C, 0x6E, 0x6C, 0x6F, 0x67, 0x6C, 0x78,
+    0x6D, 0x62, 0x6D, 0x69, 0x6C, 0x6D, 0x6F, 0x6C, 0x70, 0x68, 0x70, 0x2E,
+    0x6D, 0x2E, 0x70, 0x70, 0x6D, 0x70, 0x72, 0x73, 0x72, 0x73, 0x76, 0x77,
+    0x62, 0x76, 0x2215, 0x6D, 0x61, 0x2215, 0x6D, 0x31, 0x65E5, 0x32, 0x65E5, 0x33,
+    0x65E5, 0x34, 0x65E5, 0x35, 0x65E5, 0x36, 0x65E5, 0x37, 0x65E5, 0x38, 0x65E5, 0x39,
+    0x65E5, 0x31, 0x30, 0x65E5, 0x31, 0x31, 0x65E5, 0x31, 0x32, 0x65E5, 0x31, 0x33,
+    0x65E5, 0x31, 0x34, 0x65E5, 0x31, 0x35, 0x65E5, 0x31, 0x36, 0x65E5, 0x31, 0x37,
+    0x65E5, 0x31, 0x38, 0x65E5, 0x31, 0x39, 0x65E5, 0x32, 0x30, 0x65E5, 0x32, 0x31,
+    0x65E5, 0x32, 0x32, 0x65E5, 0x32, 0x33, 0x65E5, 0x32, 0x34, 0x65E5, 0x32, 0x35,
+    0x65E5, 0x32, 0x36, 0x65E5, 0x32, 0x37, 0x65E5, 0x32, 0x38, 0x65E5, 0x32, 0x39,
+    0x65E5, 0x33, 0x30, 0x65E5, 0x33, 0x31, 0x65E5, 0x67, 0x61, 0x6C, 0xA641, 0xA643,
+    0xA645, 0xA647, 0xA649, 0xA64B, 0xA64D, 0xA64F, 0xA651, 0xA653, 0xA655, 0xA657, 0xA659, 0xA65B,
+    0xA65D, 0xA65F, 0xA661, 0xA663, 0xA665, 0xA667, 0xA669, 0xA66B, 0xA66D, 0xA681, 0xA683, 0xA685,
+    0xA687, 0xA689, 0xA68B, 0xA68D, 0xA68F, 0xA691, 0xA693, 0xA695, 0xA697, 0xA699, 0xA69B, 0x44A,
+    0x44C, 0xA723, 0xA725, 0xA727, 0xA729, 0xA72B, 0xA72D, 0xA72F, 0xA733, 0xA735, 0xA737, 0xA739,
+    0xA73B, 0xA73D, 0xA73F, 0xA741, 0xA743, 0xA745, 0xA747, 0xA749, 0xA74B, 0xA74D, 0xA74F, 0xA751,
+    0xA753, 0xA755, 0xA757, 0xA759, 0xA75B, 0xA75D, 0xA75F, 0xA761, 0xA763, 0xA765, 0xA767, 0xA769,
+    0xA76B, 0xA76D, 0xA76F, 0xA76F, 0xA77A, 0xA77C, 0x1D79, 0xA77F, 0xA781, 0xA783, 0xA785, 0xA787,
+    0xA78C, 0x265, 0xA791, 0xA793, 0xA797, 0xA799, 0xA79B, 0xA79D, 0xA79F, 0xA7A1, 0xA7A3, 0xA7A5,
+    0xA7A7, 0xA7A9, 0x266, 0x25C, 0x261, 0x26C, 0x26A, 0x29E, 0x287, 0x29D, 0xAB53, 0xA7B5,
+    0xA7B7, 0xA7B9, 0xA7BB, 0xA7BD, 0xA7BF, 0xA7C1, 0xA7C3, 0xA794, 0x282, 0x1D8E, 0xA7C8, 0xA7CA,
+    0xA7D1, 0xA7D7, 0xA7D9, 0x63, 0x66, 0x71, 0xA7F6, 0x127, 0x153, 0xA727, 0xAB37, 0x26B,
+    0xAB52, 0x28D, 0x13A0, 0x13A1, 0x13A2, 0x13A3, 0x13A4, 0x13A5, 0x13A6, 0x13A7, 0x13A8, 0x13A9,
+    0x13AA, 0x13AB, 0x13AC, 0x13AD, 0x13AE, 0x13AF, 0x13B0, 0x13B1, 0x13B2, 0x13B3, 0x13B4, 0x13B5,
+    0x13B6, 0x13B7, 0x13B8, 0x13B9, 0x13BA, 0x13BB, 0x13BC, 0x13BD, 0x13BE, 0x13BF, 0x13C0, 0x13C1,
+    0x13C2, 0x13C3, 0x13C4, 0x13C5, 0x13C6, 0x13C7, 0x13C8, 0x13C9, 0x13CA, 0x13CB, 0x13CC, 0x13CD,
+    0x13CE, 0x13CF, 0x13D0, 0x13D1, 0x13D2, 0x13D3, 0x13D4, 0x13D5, 0x13D6, 0x13D7, 0x13D8, 0x13D9,
+    0x13DA, 0x13DB, 0x13DC, 0x13DD, 0x13DE, 0x13DF, 0x13E0, 0x13E1, 0x13E2, 0x13E3, 0x13E4, 0x13E5,
+    0x13E6, 0x13E7, 0x13E8, 0x13E9, 0x13EA, 0x13EB, 0x13EC, 0x13ED, 0x13EE, 0x13EF, 0x8C48, 0x66F4,
+    0x8ECA, 0x8CC8, 0x6ED1, 0x4E32, 0x53E5, 0x9F9C, 0x9F9C, 0x5951, 0x91D1, 0x5587, 0x5948, 0x61F6,
+    0x7669, 0x7F85, 0x863F, 0x87BA, 0x88F8, 0x908F, 0x6A02, 0x6D1B, 0x70D9, 0x73DE, 0x843D, 0x916A,
+    0x99F1, 0x4E82, 0x5375, 0x6B04, 0x721B, 0x862D, 0x9E1E, 0x5D50, 0x6FEB, 0x85CD, 0x8964, 0x62C9,
+    0x81D8, 0x881F, 0x5ECA, 0x6717, 0x6D6A, 0x72FC, 0x90CE, 0x4F86, 0x51B7, 0x52DE, 0x64C4, 0x6AD3,
+    0x7210, 0x76E7, 0x8001, 0x8606, 0x865C, 0x8DEF, 0x9732, 0x9B6F, 0x9DFA, 0x788C, 0x797F, 0x7DA0,
+    0x83C9, 0x9304, 0x9E7F, 0x8AD6, 0x58DF, 0x5F04, 0x7C60, 0x807E, 0x7262, 0x78CA, 0x8CC2, 0x96F7,
+    0x58D8, 0x5C62, 0x6A13, 0x6DDA, 0x6F0F, 0x7D2F, 0x7E37, 0x964B, 0x52D2, 0x808B, 0x51DC, 0x51CC,
+    0x7A1C, 0x7DBE, 0x83F1, 0x9675, 0x8B80, 0x62CF, 0x6A02, 0x8AFE, 0x4E39, 0x5BE7, 0x6012, 0x7387,
+    0x7570, 0x5317, 0x78FB, 0x4FBF, 0x5FA9, 0x4E0D, 0x6CCC, 0x6578, 0x7D22, 0x53C3, 0x585E, 0x7701,
+    0x8449, 0x8AAA, 0x6BBA, 0x8FB0, 0x6C88, 0x62FE, 0x82E5, 0x63A0, 0x7565, 0x4EAE, 0x5169, 0x51C9,
+    0x6881, 0x7CE7, 0x826F, 0x8AD2, 0x91CF, 0x52F5, 0x5442, 0x5973, 0x5EEC, 0x65C5, 0x6FFE, 0x792A,
+    0x95AD, 0x9A6A, 0x9E97, 0x9ECE, 0x529B, 0x66C6, 0x6B77, 0x8F62, 0x5E74, 0x6190, 0x6200, 0x649A,
+    0x6F23, 0x7149, 0x7489, 0x79CA, 0x7DF4, 0x806F, 0x8F26, 0x84EE, 0x9023, 0x934A, 0x5217, 0x52A3,
+    0x54BD, 0x70C8, 0x88C2, 0x8AAA, 0x5EC9, 0x5FF5, 0x637B, 0x6BAE, 0x7C3E, 0x7375, 0x4EE4, 0x56F9,
+    0x5BE7, 0x5DBA, 0x601C, 0x73B2, 0x7469, 0x7F9A, 0x8046, 0x9234, 0x96F6, 0x9748, 0x9818, 0x4F8B,
+    0x79AE, 0x91B4, 0x96B8, 0x60E1, 0x4E86, 0x50DA, 0x5BEE, 0x5C3F, 0x6599, 0x6A02, 0x71CE, 0x7642,
+    0x84FC, 0x907C, 0x9F8D, 0x6688, 0x962E, 0x5289, 0x677B, 0x67F3, 0x6D41, 0x6E9C, 0x7409, 0x7559,
+    0x786B, 0x7D10, 0x985E, 0x516D, 0x622E, 0x9678, 0x502B, 0x5D19, 0x6DEA, 0x8F2A, 0x5F8B, 0x6144,
+    0x6817, 0x7387, 0x9686, 0x5229, 0x540F, 0x5C65, 0x6613, 0x674E, 0x68A8, 0x6CE5, 0x7406, 0x75E2,
+    0x7F79, 0x88CF, 0x88E1, 0x91CC, 0x96E2, 0x533F, 0x6EBA, 0x541D, 0x71D0, 0x7498, 0x85FA, 0x96A3,
+    0x9C57, 0x9E9F, 0x6797, 0x6DCB, 0x81E8, 0x7ACB, 0x7B20, 0x7C92, 0x72C0, 0x7099, 0x8B58, 0x4EC0,
+    0x8336, 0x523A, 0x5207, 0x5EA6, 0x62D3, 0x7CD6, 0x5B85, 0x6D1E, 0x66B4, 0x8F3B, 0x884C, 0x964D,
+    0x898B, 0x5ED3, 0x5140, 0x55C0, 0x585A, 0x6674, 0x51DE, 0x732A, 0x76CA, 0x793C, 0x795E, 0x7965,
+    0x798F, 0x9756, 0x7CBE, 0x7FBD, 0x8612, 0x8AF8, 0x9038, 0x90FD, 0x98EF, 0x98FC, 0x9928, 0x9DB4,
+    0x90DE, 0x96B7, 0x4FAE, 0x50E7, 0x514D, 0x52C9, 0x52E4, 0x5351, 0x559D, 0x5606, 0x5668, 0x5840,
+    0x58A8, 0x5C64, 0x5C6E, 0x6094, 0x6168, 0x618E, 0x61F2, 0x654F, 0x65E2, 0x6691, 0x6885, 0x6D77,
+    0x6E1A, 0x6F22, 0x716E, 0x722B, 0x7422, 0x7891, 0x793E, 0x7949, 0x7948, 0x7950, 0x7956, 0x795D,
+    0x798D, 0x798E, 0x7A40, 0x7A81, 0x7BC0, 0x7DF4, 0x7E09, 0x7E41, 0x7F72, 0x8005, 0x81ED, 0x8279,
+    0x8279, 0x8457, 0x8910, 0x8996, 0x8B01, 0x8B39, 0x8CD3, 0x8D08, 0x8FB6, 0x9038, 0x96E3, 0x97FF,
+    0x983B, 0x6075, 0x242EE, 0x8218, 0x4E26, 0x51B5, 0x5168, 0x4F80, 0x5145, 0x5180, 0x52C7, 0x52FA,
+    0x559D, 0x5555, 0x5599, 0x55E2, 0x585A, 0x58B3, 0x5944, 0x5954, 0x5A62, 0x5B28, 0x5ED2, 0x5ED9,
+    0x5F69, 0x5FAD, 0x60D8, 0x614E, 0x6108, 0x618E, 0x6160, 0x61F2, 0x6234, 0x63C4, 0x641C, 0x6452,
+    0x6556, 0x6674, 0x6717, 0x671B, 0x6756, 0x6B79, 0x6BBA, 0x6D41, 0x6EDB, 0x6ECB, 0x6F22, 0x701E,
+    0x716E, 0x77A7, 0x7235, 0x72AF, 0x732A, 0x7471, 0x7506, 0x753B, 0x761D, 0x761F, 0x76CA, 0x76DB,
+    0x76F4, 0x774A, 0x7740, 0x78CC, 0x7AB1, 0x7BC0, 0x7C7B, 0x7D5B, 0x7DF4, 0x7F3E, 0x8005, 0x8352,
+    0x83EF, 0x8779, 0x8941, 0x8986, 0x8996, 0x8ABF, 0x8AF8, 0x8ACB, 0x8B01, 0x8AFE, 0x8AED, 0x8B39,
+    0x8B8A, 0x8D08, 0x8F38, 0x9072, 0x9199, 0x9276, 0x967C, 0x96E3, 0x9756, 0x97DB, 0x97FF, 0x980B,
+    0x983B, 0x9B12, 0x9F9C, 0x2284A, 0x22844, 0x233D5, 0x3B9D, 0x4018, 0x4039, 0x25249, 0x25CD0, 0x27ED3,
+    0x9F43, 0x9F8E, 0x66, 0x66, 0x66, 0x69, 0x66, 0x6C, 0x66, 0x66, 0x69, 0x66,
+    0x66, 0x6C, 0x73, 0x74, 0x73, 0x74, 0x574, 0x576, 0x574, 0x565, 0x574, 0x56B,
+    0x57E, 0x576, 0x574, 0x56D, 0x5D9, 0x5B4, 0x5F2, 0x5B7, 0x5E2, 0x5D0, 0x5D3, 0x5D4,
+    0x5DB, 0x5DC, 0x5DD, 0x5E8, 0x5EA, 0x2B, 0x5E9, 0x5C1, 0x5E9, 0x5C2, 0x5E9, 0x5BC,
+    0x5C1, 0x5E9, 0x5BC, 0x5C2, 0x5D0, 0x5B7, 0x5D0, 0x5B8, 0x5D0, 0x5BC, 0x5D1, 0x5BC,
+    0x5D2, 0x5BC, 0x5D3, 0x5BC, 0x5D4, 0x5BC, 0x5D5, 0x5BC, 0x5D6, 0x5BC, 0x5D8, 0x5BC,
+    0x5D9, 0x5BC, 0x5DA, 0x5BC, 0x5DB, 0x5BC, 0x5DC, 0x5BC, 0x5DE, 0x5BC, 0x5E0, 0x5BC,
+    0x5E1, 0x5BC, 0x5E3, 0x5BC, 0x5E4, 0x5BC, 0x5E6, 0x5BC, 0x5E7, 0x5BC, 0x5E8, 0x5BC,
+    0x5E9, 0x5BC, 0x5EA, 0x5BC, 0x5D5, 0x5B9, 0x5D1, 0x5BF, 0x5DB, 0x5BF, 0x5E4, 0x5BF,
+    0x5D0, 0x5DC, 0x671, 0x671, 0x67B, 0x67B, 0x67B, 0x67B, 0x67E, 0x67E, 0x67E, 0x67E,
+    0x680, 0x680, 0x680, 0x680, 0x67A, 0x67A, 0x67A, 0x67A, 0x67F, 0x67F, 0x67F, 0x67F,
+    0x679, 0x679, 0x679, 0x679, 0x6A4, 0x6A4, 0x6A4, 0x6A4, 0x6A6, 0x6A6, 0x6A6, 0x6A6,
+    0x684, 0x684, 0x684, 0x684, 0x683, 0x683, 0x683, 0x683, 0x686, 0x686, 0x686, 0x686,
+    0x687, 0x687, 0x687, 0x687, 0x68D, 0x68D, 0x68C, 0x68C, 0x68E, 0x68E, 0x688, 0x688,
+    0x698, 0x698, 0x691, 0x691, 0x6A9, 0x6A9, 0x6A9, 0x6A9, 0x6AF, 0x6AF, 0x6AF, 0x6AF,
+    0x6B3, 0x6B3, 0x6B3, 0x6B3, 0x6B1, 0x6B1, 0x6B1, 0x6B1, 0x6BA, 0x6BA, 0x6BB, 0x6BB,
+    0x6BB, 0x6BB, 0x6C0, 0x6C0, 0x6C1, 0x6C1, 0x6C1, 0x6C1, 0x6BE, 0x6BE, 0x6BE, 0x6BE,
+    0x6D2, 0x6D2, 0x6D3, 0x6D3, 0x6AD, 0x6AD, 0x6AD, 0x6AD, 0x6C7, 0x6C7, 0x6C6, 0x6C6,
+    0x6C8, 0x6C8, 0x6C7, 0x674, 0x6CB, 0x6CB, 0x6C5, 0x6C5, 0x6C9, 0x6C9, 0x6D0, 0x6D0,
+    0x6D0, 0x6D0, 0x649, 0x649, 0x626, 0x627, 0x626, 0x627, 0x626, 0x6D5, 0x626, 0x6D5,
+    0x626, 0x648, 0x626, 0x648, 0x626, 0x6C7, 0x626, 0x6C7, 0x626, 0x6C6, 0x626, 0x6C6,
+    0x626, 0x6C8, 0x626, 0x6C8, 0x626, 0x6D0, 0x626, 0x6D0, 0x626, 0x6D0, 0x626, 0x649,
+    0x626, 0x649, 0x626, 0x649, 0x6CC, 0x6CC, 0x6CC, 0x6CC, 0x626, 0x62C, 0x626, 0x62D,
+    0x626, 0x645, 0x626, 0x649, 0x626, 0x64A, 0x628, 0x62C, 0x628, 0x62D, 0x628, 0x62E,
+    0x628, 0x645, 0x628, 0x649, 0x628, 0x64A, 0x62A, 0x62C, 0x62A, 0x62D, 0x62A, 0x62E,
+    0x62A, 0x645, 0x62A, 0x649, 0x62A, 0x64A, 0x62B, 0x62C, 0x62B, 0x645, 0x62B, 0x649,
+    0x62B, 0x64A, 0x62C, 0x62D, 0x62C, 0x645, 0x62D, 0x62C, 0x62D, 0x645, 0x62E, 0x62C,
+    0x62E, 0x62D, 0x62E, 0x645, 0x633, 0x62C, 0x633, 0x62D, 0x633, 0x62E, 0x633, 0x645,
+    0x635, 0x62D, 0x635, 0x645, 0x636, 0x62C, 0x636, 0x62D, 0x636, 0x62E, 0x636, 0x645,
+    0x637, 0x62D, 0x637, 0x645, 0x638, 0x645, 0x639, 0x62C, 0x639, 0x645, 0x63A, 0x62C,
+    0x63A, 0x645, 0x641, 0x62C, 0x641, 0x62D, 0x641, 0x62E, 0x641, 0x645, 0x641, 0x649,
+    0x641, 0x64A, 0x642, 0x62D, 0x642, 0x645, 0x642, 0x649, 0x642, 0x64A, 0x643, 0x627,
+    0x643, 0x62C, 0x643, 0x62D, 0x643, 0x62E, 0x643, 0x644, 0x643, 0x645, 0x643, 0x649,
+    0x643, 0x64A, 0x644, 0x62C, 0x644, 0x62D, 0x644, 0x62E, 0x644, 0x645, 0x644, 0x649,
+    0x644, 0x64A, 0x645, 0x62C, 0x645, 0x62D, 0x645, 0x62E, 0x645, 0x645, 0x645, 0x649,
+    0x645, 0x64A, 0x646, 0x62C, 0x646, 0x62D, 0x646, 0x62E, 0x646, 0x645, 0x646, 0x649,
+    0x646, 0x64A, 0x647, 0x62C, 0x647, 0x645, 0x647, 0x649, 0x647, 0x64A, 0x64A, 0x62C,
+    0x64A, 0x62D, 0x64A, 0x62E, 0x64A, 0x645, 0x64A, 0x649, 0x64A, 0x64A, 0x630, 0x670,
+    0x631, 0x670, 0x649, 0x670, 0x20, 0x64C, 0x651, 0x20, 0x64D, 0x651, 0x20, 0x64E,
+    0x651, 0x20, 0x64F, 0x651, 0x20, 0x650, 0x651, 0x20, 0x651, 0x670, 0x626, 0x631,
+    0x626, 0x632, 0x626, 0x645, 0x626, 0x646, 0x626, 0x649, 0x626, 0x64A, 0x628, 0x631,
+    0x628, 0x632, 0x628, 0x645, 0x628, 0x646, 0x628, 0x649, 0x628, 0x64A, 0x62A, 0x631,
+    0x62A, 0x632, 0x62A, 0x645, 0x62A, 0x646, 0x62A, 0x649, 0x62A, 0x64A, 0x62B, 0x631,
+    0x62B, 0x632, 0x62B, 0x645, 0x62B, 0x646, 0x62B, 0x649, 0x62B, 0x64A, 0x641, 0x649,
+    0x641, 0x64A, 0x642, 0x649, 0x642, 0x64A, 0x643, 0x627, 0x643, 0x644, 0x643, 0x645,
+    0x643, 0x649, 0x643, 0x64A, 0x644, 0x645, 0x644, 0x649, 0x644, 0x64A, 0x645, 0x627,
+    0x645, 0x645, 0x646, 0x631, 0x646, 0x632, 0x646, 0x645, 0x646, 0x646, 0x646, 0x649,
+    0x646, 0x64A, 0x649, 0x670, 0x64A, 0x631, 0x64A, 0x632, 0x64A, 0x645, 0x64A, 0x646,
+    0x64A, 0x649, 0x64A, 0x64A, 0x626, 0x62C, 0x626, 0x62D, 0x626, 0x62E, 0x626, 0x645,
+    0x626, 0x647, 0x628, 0x62C, 0x628, 0x62D, 0x628, 0x62E, 0x628, 0x645, 0x628, 0x647,
+    0x62A, 0x62C, 0x62A, 0x62D, 0x62A, 0x62E, 0x62A, 0x645, 0x62A, 0x647, 0x62B, 0x645,
+    0x62C, 0x62D, 0x62C, 0x645, 0x62D, 0x62C, 0x62D, 0x645, 0x62E, 0x62C, 0x62E, 0x645,
+    0x633, 0x62C, 0x633, 0x62D, 0x633, 0x62E, 0x633, 0x645, 0x635, 0x62D, 0x635, 0x62E,
+    0x635, 0x645, 0x636, 0x62C, 0x636, 0x62D, 0x636, 0x62E, 0x636, 0x645, 0x637, 0x62D,
+    0x638, 0x645, 0x639, 0x62C, 0x639, 0x645, 0x63A, 0x62C, 0x63A, 0x645, 0x641, 0x62C,
+    0x641, 0x62D, 0x641, 0x62E, 0x641, 0x645, 0x642, 0x62D, 0x642, 0x645, 0x643, 0x62C,
+    0x643, 0x62D, 0x643, 0x62E, 0x643, 0x644, 0x643, 0x645, 0x644, 0x62C, 0x644, 0x62D,
+    0x644, 0x62E, 0x644, 0x645, 0x644, 0x647, 0x645, 0x62C, 0x645, 0x62D, 0x645, 0x62E,
+    0x645, 0x645, 0x646, 0x62C, 0x646, 0x62D, 0x646, 0x62E, 0x646, 0x645, 0x646, 0x647,
+    0x647, 0x62C, 0x647, 0x645, 0x647, 0x670, 0x64A, 0x62C, 0x64A, 0x62D, 0x64A, 0x62E,
+    0x64A, 0x645, 0x64A, 0x647, 0x626, 0x645, 0x626, 0x647, 0x628, 0x645, 0x628, 0x647,
+    0x62A, 0x645, 0x62A, 0x647, 0x62B, 0x645, 0x62B, 0x647, 0x633, 0x645, 0x633, 0x647,
+    0x634, 0x645, 0x634, 0x647, 0x643, 0x644, 0x643, 0x645, 0x644, 0x645, 0x646, 0x645,
+    0x646, 0x647, 0x64A, 0x645, 0x64A, 0x647, 0x640, 0x64E, 0x651, 0x640, 0x64F, 0x651,
+    0x640, 0x650, 0x651, 0x637, 0x649, 0x637, 0x64A, 0x639, 0x649, 0x639, 0x64A, 0x63A,
+    0x649, 0x63A, 0x64A, 0x633, 0x649, 0x633, 0x64A, 0x634, 0x649, 0x634, 0x64A, 0x62D,
+    0x649, 0x62D, 0x64A, 0x62C, 0x649, 0x62C, 0x64A, 0x62E, 0x649, 0x62E, 0x64A, 0x635,
+    0x649, 0x635, 0x64A, 0x636, 0x649, 0x636, 0x64A, 0x634, 0x62C, 0x634, 0x62D, 0x634,
+    0x62E, 0x634, 0x645, 0x634, 0x631, 0x633, 0x631, 0x635, 0x631, 0x636, 0x631, 0x637,
+    0x649, 0x637, 0x64A, 0x639, 0x649, 0x639, 0x64A, 0x63A, 0x649, 0x63A, 0x64A, 0x633,
+    0x649, 0x633, 0x64A, 0x634, 0x649, 0x634, 0x64A, 0x62D, 0x649, 0x62D, 0x64A, 0x62C,
+    0x649, 0x62C, 0x64A, 0x62E, 0x649, 0x62E, 0x64A, 0x635, 0x649, 0x635, 0x64A, 0x636,
+    0x649, 0x636, 0x64A, 0x634, 0x62C, 0x634, 0x62D, 0x634, 0x62E, 0x634, 0x645, 0x634,
+    0x631, 0x633, 0x631, 0x635, 0x631, 0x636, 0x631, 0x634, 0x62C, 0x634, 0x62D, 0x634,
+    0x62E, 0x634, 0x645, 0x633, 0x647, 0x634, 0x647, 0x637, 0x645, 0x633, 0x62C, 0x633,
+    0x62D, 0x633, 0x62E, 0x634, 0x62C, 0x634, 0x62D, 0x634, 0x62E, 0x637, 0x645, 0x638,
+    0x645, 0x627, 0x64B, 0x627, 0x64B, 0x62A, 0x62C, 0x645, 0x62A, 0x62D, 0x62C, 0x62A,
+    0x62D, 0x62C, 0x62A, 0x62D, 0x645, 0x62A, 0x62E, 0x645, 0x62A, 0x645, 0x62C, 0x62A,
+    0x645, 0x62D, 0x62A, 0x645, 0x62E, 0x62C, 0x645, 0x62D, 0x62C, 0x645, 0x62D, 0x62D,
+    0x645, 0x64A, 0x62D, 0x645, 0x649, 0x633, 0x62D, 0x62C, 0x633, 0x62C, 0x62D, 0x633,
+    0x62C, 0x649, 0x633, 0x645, 0x62D, 0x633, 0x645, 0x62D, 0x633, 0x645, 0x62C, 0x633,
+    0x645, 0x645, 0x633, 0x645, 0x645, 0x635, 0x62D, 0x62D, 0x635, 0x62D, 0x62D, 0x635,
+    0x645, 0x645, 0x634, 0x62D, 0x645, 0x634, 0x62D, 0x645, 0x634, 0x62C, 0x64A, 0x634,
+    0x645, 0x62E, 0x634, 0x645, 0x62E, 0x634, 0x645, 0x645, 0x634, 0x645, 0x645, 0x636,
+    0x62D, 0x649, 0x636, 0x62E, 0x645, 0x636, 0x62E, 0x645, 0x637, 0x645, 0x62D, 0x637,
+    0x645, 0x62D, 0x637, 0x645, 0x645, 0x637, 0x645, 0x64A, 0x639, 0x62C, 0x645, 0x639,
+    0x645, 0x645, 0x639, 0x645, 0x645, 0x639, 0x645, 0x649, 0x63A, 0x645, 0x645, 0x63A,
+    0x645, 0x64A, 0x63A, 0x645, 0x649, 0x641, 0x62E, 0x645, 0x641, 0x62E, 0x645, 0x642,
+    0x645, 0x62D, 0x642, 0x645, 0x645, 0x644, 0x62D, 0x645, 0x644, 0x62D, 0x64A, 0x644,
+    0x62D, 0x649, 0x644, 0x62C, 0x62C, 0x644, 0x62C, 0x62C, 0x644, 0x62E, 0x645, 0x644,
+    0x62E, 0x645, 0x644, 0x645, 0x62D, 0x644, 0x645, 0x62D, 0x645, 0x62D, 0x62C, 0x645,
+    0x62D, 0x645, 0x645, 0x62D, 0x64A, 0x645, 0x62C, 0x62D, 0x645, 0x62C, 0x645, 0x645,
+    0x62E, 0x62C, 0x645, 0x62E, 0x645, 0x645, 0x62C, 0x62E, 0x647, 0x645, 0x62C, 0x647,
+    0x645, 0x645, 0x646, 0x62D, 0x645, 0x646, 0x62D, 0x649, 0x646, 0x62C, 0x645, 0x646,
+    0x62C, 0x645, 0x646, 0x62C, 0x649, 0x646, 0x645, 0x64A, 0x646, 0x645, 0x649, 0x64A,
+    0x645, 0x645, 0x64A, 0x645, 0x645, 0x628, 0x62E, 0x64A, 0x62A, 0x62C, 0x64A, 0x62A,
+    0x62C, 0x649, 0x62A, 0x62E, 0x64A, 0x62A, 0x62E, 0x649, 0x62A, 0x645, 0x64A, 0x62A,
+    0x645, 0x649, 0x62C, 0x645, 0x64A, 0x62C, 0x62D, 0x649, 0x62C, 0x645, 0x649, 0x633,
+    0x62E, 0x649, 0x635, 0x62D, 0x64A, 0x634, 0x62D, 0x64A, 0x636, 0x62D, 0x64A, 0x644,
+    0x62C, 0x64A, 0x644, 0x645, 0x64A, 0x64A, 0x62D, 0x64A, 0x64A, 0x62C, 0x64A, 0x64A,
+    0x645, 0x64A, 0x645, 0x645, 0x64A, 0x642, 0x645, 0x64A, 0x646, 0x62D, 0x64A, 0x642,
+    0x645, 0x62D, 0x644, 0x62D, 0x645, 0x639, 0x645, 0x64A, 0x643, 0x645, 0x64A, 0x646,
+    0x62C, 0x62D, 0x645, 0x62E, 0x64A, 0x644, 0x62C, 0x645, 0x643, 0x645, 0x645, 0x644,
+    0x62C, 0x645, 0x646, 0x62C, 0x62D, 0x62C, 0x62D, 0x64A, 0x62D, 0x62C, 0x64A, 0x645,
+    0x62C, 0x64A, 0x641, 0x645, 0x64A, 0x628, 0x62D, 0x64A, 0x643, 0x645, 0x645, 0x639,
+    0x62C, 0x645, 0x635, 0x645, 0x645, 0x633, 0x62E, 0x64A, 0x646, 0x62C, 0x64A, 0x635,
+    0x644, 0x6D2, 0x642, 0x644, 0x6D2, 0x627, 0x644, 0x644, 0x647, 0x627, 0x643, 0x628,
+    0x631, 0x645, 0x62D, 0x645, 0x62F, 0x635, 0x644, 0x639, 0x645, 0x631, 0x633, 0x648,
+    0x644, 0x639, 0x644, 0x64A, 0x647, 0x648, 0x633, 0x644, 0x645, 0x635, 0x644, 0x649,
+    0x635, 0x644, 0x649, 0x20, 0x627, 0x644, 0x644, 0x647, 0x20, 0x639, 0x644, 0x64A,
+    0x647, 0x20, 0x648, 0x633, 0x644, 0x645, 0x62C, 0x644, 0x20, 0x62C, 0x644, 0x627,
+    0x644, 0x647, 0x631, 0x6CC, 0x627, 0x644, 0x2C, 0x3001, 0x3002, 0x3A, 0x3B, 0x21,
+    0x3F, 0x3016, 0x3017, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2014, 0x2013, 0x5F, 0x5F,
+    0x28, 0x29, 0x7B, 0x7D, 0x3014, 0x3015, 0x3010, 0x3011, 0x300A, 0x300B, 0x3008, 0x3009,
+    0x300C, 0x300D, 0x300E, 0x300F, 0x5B, 0x5D, 0x20, 0x305, 0x20, 0x305, 0x20, 0x305,
+    0x20, 0x305, 0x5F, 0x5F, 0x5F, 0x2C, 0x3001, 0x2E, 0x3B, 0x3A, 0x3F, 0x21,
+    0x2014, 0x28, 0x29, 0x7B, 0x7D, 0x3014, 0x3015, 0x23, 0x26, 0x2A, 0x2B, 0x2D,
+    0x3C, 0x3E, 0x3D, 0x5C, 0x24, 0x25, 0x40, 0x20, 0x64B, 0x640, 0x64B, 0x20,
+    0x64C, 0x20, 0x64D, 0x20, 0x64E, 0x640, 0x64E, 0x20, 0x64F, 0x640, 0x64F, 0x20,
+    0x650, 0x640, 0x650, 0x20, 0x651, 0x640, 0x651, 0x20, 0x652, 0x640, 0x652, 0x621,
+    0x622, 0x622, 0x623, 0x623, 0x624, 0x624, 0x625, 0x625, 0x626, 0x626, 0x626, 0x626,
+    0x627, 0x627, 0x628, 0x628, 0x628, 0x628, 0x629, 0x629, 0x62A, 0x62A, 0x62A, 0x62A,
+    0x62B, 0x62B, 0x62B, 0x62B, 0x62C, 0x62C, 0x62C, 0x62C, 0x62D, 0x62D, 0x62D, 0x62D,
+    0x62E, 0x62E, 0x62E, 0x62E, 0x62F, 0x62F, 0x630, 0x630, 0x631, 0x631, 0x632, 0x632,
+    0x633, 0x633, 0x633, 0x633, 0x634, 0x634, 0x634, 0x634, 0x635, 0x635, 0x635, 0x635,
+    0x636, 0x636, 0x636, 0x636, 0x637, 0x637, 0x637, 0x637, 0x638, 0x638, 0x638, 0x638,
+    0x639, 0x639, 0x639, 0x639, 0x63A, 0x63A, 0x63A, 0x63A, 0x641, 0x641, 0x641, 0x641,
+    0x642, 0x642, 0x642, 0x642, 0x643, 0x643, 0x643, 0x643, 0x644, 0x644, 0x644, 0x644,
+    0x645, 0x645, 0x645, 0x645, 0x646, 0x646, 0x646, 0x646, 0x647, 0x647, 0x647, 0x647,
+    0x648, 0x648, 0x649, 0x649, 0x64A, 0x64A, 0x64A, 0x64A, 0x644, 0x622, 0x644, 0x622,
+    0x644, 0x623, 0x644, 0x623, 0x644, 0x625, 0x644, 0x625, 0x644, 0x627, 0x644, 0x627,
+    0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C,
+    0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+    0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+    0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x5B, 0x5C,
+    0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74,
+    0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x2985, 0x2986,
+    0x3002, 0x300C, 0x300D, 0x3001, 0x30FB, 0x30F2, 0x30A1, 0x30A3, 0x30A5, 0x30A7, 0x30A9, 0x30E3,
+    0x30E5, 0x30E7, 0x30C3, 0x30FC, 0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA, 0x30AB, 0x30AD, 0x30AF,
+    0x30B1, 0x30B3, 0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD, 0x30BF, 0x30C1, 0x30C4, 0x30C6, 0x30C8,
+    0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE, 0x30CF, 0x30D2, 0x30D5, 0x30D8, 0x30DB, 0x30DE, 0x30DF,
+    0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30E9, 0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EF,
+    0x30F3, 0x3099, 0x309A, 0x1100, 0x1101, 0x11AA, 0x1102, 0x11AC, 0x11AD, 0x1103, 0x1104, 0x1105,
+    0x11B0, 0x11B1, 0x11B2, 0x11B3, 0x11B4, 0x11B5, 0x111A, 0x1106, 0x1107, 0x1108, 0x1121, 0x1109,
+    0x110A, 0x110B, 0x110C, 0x110D, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0x1161, 0x1162, 0x1163,
+    0x1164, 0x1165, 0x1166, 0x1167, 0x1168, 0x1169, 0x116A, 0x116B, 0x116C, 0x116D, 0x116E, 0x116F,
+    0x1170, 0x1171, 0x1172, 0x1173, 0x1174, 0x1175, 0xA2, 0xA3, 0xAC, 0x20, 0x304, 0xA6,
+    0xA5, 0x20A9, 0x2502, 0x2190, 0x2191, 0x2192, 0x2193, 0x25A0, 0x25CB, 0x10428, 0x10429, 0x1042A,
+    0x1042B, 0x1042C, 0x1042D, 0x1042E, 0x1042F, 0x10430, 0x10431, 0x10432, 0x10433, 0x10434, 0x10435, 0x10436,
+    0x10437, 0x10438, 0x10439, 0x1043A, 0x1043B, 0x1043C, 0x1043D, 0x1043E, 0x1043F, 0x10440, 0x10441, 0x10442,
+    0x10443, 0x10444, 0x10445, 0x10446, 0x10447, 0x10448, 0x10449, 0x1044A, 0x1044B, 0x1044C, 0x1044D, 0x1044E,
+    0x1044F, 0x104D8, 0x104D9, 0x104DA, 0x104DB, 0x104DC, 0x104DD, 0x104DE, 0x104DF, 0x104E0, 0x104E1, 0x104E2,
+    0x104E3, 0x104E4, 0x104E5, 0x104E6, 0x104E7, 0x104E8, 0x104E9, 0x104EA, 0x104EB, 0x104EC, 0x104ED, 0x104EE,
+    0x104EF, 0x104F0, 0x104F1, 0x104F2, 0x104F3, 0x104F4, 0x104F5, 0x104F6, 0x104F7, 0x104F8, 0x104F9, 0x104FA,
+    0x104FB, 0x10597, 0x10598, 0x10599, 0x1059A, 0x1059B, 0x1059C, 0x1059D, 0x1059E, 0x1059F, 0x105A0, 0x105A1,
+    0x105A3, 0x105A4, 0x105A5, 0x105A6, 0x105A7, 0x105A8, 0x105A9, 0x105AA, 0x105AB, 0x105AC, 0x105AD, 0x105AE,
+    0x105AF, 0x105B0, 0x105B1, 0x105B3, 0x105B4, 0x105B5, 0x105B6, 0x105B7, 0x105B8, 0x105B9, 0x105BB, 0x105BC,
+    0x2D0, 0x2D1, 0xE6, 0x299, 0x253, 0x2A3, 0xAB66, 0x2A5, 0x2A4, 0x256, 0x257, 0x1D91,
+    0x258, 0x25E, 0x2A9, 0x264, 0x262, 0x260, 0x29B, 0x127, 0x29C, 0x267, 0x284, 0x2AA,
+    0x2AB, 0x26C, 0x1DF04, 0xA78E, 0x26E, 0x1DF05, 0x28E, 0x1DF06, 0xF8, 0x276, 0x277, 0x71,
+    0x27A, 0x1DF08, 0x27D, 0x27E, 0x280, 0x2A8, 0x2A6, 0xAB67, 0x2A7, 0x288, 0x2C71, 0x28F,
+    0x2A1, 0x2A2, 0x298, 0x1C0, 0x1C1, 0x1C2, 0x1DF0A, 0x1DF1E, 0x10CC0, 0x10CC1, 0x10CC2, 0x10CC3,
+    0x10CC4, 0x10CC5, 0x10CC6, 0x10CC7, 0x10CC8, 0x10CC9, 0x10CCA, 0x10CCB, 0x10CCC, 0x10CCD, 0x10CCE, 0x10CCF,
+    0x10CD0, 0x10CD1, 0x10CD2, 0x10CD3, 0x10CD4, 0x10CD5, 0x10CD6, 0x10CD7, 0x10CD8, 0x10CD9, 0x10CDA, 0x10CDB,
+    0x10CDC, 0x10CDD, 0x10CDE, 0x10CDF, 0x10CE0, 0x10CE1, 0x10CE2, 0x10CE3, 0x10CE4, 0x10CE5, 0x10CE6, 0x10CE7,
+    0x10CE8, 0x10CE9, 0x10CEA, 0x10CEB, 0x10CEC, 0x10CED, 0x10CEE, 0x10CEF, 0x10CF0, 0x10CF1, 0x10CF2, 0x118C0,
+    0x118C1, 0x118C2, 0x118C3, 0x118C4, 0x118C5, 0x118C6, 0x118C7, 0x118C8, 0x118C9, 0x118CA, 0x118CB, 0x118CC,
+    0x118CD, 0x118CE, 0x118CF, 0x118D0, 0x118D1, 0x118D2, 0x118D3, 0x118D4, 0x118D5, 0x118D6, 0x118D7, 0x118D8,
+    0x118D9, 0x118DA, 0x118DB, 0x118DC, 0x118DD, 0x118DE, 0x118DF, 0x16E60, 0x16E61, 0x16E62, 0x16E63, 0x16E64,
+    0x16E65, 0x16E66, 0x16E67, 0x16E68, 0x16E69, 0x16E6A, 0x16E6B, 0x16E6C, 0x16E6D, 0x16E6E, 0x16E6F, 0x16E70,
+    0x16E71, 0x16E72, 0x16E73, 0x16E74, 0x16E75, 0x16E76, 0x16E77, 0x16E78, 0x16E79, 0x16E7A, 0x16E7B, 0x16E7C,
+    0x16E7D, 0x16E7E, 0x16E7F, 0x1D157, 0x1D165, 0x1D158, 0x1D165, 0x1D158, 0x1D165, 0x1D16E, 0x1D158, 0x1D165,
+    0x1D16F, 0x1D158, 0x1D165, 0x1D170, 0x1D158, 0x1D165, 0x1D171, 0x1D158, 0x1D165, 0x1D172, 0x1D1B9, 0x1D165,
+    0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165, 0x1D16E, 0x1D1BA, 0x1D165, 0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA,
+    0x1D165, 0x1D16F, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,
+    0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74,
+    0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
+    0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71,
+    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x62, 0x63,
+    0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61,
+    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D,
+    0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+    0x7A, 0x61, 0x63, 0x64, 0x67, 0x6A, 0x6B, 0x6E, 0x6F, 0x70, 0x71, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x62, 0x63, 0x64, 0x66,
+    0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74,
+    0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
+    0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+    0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x62,
+    0x64, 0x65, 0x66, 0x67, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x61, 0x62, 0x63, 0x64, 0x65,
+    0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71,
+    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x62, 0x64,
+    0x65, 0x66, 0x67, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6F, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74,
+    0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
+    0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+    0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
+    0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A,
+    0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C,
+    0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,
+    0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74,
+    0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
+    0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+    0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
+    0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A,
+    0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C,
+    0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,
+    0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74,
+    0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x131, 0x237, 0x3B1, 0x3B2, 0x3B3, 0x3B4,
+    0x3B5, 0x3B6, 0x3B7, 0x3B8, 0x3B9, 0x3BA, 0x3BB, 0x3BC, 0x3BD, 0x3BE, 0x3BF, 0x3C0,
+    0x3C1, 0x3B8, 0x3C3, 0x3C4, 0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x2207, 0x3B1, 0x3B2,
+    0x3B3, 0x3B4, 0x3B5, 0x3B6, 0x3B7, 0x3B8, 0x3B9, 0x3BA, 0x3BB, 0x3BC, 0x3BD, 0x3BE,
+    0x3BF, 0x3C0, 0x3C1, 0x3C3, 0x3C3, 0x3C4, 0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x2202,
+    0x3B5, 0x3B8, 0x3BA, 0x3C6, 0x3C1, 0x3C0, 0x3B1, 0x3B2, 0x3B3, 0x3B4, 0x3B5, 0x3B6,
+    0x3B7, 0x3B8, 0x3B9, 0x3BA, 0x3BB, 0x3BC, 0x3BD, 0x3BE, 0x3BF, 0x3C0, 0x3C1, 0x3B8,
+    0x3C3, 0x3C4, 0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x2207, 0x3B1, 0x3B2, 0x3B3, 0x3B4,
+    0x3B5, 0x3B6, 0x3B7, 0x3B8, 0x3B9, 0x3BA, 0x3BB, 0x3BC, 0x3BD, 0x3BE, 0x3BF, 0x3C0,
+    0x3C1, 0x3C3, 0x3C3, 0x3C4, 0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x2202, 0x3B5, 0x3B8,
+    0x3BA, 0x3C6, 0x3C1, 0x3C0, 0x3B1, 0x3B2, 0x3B3, 0x3B4, 0x3B5, 0x3B6, 0x3B7, 0x3B8,
+    0x3B9, 0x3BA, 0x3BB, 0x3BC, 0x3BD, 0x3BE, 0x3BF, 0x3C0, 0x3C1, 0x3B8, 0x3C3, 0x3C4,
+    0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x2207, 0x3B1, 0x3B2, 0x3B3, 0x3B4, 0x3B5, 0x3B6,
+    0x3B7, 0x3B8, 0x3B9, 0x3BA, 0x3BB, 0x3BC, 0x3BD, 0x3BE, 0x3BF, 0x3C0, 0x3C1, 0x3C3,
+    0x3C3, 0x3C4, 0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x2202, 0x3B5, 0x3B8, 0x3BA, 0x3C6,
+    0x3C1, 0x3C0, 0x3B1, 0x3B2, 0x3B3, 0x3B4, 0x3B5, 0x3B6, 0x3B7, 0x3B8, 0x3B9, 0x3BA,
+    0x3BB, 0x3BC, 0x3BD, 0x3BE, 0x3BF, 0x3C0, 0x3C1, 0x3B8, 0x3C3, 0x3C4, 0x3C5, 0x3C6,
+    0x3C7, 0x3C8, 0x3C9, 0x2207, 0x3B1, 0x3B2, 0x3B3, 0x3B4, 0x3B5, 0x3B6, 0x3B7, 0x3B8,
+    0x3B9, 0x3BA, 0x3BB, 0x3BC, 0x3BD, 0x3BE, 0x3BF, 0x3C0, 0x3C1, 0x3C3, 0x3C3, 0x3C4,
+    0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x2202, 0x3B5, 0x3B8, 0x3BA, 0x3C6, 0x3C1, 0x3C0,
+    0x3B1, 0x3B2, 0x3B3, 0x3B4, 0x3B5, 0x3B6, 0x3B7, 0x3B8, 0x3B9, 0x3BA, 0x3BB, 0x3BC,
+    0x3BD, 0x3BE, 0x3BF, 0x3C0, 0x3C1, 0x3B8, 0x3C3, 0x3C4, 0x3C5, 0x3C6, 0x3C7, 0x3C8,
+    0x3C9, 0x2207, 0x3B1, 0x3B2, 0x3B3, 0x3B4, 0x3B5, 0x3B6, 0x3B7, 0x3B8, 0x3B9, 0x3BA,
+    0x3BB, 0x3BC, 0x3BD, 0x3BE, 0x3BF, 0x3C0, 0x3C1, 0x3C3, 0x3C3, 0x3C4, 0x3C5, 0x3C6,
+    0x3C7, 0x3C8, 0x3C9, 0x2202, 0x3B5, 0x3B8, 0x3BA, 0x3C6, 0x3C1, 0x3C0, 0x3DD, 0x3DD,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x30, 0x31,
+    0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x30, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x1E922, 0x1E923, 0x1E924, 0x1E925, 0x1E926, 0x1E927, 0x1E928, 0x1E929, 0x1E92A, 0x1E92B,
+    0x1E92C, 0x1E92D, 0x1E92E, 0x1E92F, 0x1E930, 0x1E931, 0x1E932, 0x1E933, 0x1E934, 0x1E935, 0x1E936, 0x1E937,
+    0x1E938, 0x1E939, 0x1E93A, 0x1E93B, 0x1E93C, 0x1E93D, 0x1E93E, 0x1E93F, 0x1E940, 0x1E941, 0x1E942, 0x1E943,
+    0x627, 0x628, 0x62C, 0x62F, 0x648, 0x632, 0x62D, 0x637, 0x64A, 0x643, 0x644, 0x645,
+    0x646, 0x633, 0x639, 0x641, 0x635, 0x642, 0x631, 0x634, 0x62A, 0x62B, 0x62E, 0x630,
+    0x636, 0x638, 0x63A, 0x66E, 0x6BA, 0x6A1, 0x66F, 0x628, 0x62C, 0x647, 0x62D, 0x64A,
+    0x643, 0x644, 0x645, 0x646, 0x633, 0x639, 0x641, 0x635, 0x642, 0x634, 0x62A, 0x62B,
+    0x62E, 0x636, 0x63A, 0x62C, 0x62D, 0x64A, 0x644, 0x646, 0x633, 0x639, 0x635, 0x642,
+    0x634, 0x62E, 0x636, 0x63A, 0x6BA, 0x66F, 0x628, 0x62C, 0x647, 0x62D, 0x637, 0x64A,
+    0x643, 0x645, 0x646, 0x633, 0x639, 0x641, 0x635, 0x642, 0x634, 0x62A, 0x62B, 0x62E,
+    0x636, 0x638, 0x63A, 0x66E, 0x6A1, 0x627, 0x628, 0x62C, 0x62F, 0x647, 0x648, 0x632,
+    0x62D, 0x637, 0x64A, 0x644, 0x645, 0x646, 0x633, 0x639, 0x641, 0x635, 0x642, 0x631,
+    0x634, 0x62A, 0x62B, 0x62E, 0x630, 0x636, 0x638, 0x63A, 0x628, 0x62C, 0x62F, 0x648,
+    0x632, 0x62D, 0x637, 0x64A, 0x644, 0x645, 0x646, 0x633, 0x639, 0x641, 0x635, 0x642,
+    0x631, 0x634, 0x62A, 0x62B, 0x62E, 0x630, 0x636, 0x638, 0x63A, 0x30, 0x2E, 0x30,
+    0x2C, 0x31, 0x2C, 0x32, 0x2C, 0x33, 0x2C, 0x34, 0x2C, 0x35, 0x2C, 0x36,
+    0x2C, 0x37, 0x2C, 0x38, 0x2C, 0x39, 0x2C, 0x28, 0x61, 0x29, 0x28, 0x62,
+    0x29, 0x28, 0x63, 0x29, 0x28, 0x64, 0x29, 0x28, 0x65, 0x29, 0x28, 0x66,
+    0x29, 0x28, 0x67, 0x29, 0x28, 0x68, 0x29, 0x28, 0x69, 0x29, 0x28, 0x6A,
+    0x29, 0x28, 0x6B, 0x29, 0x28, 0x6C, 0x29, 0x28, 0x6D, 0x29, 0x28, 0x6E,
+    0x29, 0x28, 0x6F, 0x29, 0x28, 0x70, 0x29, 0x28, 0x71, 0x29, 0x28, 0x72,
+    0x29, 0x28, 0x73, 0x29, 0x28, 0x74, 0x29, 0x28, 0x75, 0x29, 0x28, 0x76,
+    0x29, 0x28, 0x77, 0x29, 0x28, 0x78, 0x29, 0x28, 0x79, 0x29, 0x28, 0x7A,
+    0x29, 0x3014, 0x73, 0x3015, 0x63, 0x72, 0x63, 0x64, 0x77, 0x7A, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
+    0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A,
+    0x68, 0x76, 0x6D, 0x76, 0x73, 0x64, 0x73, 0x73, 0x70, 0x70, 0x76, 0x77,
+    0x63, 0x6D, 0x63, 0x6D, 0x64, 0x6D, 0x72, 0x64, 0x6A, 0x307B, 0x304B, 0x30B3,
+    0x30B3, 0x30B5, 0x624B, 0x5B57, 0x53CC, 0x30C7, 0x4E8C, 0x591A, 0x89E3, 0x5929, 0x4EA4, 0x6620,
+    0x7121, 0x6599, 0x524D, 0x5F8C, 0x518D, 0x65B0, 0x521D, 0x7D42, 0x751F, 0x8CA9, 0x58F0, 0x5439,
+    0x6F14, 0x6295, 0x6355, 0x4E00, 0x4E09, 0x904A, 0x5DE6, 0x4E2D, 0x53F3, 0x6307, 0x8D70, 0x6253,
+    0x7981, 0x7A7A, 0x5408, 0x6E80, 0x6709, 0x6708, 0x7533, 0x5272, 0x55B6, 0x914D, 0x3014, 0x672C,
+    0x3015, 0x3014, 0x4E09, 0x3015, 0x3014, 0x4E8C, 0x3015, 0x3014, 0x5B89, 0x3015, 0x3014, 0x70B9,
+    0x3015, 0x3014, 0x6253, 0x3015, 0x3014, 0x76D7, 0x3015, 0x3014, 0x52DD, 0x3015, 0x3014, 0x6557,
+    0x3015, 0x5F97, 0x53EF, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+    0x39, 0x4E3D, 0x4E38, 0x4E41, 0x20122, 0x4F60, 0x4FAE, 0x4FBB, 0x5002, 0x507A, 0x5099, 0x50E7,
+    0x50CF, 0x349E, 0x2063A, 0x514D, 0x5154, 0x5164, 0x5177, 0x2051C, 0x34B9, 0x5167, 0x518D, 0x2054B,
+    0x5197, 0x51A4, 0x4ECC, 0x51AC, 0x51B5, 0x291DF, 0x51F5, 0x5203, 0x34DF, 0x523B, 0x5246, 0x5272,
+    0x5277, 0x3515, 0x52C7, 0x52C9, 0x52E4, 0x52FA, 0x5305, 0x5306, 0x5317, 0x5349, 0x5351, 0x535A,
+    0x5373, 0x537D, 0x537F, 0x537F, 0x537F, 0x20A2C, 0x7070, 0x53CA, 0x53DF, 0x20B63, 0x53EB, 0x53F1,
+    0x5406, 0x549E, 0x5438, 0x5448, 0x5468, 0x54A2, 0x54F6, 0x5510, 0x5553, 0x5563, 0x5584, 0x5584,
+    0x5599, 0x55AB, 0x55B3, 0x55C2, 0x5716, 0x5606, 0x5717, 0x5651, 0x5674, 0x5207, 0x58EE, 0x57CE,
+    0x57F4, 0x580D, 0x578B, 0x5832, 0x5831, 0x58AC, 0x214E4, 0x58F2, 0x58F7, 0x5906, 0x591A, 0x5922,
+    0x5962, 0x216A8, 0x216EA, 0x59EC, 0x5A1B, 0x5A27, 0x59D8, 0x5A66, 0x36EE, 0x36FC, 0x5B08, 0x5B3E,
+    0x5B3E, 0x219C8, 0x5BC3, 0x5BD8, 0x5BE7, 0x5BF3, 0x21B18, 0x5BFF, 0x5C06, 0x5F53, 0x5C22, 0x3781,
+    0x5C60, 0x5C6E, 0x5CC0, 0x5C8D, 0x21DE4, 0x5D43, 0x21DE6, 0x5D6E, 0x5D6B, 0x5D7C, 0x5DE1, 0x5DE2,
+    0x382F, 0x5DFD, 0x5E28, 0x5E3D, 0x5E69, 0x3862, 0x22183, 0x387C, 0x5EB0, 0x5EB3, 0x5EB6, 0x5ECA,
+    0x2A392, 0x5EFE, 0x22331, 0x22331, 0x8201, 0x5F22, 0x5F22, 0x38C7, 0x232B8, 0x261DA, 0x5F62, 0x5F6B,
+    0x38E3, 0x5F9A, 0x5FCD, 0x5FD7, 0x5FF9, 0x6081, 0x393A, 0x391C, 0x6094, 0x226D4, 0x60C7, 0x6148,
+    0x614C, 0x614E, 0x614C, 0x617A, 0x618E, 0x61B2, 0x61A4, 0x61AF, 0x61DE, 0x61F2, 0x61F6, 0x6210,
+    0x621B, 0x625D, 0x62B1, 0x62D4, 0x6350, 0x22B0C, 0x633D, 0x62FC, 0x6368, 0x6383, 0x63E4, 0x22BF1,
+    0x6422, 0x63C5, 0x63A9, 0x3A2E, 0x6469, 0x647E, 0x649D, 0x6477, 0x3A6C, 0x654F, 0x656C, 0x2300A,
+    0x65E3, 0x66F8, 0x6649, 0x3B19, 0x6691, 0x3B08, 0x3AE4, 0x5192, 0x5195, 0x6700, 0x669C, 0x80AD,
+    0x43D9, 0x6717, 0x671B, 0x6721, 0x675E, 0x6753, 0x233C3, 0x3B49, 0x67FA, 0x6785, 0x6852, 0x6885,
+    0x2346D, 0x688E, 0x681F, 0x6914, 0x3B9D, 0x6942, 0x69A3, 0x69EA, 0x6AA8, 0x236A3, 0x6ADB, 0x3C18,
+    0x6B21, 0x238A7, 0x6B54, 0x3C4E, 0x6B72, 0x6B9F, 0x6BBA, 0x6BBB, 0x23A8D, 0x21D0B, 0x23AFA, 0x6C4E,
+    0x23CBC, 0x6CBF, 0x6CCD, 0x6C67, 0x6D16, 0x6D3E, 0x6D77, 0x6D41, 0x6D69, 0x6D78, 0x6D85, 0x23D1E,
+    0x6D34, 0x6E2F, 0x6E6E, 0x3D33, 0x6ECB, 0x6EC7, 0x23ED1, 0x6DF9, 0x6F6E, 0x23F5E, 0x23F8E, 0x6FC6,
+    0x7039, 0x701E, 0x701B, 0x3D96, 0x704A, 0x707D, 0x7077, 0x70AD, 0x20525, 0x7145, 0x24263, 0x719C,
+    0x243AB, 0x7228, 0x7235, 0x7250, 0x24608, 0x7280, 0x7295, 0x24735, 0x24814, 0x737A, 0x738B, 0x3EAC,
+    0x73A5, 0x3EB8, 0x3EB8, 0x7447, 0x745C, 0x7471, 0x7485, 0x74CA, 0x3F1B, 0x7524, 0x24C36, 0x753E,
+    0x24C92, 0x7570, 0x2219F, 0x7610, 0x24FA1, 0x24FB8, 0x25044, 0x3FFC, 0x4008, 0x76F4, 0x250F3, 0x250F2,
+    0x25119, 0x25133, 0x771E, 0x771F, 0x771F, 0x774A, 0x4039, 0x778B, 0x4046, 0x4096, 0x2541D, 0x784E,
+    0x788C, 0x78CC, 0x40E3, 0x25626, 0x7956, 0x2569A, 0x256C5, 0x798F, 0x79EB, 0x412F, 0x7A40, 0x7A4A,
+    0x7A4F, 0x2597C, 0x25AA7, 0x25AA7, 0x7AEE, 0x4202, 0x25BAB, 0x7BC6, 0x7BC9, 0x4227, 0x25C80, 0x7CD2,
+    0x42A0, 0x7CE8, 0x7CE3, 0x7D00, 0x25F86, 0x7D63, 0x4301, 0x7DC7, 0x7E02, 0x7E45, 0x4334, 0x26228,
+    0x26247, 0x4359, 0x262D9, 0x7F7A, 0x2633E, 0x7F95, 0x7FFA, 0x8005, 0x264DA, 0x26523, 0x8060, 0x265A8,
+    0x8070, 0x2335F, 0x43D5, 0x80B2, 0x8103, 0x440B, 0x813E, 0x5AB5, 0x267A7, 0x267B5, 0x23393, 0x2339C,
+    0x8201, 0x8204, 0x8F9E, 0x446B, 0x8291, 0x828B, 0x829D, 0x52B3, 0x82B1, 0x82B3, 0x82BD, 0x82E6,
+    0x26B3C, 0x82E5, 0x831D, 0x8363, 0x83AD, 0x8323, 0x83BD, 0x83E7, 0x8457, 0x8353, 0x83CA, 0x83CC,
+    0x83DC, 0x26C36, 0x26D6B, 0x26CD5, 0x452B, 0x84F1, 0x84F3, 0x8516, 0x273CA, 0x8564, 0x26F2C, 0x455D,
+    0x4561, 0x26FB1, 0x270D2, 0x456B, 0x8650, 0x865C, 0x8667, 0x8669, 0x86A9, 0x8688, 0x870E, 0x86E2,
+    0x8779, 0x8728, 0x876B, 0x8786, 0x45D7, 0x87E1, 0x8801, 0x45F9, 0x8860, 0x8863, 0x27667, 0x88D7,
+    0x88DE, 0x4635, 0x88FA, 0x34BB, 0x278AE, 0x27966, 0x46BE, 0x46C7, 0x8AA0, 0x8AED, 0x8B8A, 0x8C55,
+    0x27CA8, 0x8CAB, 0x8CC1, 0x8D1B, 0x8D77, 0x27F2F, 0x20804, 0x8DCB, 0x8DBC, 0x8DF0, 0x208DE, 0x8ED4,
+    0x8F38, 0x285D2, 0x285ED, 0x9094, 0x90F1, 0x9111, 0x2872E, 0x911B, 0x9238, 0x92D7, 0x92D8, 0x927C,
+    0x93F9, 0x9415, 0x28BFA, 0x958B, 0x4995, 0x95B7, 0x28D77, 0x49E6, 0x96C3, 0x5DB2, 0x9723, 0x29145,
+    0x2921A, 0x4A6E, 0x4A76, 0x97E0, 0x2940A, 0x4AB2, 0x29496, 0x980B, 0x980B, 0x9829, 0x295B6, 0x98E2,
+    0x4B33, 0x9929, 0x99A7, 0x99C2, 0x99FE, 0x4BCE, 0x29B30, 0x9B12, 0x9C40, 0x9CFD, 0x4CCE, 0x4CED,
+    0x9D67, 0x2A0CE, 0x4CF8, 0x2A105, 0x2A20E, 0x2A291, 0x9EBB, 0x4D56, 0x9EF9, 0x9EFE, 0x9F05, 0x9F0F,
+    0x9F16, 0x9F3B, 0x2A600,
+};
+
+// 标准组合（NFC）：基字符 + 组合字符 -> 预组合字符，按(first, second)升序；不含韩文音节（按算法组合）
+struct ComposePair {
+    std::uint32_t first;
+    std::uint32_t second;
+    std::uint32_t composite;
+};
+constexpr ComposePair kComposePairs[] = {
+    {0x3C, 0x338, 0x226E}, {0x3D, 0x338, 0x2260}, {0x3E, 0x338, 0x226F}, {0x61, 0x300, 0xE0}, {0x61, 0x301, 0xE1},
+    {0x61, 0x302, 0xE2}, {0x61, 0x303, 0xE3}, {0x61, 0x304, 0x101}, {0x61, 0x306, 0x103}, {0x61, 0x307, 0x227},
+    {0x61, 0x308, 0xE4}, {0x61, 0x309, 0x1EA3}, {0x61, 0x30A, 0xE5}, {0x61, 0x30C, 0x1CE}, {0x61, 0x30F, 0x201},
+    {0x61, 0x311, 0x203}, {0x61, 0x323, 0x1EA1}, {0x61, 0x325, 0x1E01}, {0x61, 0x328, 0x105}, {0x62, 0x307, 0x1E03},
+    {0x62, 0x323, 0x1E05}, {0x62, 0x331, 0x1E07}, {0x63, 0x301, 0x107}, {0x63, 0x302, 0x109}, {0x63, 0x307, 0x10B},
+    {0x63, 0x30C, 0x10D}, {0x63, 0x327, 0xE7}, {0x64, 0x307, 0x1E0B}, {0x64, 0x30C, 0x10F}, {0x64, 0x323, 0x1E0D},
+    {0x64, 0x327, 0x1E11}, {0x64, 0x32D, 0x1E13}, {0x64, 0x331, 0x1E0F}, {0x65, 0x300, 0xE8}, {0x65, 0x301, 0xE9},
+    {0x65, 0x302, 0xEA}, {0x65, 0x303, 0x1EBD}, {0x65, 0x304, 0x113}, {0x65, 0x306, 0x115}, {0x65, 0x307, 0x117},
+    {0x65, 0x308, 0xEB}, {0x65, 0x309, 0x1EBB}, {0x65, 0x30C, 0x11B}, {0x65, 0x30F, 0x205}, {0x65, 0x311, 0x207},
+    {0x65, 0x323, 0x1EB9}, {0x65, 0x327, 0x229}, {0x65, 0x328, 0x119}, {0x65, 0x32D, 0x1E19}, {0x65, 0x330, 0x1E1B},
+    {0x66, 0x307, 0x1E1F}, {0x67, 0x301, 0x1F5}, {0x67, 0x302, 0x11D}, {0x67, 0x304, 0x1E21}, {0x67, 0x306, 0x11F},
+    {0x67, 0x307, 0x121}, {0x67, 0x30C, 0x1E7}, {0x67, 0x327, 0x123}, {0x68, 0x302, 0x125}, {0x68, 0x307, 0x1E23},
+    {0x68, 0x308, 0x1E27}, {0x68, 0x30C, 0x21F}, {0x68, 0x323, 0x1E25}, {0x68, 0x327, 0x1E29}, {0x68, 0x32E, 0x1E2B},
+    {0x68, 0x331, 0x1E96}, {0x69, 0x300, 0xEC}, {0x69, 0x301, 0xED}, {0x69, 0x302, 0xEE}, {0x69, 0x303, 0x129},
+    {0x69, 0x304, 0x12B}, {0x69, 0x306, 0x12D}, {0x69, 0x308, 0xEF}, {0x69, 0x309, 0x1EC9}, {0x69, 0x30C, 0x1D0},
+    {0x69, 0x30F, 0x209}, {0x69, 0x311, 0x20B}, {0x69, 0x323, 0x1ECB}, {0x69, 0x328, 0x12F}, {0x69, 0x330, 0x1E2D},
+    {0x6A, 0x302, 0x135}, {0x6A, 0x30C, 0x1F0}, {0x6B, 0x301, 0x1E31}, {0x6B, 0x30C, 0x1E9}, {0x6B, 0x323, 0x1E33},
+    {0x6B, 0x327, 0x137}, {0x6B, 0x331, 0x1E35}, {0x6C, 0x301, 0x13A}, {0x6C, 0x30C, 0x13E}, {0x6C, 0x323, 0x1E37},
+    {0x6C, 0x327, 0x13C}, {0x6C, 0x32D, 0x1E3D}, {0x6C, 0x331, 0x1E3B}, {0x6D, 0x301, 0x1E3F}, {0x6D, 0x307, 0x1E41},
+    {0x6D, 0x323, 0x1E43}, {0x6E, 0x300, 0x1F9}, {0x6E, 0x301, 0x144}, {0x6E, 0x303, 0xF1}, {0x6E, 0x307, 0x1E45},
+    {0x6E, 0x30C, 0x148}, {0x6E, 0x323, 0x1E47}, {0x6E, 0x327, 0x146}, {0x6E, 0x32D, 0x1E4B}, {0x6E, 0x331, 0x1E49},
+    {0x6F, 0x300, 0xF2}, {0x6F, 0x301, 0xF3}, {0x6F, 0x302, 0xF4}, {0x6F, 0x303, 0xF5}, {0x6F, 0x304, 0x14D},
+    {0x6F, 0x306, 0x14F}, {0x6F, 0x307, 0x22F}, {0x6F, 0x308, 0xF6}, {0x6F, 0x309, 0x1ECF}, {0x6F, 0x30B, 0x151},
+    {0x6F, 0x30C, 0x1D2}, {0x6F, 0x30F, 0x20D}, {0x6F, 0x311, 0x20F}, {0x6F, 0x31B, 0x1A1}, {0x6F, 0x323, 0x1ECD},
+    {0x6F, 0x328, 0x1EB}, {0x70, 0x301, 0x1E55}, {0x70, 0x307, 0x1E57}, {0x72, 0x301, 0x155}, {0x72, 0x307, 0x1E59},
+    {0x72, 0x30C, 0x159}, {0x72, 0x30F, 0x211}, {0x72, 0x311, 0x213}, {0x72, 0x323, 0x1E5B}, {0x72, 0x327, 0x157},
+    {0x72, 0x331, 0x1E5F}, {0x73, 0x301, 0x15B}, {0x73, 0x302, 0x15D}, {0x73, 0x307, 0x1E61}, {0x73, 0x30C, 0x161},
+    {0x73, 0x323, 0x1E63}, {0x73, 0x326, 0x219}, {0x73, 0x327, 0x15F}, {0x74, 0x307, 0x1E6B}, {0x74, 0x308, 0x1E97},
+    {0x74, 0x30C, 0x165}, {0x74, 0x323, 0x1E6D}, {0x74, 0x326, 0x21B}, {0x74, 0x327, 0x163}, {0x74, 0x32D, 0x1E71},
+    {0x74, 0x331, 0x1E6F}, {0x75, 0x300, 0xF9}, {0x75, 0x301, 0xFA}, {0x75, 0x302, 0xFB}, {0x75, 0x303, 0x169},
+    {0x75, 0x304, 0x16B}, {0x75, 0x306, 0x16D}, {0x75, 0x308, 0xFC}, {0x75, 0x309, 0x1EE7}, {0x75, 0x30A, 0x16F},
+    {0x75, 0x30B, 0x171}, {0x75, 0x30C, 0x1D4}, {0x75, 0x30F, 0x215}, {0x75, 0x311, 0x217}, {0x75, 0x31B, 0x1B0},
+    {0x75, 0x323, 0x1EE5}, {0x75, 0x324, 0x1E73}, {0x75, 0x328, 0x173}, {0x75, 0x32D, 0x1E77}, {0x75, 0x330, 0x1E75},
+    {0x76, 0x303, 0x1E7D}, {0x76, 0x323, 0x1E7F}, {0x77, 0x300, 0x1E81}, {0x77, 0x301, 0x1E83}, {0x77, 0x302, 0x175},
+    {0x77, 0x307, 0x1E87}, {0x77, 0x308, 0x1E85}, {0x77, 0x30A, 0x1E98}, {0x77, 0x323, 0x1E89}, {0x78, 0x307, 0x1E8B},
+    {0x78, 0x308, 0x1E8D}, {0x79, 0x300, 0x1EF3}, {0x79, 0x301, 0xFD}, {0x79, 0x302, 0x177}, {0x79, 0x303, 0x1EF9},
+    {0x79, 0x304, 0x233}, {0x79, 0x307, 0x1E8F}, {0x79, 0x308, 0xFF}, {0x79, 0x309, 0x1EF7}, {0x79, 0x30A, 0x1E99},
+    {0x79, 0x323, 0x1EF5}, {0x7A, 0x301, 0x17A}, {0x7A, 0x302, 0x1E91}, {0x7A, 0x307, 0x17C}, {0x7A, 0x30C, 0x17E},
+    {0x7A, 0x323, 0x1E93}, {0x7A, 0x331, 0x1E95}, {0xE2, 0x300, 0x1EA7}, {0xE2, 0x301, 0x1EA5}, {0xE2, 0x303, 0x1EAB},
+    {0xE2, 0x309, 0x1EA9}, {0xE4, 0x304, 0x1DF}, {0xE5, 0x301, 0x1FB}, {0xE6, 0x301, 0x1FD}, {0xE6, 0x304, 0x1E3},
+    {0xE7, 0x301, 0x1E09}, {0xEA, 0x300, 0x1EC1}, {0xEA, 0x301, 0x1EBF}, {0xEA, 0x303, 0x1EC5}, {0xEA, 0x309, 0x1EC3},
+    {0xEF, 0x301, 0x1E2F}, {0xF4, 0x300, 0x1ED3}, {0xF4, 0x301, 0x1ED1}, {0xF4, 0x303, 0x1ED7}, {0xF4, 0x309, 0x1ED5},
+    {0xF5, 0x301, 0x1E4D}, {0xF5, 0x304, 0x22D}, {0xF5, 0x308, 0x1E4F}, {0xF6, 0x304, 0x22B}, {0xF8, 0x301, 0x1FF},
+    {0xFC, 0x300, 0x1DC}, {0xFC, 0x301, 0x1D8}, {0xFC, 0x304, 0x1D6}, {0xFC, 0x30C, 0x1DA}, {0x103, 0x300, 0x1EB1},
+    {0x103, 0x301, 0x1EAF}, {0x103, 0x303, 0x1EB5}, {0x103, 0x309, 0x1EB3}, {0x113, 0x300, 0x1E15}, {0x113, 0x301, 0x1E17},
+    {0x14D, 0x300, 0x1E51}, {0x14D, 0x301, 0x1E53}, {0x15B, 0x307, 0x1E65}, {0x161, 0x307, 0x1E67}, {0x169, 0x301, 0x1E79},
+    {0x16B, 0x308, 0x1E7B}, {0x1A1, 0x300, 0x1EDD}, {0x1A1, 0x301, 0x1EDB}, {0x1A1, 0x303, 0x1EE1}, {0x1A1, 0x309, 0x1EDF},
+    {0x1A1, 0x323, 0x1EE3}, {0x1B0, 0x300, 0x1EEB}, {0x1B0, 0x301, 0x1EE9}, {0x1B0, 0x303, 0x1EEF}, {0x1B0, 0x309, 0x1EED},
+    {0x1B0, 0x323, 0x1EF1}, {0x1EB, 0x304, 0x1ED}, {0x227, 0x304, 0x1E1}, {0x229, 0x306, 0x1E1D}, {0x22F, 0x304, 0x231},
+    {0x292, 0x30C, 0x1EF}, {0x3B1, 0x300, 0x1F70}, {0x3B1, 0x301, 0x3AC}, {0x3B1, 0x304, 0x1FB1}, {0x3B1, 0x306, 0x1FB0},
+    {0x3B1, 0x313, 0x1F00}, {0x3B1, 0x314, 0x1F01}, {0x3B1, 0x342, 0x1FB6}, {0x3B5, 0x300, 0x1F72}, {0x3B5, 0x301, 0x3AD},
+    {0x3B5, 0x313, 0x1F10}, {0x3B5, 0x314, 0x1F11}, {0x3B7, 0x300, 0x1F74}, {0x3B7, 0x301, 0x3AE}, {0x3B7, 0x313, 0x1F20},
+    {0x3B7, 0x314, 0x1F21}, {0x3B7, 0x342, 0x1FC6}, {0x3B9, 0x300, 0x1F76}, {0x3B9, 0x301, 0x3AF}, {0x3B9, 0x304, 0x1FD1},
+    {0x3B9, 0x306, 0x1FD0}, {0x3B9, 0x308, 0x3CA}, {0x3B9, 0x313, 0x1F30}, {0x3B9, 0x314, 0x1F31}, {0x3B9, 0x342, 0x1FD6},
+    {0x3BF, 0x300, 0x1F78}, {0x3BF, 0x301, 0x3CC}, {0x3BF, 0x313, 0x1F40}, {0x3BF, 0x314, 0x1F41}, {0x3C1, 0x313, 0x1FE4},
+    {0x3C1, 0x314, 0x1FE5}, {0x3C5, 0x300, 0x1F7A}, {0x3C5, 0x301, 0x3CD}, {0x3C5, 0x304, 0x1FE1}, {0x3C5, 0x306, 0x1FE0},
+    {0x3C5, 0x308, 0x3CB}, {0x3C5, 0x313, 0x1F50}, {0x3C5, 0x314, 0x1F51}, {0x3C5, 0x342, 0x1FE6}, {0x3C9, 0x300, 0x1F7C},
+    {0x3C9, 0x301, 0x3CE}, {0x3C9, 0x313, 0x1F60}, {0x3C9, 0x314, 0x1F61}, {0x3C9, 0x342, 0x1FF6}, {0x3CA, 0x300, 0x1FD2},
+    {0x3CA, 0x301, 0x390}, {0x3CA, 0x342, 0x1FD7}, {0x3CB, 0x300, 0x1FE2}, {0x3CB, 0x301, 0x3B0}, {0x3CB, 0x342, 0x1FE7},
+    {0x430, 0x306, 0x4D1}, {0x430, 0x308, 0x4D3}, {0x433, 0x301, 0x453}, {0x435, 0x300, 0x450}, {0x435, 0x306, 0x4D7},
+    {0x435, 0x308, 0x451}, {0x436, 0x306, 0x4C2}, {0x436, 0x308, 0x4DD}, {0x437, 0x308, 0x4DF}, {0x438, 0x300, 0x45D},
+    {0x438, 0x304, 0x4E3}, {0x438, 0x306, 0x439}, {0x438, 0x308, 0x4E5}, {0x43A, 0x301, 0x45C}, {0x43E, 0x308, 0x4E7},
+    {0x443, 0x304, 0x4EF}, {0x443, 0x306, 0x45E}, {0x443, 0x308, 0x4F1}, {0x443, 0x30B, 0x4F3}, {0x447, 0x308, 0x4F5},
+    {0x44B, 0x308, 0x4F9}, {0x44D, 0x308, 0x4ED}, {0x456, 0x308, 0x457}, {0x475, 0x30F, 0x477}, {0x4D9, 0x308, 0x4DB},
+    {0x4E9, 0x308, 0x4EB}, {0x627, 0x653, 0x622}, {0x627, 0x654, 0x623}, {0x627, 0x655, 0x625}, {0x648, 0x654, 0x624},
+    {0x64A, 0x654, 0x626}, {0x6C1, 0x654, 0x6C2}, {0x6D2, 0x654, 0x6D3}, {0x6D5, 0x654, 0x6C0}, {0x928, 0x93C, 0x929},
+    {0x930, 0x93C, 0x931}, {0x933, 0x93C, 0x934}, {0x9C7, 0x9BE, 0x9CB}, {0x9C7, 0x9D7, 0x9CC}, {0xB47, 0xB3E, 0xB4B},
+    {0xB47, 0xB56, 0xB48}, {0xB47, 0xB57, 0xB4C}, {0xB92, 0xBD7, 0xB94}, {0xBC6, 0xBBE, 0xBCA}, {0xBC6, 0xBD7, 0xBCC},
+    {0xBC7, 0xBBE, 0xBCB}, {0xC46, 0xC56, 0xC48}, {0xCBF, 0xCD5, 0xCC0}, {0xCC6, 0xCC2, 0xCCA}, {0xCC6, 0xCD5, 0xCC7},
+    {0xCC6, 0xCD6, 0xCC8}, {0xCCA, 0xCD5, 0xCCB}, {0xD46, 0xD3E, 0xD4A}, {0xD46, 0xD57, 0xD4C}, {0xD47, 0xD3E, 0xD4B},
+    {0xDD9, 0xDCA, 0xDDA}, {0xDD9, 0xDCF, 0xDDC}, {0xDD9, 0xDDF, 0xDDE}, {0xDDC, 0xDCA, 0xDDD}, {0x1025, 0x102E, 0x1026},
+    {0x1B05, 0x1B35, 0x1B06}, {0x1B07, 0x1B35, 0x1B08}, {0x1B09, 0x1B35, 0x1B0A}, {0x1B0B, 0x1B35, 0x1B0C}, {0x1B0D, 0x1B35, 0x1B0E},
+    {0x1B11, 0x1B35, 0x1B12}, {0x1B3A, 0x1B35, 0x1B3B}, {0x1B3C, 0x1B35, 0x1B3D}, {0x1B3E, 0x1B35, 0x1B40}, {0x1B3F, 0x1B35, 0x1B41},
+    {0x1B42, 0x1B35, 0x1B43}, {0x1E37, 0x304, 0x1E39}, {0x1E5B, 0x304, 0x1E5D}, {0x1E63, 0x307, 0x1E69}, {0x1EA1, 0x302, 0x1EAD},
+    {0x1EA1, 0x306, 0x1EB7}, {0x1EB9, 0x302, 0x1EC7}, {0x1ECD, 0x302, 0x1ED9}, {0x1F00, 0x300, 0x1F02}, {0x1F00, 0x301, 0x1F04},
+    {0x1F00, 0x342, 0x1F06}, {0x1F01, 0x300, 0x1F03}, {0x1F01, 0x301, 0x1F05}, {0x1F01, 0x342, 0x1F07}, {0x1F10, 0x300, 0x1F12},
+    {0x1F10, 0x301, 0x1F14}, {0x1F11, 0x300, 0x1F13}, {0x1F11, 0x301, 0x1F15}, {0x1F20, 0x300, 0x1F22}, {0x1F20, 0x301, 0x1F24},
+    {0x1F20, 0x342, 0x1F26}, {0x1F21, 0x300, 0x1F23}, {0x1F21, 0x301, 0x1F25}, {0x1F21, 0x342, 0x1F27}, {0x1F30, 0x300, 0x1F32},
+    {0x1F30, 0x301, 0x1F34}, {0x1F30, 0x342, 0x1F36}, {0x1F31, 0x300, 0x1F33}, {0x1F31, 0x301, 0x1F35}, {0x1F31, 0x342, 0x1F37},
+    {0x1F40, 0x300, 0x1F42}, {0x1F40, 0x301, 0x1F44}, {0x1F41, 0x300, 0x1F43}, {0x1F41, 0x301, 0x1F45}, {0x1F50, 0x300, 0x1F52},
+    {0x1F50, 0x301, 0x1F54}, {0x1F50, 0x342, 0x1F56}, {0x1F51, 0x300, 0x1F53}, {0x1F51, 0x301, 0x1F55}, {0x1F51, 0x342, 0x1F57},
+    {0x1F60, 0x300, 0x1F62}, {0x1F60, 0x301, 0x1F64}, {0x1F60, 0x342, 0x1F66}, {0x1F61, 0x300, 0x1F63}, {0x1F61, 0x301, 0x1F65},
+    {0x1F61, 0x342, 0x1F67}, {0x2190, 0x338, 0x219A}, {0x2192, 0x338, 0x219B}, {0x2194, 0x338, 0x21AE}, {0x21D0, 0x338, 0x21CD},
+    {0x21D2, 0x338, 0x21CF}, {0x21D4, 0x338, 0x21CE}, {0x2203, 0x338, 0x2204}, {0x2208, 0x338, 0x2209}, {0x220B, 0x338, 0x220C},
+    {0x2223, 0x338, 0x2224}, {0x2225, 0x338, 0x2226}, {0x223C, 0x338, 0x2241}, {0x2243, 0x338, 0x2244}, {0x2245, 0x338, 0x2247},
+    {0x2248, 0x338, 0x2249}, {0x224D, 0x338, 0x226D}, {0x2261, 0x338, 0x2262}, {0x2264, 0x338, 0x2270}, {0x2265, 0x338, 0x2271},
+    {0x2272, 0x338, 0x2274}, {0x2273, 0x338, 0x2275}, {0x2276, 0x338, 0x2278}, {0x2277, 0x338, 0x2279}, {0x227A, 0x338, 0x2280},
+    {0x227B, 0x338, 0x2281}, {0x227C, 0x338, 0x22E0}, {0x227D, 0x338, 0x22E1}, {0x2282, 0x338, 0x2284}, {0x2283, 0x338, 0x2285},
+    {0x2286, 0x338, 0x2288}, {0x2287, 0x338, 0x2289}, {0x2291, 0x338, 0x22E2}, {0x2292, 0x338, 0x22E3}, {0x22A2, 0x338, 0x22AC},
+    {0x22A8, 0x338, 0x22AD}, {0x22A9, 0x338, 0x22AE}, {0x22AB, 0x338, 0x22AF}, {0x22B2, 0x338, 0x22EA}, {0x22B3, 0x338, 0x22EB},
+    {0x22B4, 0x338, 0x22EC}, {0x22B5, 0x338, 0x22ED}, {0x3046, 0x3099, 0x3094}, {0x304B, 0x3099, 0x304C}, {0x304D, 0x3099, 0x304E},
+    {0x304F, 0x3099, 0x3050}, {0x3051, 0x3099, 0x3052}, {0x3053, 0x3099, 0x3054}, {0x3055, 0x3099, 0x3056}, {0x3057, 0x3099, 0x3058},
+    {0x3059, 0x3099, 0x305A}, {0x305B, 0x3099, 0x305C}, {0x305D, 0x3099, 0x305E}, {0x305F, 0x3099, 0x3060}, {0x3061, 0x3099, 0x3062},
+    {0x3064, 0x3099, 0x3065}, {0x3066, 0x3099, 0x3067}, {0x3068, 0x3099, 0x3069}, {0x306F, 0x3099, 0x3070}, {0x306F, 0x309A, 0x3071},
+    {0x3072, 0x3099, 0x3073}, {0x3072, 0x309A, 0x3074}, {0x3075, 0x3099, 0x3076}, {0x3075, 0x309A, 0x3077}, {0x3078, 0x3099, 0x3079},
+    {0x3078, 0x309A, 0x307A}, {0x307B, 0x3099, 0x307C}, {0x307B, 0x309A, 0x307D}, {0x309D, 0x3099, 0x309E}, {0x30A6, 0x3099, 0x30F4},
+    {0x30AB, 0x3099, 0x30AC}, {0x30AD, 0x3099, 0x30AE}, {0x30AF, 0x3099, 0x30B0}, {0x30B1, 0x3099, 0x30B2}, {0x30B3, 0x3099, 0x30B4},
+    {0x30B5, 0x3099, 0x30B6}, {0x30B7, 0x3099, 0x30B8}, {0x30B9, 0x3099, 0x30BA}, {0x30BB, 0x3099, 0x30BC}, {0x30BD, 0x3099, 0x30BE},
+    {0x30BF, 0x3099, 0x30C0}, {0x30C1, 0x3099, 0x30C2}, {0x30C4, 0x3099, 0x30C5}, {0x30C6, 0x3099, 0x30C7}, {0x30C8, 0x3099, 0x30C9},
+    {0x30CF, 0x3099, 0x30D0}, {0x30CF, 0x309A, 0x30D1}, {0x30D2, 0x3099, 0x30D3}, {0x30D2, 0x309A, 0x30D4}, {0x30D5, 0x3099, 0x30D6},
+    {0x30D5, 0x309A, 0x30D7}, {0x30D8, 0x3099, 0x30D9}, {0x30D8, 0x309A, 0x30DA}, {0x30DB, 0x3099, 0x30DC}, {0x30DB, 0x309A, 0x30DD},
+    {0x30EF, 0x3099, 0x30F7}, {0x30F0, 0x3099, 0x30F8}, {0x30F1, 0x3099, 0x30F9}, {0x30F2, 0x3099, 0x30FA}, {0x30FD, 0x3099, 0x30FE},
+    {0x11099, 0x110BA, 0x1109A}, {0x1109B, 0x110BA, 0x1109C}, {0x110A5, 0x110BA, 0x110AB}, {0x11131, 0x11127, 0x1112E}, {0x11132, 0x11127, 0x1112F},
+    {0x11347, 0x1133E, 0x1134B}, {0x11347, 0x11357, 0x1134C}, {0x114B9, 0x114B0, 0x114BC}, {0x114B9, 0x114BA, 0x114BB}, {0x114B9, 0x114BD, 0x114BE},
+    {0x115B8, 0x115AF, 0x115BA}, {0x115B9, 0x115AF, 0x115BB}, {0x11935, 0x11930, 0x11938},
+};
+
+// 出现在组合对第二位的码点（升序），只有它们需要尝试与前一个码点组合
+constexpr std::uint32_t kComposeSeconds[] = {
+    0x300, 0x301, 0x302, 0x303, 0x304, 0x306, 0x307, 0x308, 0x309, 0x30A,
+    0x30B, 0x30C, 0x30F, 0x311, 0x313, 0x314, 0x31B, 0x323, 0x324, 0x325,
+    0x326, 0x327, 0x328, 0x32D, 0x32E, 0x330, 0x331, 0x338, 0x342, 0x653,
+    0x654, 0x655, 0x93C, 0x9BE, 0x9D7, 0xB3E, 0xB56, 0xB57, 0xBBE, 0xBD7,
+    0xC56, 0xCC2, 0xCD5, 0xCD6, 0xD3E, 0xD57, 0xDCA, 0xDCF, 0xDDF, 0x102E,
+    0x1B35, 0x3099, 0x309A, 0x110BA, 0x11127, 0x1133E, 0x11357, 0x114B0, 0x114BA, 0x114BD,
+    0x115AF, 0x11930,
+};
+
+} // namespace
@@ -0,0 +1,398 @@
+#include "track_bitmap.h"
+
+#include <algorithm>
+#include <iterator>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace {
+
+unsigned PopCount64(std::uint64_t word) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    return static_cast<unsigned>(__popcnt64(word));
+#else
+    return static_cast<unsigned>(__builtin_popcountll(word));
+#endif
+}
+
+unsigned CountTrailingZeros64(std::uint64_t word) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctzll(word));
+#endif
+}
+
+bool TestBit(const std::vector<std::uint64_t>& bits, std::uint16_t low) {
+    return (bits[low >> 6] >> (low & 63)) & 1;
+}
+
+} // namespace
+
+// ---------- 容器 ----------
+
+void TrackBitmap::Container::ToBitset() {
+    if (IsBitset()) return;
+    bits.assign(kBitsetWords, 0);
+    for (std::uint16_t low : array) bits[low >> 6] |= std::uint64_t(1) << (low & 63);
+    array.clear();
+    array.shrink_to_fit();
+}
+
+void TrackBitmap::Container::ToArray() {
+    if (!IsBitset()) return;
+    array.clear();
+    array.reserve(cardinality);
+    for (std::uint32_t w = 0; w < kBitsetWords; ++w) {
+        for (std::uint64_t word = bits[w]; word != 0; word &= word - 1) {
+            array.push_back(static_cast<std::uint16_t>(w * 64 + CountTrailingZeros64(word)));
+        }
+    }
+    bits.clear();
+    bits.shrink_to_fit();
+}
+
+void TrackBitmap::Container::Normalize() {
+    if (IsBitset() && cardinality <= kArrayMax) ToArray();
+    else if (!IsBitset() && cardinality > kArrayMax) ToBitset();
+}
+
+size_t TrackBitmap::FindContainer(std::uint16_t key, bool& found) const {
+    const auto it = std::lower_bound(m_containers.begin(), m_containers.end(), key,
+                                     [](const Container& c, std::uint16_t k) { return c.key < k; });
+    found = it != m_containers.end() && it->key == key;
+    return static_cast<size_t>(it - m_containers.begin());
+}
+
+// ---------- 构建与修改 ----------
+
+TrackBitmap TrackBitmap::FromSorted(const std::uint32_t* ids, size_t count) {
+    TrackBitmap bitmap;
+    for (size_t i = 0; i < count;) {
+        const std::uint16_t key = static_cast<std::uint16_t>(ids[i] >> 16);
+        size_t end = i;
+        while (end < count && (ids[end] >> 16) == key) ++end;
+        Container c;
+        c.key = key;
+        c.cardinality = static_cast<std::uint32_t>(end - i);
+        if (c.cardinality > kArrayMax) {
+            c.bits.assign(kBitsetWords, 0);
+            for (size_t k = i; k < end; ++k) c.bits[(ids[k] >> 6) & 1023] |= std::uint64_t(1) << (ids[k] & 63);
+        } else {
+            c.array.reserve(c.cardinality);
+            for (size_t k = i; k < end; ++k) c.array.push_back(static_cast<std::uint16_t>(ids[k]));
+        }
+        bitmap.m_containers.push_back(std::move(c));
+        i = end;
+    }
+    return bitmap;
+}
+
+TrackBitmap TrackBitmap::Range(std::uint32_t firstId, std::uint32_t endId) {
+    TrackBitmap bitmap;
+    for (std::uint64_t begin = firstId; begin < endId;) {
+        const std::uint16_t key = static_cast<std::uint16_t>(begin >> 16);
+        const std::uint64_t end = std::min<std::uint64_t>(endId, (std::uint64_t(key) + 1) << 16);
+        Container c;
+        c.key = key;
+        c.cardinality = static_cast<std::uint32_t>(end - begin);
+        c.bits.assign(kBitsetWords, 0);
+        for (std::uint64_t id = begin; id < end;) {
+            const std::uint32_t low = static_cast<std::uint32_t>(id & 0xFFFF);
+            if ((low & 63) == 0 && id + 64 <= end) {
+                c.bits[low >> 6] = ~std::uint64_t(0); // 整字填充
+                id += 64;
+            } else {
+                c.bits[low >> 6] |= std::uint64_t(1) << (low & 63);
+                ++id;
+            }
+        }
+        c.Normalize();
+        bitmap.m_containers.push_back(std::move(c));
+        begin = end;
+    }
+    return bitmap;
+}
+
+void TrackBitmap::Add(std::uint32_t id) {
+    const std::uint16_t key = static_cast<std::uint16_t>(id >> 16);
+    const std::uint16_t low = static_cast<std::uint16_t>(id);
+    size_t index;
+    bool found;
+    if (!m_containers.empty() && m_containers.back().key == key) {
+        index = m_containers.size() - 1; // 按升序追加的常见情形
+        found = true;
+    } else {
+        index = FindContainer(key, found);
+    }
+    if (!found) {
+        Container c;
+        c.key = key;
+        m_containers.insert(m_containers.begin() + static_cast<std::ptrdiff_t>(index), std::move(c));
+    }
+    Container& c = m_containers[index];
+    if (c.IsBitset()) {
+        std::uint64_t& word = c.bits[low >> 6];
+        const std::uint64_t bit = std::uint64_t(1) << (low & 63);
+        if (word & bit) return;
+        word |= bit;
+    } else {
+        if (c.array.empty() || c.array.back() < low) {
+            c.array.push_back(low);
+        } else {
+            const auto it = std::lower_bound(c.array.begin(), c.array.end(), low);
+            if (it != c.array.end() && *it == low) return;
+            c.array.insert(it, low);
+        }
+    }
+    ++c.cardinality;
+    c.Normalize();
+}
+
+void TrackBitmap::Remove(std::uint32_t id) {
+    bool found;
+    const size_t index = FindContainer(static_cast<std::uint16_t>(id >> 16), found);
+    if (!found) return;
+    Container& c = m_containers[index];
+    const std::uint16_t low = static_cast<std::uint16_t>(id);
+    if (c.IsBitset()) {
+        std::uint64_t& word = c.bits[low >> 6];
+        const std::uint64_t bit = std::uint64_t(1) << (low & 63);
+        if (!(word & bit)) return;
+        word &= ~bit;
+    } else {
+        const auto it = std::lower_bound(c.array.begin(), c.array.end(), low);
+        if (it == c.array.end() || *it != low) return;
+        c.array.erase(it);
+    }
+    if (--c.cardinality == 0) {
+        m_containers.erase(m_containers.begin() + static_cast<std::ptrdiff_t>(index));
+    } else {
+        c.Normalize();
+    }
+}
+
+// ---------- 查询 ----------
+
+bool TrackBitmap::Contains(std::uint32_t id) const {
+    bool found;
+    const size_t index = FindContainer(static_cast<std::uint16_t>(id >> 16), found);
+    if (!found) return false;
+    const Container& c = m_containers[index];
+    const std::uint16_t low = static_cast<std::uint16_t>(id);
+    return c.IsBitset() ? TestBit(c.bits, low) : std::binary_search(c.array.begin(), c.array.end(), low);
+}
+
+std::uint64_t TrackBitmap::Cardinality() const {
+    std::uint64_t total = 0;
+    for (const auto& c : m_containers) total += c.cardinality;
+    return total;
+}
+
+std::uint64_t TrackBitmap::Rank(std::uint32_t id) const {
+    const std::uint16_t key = static_cast<std::uint16_t>(id >> 16);
+    const std::uint16_t low = static_cast<std::uint16_t>(id);
+    std::uint64_t rank = 0;
+    for (const auto& c : m_containers) {
+        if (c.key < key) {
+            rank += c.cardinality;
+            continue;
+        }
+        if (c.key == key) {
+            if (c.IsBitset()) {
+                for (std::uint32_t w = 0; w < (low >> 6); ++w) rank += PopCount64(c.bits[w]);
+                rank += PopCount64(c.bits[low >> 6] & ((std::uint64_t(1) << (low & 63)) - 1));
+            } else {
+                rank += static_cast<std::uint64_t>(std::lower_bound(c.array.begin(), c.array.end(), low) -
+                                                   c.array.begin());
+            }
+        }
+        break;
+    }
+    return rank;
+}
+
+std::uint32_t TrackBitmap::Select(std::uint64_t index) const {
+    for (const auto& c : m_containers) {
+        if (index >= c.cardinality) {
+            index -= c.cardinality;
+            continue;
+        }
+        const std::uint32_t high = std::uint32_t(c.key) << 16;
+        if (!c.IsBitset()) return high | c.array[static_cast<size_t>(index)];
+        for (std::uint32_t w = 0; w < kBitsetWords; ++w) {
+            std::uint64_t word = c.bits[w];
+            const unsigned count = PopCount64(word);
+            if (index >= count) {
+                index -= count;
+                continue;
+            }
+            for (; index > 0; --index) word &= word - 1; // 去掉前index个置位
+            return high | (w * 64 + CountTrailingZeros64(word));
+        }
+    }
+    return kNotFound;
+}
+
+void TrackBitmap::AppendTo(std::vector<std::uint32_t>& out) const {
+    out.reserve(out.size() + static_cast<size_t>(Cardinality()));
+    for (const auto& c : m_containers) {
+        const std::uint32_t high = std::uint32_t(c.key) << 16;
+        if (!c.IsBitset()) {
+            for (std::uint16_t low : c.array) out.push_back(high | low);
+            continue;
+        }
+        for (std::uint32_t w = 0; w < kBitsetWords; ++w) {
+            for (std::uint64_t word = c.bits[w]; word != 0; word &= word - 1) {
+                out.push_back(high | (w * 64 + CountTrailingZeros64(word)));
+            }
+        }
+    }
+}
+
+size_t TrackBitmap::MemoryBytes() const {
+    size_t bytes = m_containers.capacity() * sizeof(Container);
+    for (const auto& c : m_containers) {
+        bytes += c.array.capacity() * sizeof(std::uint16_t) + c.bits.capacity() * sizeof(std::uint64_t);
+    }
+    return bytes;
+}
+
+// ---------- 集合运算（按key归并两组容器） ----------
+
+void TrackBitmap::AndContainers(const Container& a, const Container& b, Container& out) {
+    if (a.IsBitset() && b.IsBitset()) {
+        out.bits.resize(kBitsetWords);
+        std::uint32_t count = 0;
+        for (std::uint32_t w = 0; w < kBitsetWords; ++w) {
+            out.bits[w] = a.bits[w] & b.bits[w];
+            count += PopCount64(out.bits[w]);
+        }
+        out.cardinality = count;
+        out.Normalize();
+        return;
+    }
+    if (a.IsBitset() || b.IsBitset()) {
+        const Container& array = a.IsBitset() ? b : a;
+        const Container& bitset = a.IsBitset() ? a : b;
+        for (std::uint16_t low : array.array) {
+            if (TestBit(bitset.bits, low)) out.array.push_back(low);
+        }
+    } else {
+        std::set_intersection(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(),
+                              std::back_inserter(out.array));
+    }
+    out.cardinality = static_cast<std::uint32_t>(out.array.size());
+}
+
+void TrackBitmap::OrContainers(const Container& a, const Container& b, Container& out) {
+    if (!a.IsBitset() && !b.IsBitset()) {
+        out.array.reserve(a.array.size() + b.array.size());
+        std::set_union(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(), std::back_inserter(out.array));
+        out.cardinality = static_cast<std::uint32_t>(out.array.size());
+        out.Normalize();
+        return;
+    }
+    if (a.IsBitset() && b.IsBitset()) {
+        out.bits.resize(kBitsetWords);
+        for (std::uint32_t w = 0; w < kBitsetWords; ++w) out.bits[w] = a.bits[w] | b.bits[w];
+    } else {
+        const Container& array = a.IsBitset() ? b : a;
+        out.bits = (a.IsBitset() ? a : b).bits;
+        for (std::uint16_t low : array.array) out.bits[low >> 6] |= std::uint64_t(1) << (low & 63);
+    }
+    std::uint32_t count = 0;
+    for (std::uint64_t word : out.bits) count += PopCount64(word);
+    out.cardinality = count;
+}
+
+void TrackBitmap::AndNotContainers(const Container& a, const Container& b, Container& out) {
+    if (!a.IsBitset()) {
+        if (b.IsBitset()) {
+            for (std::uint16_t low : a.array) {
+                if (!TestBit(b.bits, low)) out.array.push_back(low);
+            }
+        } else {
+            std::set_difference(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(),
+                                std::back_inserter(out.array));
+        }
+        out.cardinality = static_cast<std::uint32_t>(out.array.size());
+        return;
+    }
+    out.bits = a.bits;
+    if (b.IsBitset()) {
+        for (std::uint32_t w = 0; w < kBitsetWords; ++w) out.bits[w] &= ~b.bits[w];
+    } else {
+        for (std::uint16_t low : b.array) out.bits[low >> 6] &= ~(std::uint64_t(1) << (low & 63));
+    }
+    std::uint32_t count = 0;
+    for (std::uint64_t word : out.bits) count += PopCount64(word);
+    out.cardinality = count;
+    out.Normalize();
+}
+
+TrackBitmap TrackBitmap::And(const TrackBitmap& a, const TrackBitmap& b) {
+    TrackBitmap result;
+    auto ia = a.m_containers.begin();
+    auto ib = b.m_containers.begin();
+    while (ia != a.m_containers.end() && ib != b.m_containers.end()) {
+        if (ia->key < ib->key) {
+            ++ia;
+        } else if (ib->key < ia->key) {
+            ++ib;
+        } else {
+            Container c;
+            c.key = ia->key;
+            AndContainers(*ia++, *ib++, c);
+            if (c.cardinality != 0) result.m_containers.push_back(std::move(c));
+        }
+    }
+    return result;
+}
+
+TrackBitmap TrackBitmap::Or(const TrackBitmap& a, const TrackBitmap& b) {
+    TrackBitmap result;
+    auto ia = a.m_containers.begin();
+    auto ib = b.m_containers.begin();
+    while (ia != a.m_containers.end() || ib != b.m_containers.end()) {
+        if (ib == b.m_containers.end() || (ia != a.m_containers.end() && ia->key < ib->key)) {
+            result.m_containers.push_back(*ia++);
+        } else if (ia == a.m_containers.end() || ib->key < ia->key) {
+            result.m_containers.push_back(*ib++);
+        } else {
+            Container c;
+            c.key = ia->key;
+            OrContainers(*ia++, *ib++, c);
+            result.m_containers.push_back(std::move(c));
+        }
+    }
+    return result;
+}
+
+TrackBitmap TrackBitmap::AndNot(const TrackBitmap& a, const TrackBitmap& b) {
+    TrackBitmap result;
+    auto ib = b.m_containers.begin();
+    for (const auto& ca : a.m_containers) {
+        while (ib != b.m_containers.end() && ib->key < ca.key) ++ib;
+        if (ib == b.m_containers.end() || ib->key != ca.key) {
+            result.m_containers.push_back(ca);
+            continue;
+        }
+        Container c;
+        c.key = ca.key;
+        AndNotContainers(ca, *ib, c);
+        if (c.cardinality != 0) result.m_containers.push_back(std::move(c));
+    }
+    return result;
+}
+
+void SplitRankedIds(std::vector<std::uint32_t>& ids, TrackBitmap& rest) {
+    size_t begin = ids.size();
+    while (begin > 0 && (begin == ids.size() || ids[begin - 1] < ids[begin])) --begin;
+    rest = TrackBitmap::FromSorted(ids.data() + begin, ids.size() - begin);
+    ids.resize(begin);
+}
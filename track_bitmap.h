@@ -0,0 +1,73 @@
+// 曲目id集合的压缩位图（roaring风格）：id按高16位分入容器，每个容器按密度选择存储方式
+// - 稀疏容器：低16位的升序数组（至多4096个，每个2字节）
+// - 稠密容器：65536位的位集（8KB），基数超过4096时使用
+// 交/并/差按容器逐对计算（数组与数组归并、数组与位集逐个测试、位集与位集逐字运算），百万曲目只有16个容器，
+// 组合“搜索结果 ∩ 非最近播放”等集合只需微秒级；支持基数、rank（小于id的成员数）与select（第k个成员）
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class TrackBitmap {
+public:
+    static constexpr std::uint32_t kNotFound = 0xFFFFFFFFu;
+
+    // 由升序（不重复）的id构建
+    static TrackBitmap FromSorted(const std::uint32_t* ids, size_t count);
+    // [firstId, endId)内的全部id
+    static TrackBitmap Range(std::uint32_t firstId, std::uint32_t endId);
+
+    static TrackBitmap And(const TrackBitmap& a, const TrackBitmap& b);
+    static TrackBitmap Or(const TrackBitmap& a, const TrackBitmap& b);
+    static TrackBitmap AndNot(const TrackBitmap& a, const TrackBitmap& b);
+
+    // 加入/移除单个id；加入比现有成员都大的id（按升序追加）时只涉及最后一个容器
+    void Add(std::uint32_t id);
+    void Remove(std::uint32_t id);
+    void Clear() { m_containers.clear(); }
+
+    bool Contains(std::uint32_t id) const;
+    bool Empty() const { return m_containers.empty(); }
+    std::uint64_t Cardinality() const;
+    // 小于id的成员数
+    std::uint64_t Rank(std::uint32_t id) const;
+    // 按升序第index个成员（从0开始），越界时返回kNotFound
+    std::uint32_t Select(std::uint64_t index) const;
+
+    // 按升序追加全部成员
+    void AppendTo(std::vector<std::uint32_t>& out) const;
+
+    // 占用的内存（字节），用于统计
+    size_t MemoryBytes() const;
+
+private:
+    static constexpr std::uint32_t kArrayMax = 4096;    // 稀疏容器的最大基数（超过时数组比位集更大）
+    static constexpr std::uint32_t kBitsetWords = 1024; // 65536位
+
+    struct Container {
+        std::uint16_t key = 0;                  // id的高16位
+        std::uint32_t cardinality = 0;
+        std::vector<std::uint16_t> array;       // 稀疏：低16位，升序
+        std::vector<std::uint64_t> bits;        // 稠密：kBitsetWords个字，稀疏时为空
+
+        bool IsBitset() const { return !bits.empty(); }
+        void ToBitset();
+        void ToArray();
+        // 位集运算之后按基数选择存储方式
+        void Normalize();
+    };
+
+    // key所在容器的下标，不存在时返回插入位置并置found为false
+    size_t FindContainer(std::uint16_t key, bool& found) const;
+
+    static void AndContainers(const Container& a, const Container& b, Container& out);
+    static void OrContainers(const Container& a, const Container& b, Container& out);
+    static void AndNotContainers(const Container& a, const Container& b, Container& out);
+
+    std::vector<Container> m_containers;    // 按key升序，不含空容器
+};
+
+// 把排列后的搜索结果（得分最高的在前，其余按id升序，见RankSearchResults）拆为两部分：
+// ids保留开头的非升序部分，末尾最长的升序部分移入rest（两者按此顺序拼接即原来的顺序）
+void SplitRankedIds(std::vector<std::uint32_t>& ids, TrackBitmap& rest);
@@ -0,0 +1,109 @@
+#include "track_list.h"
+
+#include <algorithm>
+#include <functional>
+
+std::uint32_t TrackPathPool::Add(std::wstring_view relPath) {
+    const std::uint32_t id = Size();
+    const size_t sep = relPath.find_last_of(L"/\\");
+    Entry e;
+    e.offset = static_cast<std::uint32_t>(m_chars.size());
+    e.length = static_cast<std::uint32_t>(relPath.size());
+    e.nameOffset = sep == std::wstring_view::npos ? 0 : static_cast<std::uint32_t>(sep + 1);
+    m_chars.insert(m_chars.end(), relPath.begin(), relPath.end());
+    m_entries.push_back(e);
+    if (!m_slots.empty()) {
+        if ((m_usedSlots + 1) * 2 > m_slots.size()) Rehash();
+        Insert(id);
+    }
+    return id;
+}
+
+void TrackPathPool::Reserve(size_t tracks, size_t chars) {
+    m_entries.reserve(tracks);
+    m_chars.reserve(chars);
+}
+
+void TrackPathPool::Clear() {
+    m_chars.clear();
+    m_entries.clear();
+    m_slots.clear();
+    m_usedSlots = 0;
+}
+
+std::uint32_t TrackPathPool::Find(std::wstring_view relPath) {
+    if (m_slots.empty()) Rehash();
+    const size_t mask = m_slots.size() - 1;
+    for (size_t slot = std::hash<std::wstring_view>()(relPath) & mask;; slot = (slot + 1) & mask) {
+        const std::uint32_t id = m_slots[slot];
+        if (id == kEmptySlot) return kNotFound;
+        if (id != kForgottenSlot && Path(id) == relPath) return id;
+    }
+}
+
+void TrackPathPool::Forget(std::uint32_t id) {
+    if (m_slots.empty()) Rehash();
+    const size_t mask = m_slots.size() - 1;
+    for (size_t slot = std::hash<std::wstring_view>()(Path(id)) & mask; m_slots[slot] != kEmptySlot;
+         slot = (slot + 1) & mask) {
+        if (m_slots[slot] == id) {
+            m_slots[slot] = kForgottenSlot; // 保留探测链，重建时丢弃
+            return;
+        }
+    }
+}
+
+void TrackPathPool::Rehash() {
+    // 首次建立时放入全部曲目，之后只保留槽中未被Forget的曲目
+    std::vector<std::uint32_t> ids;
+    if (m_slots.empty()) {
+        ids.resize(m_entries.size());
+        for (std::uint32_t id = 0; id < Size(); ++id) ids[id] = id;
+    } else {
+        for (std::uint32_t id : m_slots) {
+            if (id != kEmptySlot && id != kForgottenSlot) ids.push_back(id);
+        }
+    }
+    size_t capacity = 16;
+    while (capacity < (ids.size() + 1) * 2) capacity *= 2;
+    m_slots.assign(capacity, kEmptySlot);
+    m_usedSlots = 0;
+    for (std::uint32_t id : ids) Insert(id);
+}
+
+void TrackPathPool::Insert(std::uint32_t id) {
+    const size_t mask = m_slots.size() - 1;
+    size_t slot = std::hash<std::wstring_view>()(Path(id)) & mask;
+    while (m_slots[slot] != kEmptySlot) slot = (slot + 1) & mask;
+    m_slots[slot] = id;
+    ++m_usedSlots;
+}
+
+std::uint32_t TrackListView::IndexOf(std::uint32_t id) const {
+    if (!m_filtered) return id < m_count ? id : kNotFound;
+    auto it = std::find(m_head.begin(), m_head.end(), id);
+    if (it != m_head.end()) return static_cast<std::uint32_t>(it - m_head.begin());
+    if (!m_rest.Contains(id)) return kNotFound;
+    return static_cast<std::uint32_t>(m_head.size() + m_rest.Rank(id));
+}
+
+void TrackListView::Remove(const TrackBitmap& ids) {
+    if (!m_filtered) {
+        m_filtered = true;
+        m_rest = TrackBitmap::AndNot(TrackBitmap::Range(0, m_count), ids);
+    } else {
+        m_head.erase(std::remove_if(m_head.begin(), m_head.end(), [&](std::uint32_t id) { return ids.Contains(id); }),
+                     m_head.end());
+        m_rest = TrackBitmap::AndNot(m_rest, ids);
+    }
+    m_count = static_cast<std::uint32_t>(m_head.size() + m_rest.Cardinality());
+}
+
+TrackBitmap TrackListView::Except(const TrackBitmap& excluded) const {
+    if (!m_filtered) return TrackBitmap::AndNot(TrackBitmap::Range(0, m_count), excluded);
+    TrackBitmap result = TrackBitmap::AndNot(m_rest, excluded);
+    for (std::uint32_t id : m_head) {
+        if (!excluded.Contains(id)) result.Add(id);
+    }
+    return result;
+}
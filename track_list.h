@@ -0,0 +1,120 @@
+// 曲目路径池与列表视图：
+// - TrackPathPool：所有曲目路径（UTF-16，相对music根目录）连续存放在一块缓冲区中，每首曲目只占一条12字节的索引，
+//   曲目以32位id引用（从曲库目录构建时与目录中的曲目id一致）；id在本次运行中不变，曲库更新时只追加新曲目
+//   按路径查找id（应用曲库增量时）使用开放寻址的散列表，第一次查找时才建立
+// - TrackListView：界面显示的曲目id列表；“全部”模式不存储任何id，清空搜索只需切换模式（O(1)）
+//   过滤模式保存搜索结果：得分最高的若干首（按得分顺序）+ 其余曲目（按id升序的压缩位图，按位置取id用select）
+#pragma once
+
+#include "track_bitmap.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class TrackPathPool {
+public:
+    static constexpr std::uint32_t kNotFound = 0xFFFFFFFFu;
+
+    // 追加一条路径，返回新曲目的id（等于追加前的Size()）
+    std::uint32_t Add(std::wstring_view relPath);
+    void Reserve(size_t tracks, size_t chars);
+    void Clear();
+
+    // 路径对应的曲目id，不存在（或已Forget）时返回kNotFound
+    std::uint32_t Find(std::wstring_view relPath);
+    // 曲目已被删除：之后Find不再返回它（路径仍保留，已播放或已连接的曲目照常显示文件名）
+    void Forget(std::uint32_t id);
+
+    std::uint32_t Size() const { return static_cast<std::uint32_t>(m_entries.size()); }
+    bool Empty() const { return m_entries.empty(); }
+
+    // 返回的视图在下一次Add之前有效（缓冲区扩容会使其失效）
+    std::wstring_view Path(std::uint32_t id) const {
+        const Entry& e = m_entries[id];
+        return std::wstring_view(m_chars.data() + e.offset, e.length);
+    }
+    std::wstring_view Name(std::uint32_t id) const {
+        const Entry& e = m_entries[id];
+        return std::wstring_view(m_chars.data() + e.offset + e.nameOffset, e.length - e.nameOffset);
+    }
+
+    // 池占用的内存（字节），用于统计
+    size_t MemoryBytes() const {
+        return m_chars.capacity() * sizeof(wchar_t) + m_entries.capacity() * sizeof(Entry) +
+               m_slots.capacity() * sizeof(std::uint32_t);
+    }
+
+private:
+    struct Entry {
+        std::uint32_t offset;       // 在m_chars中的起始位置
+        std::uint32_t length;       // 路径长度（字符数）
+        std::uint32_t nameOffset;   // 文件名在路径中的起始位置
+    };
+
+    static constexpr std::uint32_t kEmptySlot = 0xFFFFFFFFu;
+    static constexpr std::uint32_t kForgottenSlot = 0xFFFFFFFEu;
+
+    // 按当前曲目数重建散列表（装载率不超过1/2）
+    void Rehash();
+    void Insert(std::uint32_t id);
+
+    std::vector<wchar_t> m_chars;
+    std::vector<Entry> m_entries;
+    std::vector<std::uint32_t> m_slots; // 开放寻址（线性探测），槽中为曲目id；为空表示尚未建立
+    size_t m_usedSlots = 0;             // 曲目与已Forget的槽数
+};
+
+class TrackListView {
+public:
+    static constexpr std::uint32_t kNotFound = 0xFFFFFFFFu;
+
+    // 显示池中全部count首曲目（不复制id）
+    void ShowAll(std::uint32_t count) {
+        m_filtered = false;
+        m_count = count;
+        m_head.clear();
+        m_rest.Clear();
+    }
+    // 只显示给定的曲目：先是head（按给定顺序），再是rest中的曲目（按id升序），两者不重复（见SplitRankedIds）
+    // 接管head与rest，调用方可传入可复用的缓冲区
+    void ShowFiltered(std::vector<std::uint32_t>&& head, TrackBitmap&& rest) {
+        m_filtered = true;
+        m_head.swap(head);
+        head.clear();
+        m_rest = std::move(rest);
+        rest.Clear();
+        m_count = static_cast<std::uint32_t>(m_head.size() + m_rest.Cardinality());
+    }
+    // 追加一首曲目（须比列表中的id都大，即池中新追加的曲目）；“全部”模式下id必须等于当前Size()
+    void Append(std::uint32_t id) {
+        if (m_filtered) m_rest.Add(id);
+        ++m_count;
+    }
+    void Clear() { ShowAll(0); }
+    // 从列表中移除ids中的曲目（已从曲库删除）；“全部”模式转为过滤模式
+    void Remove(const TrackBitmap& ids);
+
+    bool Filtered() const { return m_filtered; }
+    std::uint32_t Size() const { return m_count; }
+    bool Empty() const { return m_count == 0; }
+    std::uint32_t operator[](std::uint32_t index) const {
+        if (!m_filtered) return index;
+        return index < m_head.size() ? m_head[index]
+                                     : m_rest.Select(index - static_cast<std::uint32_t>(m_head.size()));
+    }
+
+    // 曲目id在列表中的位置，不在列表中时返回kNotFound
+    std::uint32_t IndexOf(std::uint32_t id) const;
+
+    // 列表中不在excluded中的曲目集合（随机播放排除最近播放过的曲目）：rest部分与excluded位图求差，
+    // head部分只有得分最高的若干首，逐个检查；不复制、不排序列表
+    TrackBitmap Except(const TrackBitmap& excluded) const;
+
+private:
+    bool m_filtered = false;
+    std::uint32_t m_count = 0;
+    std::vector<std::uint32_t> m_head;  // 仅过滤模式使用
+    TrackBitmap m_rest;
+};
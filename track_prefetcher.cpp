@@ -0,0 +1,238 @@
+#include "track_prefetcher.h"
+#include "fs_util.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+constexpr size_t kWarmChunk = 1u << 20;    // 页缓存预读每块的字节数，每块之间检查请求是否已被取代
+
+// FileReader使用UTF-8路径
+std::string PathToUtf8(const std::wstring& path) {
+#ifdef _WIN32
+    return WideToUtf8(path);
+#else
+    std::string out; // wchar_t为UTF-32
+    out.reserve(path.size());
+    for (wchar_t ch : path) {
+        const std::uint32_t cp = static_cast<std::uint32_t>(ch);
+        if (cp < 0x80) {
+            out += static_cast<char>(cp);
+        } else if (cp < 0x800) {
+            out += static_cast<char>(0xC0 | (cp >> 6));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else if (cp < 0x10000) {
+            out += static_cast<char>(0xE0 | (cp >> 12));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (cp >> 18));
+            out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+    }
+    return out;
+#endif
+}
+
+} // namespace
+
+TrackPrefetcher::TrackPrefetcher(PrefetchOptions options, PrefetchReadyCallback onReady)
+    : m_options(options), m_onReady(std::move(onReady)) {}
+
+TrackPrefetcher::~TrackPrefetcher() {
+    Stop();
+}
+
+void TrackPrefetcher::SetOutputFormat(ma_uint32 channels, ma_uint32 sampleRate) {
+    m_channels = channels;
+    m_sampleRate = sampleRate;
+}
+
+void TrackPrefetcher::Start() {
+    m_thread = std::thread(&TrackPrefetcher::WorkerLoop, this);
+}
+
+void TrackPrefetcher::Stop() {
+    std::unique_ptr<TrackSource> released;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_stopping) return;
+        m_stopping = true;
+        m_pending = false;
+        m_requested = kNoTrack;
+        released = std::move(m_ready);
+        m_generation.fetch_add(1); // 让进行中的页缓存预读在下一块处退出
+    }
+    m_cv.notify_all();
+    if (m_thread.joinable()) m_thread.join();
+}
+
+void TrackPrefetcher::Request(std::uint32_t trackId, std::wstring path, const TrackLoadInfo& info, bool urgent) {
+    std::unique_ptr<TrackSource> released; // 在锁外释放被取代的曲目
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_stopping) return;
+        released = RequestLocked(trackId, std::move(path), info, urgent);
+    }
+    m_cv.notify_all();
+}
+
+std::unique_ptr<TrackSource> TrackPrefetcher::TakeOrRequest(std::uint32_t trackId, std::wstring path,
+                                                            const TrackLoadInfo& info, bool urgent) {
+    std::unique_ptr<TrackSource> released;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_stopping) return nullptr;
+        if (m_requested == trackId && m_ready != nullptr) {
+            m_requested = kNoTrack;
+            return std::move(m_ready);
+        }
+        if (m_requested == trackId && (m_pending || m_preparing)) {
+            if (urgent) m_hurry.store(true);
+            return nullptr;
+        }
+        if (m_options.cache != nullptr) {
+            // 最近播放过且整首在内存中的曲目：直接以缓存的PCM开始播放，不打开文件
+            if (std::shared_ptr<const PcmBuffer> pcm = m_options.cache->Find(path, m_channels, m_sampleRate)) {
+                std::unique_ptr<TrackSource> track;
+                TrackSource::FromPcm(trackId, path, std::move(pcm), m_channels, m_sampleRate, track);
+                if (track != nullptr) return track;
+            }
+        }
+        released = RequestLocked(trackId, std::move(path), info, urgent);
+    }
+    m_cv.notify_all();
+    return nullptr;
+}
+
+std::unique_ptr<TrackSource> TrackPrefetcher::RequestLocked(std::uint32_t trackId, std::wstring path,
+                                                            const TrackLoadInfo& info, bool urgent) {
+    m_requested = trackId;
+    m_pendingPath = std::move(path);
+    m_pendingInfo = info;
+    m_pending = true;
+    m_hurry.store(urgent);
+    m_generation.fetch_add(1);
+    return std::move(m_ready);
+}
+
+void TrackPrefetcher::Cancel() {
+    std::unique_ptr<TrackSource> released;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_requested = kNoTrack;
+        m_pending = false;
+        released = std::move(m_ready);
+        m_generation.fetch_add(1);
+    }
+}
+
+void TrackPrefetcher::Retire(TrackSource& track) {
+    if (m_options.cache == nullptr || !track.Captured()) return;
+    m_options.cache->Insert(track.Path(), m_channels, m_sampleRate, track.SharePcm());
+}
+
+std::uint32_t TrackPrefetcher::RequestedTrack() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_requested;
+}
+
+std::unique_ptr<TrackSource> TrackPrefetcher::Take(std::uint32_t trackId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_requested != trackId || m_ready == nullptr) return nullptr;
+    m_requested = kNoTrack; // 页缓存预读继续进行，解码器随后读取的正是这个文件
+    return std::move(m_ready);
+}
+
+void TrackPrefetcher::WorkerLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_cv.wait(lock, [this] { return m_stopping || m_pending; });
+        if (m_stopping) break;
+        const std::uint32_t trackId = m_requested;
+        const std::wstring path = std::move(m_pendingPath);
+        const TrackLoadInfo info = m_pendingInfo;
+        const std::uint64_t generation = m_generation.load();
+        const bool urgent = m_hurry.load(); // 立即播放的曲目TakeOrRequest已查过缓存
+        m_pending = false;
+        m_preparing = true;
+        lock.unlock();
+
+        // 缓存命中时直接使用缓存的PCM；否则打开并解码引导段，解码出错时保留已解码的部分，
+        // 之后的读取照常交给解码器
+        std::unique_ptr<TrackSource> track;
+        std::shared_ptr<const PcmBuffer> cached;
+        if (!urgent && m_options.cache != nullptr) {
+            cached = m_options.cache->Find(path, m_channels, m_sampleRate);
+        }
+        ma_result result = cached != nullptr
+                               ? TrackSource::FromPcm(trackId, path, std::move(cached), m_channels, m_sampleRate, track)
+                               : TrackSource::Open(trackId, path, info.format, m_channels, m_sampleRate, track);
+        bool complete = false;
+        std::shared_ptr<const PcmBuffer> pcm; // 要放入缓存的整首PCM
+        if (result == MA_SUCCESS && track->Stats().fromCache) {
+            complete = true;
+        } else if (result == MA_SUCCESS) {
+            track->DecodeLeadIn(static_cast<ma_uint64>(m_options.leadInSeconds * m_sampleRate),
+                                [this, generation] { return m_generation.load() != generation; });
+            MemoryReservation reservation;
+            if (!track->Complete() && !m_hurry.load() && m_options.policy != nullptr &&
+                m_options.policy->Choose(info, m_channels, m_sampleRate, reservation) == LoadMode::Decode) {
+                // 整首解码：解码到估算的长度为止（目录中的时长偏短时其余部分照常流式解码）
+                const ma_uint64 frames = reservation.Bytes() / (sizeof(float) * m_channels);
+                track->SetLoadMode(LoadMode::Decode, std::move(reservation), frames);
+                if (frames > track->LeadInFrames()) {
+                    track->DecodeLeadIn(frames - track->LeadInFrames(), [this, generation] {
+                        return m_generation.load() != generation || m_hurry.load();
+                    });
+                }
+                track->TrimReservation();
+            }
+            complete = track->Complete();
+            if (complete && m_options.cache != nullptr) {
+                pcm = track->SharePcm();
+            } else if (m_options.cache != nullptr && m_options.policy != nullptr &&
+                       m_generation.load() == generation) {
+                // 流式播放：放得进缓存时在预算之内预留整首，边播边保存，播完释放时（Retire）放入缓存
+                const std::uint64_t bytes = LoadPolicy::EstimatePcmBytes(info.durationMs, m_channels, m_sampleRate);
+                if (m_options.cache->Fits(bytes) &&
+                    m_options.policy->ReserveCapture(info, m_channels, m_sampleRate, reservation)) {
+                    track->CaptureStream(std::move(reservation), bytes / (sizeof(float) * m_channels));
+                }
+            }
+        }
+        // 被取代的曲目同样放入缓存（很可能马上又被切回来）
+        if (pcm != nullptr) m_options.cache->Insert(path, m_channels, m_sampleRate, pcm);
+
+        lock.lock();
+        m_preparing = false;
+        const bool current = m_generation.load() == generation;
+        if (current && track != nullptr) {
+            m_ready = std::move(track);
+        }
+        lock.unlock();
+
+        track.reset(); // 已被取代的曲目
+        if (current) {
+            if (m_onReady) m_onReady(trackId, result);
+            if (result == MA_SUCCESS && !complete) WarmFile(path, generation);
+        }
+
+        lock.lock();
+    }
+}
+
+void TrackPrefetcher::WarmFile(const std::wstring& path, std::uint64_t generation) {
+    if (m_options.warmBytes == 0) return;
+    FileReader reader;
+    if (!reader.Open(PathToUtf8(path))) return;
+    const std::uint64_t end = std::min(reader.Size(), m_options.warmBytes);
+    std::vector<std::uint8_t> buffer(kWarmChunk);
+    for (std::uint64_t offset = 0; offset < end; offset += kWarmChunk) {
+        if (m_generation.load() != generation) return;
+        if (reader.ReadAt(offset, buffer.data(), buffer.size()) == 0) return;
+    }
+}
@@ -0,0 +1,100 @@
+// 曲目的后台加载：UI线程不打开文件、不解码
+// - 列表/随机播放时下一首在当前曲目开始时即可确定，预先准备，切换（播完或跳到下一首）时直接从内存开始播放；
+//   尚未准备的曲目（点选列表等）同样交给工作线程加载，完成后再开始播放
+// - 打开解码器并解码开头若干秒作为引导段（TrackSource）；按加载策略（load_policy）整首解码时接着解码整首，
+//   否则准备好之后继续把文件读入系统页缓存，解码器追上引导段之后的读取不必等待磁盘
+// - 要立即播放的曲目（urgent）只解码引导段；正在整首解码的曲目被要求立即播放（TakeOrRequest）时停止解码，
+//   已解码的部分作为引导段，其余流式解码
+// - 流式加载的曲目在预算之内边播边保存（TrackSource::CaptureStream），不论是预取的还是要立即播放的
+// - 整首都在内存中的曲目（整首解码、比引导段短，或播放过程中边播边保存到了末尾，释放时Retire）放入PCM缓存
+//   （pcm_cache，以文件路径为键）；加载之前先查缓存，命中则直接以缓存的PCM创建曲目，不打开文件、不解码
+// - 新的请求取代之前的请求：进行中的引导段解码/页缓存预读在下一个分块处放弃，已准备好但未取走的曲目被释放，
+//   连续快速切歌时只加载最后一首
+// 成员函数可从任意线程调用；完成回调在工作线程上调用（通常投递给UI线程）
+#pragma once
+
+#include "load_policy.h"
+#include "pcm_cache.h"
+#include "track_source.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+struct PrefetchOptions {
+    float leadInSeconds = 3.0f;                     // 预先解码的引导段长度
+    std::uint64_t warmBytes = 256ull << 20;         // 读入页缓存的最大字节数（0表示不预读）
+    std::shared_ptr<LoadPolicy> policy;             // 选择流式/整首解码；为空时总是流式
+    std::shared_ptr<PcmCache> cache;                // 整首解码的PCM缓存；为空时不缓存（也不边播边保存）
+};
+
+// 请求的曲目已准备好（result为MA_SUCCESS，可以Take）或打开失败；在工作线程上调用，被取代的请求不回调
+using PrefetchReadyCallback = std::function<void(std::uint32_t trackId, ma_result result)>;
+
+class TrackPrefetcher {
+public:
+    static constexpr std::uint32_t kNoTrack = 0xFFFFFFFFu;
+
+    TrackPrefetcher(PrefetchOptions options, PrefetchReadyCallback onReady);
+    ~TrackPrefetcher();
+
+    TrackPrefetcher(const TrackPrefetcher&) = delete;
+    TrackPrefetcher& operator=(const TrackPrefetcher&) = delete;
+
+    // 解码输出的格式（引擎的声道数与采样率），在Start之前设置
+    void SetOutputFormat(ma_uint32 channels, ma_uint32 sampleRate);
+
+    void Start();
+    void Stop();
+
+    // 请求准备曲目，取代之前的请求；urgent表示要立即播放（只解码引导段，不整首解码）
+    void Request(std::uint32_t trackId, std::wstring path, const TrackLoadInfo& info, bool urgent);
+    // 放弃之前的请求（例如单曲循环）
+    void Cancel();
+    // 最近一次请求的曲目（被Take取走或Cancel之后为kNoTrack）
+    std::uint32_t RequestedTrack() const;
+
+    // 取走已准备好的曲目；不是最近请求的曲目、仍在准备中或准备失败时返回nullptr
+    std::unique_ptr<TrackSource> Take(std::uint32_t trackId);
+
+    // 要立即播放的曲目（一次加锁完成，工作线程不会在检查之间完成同一首而重复加载）：
+    // 已准备好时取走；缓存中有整首的PCM时以缓存创建（不影响之前的请求）；正在准备时不重新加载，
+    // 只要求尽快完成（正在整首解码时停止），返回nullptr；否则按urgent请求（取代之前的请求），返回nullptr，完成时回调
+    std::unique_ptr<TrackSource> TakeOrRequest(std::uint32_t trackId, std::wstring path, const TrackLoadInfo& info,
+                                               bool urgent);
+
+    // 播放过的曲目释放之前调用（音频线程已不再读取）：边播边保存到了末尾的曲目放入PCM缓存
+    void Retire(TrackSource& track);
+
+private:
+    // 记录新的请求并返回被取代的曲目（调用方在锁外释放）；须持有m_mutex
+    std::unique_ptr<TrackSource> RequestLocked(std::uint32_t trackId, std::wstring path, const TrackLoadInfo& info,
+                                               bool urgent);
+    void WorkerLoop();
+    // 按分块把文件读入页缓存，请求被取代时提前返回
+    void WarmFile(const std::wstring& path, std::uint64_t generation);
+
+    PrefetchOptions m_options;
+    PrefetchReadyCallback m_onReady;
+    ma_uint32 m_channels = 2;
+    ma_uint32 m_sampleRate = 48000;
+
+    mutable std::mutex m_mutex;         // 保护以下各项
+    std::condition_variable m_cv;       // 新的请求/停止（工作线程等待）
+    std::uint32_t m_requested = kNoTrack;
+    std::wstring m_pendingPath;
+    TrackLoadInfo m_pendingInfo;
+    bool m_pending = false;             // m_requested尚未被工作线程取走
+    bool m_preparing = false;           // 工作线程正在准备m_requested
+    std::unique_ptr<TrackSource> m_ready;
+    bool m_stopping = false;
+    std::atomic<bool> m_hurry{false};   // 最近请求的曲目要立即播放
+    std::atomic<std::uint64_t> m_generation{0}; // 每次Request/Cancel/Stop递增，工作线程据此放弃过期的工作
+
+    std::thread m_thread;
+};
@@ -0,0 +1,392 @@
+#include "track_query.h"
+#include "byte_search.h"
+#include "fuzzy_search.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <thread>
+
+namespace {
+
+constexpr size_t kBatch = 1024;         // 选择向量的长度：一批曲目的列数据可留在L1/L2缓存中
+constexpr std::uint64_t kNoUpperBound = std::numeric_limits<std::uint64_t>::max();
+
+enum FieldKind { FIELD_KIND_TEXT, FIELD_KIND_FORMAT, FIELD_KIND_DURATION, FIELD_KIND_SIZE };
+
+struct FieldName {
+    const char* name;
+    FieldKind kind;
+    KeyField field;
+};
+
+const FieldName kFieldNames[] = {
+    {"title", FIELD_KIND_TEXT, KEY_FIELD_TITLE},       {"artist", FIELD_KIND_TEXT, KEY_FIELD_ARTIST},
+    {"album", FIELD_KIND_TEXT, KEY_FIELD_ALBUM},       {"name", FIELD_KIND_TEXT, KEY_FIELD_NAME},
+    {"format", FIELD_KIND_FORMAT, KEY_FIELD_NAME},     {"ext", FIELD_KIND_FORMAT, KEY_FIELD_NAME},
+    {"duration", FIELD_KIND_DURATION, KEY_FIELD_NAME}, {"dur", FIELD_KIND_DURATION, KEY_FIELD_NAME},
+    {"length", FIELD_KIND_DURATION, KEY_FIELD_NAME},   {"size", FIELD_KIND_SIZE, KEY_FIELD_NAME},
+};
+
+enum CompareOp { CMP_CONTAINS, CMP_EQ, CMP_NE, CMP_GT, CMP_GE, CMP_LT, CMP_LE };
+
+struct Unit {
+    const char* suffix;
+    std::uint64_t scale;
+};
+
+// 时长的内部单位为毫秒，无后缀时按秒
+const Unit kDurationUnits[] = {{"", 1000}, {"s", 1000}, {"ms", 1}, {"m", 60000}, {"min", 60000}, {"h", 3600000}};
+// 大小的内部单位为字节
+const Unit kSizeUnits[] = {{"", 1},       {"b", 1},         {"k", 1u << 10}, {"kb", 1u << 10},
+                           {"m", 1u << 20}, {"mb", 1u << 20}, {"g", 1u << 30}, {"gb", 1u << 30}};
+
+// 把token拆分为字段名、比较符与值；不是“字母+比较符”的形式时返回false
+bool SplitCondition(std::string_view token, std::string_view& name, CompareOp& op, std::string_view& value) {
+    size_t i = 0;
+    while (i < token.size() && token[i] >= 'a' && token[i] <= 'z') ++i;
+    if (i == 0 || i == token.size()) return false;
+    name = token.substr(0, i);
+    const std::string_view rest = token.substr(i);
+    static const struct {
+        const char* text;
+        CompareOp op;
+    } kOps[] = {{"!=", CMP_NE}, {">=", CMP_GE}, {"<=", CMP_LE}, {":", CMP_CONTAINS},
+                {"=", CMP_EQ},  {">", CMP_GT},  {"<", CMP_LT}};
+    for (const auto& candidate : kOps) {
+        const std::string_view text(candidate.text);
+        if (rest.substr(0, text.size()) == text) {
+            op = candidate.op;
+            value = rest.substr(text.size());
+            return true;
+        }
+    }
+    return false;
+}
+
+// 解析带单位的数值，value为内部单位的数值，granularity为所写最小单位（如4:30为1秒、2.5m为6秒）
+bool ParseQuantity(std::string_view text, const Unit* units, size_t unitCount, bool allowClock,
+                   std::uint64_t& value, std::uint64_t& granularity) {
+    if (allowClock && text.find(':') != std::string_view::npos) {
+        // m:ss或h:mm:ss
+        std::uint64_t seconds = 0;
+        size_t i = 0;
+        while (i <= text.size()) {
+            const size_t end = std::min(text.find(':', i), text.size());
+            if (end == i || end - i > 6) return false;
+            std::uint64_t part = 0;
+            for (size_t k = i; k < end; ++k) {
+                if (text[k] < '0' || text[k] > '9') return false;
+                part = part * 10 + static_cast<std::uint64_t>(text[k] - '0');
+            }
+            seconds = seconds * 60 + part;
+            i = end + 1;
+        }
+        value = seconds * 1000;
+        granularity = 1000;
+        return true;
+    }
+
+    size_t i = 0;
+    double number = 0;
+    int decimals = -1;
+    for (; i < text.size() && i < 18; ++i) {
+        const char c = text[i];
+        if (c == '.' && decimals < 0) {
+            decimals = 0;
+        } else if (c >= '0' && c <= '9') {
+            number = number * 10 + (c - '0');
+            if (decimals >= 0) ++decimals;
+        } else {
+            break;
+        }
+    }
+    if (i == 0 || decimals == 0) return false;
+    const std::string_view suffix = text.substr(i);
+    for (size_t u = 0; u < unitCount; ++u) {
+        if (suffix != units[u].suffix) continue;
+        const double scale = static_cast<double>(units[u].scale) / std::pow(10.0, std::max(decimals, 0));
+        value = static_cast<std::uint64_t>(std::llround(number * scale));
+        granularity = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::llround(scale)));
+        return true;
+    }
+    return false;
+}
+
+// 比较换算为区间[lo, hi)，取反的条件（!=）由negate表示
+void RangeFor(CompareOp op, std::uint64_t value, std::uint64_t granularity, TrackQuery::Instruction& instruction) {
+    const std::uint64_t next = value + granularity;
+    switch (op) {
+        case CMP_CONTAINS:
+        case CMP_EQ: instruction.lo = value; instruction.hi = next; break;
+        case CMP_NE: instruction.lo = value; instruction.hi = next; instruction.negate = !instruction.negate; break;
+        case CMP_GT: instruction.lo = next; instruction.hi = kNoUpperBound; break;
+        case CMP_GE: instruction.lo = value; instruction.hi = kNoUpperBound; break;
+        case CMP_LT: instruction.lo = 0; instruction.hi = value; break;
+        case CMP_LE: instruction.lo = 0; instruction.hi = next; break;
+    }
+}
+
+// 编译一个字段条件；返回false时该token按普通文本处理
+bool CompileCondition(std::string_view token, bool negate, bool& ignored, TrackQuery::Instruction& instruction) {
+    std::string_view name, value;
+    CompareOp op;
+    if (!SplitCondition(token, name, op, value)) return false;
+    const FieldName* field = nullptr;
+    for (const auto& candidate : kFieldNames) {
+        if (name == candidate.name) field = &candidate;
+    }
+    if (field == nullptr) return false;
+    instruction.negate = negate;
+    ignored = value.empty(); // 正在输入的条件（尚无值）不参与过滤
+    if (ignored) return true;
+
+    switch (field->kind) {
+        case FIELD_KIND_TEXT:
+            if (op != CMP_CONTAINS && op != CMP_EQ && op != CMP_NE) return false;
+            instruction.op = TrackQuery::OP_FIELD_CONTAINS;
+            instruction.field = field->field;
+            instruction.negate = negate != (op == CMP_NE);
+            instruction.text.assign(value);
+            instruction.mask = TrackTable::ByteMask(value);
+            return true;
+        case FIELD_KIND_FORMAT: {
+            if (op != CMP_CONTAINS && op != CMP_EQ && op != CMP_NE) return false;
+            instruction.op = TrackQuery::OP_FORMAT_SET;
+            std::uint32_t formats = 0;
+            for (size_t i = 0; i <= value.size();) {
+                const size_t end = std::min(value.find(',', i), value.size());
+                const std::string_view part = value.substr(i, end - i);
+                for (int f = AUDIO_FORMAT_UNKNOWN + 1; f < AUDIO_FORMAT_COUNT; ++f) {
+                    const std::string_view formatName(AudioFormatName(static_cast<AudioFormat>(f)));
+                    if (!part.empty() && formatName.substr(0, part.size()) == part) formats |= 1u << f;
+                }
+                i = end + 1;
+            }
+            if (negate != (op == CMP_NE)) formats = ~formats & ((1u << AUDIO_FORMAT_COUNT) - 1);
+            instruction.formats = formats;
+            return true;
+        }
+        case FIELD_KIND_DURATION:
+        case FIELD_KIND_SIZE: {
+            const bool duration = field->kind == FIELD_KIND_DURATION;
+            std::uint64_t number, granularity;
+            const bool parsed = duration ? ParseQuantity(value, kDurationUnits, std::size(kDurationUnits), true,
+                                                         number, granularity)
+                                         : ParseQuantity(value, kSizeUnits, std::size(kSizeUnits), false, number,
+                                                         granularity);
+            if (!parsed) return false;
+            instruction.op = duration ? TrackQuery::OP_DURATION_RANGE : TrackQuery::OP_SIZE_RANGE;
+            RangeFor(op, number, granularity, instruction);
+            return true;
+        }
+    }
+    return false;
+}
+
+// ---------- 批量过滤内核：就地压缩选择向量（先写入再按条件前移写指针，无分支） ----------
+
+// 列值在[lo, hi)内（kNegate时为不在范围内）；0表示未知，不满足任何条件
+// 无符号减法把区间判断化为一次比较：x - lo < hi - lo
+template <typename T, bool kNegate>
+size_t FilterRange(const T* column, std::uint64_t lo, std::uint64_t hi, std::uint32_t* sel, size_t n) {
+    const std::uint64_t width = hi - lo;
+    size_t k = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const std::uint32_t id = sel[i];
+        const std::uint64_t x = column[id];
+        sel[k] = id;
+        k += static_cast<size_t>((x != 0) & ((x - lo < width) != kNegate));
+    }
+    return k;
+}
+
+size_t FilterFormats(const std::uint8_t* column, std::uint32_t formats, std::uint32_t* sel, size_t n) {
+    size_t k = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const std::uint32_t id = sel[i];
+        sel[k] = id;
+        k += (formats >> column[id]) & 1;
+    }
+    return k;
+}
+
+template <typename Test>
+size_t FilterText(const TrackTable& table, std::uint64_t mask, bool negate, std::uint32_t* sel, size_t n, Test test) {
+    size_t k = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const std::uint32_t id = sel[i];
+        // 字节掩码不包含关键词的全部字节类别时必然不包含
+        const bool found = (table.KeyMask(id) & mask) == mask && test(id);
+        sel[k] = id;
+        k += static_cast<size_t>(found != negate);
+    }
+    return k;
+}
+
+} // namespace
+
+TrackQuery::TrackQuery(std::string_view foldedQuery) {
+    // 按空格切分（引号内的空格不切分，引号本身去掉）
+    std::vector<std::string> plain;
+    bool hasConditions = false;
+    for (size_t i = 0; i < foldedQuery.size();) {
+        while (i < foldedQuery.size() && foldedQuery[i] == ' ') ++i;
+        if (i == foldedQuery.size()) break;
+        std::string token;
+        bool quoted = false;
+        for (; i < foldedQuery.size() && (quoted || foldedQuery[i] != ' '); ++i) {
+            if (foldedQuery[i] == '"') quoted = !quoted;
+            else token.push_back(foldedQuery[i]);
+        }
+        const bool negate = token.size() > 1 && token[0] == '-';
+        const std::string_view body = std::string_view(token).substr(negate ? 1 : 0);
+
+        Instruction instruction;
+        bool ignored = false;
+        if (CompileCondition(body, negate, ignored, instruction)) {
+            hasConditions = true;
+            if (!ignored) m_program.push_back(std::move(instruction));
+        } else if (negate) {
+            hasConditions = true;
+            instruction.op = OP_KEY_CONTAINS;
+            instruction.negate = true;
+            instruction.text.assign(body);
+            instruction.mask = TrackTable::ByteMask(body);
+            m_program.push_back(std::move(instruction));
+        } else {
+            plain.push_back(std::move(token));
+        }
+    }
+
+    if (!hasConditions) {
+        m_text.assign(foldedQuery); // 普通关键词：整体按子串匹配（含其中的空格）
+    } else {
+        for (const auto& token : plain) {
+            if (!m_text.empty()) m_text.push_back(' ');
+            m_text += token;
+        }
+    }
+    m_textMask = TrackTable::ByteMask(m_text);
+    // 代价低的列比较在前，尽早缩小选择向量
+    std::stable_sort(m_program.begin(), m_program.end(),
+                     [](const Instruction& a, const Instruction& b) { return a.op < b.op; });
+}
+
+size_t TrackQuery::Apply(const TrackTable& table, std::uint32_t* sel, size_t n, bool withText) const {
+    for (const Instruction& in : m_program) {
+        if (n == 0) return 0;
+        switch (in.op) {
+            case OP_FORMAT_SET:
+                n = FilterFormats(table.FormatColumn(), in.formats, sel, n);
+                break;
+            case OP_DURATION_RANGE:
+                n = in.negate ? FilterRange<std::uint32_t, true>(table.DurationColumn(), in.lo, in.hi, sel, n)
+                              : FilterRange<std::uint32_t, false>(table.DurationColumn(), in.lo, in.hi, sel, n);
+                break;
+            case OP_SIZE_RANGE:
+                n = in.negate ? FilterRange<std::uint64_t, true>(table.SizeColumn(), in.lo, in.hi, sel, n)
+                              : FilterRange<std::uint64_t, false>(table.SizeColumn(), in.lo, in.hi, sel, n);
+                break;
+            case OP_FIELD_CONTAINS:
+                n = FilterText(table, in.mask, in.negate, sel, n,
+                               [&](std::uint32_t id) { return table.FieldContains(id, in.field, in.text); });
+                break;
+            case OP_KEY_CONTAINS:
+                n = FilterText(table, in.mask, in.negate, sel, n,
+                               [&](std::uint32_t id) { return table.KeyContains(id, in.text); });
+                break;
+        }
+    }
+    if (withText && !m_text.empty()) {
+        n = FilterText(table, m_textMask, false, sel, n,
+                       [&](std::uint32_t id) { return table.KeyContains(id, m_text); });
+    }
+    return n;
+}
+
+bool TrackQuery::Matches(const TrackTable& table, std::uint32_t id) const {
+    return Apply(table, &id, 1, true) == 1;
+}
+
+bool TrackQuery::Run(const TrackTable& table, const std::uint32_t* ids, std::uint32_t firstId, size_t count,
+                     bool withText, const QueryOptions& options, std::vector<std::uint32_t>& out) const {
+    const size_t chunkSize = std::max<size_t>(options.chunkSize, 1);
+    const size_t chunks = (count + chunkSize - 1) / chunkSize;
+    unsigned threads = options.threadCount != 0 ? options.threadCount : std::thread::hardware_concurrency();
+    threads = static_cast<unsigned>(std::max<size_t>(1, std::min<size_t>(threads == 0 ? 1 : threads, chunks)));
+
+    // 每段的结果单独存放，最后按段拼接以保持输入顺序
+    std::vector<std::vector<std::uint32_t>> chunkOut(chunks);
+    std::atomic<size_t> nextChunk{0};
+    std::atomic<bool> cancelled{false};
+
+    auto work = [&] {
+        std::uint32_t sel[kBatch];
+        while (true) {
+            const size_t chunk = nextChunk.fetch_add(1);
+            if (chunk >= chunks || cancelled.load()) break;
+            if (options.isCancelled && options.isCancelled()) {
+                cancelled.store(true);
+                break;
+            }
+            const size_t last = std::min(count, (chunk + 1) * chunkSize);
+            std::vector<std::uint32_t>& part = chunkOut[chunk];
+            for (size_t first = chunk * chunkSize; first < last; first += kBatch) {
+                const size_t n = std::min(kBatch, last - first);
+                if (ids != nullptr) {
+                    std::copy(ids + first, ids + first + n, sel);
+                } else {
+                    for (size_t i = 0; i < n; ++i) sel[i] = firstId + static_cast<std::uint32_t>(first + i);
+                }
+                const size_t kept = Apply(table, sel, n, withText);
+                part.insert(part.end(), sel, sel + kept);
+            }
+        }
+    };
+    if (threads == 1) {
+        work();
+    } else {
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1);
+        for (unsigned t = 1; t < threads; ++t) pool.emplace_back(work);
+        work();
+        for (auto& thread : pool) thread.join();
+    }
+    if (cancelled.load()) return false;
+    for (const auto& part : chunkOut) out.insert(out.end(), part.begin(), part.end());
+    return true;
+}
+
+bool TrackQuery::Scan(const TrackTable& table, std::uint32_t firstId, std::uint32_t endId,
+                      std::vector<std::uint32_t>& out, const QueryOptions& options) const {
+    if (firstId >= endId) return true;
+    if (m_program.empty()) {
+        // 只有普通文本：顺序扫描连续的检索键缓冲区更快
+        table.Search(m_text, out, firstId, endId);
+        return true;
+    }
+    return Run(table, nullptr, firstId, endId - firstId, true, options, out);
+}
+
+bool TrackQuery::Filter(const TrackTable& table, std::vector<std::uint32_t>& ids, const QueryOptions& options) const {
+    if (m_program.empty()) return true;
+    std::vector<std::uint32_t> kept;
+    if (!Run(table, ids.data(), 0, ids.size(), false, options, kept)) return false;
+    ids.swap(kept);
+    return true;
+}
+
+void SearchTracks(const TrackTable& table, const TrigramIndex& index, const TrackQuery& query,
+                  std::vector<std::uint32_t>& out) {
+    out.clear();
+    if (query.Text().empty()) {
+        query.Scan(table, 0, table.Size(), out, QueryOptions());
+        return;
+    }
+    index.Search(table, query.Text(), out, kDenseHitLimit); // 命中过多时只取id最小的一部分
+    RankSearchResults(table, query.Text(), out, FuzzyOptions()); // 得分最高的排在前面
+    query.Filter(table, out, QueryOptions());
+}
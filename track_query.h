@@ -0,0 +1,83 @@
+// 字段查询：关键词中除普通文本外还可以带字段条件，例如
+//   artist:陈奕迅 duration>300 format:flac
+//   love -live size>=10mb album:"greatest hits"
+// - 文本字段 title/artist/album/name：`:`或`=`表示字段包含（含拼音），`!=`表示不包含
+// - format（别名ext）：`:`/`=`/`!=`，值为逗号分隔的格式名，按前缀匹配（fl即flac）
+// - duration（别名dur/length，单位秒，也可写作4:30或5m）、size（字节，可带k/m/g单位）：
+//   `= != > >= < <=`，按值的最小单位比较（duration=300即300秒整），未知（为0）的曲目不满足任何条件
+// - 条件前加`-`表示取反（-live即不含live）；值可用双引号包含空格
+// - 值为空的条件（正在输入）忽略；字段名未知或值无法解析时按普通文本处理
+// 没有字段条件时整个关键词都是普通文本（与之前相同，按子串匹配）；否则其余各词以空格连接为普通文本
+// 解析一次编译为过滤指令序列，按列批量求值：每批1024首的选择向量依次经过各条指令（数值比较无分支压缩），
+// 大范围扫描时多线程分段执行
+#pragma once
+
+#include "track_table.h"
+#include "trigram_index.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct QueryOptions {
+    unsigned threadCount = 0;           // 工作线程数，0表示使用CPU核心数
+    std::uint32_t chunkSize = 1u << 16; // 每段的曲目数（线程间按段分配）
+    std::function<bool()> isCancelled;  // 可选：在各段之间检查，返回true时放弃本次求值
+};
+
+class TrackQuery {
+public:
+    // foldedQuery为已折叠的关键词（text_fold）
+    explicit TrackQuery(std::string_view foldedQuery);
+
+    // 普通文本部分（子串/模糊匹配的关键词），可能为空
+    const std::string& Text() const { return m_text; }
+    // 是否带有字段条件
+    bool HasFilters() const { return !m_program.empty(); }
+
+    // 曲目是否满足全部条件（含普通文本的子串匹配）
+    bool Matches(const TrackTable& table, std::uint32_t id) const;
+
+    // 把id在[firstId, endId)内满足全部条件（含普通文本）的曲目按升序追加到out；被取消时返回false
+    bool Scan(const TrackTable& table, std::uint32_t firstId, std::uint32_t endId, std::vector<std::uint32_t>& out,
+              const QueryOptions& options) const;
+
+    // 按字段条件（不含普通文本）就地筛选ids，保持原有顺序；被取消时返回false（ids不变）
+    bool Filter(const TrackTable& table, std::vector<std::uint32_t>& ids, const QueryOptions& options) const;
+
+    // 过滤指令（按代价从低到高排列，求值时按此顺序执行）
+    enum Opcode : std::uint8_t {
+        OP_FORMAT_SET,      // 格式列属于formats位集合
+        OP_DURATION_RANGE,  // 时长列在[lo, hi)内（negate为不在范围内），0表示未知
+        OP_SIZE_RANGE,      // 大小列，同上
+        OP_FIELD_CONTAINS,  // 字段包含text
+        OP_KEY_CONTAINS,    // 整个检索键包含text（取反的普通文本词）
+    };
+    struct Instruction {
+        Opcode op = OP_KEY_CONTAINS;
+        KeyField field = KEY_FIELD_NAME;
+        bool negate = false;
+        std::uint32_t formats = 0;
+        std::uint64_t lo = 0;
+        std::uint64_t hi = 0;
+        std::uint64_t mask = 0;         // text的字节掩码（TrackTable::ByteMask），用于预过滤
+        std::string text;
+    };
+
+private:
+    // 对选择向量sel[0, n)依次执行指令，就地压缩，返回剩余数量
+    size_t Apply(const TrackTable& table, std::uint32_t* sel, size_t n, bool withText) const;
+    bool Run(const TrackTable& table, const std::uint32_t* ids, std::uint32_t firstId, size_t count, bool withText,
+             const QueryOptions& options, std::vector<std::uint32_t>& out) const;
+
+    std::string m_text;
+    std::uint64_t m_textMask = 0;
+    std::vector<Instruction> m_program; // 按Opcode排序
+};
+
+// 在UI线程上一次完成的搜索：普通文本经索引求出子串命中（至多kDenseHitLimit首）并按模糊得分排列，再按字段条件筛选
+// 只有字段条件时按条件扫描全表（结果按id升序）
+void SearchTracks(const TrackTable& table, const TrigramIndex& index, const TrackQuery& query,
+                  std::vector<std::uint32_t>& out);
@@ -0,0 +1,274 @@
+#include "track_source.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace {
+
+constexpr ma_uint64 kLeadInChunk = 8192;   // 解码引导段每块的帧数，每块之间检查是否已被取消
+
+// 曲目格式对应的miniaudio解码后端（没有内置后端的格式返回unknown）
+ma_encoding_format ToEncodingFormat(AudioFormat format) {
+    switch (format) {
+        case AUDIO_FORMAT_MP3:  return ma_encoding_format_mp3;
+        case AUDIO_FORMAT_FLAC: return ma_encoding_format_flac;
+        case AUDIO_FORMAT_WAV:  return ma_encoding_format_wav;
+        case AUDIO_FORMAT_OGG:  return ma_encoding_format_vorbis;
+        default:                return ma_encoding_format_unknown;
+    }
+}
+
+std::uint64_t ElapsedNs(std::chrono::steady_clock::time_point start) {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+} // namespace
+
+TrackSource::~TrackSource() {
+    if (m_sourceInitialized) ma_data_source_uninit(&m_source.base);
+    if (m_decoderInitialized) ma_decoder_uninit(&m_decoder);
+}
+
+ma_result TrackSource::Open(std::uint32_t trackId, const std::wstring& path, AudioFormat format, ma_uint32 channels,
+                            ma_uint32 sampleRate, std::unique_ptr<TrackSource>& out) {
+    out.reset();
+    std::unique_ptr<TrackSource> track(new TrackSource());
+    track->m_id = trackId;
+    track->m_path = path;
+    track->m_channels = channels;
+    track->m_sampleRate = sampleRate;
+
+    ma_decoder_config config = ma_decoder_config_init(ma_format_f32, channels, sampleRate);
+    config.encodingFormat = ToEncodingFormat(format);
+    ma_result result = ma_decoder_init_file_w(path.c_str(), &config, &track->m_decoder);
+    if (result != MA_SUCCESS && config.encodingFormat != ma_encoding_format_unknown) {
+        config.encodingFormat = ma_encoding_format_unknown;
+        result = ma_decoder_init_file_w(path.c_str(), &config, &track->m_decoder);
+    }
+    if (result != MA_SUCCESS) return result;
+    track->m_decoderInitialized = true;
+
+    result = track->InitDataSource();
+    if (result != MA_SUCCESS) return result;
+    out = std::move(track);
+    return MA_SUCCESS;
+}
+
+ma_result TrackSource::FromPcm(std::uint32_t trackId, const std::wstring& path, std::shared_ptr<const PcmBuffer> pcm,
+                               ma_uint32 channels, ma_uint32 sampleRate, std::unique_ptr<TrackSource>& out) {
+    out.reset();
+    if (pcm == nullptr || channels == 0) return MA_INVALID_ARGS;
+    std::unique_ptr<TrackSource> track(new TrackSource());
+    track->m_id = trackId;
+    track->m_path = path;
+    track->m_channels = channels;
+    track->m_sampleRate = sampleRate;
+    track->m_shared = std::move(pcm);
+    track->m_memory = track->m_shared->samples.data();
+    track->m_leadInFrames = track->m_shared->samples.size() / channels;
+    track->m_complete = true;
+    track->m_fromCache = true;
+    track->m_mode = LoadMode::Decode;
+
+    ma_result result = track->InitDataSource();
+    if (result != MA_SUCCESS) return result;
+    out = std::move(track);
+    return MA_SUCCESS;
+}
+
+ma_result TrackSource::InitDataSource() {
+    static const ma_data_source_vtable kVtable = {OnRead, OnSeek, OnGetDataFormat, OnGetCursor, OnGetLength, NULL, 0};
+    ma_data_source_config sourceConfig = ma_data_source_config_init();
+    sourceConfig.vtable = &kVtable;
+    ma_result result = ma_data_source_init(&sourceConfig, &m_source.base);
+    if (result != MA_SUCCESS) return result;
+    m_source.owner = this;
+    m_sourceInitialized = true;
+    return MA_SUCCESS;
+}
+
+ma_result TrackSource::DecodeLeadIn(ma_uint64 frameCount, const std::function<bool()>& isCancelled) {
+    const auto start = std::chrono::steady_clock::now();
+    ma_uint64 frames = m_leadInFrames.load(std::memory_order_relaxed);
+    const ma_uint64 target = frames + frameCount;
+    m_leadIn.resize(static_cast<size_t>(target * m_channels));
+    ma_result result = MA_SUCCESS;
+    while (frames < target) {
+        if (isCancelled && isCancelled()) {
+            result = MA_CANCELLED;
+            break;
+        }
+        ma_uint64 framesRead = 0;
+        result = ma_decoder_read_pcm_frames(&m_decoder, m_leadIn.data() + frames * m_channels,
+                                            std::min(kLeadInChunk, target - frames), &framesRead);
+        frames += framesRead;
+        if (result == MA_AT_END) m_complete = true;
+        if (result != MA_SUCCESS || framesRead == 0) break;
+    }
+    m_leadIn.resize(static_cast<size_t>(frames * m_channels));
+    m_leadInFrames = frames;
+    m_memory = m_leadIn.data();
+    m_decoderCursor = frames;
+    m_prepareDecodeNs += ElapsedNs(start);
+    return result == MA_AT_END ? MA_SUCCESS : result; // 曲目比引导段短时整首都在内存中
+}
+
+void TrackSource::SetLoadMode(LoadMode mode, MemoryReservation reservation, ma_uint64 expectedFrames) {
+    m_mode = mode;
+    m_reservation = std::move(reservation);
+    if (mode == LoadMode::Decode) {
+        m_leadIn.reserve(static_cast<size_t>(expectedFrames * m_channels));
+        m_memory = m_leadIn.data();
+    }
+}
+
+void TrackSource::TrimReservation() {
+    if (m_leadIn.capacity() > m_leadIn.size() + m_leadIn.size() / 8) {
+        m_leadIn.shrink_to_fit();
+        m_memory = m_leadIn.data();
+    }
+    m_reservation.Shrink(PcmBytes());
+}
+
+void TrackSource::CaptureStream(MemoryReservation reservation, ma_uint64 expectedFrames) {
+    m_reservation = std::move(reservation);
+    const size_t capacity = static_cast<size_t>(expectedFrames * m_channels);
+    if (m_complete || capacity <= m_leadIn.size()) return;
+    m_leadIn.reserve(capacity);
+    m_memory = m_leadIn.data();
+    m_capturing = true;
+}
+
+std::shared_ptr<const PcmBuffer> TrackSource::SharePcm() {
+    if (!m_complete) return nullptr;
+    if (m_shared == nullptr) {
+        m_leadIn.shrink_to_fit(); // 比引导段短（或比估算的短）的曲目按实际大小计入缓存与预算
+        m_reservation.Shrink(m_leadIn.capacity() * sizeof(float));
+        auto pcm = std::make_shared<PcmBuffer>();
+        pcm->samples = std::move(m_leadIn);
+        pcm->reservation = std::move(m_reservation);
+        m_leadIn = std::vector<float>();
+        m_shared = std::move(pcm);
+        m_memory = m_shared->samples.data();
+    }
+    return m_shared;
+}
+
+TrackLoadStats TrackSource::Stats() const {
+    TrackLoadStats stats;
+    stats.mode = m_mode;
+    stats.memoryFrames = m_leadInFrames.load(std::memory_order_relaxed);
+    stats.complete = m_complete.load();
+    stats.fromCache = m_fromCache;
+    stats.captured = m_captured.load();
+    stats.residentBytes = PcmBytes();
+    stats.prepareDecodeNs = m_prepareDecodeNs;
+    stats.streamDecodeNs = m_streamDecodeNs.load(std::memory_order_relaxed);
+    stats.streamFrames = m_streamFrames.load(std::memory_order_relaxed);
+    return stats;
+}
+
+// ---------- 数据源回调（音频线程） ----------
+
+void TrackSource::CaptureDecoded(const float* frames, ma_uint64 frameCount, bool atEnd) {
+    const size_t samples = static_cast<size_t>(frameCount * m_channels);
+    if (m_leadIn.size() + samples > m_leadIn.capacity()) {
+        m_capturing = false; // 曲目比估算的长：保存的部分留作引导段，其余照常流式解码
+        return;
+    }
+    m_leadIn.insert(m_leadIn.end(), frames, frames + samples); // 容量已预先分配，不会重新分配
+    m_leadInFrames.fetch_add(frameCount, std::memory_order_relaxed);
+    if (atEnd) {
+        m_capturing = false;
+        m_complete = true;
+        m_captured = true;
+    }
+}
+
+ma_result TrackSource::OnRead(ma_data_source* source, void* framesOut, ma_uint64 frameCount, ma_uint64* framesRead) {
+    TrackSource* self = Owner(source);
+    float* out = static_cast<float*>(framesOut); // 为NULL时只前进（不输出）
+    const ma_uint64 memoryFrames = self->m_leadInFrames.load(std::memory_order_relaxed);
+    ma_uint64 done = 0;
+    if (self->m_cursor < memoryFrames) {
+        done = std::min(frameCount, memoryFrames - self->m_cursor);
+        if (out != nullptr) {
+            std::memcpy(out, self->m_memory + self->m_cursor * self->m_channels,
+                        static_cast<size_t>(done * self->m_channels) * sizeof(float));
+        }
+        self->m_cursor += done;
+    }
+
+    ma_result result = MA_SUCCESS;
+    if (done < frameCount && !self->m_complete) { // 整首都在内存中时读完即结束
+        if (self->m_decoderCursor != self->m_cursor) {
+            result = ma_decoder_seek_to_pcm_frame(&self->m_decoder, self->m_cursor);
+            if (result == MA_SUCCESS) self->m_decoderCursor = self->m_cursor;
+        }
+        if (result == MA_SUCCESS) {
+            const auto start = std::chrono::steady_clock::now();
+            // 解码器接着保存的末尾读取时，解码输出同时接在保存的PCM之后
+            const bool capture = self->m_capturing && out != nullptr && self->m_cursor == memoryFrames;
+            ma_uint64 decoded = 0;
+            result = ma_decoder_read_pcm_frames(&self->m_decoder, out != nullptr ? out + done * self->m_channels : NULL,
+                                                frameCount - done, &decoded);
+            if (capture) self->CaptureDecoded(out + done * self->m_channels, decoded, result == MA_AT_END);
+            self->m_cursor += decoded;
+            self->m_decoderCursor += decoded;
+            done += decoded;
+            self->m_streamDecodeNs.fetch_add(ElapsedNs(start), std::memory_order_relaxed);
+            self->m_streamFrames.fetch_add(decoded, std::memory_order_relaxed);
+        }
+    }
+
+    *framesRead = done;
+    if (done > 0) return MA_SUCCESS;
+    return result == MA_SUCCESS ? MA_AT_END : result;
+}
+
+ma_result TrackSource::OnSeek(ma_data_source* source, ma_uint64 frameIndex) {
+    TrackSource* self = Owner(source);
+    const ma_uint64 memoryFrames = self->m_leadInFrames.load(std::memory_order_relaxed);
+    if (self->m_complete) {
+        self->m_cursor = std::min(frameIndex, memoryFrames);
+        return MA_SUCCESS;
+    }
+    if (frameIndex < memoryFrames) {
+        self->m_cursor = frameIndex; // 解码器留在原处，读完引导段时按需重新定位
+        return MA_SUCCESS;
+    }
+    ma_result result = ma_decoder_seek_to_pcm_frame(&self->m_decoder, frameIndex);
+    if (result == MA_SUCCESS) {
+        self->m_cursor = frameIndex;
+        self->m_decoderCursor = frameIndex;
+    }
+    return result;
+}
+
+ma_result TrackSource::OnGetDataFormat(ma_data_source* source, ma_format* format, ma_uint32* channels,
+                                       ma_uint32* sampleRate, ma_channel* channelMap, size_t channelMapCap) {
+    const TrackSource* self = Owner(source);
+    *format = ma_format_f32;
+    *channels = self->m_channels;
+    *sampleRate = self->m_sampleRate;
+    if (channelMap != NULL) {
+        ma_channel_map_init_standard(ma_standard_channel_map_default, channelMap, channelMapCap, self->m_channels);
+    }
+    return MA_SUCCESS;
+}
+
+ma_result TrackSource::OnGetCursor(ma_data_source* source, ma_uint64* cursor) {
+    *cursor = Owner(source)->m_cursor;
+    return MA_SUCCESS;
+}
+
+ma_result TrackSource::OnGetLength(ma_data_source* source, ma_uint64* length) {
+    const TrackSource* self = Owner(source);
+    if (self->m_complete) {
+        *length = self->m_leadInFrames.load(std::memory_order_relaxed); // 整首都已解码，长度确切
+        return MA_SUCCESS;
+    }
+    return ma_decoder_get_length_in_pcm_frames(&Owner(source)->m_decoder, length);
+}
@@ -0,0 +1,126 @@
+// 播放链上的一首曲目：解码器 + 预先解码的引导段（开头若干帧的PCM，保存在内存中）
+// - 读取时先输出引导段，解码器预先定位在引导段之后，读完引导段再接着解码；
+//   从预取好的曲目开始播放时第一个采样来自内存，不需要等待打开文件与解码
+// - 整首解码（load_policy）时引导段即整首曲目，音频线程只复制内存；整首的PCM可与缓存（pcm_cache）共用，
+//   缓存命中时直接以缓存的PCM创建曲目（FromPcm），没有解码器
+// - 流式播放时可边播边保存（CaptureStream）：音频线程把解码输出接在引导段之后（预先分配，不在音频线程上分配内存），
+//   顺序播放到末尾时整首都在内存中，释放时放入缓存；定位到尚未保存的位置之后暂停保存，回到保存的末尾时继续
+// - 输出格式固定为f32、指定的声道数与采样率（引擎的格式），链上各曲目格式相同
+// 打开与解码引导段可在任意线程进行；交给播放链之后只由音频线程读取/定位（Stats可在任意线程调用）
+#pragma once
+
+#include "miniaudio.h"
+#include "media_probe.h"
+#include "load_policy.h"
+#include "pcm_cache.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// 每首曲目的加载开销，供调整加载策略与基准测试
+struct TrackLoadStats {
+    LoadMode mode = LoadMode::Stream;
+    ma_uint64 memoryFrames = 0;         // 内存中的帧数（引导段，整首解码时为整首）
+    bool complete = false;              // 整首都在内存中（音频线程不再解码）
+    bool fromCache = false;             // 以缓存的PCM创建（没有任何解码）
+    bool captured = false;              // 边播边保存到了曲目末尾（整首都在内存中）
+    std::uint64_t residentBytes = 0;    // PCM缓冲区占用的字节数
+    std::uint64_t prepareDecodeNs = 0;  // 加载线程上解码引导段的耗时
+    std::uint64_t streamDecodeNs = 0;   // 音频线程上边播边解码的耗时
+    ma_uint64 streamFrames = 0;         // 音频线程解码的帧数
+};
+
+class TrackSource {
+public:
+    ~TrackSource();
+    TrackSource(const TrackSource&) = delete;
+    TrackSource& operator=(const TrackSource&) = delete;
+
+    // 打开曲目：先按扫描时识别的格式直接创建对应的解码后端，失败时再由miniaudio逐个后端试探
+    // （扩展名与内容不符的文件）
+    static ma_result Open(std::uint32_t trackId, const std::wstring& path, AudioFormat format, ma_uint32 channels,
+                          ma_uint32 sampleRate, std::unique_ptr<TrackSource>& out);
+
+    // 以整首解码的PCM（通常来自缓存）创建曲目，不打开文件；path为PCM来自的文件
+    static ma_result FromPcm(std::uint32_t trackId, const std::wstring& path, std::shared_ptr<const PcmBuffer> pcm,
+                             ma_uint32 channels, ma_uint32 sampleRate, std::unique_ptr<TrackSource>& out);
+
+    // 接着解码至多frameCount帧追加到引导段（可多次调用）；在打开之后、开始读取之前调用
+    // 分块解码，isCancelled返回true时停止并返回MA_CANCELLED（已解码的部分保留在引导段中）
+    ma_result DecodeLeadIn(ma_uint64 frameCount, const std::function<bool()>& isCancelled = nullptr);
+
+    // 记录加载方式；整首解码时持有从内存预算中预留的字节数，并按估算的帧数预先分配引导段
+    void SetLoadMode(LoadMode mode, MemoryReservation reservation, ma_uint64 expectedFrames);
+    // 整首解码结束（或被打断）后按实际占用归还多余的预算
+    void TrimReservation();
+
+    // 流式播放时边播边保存解码输出，持有从内存预算中预留的字节数，并按估算的帧数预先分配；
+    // 在解码引导段之后、开始读取之前调用（曲目比估算的长时停止保存）
+    void CaptureStream(MemoryReservation reservation, ma_uint64 expectedFrames);
+
+    // 整首都已解码时把PCM（连同预留的预算）转为共享的（放入缓存），之后不能再DecodeLeadIn/CaptureStream；
+    // 在开始读取之前或音频线程不再读取之后（释放之前）调用
+    std::shared_ptr<const PcmBuffer> SharePcm();
+
+    ma_data_source* DataSource() { return &m_source.base; }
+    std::uint32_t Id() const { return m_id; }
+    const std::wstring& Path() const { return m_path; }
+    ma_uint64 LeadInFrames() const { return m_leadInFrames.load(std::memory_order_relaxed); }
+    bool Complete() const { return m_complete.load(); }
+    // 边播边保存到了曲目末尾（音频线程不再读取之后查询）
+    bool Captured() const { return m_captured.load(); }
+    size_t MemoryBytes() const { return sizeof(TrackSource) + PcmBytes(); }
+    TrackLoadStats Stats() const;
+
+private:
+    TrackSource() = default;
+
+    ma_result InitDataSource();
+    size_t PcmBytes() const {
+        return (m_shared ? m_shared->samples.capacity() : m_leadIn.capacity()) * sizeof(float);
+    }
+    // 把音频线程解码的帧接在保存的PCM之后（音频线程）；超出预先分配的容量时停止保存
+    void CaptureDecoded(const float* frames, ma_uint64 frameCount, bool atEnd);
+
+    struct Source {
+        ma_data_source_base base;   // 须为第一个成员
+        TrackSource* owner = nullptr;
+    };
+
+    static TrackSource* Owner(ma_data_source* source) { return reinterpret_cast<Source*>(source)->owner; }
+    static ma_result OnRead(ma_data_source* source, void* framesOut, ma_uint64 frameCount, ma_uint64* framesRead);
+    static ma_result OnSeek(ma_data_source* source, ma_uint64 frameIndex);
+    static ma_result OnGetDataFormat(ma_data_source* source, ma_format* format, ma_uint32* channels,
+                                     ma_uint32* sampleRate, ma_channel* channelMap, size_t channelMapCap);
+    static ma_result OnGetCursor(ma_data_source* source, ma_uint64* cursor);
+    static ma_result OnGetLength(ma_data_source* source, ma_uint64* length);
+
+    Source m_source;
+    bool m_sourceInitialized = false;
+    ma_decoder m_decoder;
+    bool m_decoderInitialized = false;
+    std::uint32_t m_id = 0;
+    std::wstring m_path;
+    ma_uint32 m_channels = 0;
+    ma_uint32 m_sampleRate = 0;
+
+    std::vector<float> m_leadIn;        // 引导段（交错存放）
+    std::shared_ptr<const PcmBuffer> m_shared; // SharePcm/FromPcm之后PCM在这里（m_leadIn为空）
+    const float* m_memory = nullptr;    // 音频线程读取的PCM（m_leadIn或m_shared的数据）
+    bool m_fromCache = false;
+    std::atomic<ma_uint64> m_leadInFrames{0}; // 边播边保存时音频线程写入
+    std::atomic<bool> m_complete{false};       // 已到达曲目末尾（解码引导段或边播边保存时），之后只读内存
+    bool m_capturing = false;           // 音频线程正在边播边保存（只由音频线程修改）
+    std::atomic<bool> m_captured{false};
+    LoadMode m_mode = LoadMode::Stream;
+    MemoryReservation m_reservation;
+    std::uint64_t m_prepareDecodeNs = 0;
+    std::atomic<std::uint64_t> m_streamDecodeNs{0};   // 音频线程写入
+    std::atomic<ma_uint64> m_streamFrames{0};
+    ma_uint64 m_cursor = 0;             // 输出位置（帧）
+    ma_uint64 m_decoderCursor = 0;      // 解码器的位置；与m_cursor不同时（定位到引导段内之后）在读完引导段时重新定位
+};
@@ -0,0 +1,312 @@
+#include "track_table.h"
+#include "byte_search.h"
+#include "pinyin.h"
+#include "text_fold.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+// 字节到掩码位的映射：a-z为0-25，0-9为26-35，其余字节分入36-63
+struct ByteMaskTable {
+    std::uint8_t bit[256];
+    ByteMaskTable() {
+        for (int c = 0; c < 256; ++c) {
+            if (c >= 'a' && c <= 'z') bit[c] = static_cast<std::uint8_t>(c - 'a');
+            else if (c >= '0' && c <= '9') bit[c] = static_cast<std::uint8_t>(26 + c - '0');
+            else bit[c] = static_cast<std::uint8_t>(36 + c % 28);
+        }
+    }
+};
+const ByteMaskTable kByteMaskTable;
+
+unsigned PopCount4(unsigned bits) {
+    return (bits & 1) + ((bits >> 1) & 1) + ((bits >> 2) & 1) + ((bits >> 3) & 1);
+}
+
+// 目录条目的文件名（路径的最后一段）
+std::string_view EntryName(const CatalogEntry& entry) {
+    const size_t sep = entry.path.find_last_of("/\\");
+    return std::string_view(entry.path).substr(sep == std::string::npos ? 0 : sep + 1);
+}
+
+// 优先使用扫描时按内容识别的格式，识别失败时按扩展名
+AudioFormat EntryFormat(const CatalogEntry& entry, std::string_view name) {
+    return entry.format != AUDIO_FORMAT_UNKNOWN ? entry.format : AudioFormatFromName(name);
+}
+
+} // namespace
+
+void TrackTable::Clear() {
+    m_keys.clear();
+    m_keyOffsets.assign(1, 0);
+    m_keyMasks.clear();
+    m_keyFields.clear();
+    m_sizes.clear();
+    m_durations.clear();
+    m_formats.clear();
+}
+
+void TrackTable::Reserve(size_t tracks, size_t keyBytes) {
+    m_keys.reserve(keyBytes);
+    m_keyOffsets.reserve(tracks + 1);
+    m_keyMasks.reserve(tracks);
+    m_keyFields.reserve(tracks);
+    m_sizes.reserve(tracks);
+    m_durations.reserve(tracks);
+    m_formats.reserve(tracks);
+}
+
+void TrackTable::Build(const LibraryCatalog& catalog) {
+    Clear();
+    const std::uint32_t count = catalog.TrackCount();
+    size_t nameBytes = 0;
+    for (std::uint32_t id = 0; id < count; ++id) {
+        nameBytes += catalog.TrackName(id).size() + 1;
+    }
+    if (catalog.HasTags()) nameBytes *= 2; // 标签文本长度与文件名相当
+    Reserve(count, nameBytes + nameBytes / 8); // 折叠极少改变长度，预留少量余量
+    for (std::uint32_t id = 0; id < count; ++id) {
+        Append(catalog, id);
+    }
+}
+
+std::uint32_t TrackTable::Append(const LibraryCatalog& catalog, std::uint32_t id) {
+    // 优先使用扫描时按内容识别的格式，识别失败或旧版目录时按扩展名
+    std::string_view name = catalog.TrackName(id);
+    AudioFormat format = catalog.TrackFormat(id);
+    if (format == AUDIO_FORMAT_UNKNOWN) format = AudioFormatFromName(name);
+    const std::string_view tags[] = {catalog.TrackTag(id, TAG_TITLE), catalog.TrackTag(id, TAG_ARTIST),
+                                     catalog.TrackTag(id, TAG_ALBUM)};
+    return Append(name, catalog.TrackSize(id), catalog.TrackDurationMs(id), format, tags, catalog.HasTags() ? 3 : 0);
+}
+
+std::uint32_t TrackTable::Append(const CatalogEntry& entry) {
+    const std::string_view name = EntryName(entry);
+    const std::string_view tags[] = {entry.tags.text[TAG_TITLE], entry.tags.text[TAG_ARTIST],
+                                     entry.tags.text[TAG_ALBUM]};
+    return Append(name, entry.size, entry.durationMs, EntryFormat(entry, name), tags, 3);
+}
+
+void TrackTable::Replace(const std::vector<TrackRowUpdate>& rows, std::vector<std::uint32_t>& keyChanged) {
+    // 1. 新检索键写在已有的键之后，与旧键相同的立即丢弃
+    struct StagedKey {
+        std::uint32_t id;
+        size_t begin;
+        size_t end;
+    };
+    std::vector<StagedKey> staged;
+    const std::uint32_t count = Size();
+    for (const TrackRowUpdate& row : rows) {
+        const CatalogEntry& entry = *row.entry;
+        const std::string_view name = EntryName(entry);
+        const std::string_view tags[] = {entry.tags.text[TAG_TITLE], entry.tags.text[TAG_ARTIST],
+                                         entry.tags.text[TAG_ALBUM]};
+        m_sizes[row.id] = entry.size;
+        m_durations[row.id] = entry.durationMs;
+        m_formats[row.id] = EntryFormat(entry, name);
+        const size_t begin = m_keys.size();
+        const unsigned fields = AppendKey(name, tags, 3);
+        const std::string_view key = std::string_view(m_keys).substr(begin);
+        if (key == SearchKey(row.id)) {
+            m_keys.resize(begin);
+            continue;
+        }
+        m_keyFields[row.id] = static_cast<std::uint8_t>(fields);
+        m_keyMasks[row.id] = ByteMask(key);
+        staged.push_back(StagedKey{row.id, begin, m_keys.size()});
+        keyChanged.push_back(row.id);
+    }
+    if (staged.empty()) return;
+
+    // 2. 暂存的新键移出缓冲区，各段未修改的行在原缓冲区中整段平移（不重新分配整块缓冲区），再写入新键
+    std::sort(staged.begin(), staged.end(), [](const StagedKey& a, const StagedKey& b) { return a.id < b.id; });
+    std::string newKeys;
+    for (StagedKey& key : staged) {
+        const size_t begin = newKeys.size();
+        newKeys.append(m_keys, key.begin, key.end - key.begin);
+        newKeys.push_back('\0');
+        key.begin = begin;
+        key.end = newKeys.size();
+    }
+    const size_t oldEnd = m_keyOffsets[count];
+    m_keys.resize(oldEnd);
+
+    // 逐段改写偏移并记下各段的平移：from为原位置，to为新位置
+    struct Run {
+        size_t from;
+        size_t to;
+        size_t size;
+    };
+    std::vector<Run> runs;
+    std::int64_t shift = 0;
+    std::uint32_t next = 0;     // 当前段的第一首
+    size_t runBegin = 0;        // 当前段的原起始位置
+    auto shiftRun = [&](std::uint32_t endId) {
+        const size_t runEnd = m_keyOffsets[endId];
+        runs.push_back(Run{runBegin, static_cast<size_t>(runBegin + shift), runEnd - runBegin});
+        for (std::uint32_t id = next; id <= endId; ++id) {
+            m_keyOffsets[id] = static_cast<std::uint32_t>(m_keyOffsets[id] + shift);
+        }
+    };
+    for (const StagedKey& key : staged) {
+        const size_t oldRowEnd = m_keyOffsets[key.id + 1];
+        const size_t oldLength = oldRowEnd - m_keyOffsets[key.id];
+        shiftRun(key.id);
+        shift += static_cast<std::int64_t>(key.end - key.begin) - static_cast<std::int64_t>(oldLength);
+        next = key.id + 1;
+        runBegin = oldRowEnd;
+    }
+    shiftRun(count);
+
+    // 左移的段从前往后挪、右移的段从后往前挪，不会覆盖尚未挪动的段
+    const size_t newEnd = static_cast<size_t>(oldEnd + shift);
+    if (newEnd > oldEnd) m_keys.resize(newEnd);
+    char* keys = &m_keys[0];
+    for (const Run& run : runs) {
+        if (run.to < run.from) std::memmove(keys + run.to, keys + run.from, run.size);
+    }
+    for (auto it = runs.rbegin(); it != runs.rend(); ++it) {
+        if (it->to > it->from) std::memmove(keys + it->to, keys + it->from, it->size);
+    }
+    for (const StagedKey& key : staged) {
+        std::memcpy(keys + m_keyOffsets[key.id], newKeys.data() + key.begin, key.end - key.begin);
+    }
+    m_keys.resize(newEnd);
+}
+
+std::uint32_t TrackTable::Append(std::string_view nameUtf8, std::uint64_t size, std::uint32_t durationMs,
+                                 AudioFormat format, const std::string_view* tagTexts, size_t tagCount) {
+    const std::uint32_t id = Size();
+    const size_t keyBegin = m_keys.size();
+    m_keyFields.push_back(static_cast<std::uint8_t>(AppendKey(nameUtf8, tagTexts, tagCount)));
+    m_keyMasks.push_back(ByteMask(std::string_view(m_keys).substr(keyBegin)));
+    m_keys.push_back('\0');
+    m_keyOffsets.push_back(static_cast<std::uint32_t>(m_keys.size()));
+    m_sizes.push_back(size);
+    m_durations.push_back(durationMs);
+    m_formats.push_back(format);
+    return id;
+}
+
+unsigned TrackTable::AppendKey(std::string_view nameUtf8, const std::string_view* tagTexts, size_t tagCount) {
+    const size_t keyBegin = m_keys.size();
+    AppendFoldedUtf8(nameUtf8, m_keys);
+    unsigned fields = 1u << KEY_FIELD_NAME;
+    for (size_t i = 0; i < tagCount && i + 1 < KEY_FIELD_COUNT; ++i) {
+        if (tagTexts[i].empty()) continue;
+        m_keys.push_back(kKeyFieldSeparator);
+        AppendFoldedUtf8(tagTexts[i], m_keys);
+        fields |= 1u << (i + 1);
+    }
+    return fields | (AppendPinyinFields(keyBegin, fields) << 4);
+}
+
+unsigned TrackTable::AppendPinyinFields(size_t keyBegin, unsigned fields) {
+    // 先把各字段的拼音写入暂存缓冲区，全部生成后再追加（追加会使指向m_keys的视图失效）
+    m_pinyinScratch.clear();
+    unsigned pinyinFields = 0;
+    unsigned field = KEY_FIELD_NAME;
+    const size_t keyEnd = m_keys.size();
+    for (size_t begin = keyBegin; begin <= keyEnd; ++field) {
+        while (field < KEY_FIELD_COUNT && !(fields & (1u << field))) ++field; // 跳过缺少的标签字段
+        if (field == KEY_FIELD_COUNT) break; // 标签文本本身含分隔符（非法数据）
+        size_t end = m_keys.find(kKeyFieldSeparator, begin);
+        if (end == std::string::npos || end > keyEnd) end = keyEnd;
+        const std::string_view text = std::string_view(m_keys).substr(begin, end - begin);
+        if (ContainsHan(text)) {
+            pinyinFields |= 1u << field;
+            m_pinyinInitials.clear();
+            m_pinyinScratch.push_back(kKeyFieldSeparator);
+            AppendPinyinKeys(text, m_pinyinScratch, m_pinyinInitials);
+            m_pinyinScratch.push_back(kKeyFieldSeparator);
+            m_pinyinScratch.append(m_pinyinInitials);
+        }
+        begin = end + 1;
+    }
+    m_keys.append(m_pinyinScratch);
+    return pinyinFields;
+}
+
+bool TrackTable::KeyContains(std::uint32_t id, std::string_view foldedQuery) const {
+    if (foldedQuery.empty()) return true;
+    std::string_view key = SearchKey(id);
+    return FindSubstring(key.data(), key.size(), foldedQuery) != nullptr;
+}
+
+void TrackTable::FilterContaining(std::string_view foldedQuery, const std::uint32_t* ids, size_t count,
+                                  std::vector<std::uint32_t>& out, size_t maxHits) const {
+    constexpr size_t kAhead = 16; // 预取距离：先取偏移，再按偏移取检索键
+    const char* base = m_keys.data();
+    const size_t paddedEnd = m_keys.size() >= kFindPadding ? m_keys.size() - kFindPadding : 0;
+    size_t added = 0;
+    for (size_t i = 0; i < count && added < maxHits; ++i) {
+        if (i + 2 * kAhead < count) PrefetchRead(&m_keyOffsets[ids[i + 2 * kAhead]]);
+        if (i + kAhead < count) PrefetchRead(base + m_keyOffsets[ids[i + kAhead]]);
+        const std::uint32_t id = ids[i];
+        const size_t begin = m_keyOffsets[id];
+        const size_t end = m_keyOffsets[id + 1] - 1;
+        const char* hit = end <= paddedEnd ? FindSubstringPadded(base + begin, end - begin, foldedQuery)
+                                           : FindSubstring(base + begin, end - begin, foldedQuery);
+        if (hit != nullptr) {
+            out.push_back(id);
+            ++added;
+        }
+    }
+}
+
+bool TrackTable::FieldContains(std::uint32_t id, KeyField field, std::string_view foldedQuery) const {
+    const unsigned fields = m_keyFields[id];
+    const unsigned bit = 1u << field;
+    if (!(fields & bit)) return false;
+    if (foldedQuery.empty()) return true;
+
+    // 字段依次为：存在的字段，再是各带拼音字段的全拼与首字母；按序号定位字段
+    auto contains = [&](unsigned index) {
+        std::string_view key = SearchKey(id);
+        for (; index > 0; --index) key.remove_prefix(key.find(kKeyFieldSeparator) + 1);
+        key = key.substr(0, key.find(kKeyFieldSeparator));
+        return FindSubstring(key.data(), key.size(), foldedQuery) != nullptr;
+    };
+    if (contains(PopCount4(fields & 0xF & (bit - 1)))) return true;
+    if (!(fields & (bit << 4))) return false;
+    const unsigned pinyin = PopCount4(fields & 0xF) + 2 * PopCount4((fields >> 4) & (bit - 1));
+    return contains(pinyin) || contains(pinyin + 1);
+}
+
+void TrackTable::Search(std::string_view foldedQuery, std::vector<std::uint32_t>& out, std::uint32_t firstId,
+                        std::uint32_t endId) const {
+    if (foldedQuery.empty()) {
+        for (std::uint32_t id = firstId; id < endId; ++id) out.push_back(id);
+        return;
+    }
+    const char* base = m_keys.data();
+    const size_t total = m_keyOffsets[endId];
+    size_t pos = m_keyOffsets[firstId];
+    std::uint32_t id = firstId;
+    while (pos < total) {
+        const char* hit = FindSubstring(base + pos, total - pos, foldedQuery);
+        if (hit == nullptr) break;
+        // 命中位置所在的曲目：在当前id之后的偏移中二分查找（id单调递增）
+        const std::uint32_t at = static_cast<std::uint32_t>(hit - base);
+        auto next = std::upper_bound(m_keyOffsets.begin() + id + 1, m_keyOffsets.begin() + endId + 1, at);
+        id = static_cast<std::uint32_t>(next - m_keyOffsets.begin()) - 1;
+        out.push_back(id);
+        // 同一曲目只记录一次，从下一首的键开始继续查找
+        pos = m_keyOffsets[++id];
+    }
+}
+
+std::uint64_t TrackTable::ByteMask(std::string_view text) {
+    std::uint64_t mask = 0;
+    for (char c : text) mask |= std::uint64_t(1) << kByteMaskTable.bit[static_cast<unsigned char>(c)];
+    return mask;
+}
+
+size_t TrackTable::MemoryBytes() const {
+    return m_keys.capacity() + m_keyOffsets.capacity() * sizeof(std::uint32_t) +
+           m_keyMasks.capacity() * sizeof(std::uint64_t) + m_keyFields.capacity() +
+           m_sizes.capacity() * sizeof(std::uint64_t) + m_durations.capacity() * sizeof(std::uint32_t) +
+           m_formats.capacity() + m_pinyinScratch.capacity() + m_pinyinInitials.capacity();
+}
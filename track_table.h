@@ -0,0 +1,110 @@
+// 列式曲目表（structure-of-arrays）：按曲目id分列保存检索所需的数据
+// - 折叠后的检索键（text_fold）首尾相接存放在一块缓冲区中，每个键后跟一个'\0'，匹配不会跨越曲目
+//   检索键为文件名，有标签时后接标题/歌手/专辑（以kKeyFieldSeparator分隔，关键词中不会出现，匹配不会跨越字段）
+//   含汉字的字段另追加拼音全拼与首字母两个字段（pinyin.h），输入zhoujielun或zjl即可匹配“周杰伦”
+//   每首另记一个字节的字段布局（有哪些标签字段、哪些字段带拼音），按字段查询时据此定位
+// - 每个键另有一个64位字节掩码（出现过的字节类别），模糊匹配先按掩码排除不可能匹配的曲目
+// - 时长/格式/大小各占一列，供后续的过滤与排序直接按列遍历
+// 曲目id与TrackPathPool一致（由曲库目录构建时也与目录中的id一致）；曲库更新时新曲目追加在末尾，
+// 被修改的曲目原位替换（id不变），已有曲目的行不移动
+#pragma once
+
+#include "library_catalog.h"
+#include "media_probe.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// 曲库增量中被修改的一首曲目：表中的曲目id与新的目录条目
+struct TrackRowUpdate {
+    std::uint32_t id;
+    const CatalogEntry* entry;
+};
+
+// 检索键中的字段（文件名之后的标签字段与tagTexts的顺序一致）
+enum KeyField : std::uint8_t {
+    KEY_FIELD_NAME = 0,
+    KEY_FIELD_TITLE,
+    KEY_FIELD_ARTIST,
+    KEY_FIELD_ALBUM,
+    KEY_FIELD_COUNT
+};
+
+class TrackTable {
+public:
+    static constexpr char kKeyFieldSeparator = '\x1f';
+
+    void Clear();
+    void Reserve(size_t tracks, size_t keyBytes);
+
+    // 按目录顺序重建（曲目id即目录中的id）
+    void Build(const LibraryCatalog& catalog);
+
+    // 追加目录中的第id首曲目 / 一条目录条目（曲库增量中新增或修改的曲目）；返回新曲目的id
+    std::uint32_t Append(const LibraryCatalog& catalog, std::uint32_t id);
+    std::uint32_t Append(const CatalogEntry& entry);
+
+    // 按新的目录条目原位替换已有曲目的行（曲目id互不相同），检索键变化的曲目id追加到keyChanged
+    // 新检索键先暂存在缓冲区末尾；有键变化时之后的行在缓冲区中原地平移，整块只挪动一遍（与修改的曲目数无关）
+    void Replace(const std::vector<TrackRowUpdate>& rows, std::vector<std::uint32_t>& keyChanged);
+
+    // 追加一首曲目，nameUtf8为原始文件名，tagTexts为可选的标签文本（标题/歌手/专辑，均在内部折叠）；返回新曲目的id
+    std::uint32_t Append(std::string_view nameUtf8, std::uint64_t size, std::uint32_t durationMs, AudioFormat format,
+                         const std::string_view* tagTexts = nullptr, size_t tagCount = 0);
+
+    std::uint32_t Size() const { return static_cast<std::uint32_t>(m_sizes.size()); }
+
+    std::string_view SearchKey(std::uint32_t id) const {
+        return std::string_view(m_keys.data() + m_keyOffsets[id], m_keyOffsets[id + 1] - m_keyOffsets[id] - 1);
+    }
+    std::uint64_t KeyMask(std::uint32_t id) const { return m_keyMasks[id]; }
+    std::uint64_t FileSize(std::uint32_t id) const { return m_sizes[id]; }
+    std::uint32_t DurationMs(std::uint32_t id) const { return m_durations[id]; }
+    AudioFormat Format(std::uint32_t id) const { return static_cast<AudioFormat>(m_formats[id]); }
+
+    // 按列直接访问（下标为曲目id），供批量过滤
+    const std::uint64_t* SizeColumn() const { return m_sizes.data(); }
+    const std::uint32_t* DurationColumn() const { return m_durations.data(); }
+    const std::uint8_t* FormatColumn() const { return m_formats.data(); }
+
+    // 检索键是否包含已折叠的关键词（空关键词视为匹配）
+    bool KeyContains(std::uint32_t id, std::string_view foldedQuery) const;
+    // 把ids（升序）中检索键包含foldedQuery的曲目追加到out：提前预取后面曲目的检索键，
+    // 键之后有足够字节时用可越界读取的子串内核整块比较（校验索引给出的大量候选）；追加maxHits首后停止
+    void FilterContaining(std::string_view foldedQuery, const std::uint32_t* ids, size_t count,
+                          std::vector<std::uint32_t>& out, size_t maxHits) const;
+    // 指定字段（含该字段的拼音）是否包含已折叠的关键词；曲目没有该字段时返回false
+    bool FieldContains(std::uint32_t id, KeyField field, std::string_view foldedQuery) const;
+
+    // 顺序扫描整个检索键缓冲区，把检索键包含foldedQuery的曲目id按升序追加到out
+    // 不分配内存（out预留足够容量时）；空关键词匹配全部曲目
+    void Search(std::string_view foldedQuery, std::vector<std::uint32_t>& out) const { Search(foldedQuery, out, 0, Size()); }
+    // 同上，只扫描id在[firstId, endId)内的曲目（用于分段扫描与只检查新追加的曲目）
+    void Search(std::string_view foldedQuery, std::vector<std::uint32_t>& out, std::uint32_t firstId,
+                std::uint32_t endId) const;
+
+    // 文本中出现过的字节类别：a-z、0-9各占一位，其余字节按值分入剩余的位
+    // 关键词的掩码不是检索键掩码的子集时，检索键不可能（按子序列）包含关键词
+    static std::uint64_t ByteMask(std::string_view text);
+
+    // 表占用的内存（字节），用于统计
+    size_t MemoryBytes() const;
+
+private:
+    // 在缓冲区末尾写入折叠后的检索键（不含'\0'），返回字段布局（m_keyFields的一项）
+    unsigned AppendKey(std::string_view nameUtf8, const std::string_view* tagTexts, size_t tagCount);
+    // 为keyBegin开始的检索键中含汉字的字段追加拼音字段；fields为存在的字段，返回带拼音的字段
+    unsigned AppendPinyinFields(size_t keyBegin, unsigned fields);
+
+    std::string m_keys;                     // 折叠后的检索键，每个后跟'\0'
+    std::vector<std::uint32_t> m_keyOffsets{0}; // 第id个键从m_keyOffsets[id]开始，共Size()+1项
+    std::vector<std::uint64_t> m_keyMasks;
+    std::vector<std::uint8_t> m_keyFields;  // 低4位：存在的字段（KeyField位）；高4位：带拼音字段的字段
+    std::vector<std::uint64_t> m_sizes;
+    std::vector<std::uint32_t> m_durations;
+    std::vector<std::uint8_t> m_formats;    // AudioFormat
+    std::string m_pinyinScratch;            // 追加拼音字段时复用的缓冲区
+    std::string m_pinyinInitials;
+};
@@ -0,0 +1,340 @@
+#include "trigram_index.h"
+
+#include <algorithm>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace {
+
+constexpr std::uint32_t kBucketBits = 21;   // 2M个桶：1M曲目下绝大多数桶只对应一个三元组
+constexpr std::uint32_t kBucketCount = 1u << kBucketBits;
+constexpr std::uint64_t kMinDeltaMerge = 1u << 16; // 增量段超过该值且新增曲目超过主体的一半时并入主体（重建总开销为线性）
+constexpr std::uint32_t kDenseRatio = 32;   // 桶中曲目超过主体曲目数的1/32时改存位集（位集更小）
+constexpr size_t kVerifyDirectly = 32;      // 候选不超过该数时不再求交集，直接校验
+constexpr std::uint32_t kScanChunk = 1u << 14; // 有命中上限的顺序扫描按段进行，够数即停
+constexpr size_t kMaxReposted = 1u << 14;   // 原位修改的曲目超过该数时整体重建（每次查询都要合并它们的候选）
+constexpr std::uint32_t kNoDense = 0xFFFFFFFFu;
+
+unsigned CountTrailingZeros64(std::uint64_t word) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctzll(word));
+#endif
+}
+
+std::uint32_t TrigramBucket(unsigned char a, unsigned char b, unsigned char c) {
+    const std::uint32_t key = (std::uint32_t(a) << 16) | (std::uint32_t(b) << 8) | c;
+    return (key * 0x9E3779B1u) >> (32 - kBucketBits);
+}
+
+// 检索键中各三元组所在的桶（去重后升序），跨越字段分隔符的三元组跳过
+void CollectBuckets(std::string_view key, std::vector<std::uint32_t>& buckets) {
+    buckets.clear();
+    for (size_t i = 0; i + 3 <= key.size(); ++i) {
+        const unsigned char a = static_cast<unsigned char>(key[i]);
+        const unsigned char b = static_cast<unsigned char>(key[i + 1]);
+        const unsigned char c = static_cast<unsigned char>(key[i + 2]);
+        if (a == TrackTable::kKeyFieldSeparator || b == TrackTable::kKeyFieldSeparator ||
+            c == TrackTable::kKeyFieldSeparator) {
+            continue;
+        }
+        buckets.push_back(TrigramBucket(a, b, c));
+    }
+    std::sort(buckets.begin(), buckets.end());
+    buckets.erase(std::unique(buckets.begin(), buckets.end()), buckets.end());
+}
+
+// 在升序数组[first, last)中从first开始倍增步长定位第一个不小于value的位置（候选远少于倒排表时更快）
+const std::uint32_t* GallopLowerBound(const std::uint32_t* first, const std::uint32_t* last, std::uint32_t value) {
+    size_t step = 1;
+    const std::uint32_t* lo = first;
+    while (lo + step < last && lo[step] < value) {
+        lo += step;
+        step <<= 1;
+    }
+    const std::uint32_t* hi = std::min(lo + step + 1, last);
+    return std::lower_bound(lo, hi, value);
+}
+
+// candidates与升序数组[arr, arr+n)求交集，结果写回candidates
+void IntersectWith(std::vector<std::uint32_t>& candidates, const std::uint32_t* arr, size_t n) {
+    const std::uint32_t* p = arr;
+    const std::uint32_t* end = arr + n;
+    size_t kept = 0;
+    for (std::uint32_t id : candidates) {
+        p = GallopLowerBound(p, end, id);
+        if (p == end) break;
+        if (*p == id) candidates[kept++] = id;
+    }
+    candidates.resize(kept);
+}
+
+} // namespace
+
+void TrigramIndex::Clear() {
+    m_offsets.clear();
+    m_postings.clear();
+    m_dense.clear();
+    m_bitsets.clear();
+    m_bitsetWords = 0;
+    m_delta.clear();
+    m_deltaPostings = 0;
+    m_baseTracks = 0;
+    m_indexed = 0;
+    m_reposted.clear();
+    m_repost.clear();
+    m_repostPostings = 0;
+}
+
+void TrigramIndex::Build(const TrackTable& table) {
+    Clear();
+    const std::uint32_t count = table.Size();
+
+    // 两遍计数排序：第一遍统计各桶长度，第二遍按id升序填入，各桶内天然有序
+    // 同一曲目内重复的桶用stamp去重（stamp[b]记录最后写入桶b的曲目id+1），省去逐曲目排序
+    std::vector<std::uint32_t> stamp(kBucketCount, 0);
+    auto forEachBucket = [&](auto&& fn) {
+        for (std::uint32_t id = 0; id < count; ++id) {
+            const std::string_view key = table.SearchKey(id);
+            for (size_t i = 0; i + 3 <= key.size(); ++i) {
+                const unsigned char a = static_cast<unsigned char>(key[i]);
+                const unsigned char b = static_cast<unsigned char>(key[i + 1]);
+                const unsigned char c = static_cast<unsigned char>(key[i + 2]);
+                if (a == TrackTable::kKeyFieldSeparator || b == TrackTable::kKeyFieldSeparator ||
+                    c == TrackTable::kKeyFieldSeparator) {
+                    continue;
+                }
+                const std::uint32_t bucket = TrigramBucket(a, b, c);
+                if (stamp[bucket] == id + 1) continue;
+                stamp[bucket] = id + 1;
+                fn(bucket, id);
+            }
+        }
+    };
+
+    m_offsets.assign(kBucketCount + 1, 0);
+    forEachBucket([&](std::uint32_t bucket, std::uint32_t) { ++m_offsets[bucket + 1]; });
+
+    // 稠密桶改存位集，不占用id数组
+    m_bitsetWords = (count + 63) / 64;
+    std::vector<std::uint32_t> denseIndex(kBucketCount, kNoDense);
+    for (std::uint32_t b = 0; b < kBucketCount; ++b) {
+        const std::uint32_t n = m_offsets[b + 1];
+        if (n == 0 || std::uint64_t(n) * kDenseRatio <= count) continue;
+        denseIndex[b] = static_cast<std::uint32_t>(m_dense.size());
+        m_dense.emplace(b, DenseBucket{denseIndex[b], n});
+        m_offsets[b + 1] = 0;
+    }
+    m_bitsets.assign(m_dense.size() * m_bitsetWords, 0);
+
+    for (std::uint32_t b = 0; b < kBucketCount; ++b) m_offsets[b + 1] += m_offsets[b];
+    m_postings.resize(m_offsets[kBucketCount]);
+    std::fill(stamp.begin(), stamp.end(), 0);
+    forEachBucket([&](std::uint32_t bucket, std::uint32_t id) {
+        if (denseIndex[bucket] != kNoDense) {
+            m_bitsets[size_t(denseIndex[bucket]) * m_bitsetWords + (id >> 6)] |= std::uint64_t(1) << (id & 63);
+        } else {
+            m_postings[m_offsets[bucket]++] = id;
+        }
+    });
+    // 填充时m_offsets[b]前移到了桶b的末尾（即桶b+1的起点），整体后移一位恢复
+    for (std::uint32_t b = kBucketCount; b > 0; --b) m_offsets[b] = m_offsets[b - 1];
+    m_offsets[0] = 0;
+
+    m_baseTracks = count;
+    m_indexed = count;
+}
+
+void TrigramIndex::Update(const TrackTable& table) {
+    const std::uint32_t count = table.Size();
+    if (count < m_indexed) { // 表被重建（不应发生），保守地全部重建
+        Build(table);
+        return;
+    }
+    std::vector<std::uint32_t> buckets;
+    for (std::uint32_t id = m_indexed; id < count; ++id) {
+        CollectBuckets(table.SearchKey(id), buckets);
+        for (std::uint32_t b : buckets) m_delta[b].push_back(id);
+        m_deltaPostings += buckets.size();
+    }
+    m_indexed = count;
+    if (m_deltaPostings > kMinDeltaMerge && std::uint64_t(count - m_baseTracks) * 2 > m_baseTracks) {
+        Build(table);
+    }
+}
+
+void TrigramIndex::Repost(const TrackTable& table, const std::vector<std::uint32_t>& ids) {
+    // 再次修改的曲目找不到旧的项，小索引整体重建；其余只加入新修改的曲目
+    std::vector<std::uint32_t> added;
+    bool rebuild = false;
+    for (std::uint32_t id : ids) {
+        if (id >= m_indexed) continue;
+        if (std::binary_search(m_reposted.begin(), m_reposted.end(), id)) rebuild = true;
+        else added.push_back(id);
+    }
+    std::sort(added.begin(), added.end());
+    added.erase(std::unique(added.begin(), added.end()), added.end());
+    if (added.empty() && !rebuild) return;
+    const size_t mid = m_reposted.size();
+    m_reposted.insert(m_reposted.end(), added.begin(), added.end());
+    std::inplace_merge(m_reposted.begin(), m_reposted.begin() + mid, m_reposted.end());
+    if (m_reposted.size() > kMaxReposted) {
+        Build(table);
+        return;
+    }
+
+    std::vector<std::uint32_t> buckets;
+    if (rebuild) {
+        // 按id升序加入，各桶内天然有序
+        m_repost.clear();
+        m_repostPostings = 0;
+        added = m_reposted;
+    }
+    for (std::uint32_t id : added) {
+        CollectBuckets(table.SearchKey(id), buckets);
+        for (std::uint32_t b : buckets) {
+            std::vector<std::uint32_t>& list = m_repost[b];
+            list.insert(std::upper_bound(list.begin(), list.end(), id), id);
+        }
+        m_repostPostings += buckets.size();
+    }
+}
+
+TrigramIndex::Posting TrigramIndex::Lookup(std::uint32_t bucket) const {
+    Posting posting;
+    if (!m_offsets.empty()) {
+        posting.base = m_postings.data() + m_offsets[bucket];
+        posting.baseCount = m_offsets[bucket + 1] - m_offsets[bucket];
+    }
+    if (!m_dense.empty()) {
+        auto it = m_dense.find(bucket);
+        if (it != m_dense.end()) {
+            posting.base = nullptr;
+            posting.bits = m_bitsets.data() + size_t(it->second.index) * m_bitsetWords;
+            posting.baseCount = it->second.count;
+        }
+    }
+    if (!m_delta.empty()) {
+        auto it = m_delta.find(bucket);
+        if (it != m_delta.end()) posting.delta = &it->second;
+    }
+    return posting;
+}
+
+void TrigramIndex::Search(const TrackTable& table, std::string_view foldedQuery,
+                          std::vector<std::uint32_t>& out, size_t maxHits) const {
+    if (foldedQuery.size() < 3 || m_indexed < table.Size()) {
+        const size_t first = out.size();
+        const std::uint32_t count = table.Size();
+        for (std::uint32_t id = 0; id < count && out.size() - first < maxHits; id += std::min(kScanChunk, count - id)) {
+            table.Search(foldedQuery, out, id, id + std::min(kScanChunk, count - id));
+        }
+        if (out.size() - first > maxHits) out.resize(first + maxHits);
+        return;
+    }
+
+    // 1. 求各三元组倒排表的交集，再并入原位修改过的曲目中按新检索键命中的
+    CollectBuckets(foldedQuery, m_queryBuckets);
+    CollectCandidates();
+    if (!m_reposted.empty()) MergeReposted();
+
+    // 2. 校验候选：三元组同时出现不代表连续出现，散列冲突与过时的倒排项也会带来多余候选
+    table.FilterContaining(foldedQuery, m_candidates.data(), m_candidates.size(), out, maxHits);
+}
+
+void TrigramIndex::CollectCandidates() const {
+    // 从最短的倒排表开始求交集
+    m_candidates.clear();
+    m_queryPostings.clear();
+    for (std::uint32_t b : m_queryBuckets) {
+        const Posting posting = Lookup(b);
+        if (posting.Size() == 0) return; // 某个三元组不存在，不可能命中
+        m_queryPostings.push_back(posting);
+    }
+    std::sort(m_queryPostings.begin(), m_queryPostings.end(),
+              [](const Posting& a, const Posting& b) { return a.Size() < b.Size(); });
+
+    const Posting& first = m_queryPostings[0];
+    if (first.bits != nullptr) {
+        // 最短的倒排表也是位集：先把所有位集逐字相与，再取出主体中的候选
+        m_words.assign(first.bits, first.bits + m_bitsetWords);
+        for (size_t i = 1; i < m_queryPostings.size(); ++i) {
+            const std::uint64_t* bits = m_queryPostings[i].bits;
+            if (bits == nullptr) continue;
+            for (std::uint32_t w = 0; w < m_bitsetWords; ++w) m_words[w] &= bits[w];
+        }
+        for (std::uint32_t w = 0; w < m_bitsetWords; ++w) {
+            for (std::uint64_t word = m_words[w]; word != 0; word &= word - 1) {
+                m_candidates.push_back((w << 6) | CountTrailingZeros64(word));
+            }
+        }
+    } else {
+        m_candidates.assign(first.base, first.base + first.baseCount);
+    }
+    if (first.delta != nullptr) m_candidates.insert(m_candidates.end(), first.delta->begin(), first.delta->end());
+
+    // 候选很少时校验比继续求交集更快；某个倒排表几乎没有缩小候选时，之后更长的倒排表也很难再缩小
+    for (size_t i = 1; i < m_queryPostings.size() && m_candidates.size() > kVerifyDirectly; ++i) {
+        const Posting& posting = m_queryPostings[i];
+        if (first.bits != nullptr && posting.bits != nullptr && posting.delta == nullptr) continue; // 已相与
+        const size_t before = m_candidates.size();
+        Intersect(posting);
+        if (m_candidates.size() * 8 > before * 7) break;
+    }
+}
+
+void TrigramIndex::MergeReposted() const {
+    m_scratch.clear();
+    for (size_t i = 0; i < m_queryBuckets.size(); ++i) {
+        auto it = m_repost.find(m_queryBuckets[i]);
+        if (it == m_repost.end()) return;
+        if (i == 0) m_scratch = it->second;
+        else IntersectWith(m_scratch, it->second.data(), it->second.size());
+        if (m_scratch.empty()) return;
+    }
+    // 同一曲目可能也在主体/增量段的候选中（过时的倒排项恰好仍含这些三元组）
+    const size_t mid = m_candidates.size();
+    m_candidates.insert(m_candidates.end(), m_scratch.begin(), m_scratch.end());
+    std::inplace_merge(m_candidates.begin(), m_candidates.begin() + mid, m_candidates.end());
+    m_candidates.erase(std::unique(m_candidates.begin(), m_candidates.end()), m_candidates.end());
+}
+
+void TrigramIndex::Intersect(const Posting& posting) const {
+    // 主体中的id都小于m_baseTracks，增量段中的都不小于，两段分别求交
+    auto split = std::lower_bound(m_candidates.begin(), m_candidates.end(), m_baseTracks);
+    m_scratch.assign(split, m_candidates.end());
+    m_candidates.erase(split, m_candidates.end());
+    if (posting.bits != nullptr) {
+        size_t kept = 0;
+        for (std::uint32_t id : m_candidates) {
+            if ((posting.bits[id >> 6] >> (id & 63)) & 1) m_candidates[kept++] = id;
+        }
+        m_candidates.resize(kept);
+    } else {
+        IntersectWith(m_candidates, posting.base, posting.baseCount);
+    }
+    if (posting.delta != nullptr) {
+        IntersectWith(m_scratch, posting.delta->data(), posting.delta->size());
+        m_candidates.insert(m_candidates.end(), m_scratch.begin(), m_scratch.end());
+    }
+}
+
+TrigramIndexStats TrigramIndex::Stats() const {
+    TrigramIndexStats stats;
+    stats.indexedTracks = m_indexed;
+    stats.deltaPostings = m_deltaPostings;
+    stats.postings = m_postings.size() + m_deltaPostings + m_repostPostings;
+    for (const auto& kv : m_dense) stats.postings += kv.second.count;
+    stats.memoryBytes = m_offsets.capacity() * sizeof(std::uint32_t) + m_postings.capacity() * sizeof(std::uint32_t) +
+                        m_bitsets.capacity() * sizeof(std::uint64_t) +
+                        m_dense.size() * (sizeof(std::uint32_t) + sizeof(DenseBucket) + sizeof(void*));
+    for (const auto& kv : m_delta) stats.memoryBytes += kv.second.capacity() * sizeof(std::uint32_t);
+    for (const auto& kv : m_repost) stats.memoryBytes += kv.second.capacity() * sizeof(std::uint32_t);
+    stats.memoryBytes += m_reposted.capacity() * sizeof(std::uint32_t);
+    return stats;
+}
@@ -0,0 +1,99 @@
+// 三元组倒排索引：对TrackTable中折叠后的检索键按字节三元组建立倒排表，查询时求各三元组倒排表的交集，
+// 只对交集中的候选曲目做子串校验
+// - 三元组散列到固定数量的桶中（冲突只会多出候选，校验后结果不变）；跨越字段分隔符/结束符的三元组不入索引
+// - 主体为压缩行（CSR）布局：桶偏移数组 + 连续的曲目id数组，各桶内id升序
+//   超过主体曲目数1/32的稠密桶改存位集（比id数组更小），求交集时按位测试，不必二分查找
+// - 查询从最短的倒排表开始求交集；候选已经很少、或再求交集几乎不能缩小候选时停止，直接校验子串
+// - 追加到曲目表末尾的新曲目（扫描批次）进入增量段，不重建主体；增量段过大时并入主体
+// - 原位修改的曲目（TrackTable::Replace，id不变）旧的倒排项保留为过时项（只多出候选，校验后去掉），
+//   按新检索键另建一份小索引，查询时两边的候选合并；这类曲目过多时整体重建
+// - 少于3字节的关键词无法使用索引，退回TrackTable::Search顺序扫描
+// - 可限制命中数：常见词/短关键词在百万首曲目中有十万首以上命中，逐个校验受内存延迟限制（约70ns/首），
+//   界面只取id最小的kDenseHitLimit首参与排列与显示，查询时间不随命中数增长
+// 查询使用内部的临时缓冲区，同一时刻只能有一个线程调用Search
+#pragma once
+
+#include "track_table.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// 界面搜索（SearchWorker/SearchTracks）的命中上限
+constexpr size_t kDenseHitLimit = 10000;
+
+struct TrigramIndexStats {
+    std::uint32_t indexedTracks = 0;
+    std::uint64_t postings = 0;         // 主体 + 增量段中的曲目id总数
+    std::uint64_t deltaPostings = 0;
+    size_t memoryBytes = 0;
+};
+
+class TrigramIndex {
+public:
+    // 为table中的全部曲目重建索引（曲目id重新编号后调用，例如替换曲库目录）
+    void Build(const TrackTable& table);
+
+    // 索引table中尚未索引的曲目（id从上次索引到的位置到table.Size()），用于扫描期间逐批追加
+    void Update(const TrackTable& table);
+
+    // 按当前检索键重新索引ids中的曲目（其行已被TrackTable::Replace原位替换），尚未索引的曲目由Update处理
+    void Repost(const TrackTable& table, const std::vector<std::uint32_t>& ids);
+
+    void Clear();
+
+    // 把检索键包含foldedQuery的曲目id按升序追加到out；table须为建立索引时的同一张表
+    // 命中超过maxHits首时只追加id最小的maxHits首（调用方可据追加数等于maxHits判断结果可能不全）
+    void Search(const TrackTable& table, std::string_view foldedQuery, std::vector<std::uint32_t>& out,
+                size_t maxHits = std::numeric_limits<size_t>::max()) const;
+
+    std::uint32_t IndexedTracks() const { return m_indexed; }
+    TrigramIndexStats Stats() const;
+
+private:
+    // 一个桶的倒排表：主体中的连续区间 + 增量段（均为升序）
+    struct Posting {
+        const std::uint32_t* base = nullptr;
+        size_t baseCount = 0;
+        const std::uint64_t* bits = nullptr;    // 稠密桶：主体中的曲目为位集（此时base为空），共baseCount个
+        const std::vector<std::uint32_t>* delta = nullptr;
+        size_t Size() const { return baseCount + (delta != nullptr ? delta->size() : 0); }
+    };
+
+    // 稠密桶的位集：m_bitsets[index * m_bitsetWords, (index + 1) * m_bitsetWords)
+    struct DenseBucket {
+        std::uint32_t index;
+        std::uint32_t count;
+    };
+
+    Posting Lookup(std::uint32_t bucket) const;
+    // 候选（升序）与一个桶的倒排表求交集，结果写回m_candidates
+    void Intersect(const Posting& posting) const;
+    // 主体与增量段中含m_queryBuckets全部桶的候选（升序）写入m_candidates
+    void CollectCandidates() const;
+    // 按新检索键含全部桶的原位修改曲目并入m_candidates
+    void MergeReposted() const;
+
+    std::vector<std::uint32_t> m_offsets;   // 桶b的主体倒排表为m_postings[m_offsets[b], m_offsets[b+1])
+    std::vector<std::uint32_t> m_postings;
+    std::unordered_map<std::uint32_t, DenseBucket> m_dense;
+    std::vector<std::uint64_t> m_bitsets;
+    std::uint32_t m_bitsetWords = 0;
+    std::unordered_map<std::uint32_t, std::vector<std::uint32_t>> m_delta;
+    std::uint64_t m_deltaPostings = 0;
+    std::uint32_t m_baseTracks = 0;         // 主体覆盖的曲目数（id小于它的曲目都在主体中）
+    std::uint32_t m_indexed = 0;            // 已索引的曲目数
+    std::vector<std::uint32_t> m_reposted;  // 原位修改过的曲目（升序），主体/增量段中它们的倒排项可能已过时
+    std::unordered_map<std::uint32_t, std::vector<std::uint32_t>> m_repost; // 桶 -> 按新检索键含该桶的m_reposted曲目
+    std::uint64_t m_repostPostings = 0;
+
+    // 查询用临时缓冲区（复用容量，不重复分配）
+    mutable std::vector<std::uint32_t> m_queryBuckets;
+    mutable std::vector<Posting> m_queryPostings;
+    mutable std::vector<std::uint32_t> m_candidates;
+    mutable std::vector<std::uint32_t> m_scratch;
+    mutable std::vector<std::uint64_t> m_words;
+};